@@ -16,6 +16,7 @@
 
 #include "rs485.hpp"
 #include "thread.hpp"
+#include "modbus_codec.hpp"
 
 /// @brief 名称空间 库名
 namespace OwO
@@ -10,6 +10,9 @@
  */
 #include "ir.hpp"
 #include "thread.hpp"
+#include "atomic.hpp"
+#include "port_system.h"
+#include "delay.hpp"
 #include <cstring>
 
 using namespace OwO;
@@ -19,598 +22,557 @@ using namespace kernel;
 
 O_METAOBJECT(IR, Object)
 
+/// @brief IR 已编码时序缓存 (各通道共享, 固定内存块池)
+IR_Cache IR::s_cache;
+
 /**
- * @brief (私有函数) IR 输出接口
+ * @brief (私有函数) IR 软件载波输出一个门控步骤 (按CPU周期计数的绝对时刻翻转引脚, 循环开销不累计; 记录每个边沿的实际时刻; 只有载波标记忙等待)
  *
- * @param high_time 高电平周期
- * @param low_time  低电平周期
+ * @param step    门控步骤
+ * @param edge    当前载波周期开始时刻(CPU周期计数, 输出为步骤结束时刻)
+ * @param period  载波周期(CPU周期)
+ * @param high    高电平时长(CPU周期)
  */
-void IR::m_ir_flash(uint32_t high_time, uint32_t low_time)
+void IR::m_ir_flash(const ir_gate_step_t& step, uint32_t& edge, uint32_t period, uint32_t high)
 {
-  high_time = high_time / m_pulse_width;
-  low_time  = low_time / m_pulse_width;
-
-  while (high_time--)
+  /* 空闲: 只有结束时刻需要精确, 长空闲单次定时让出CPU, 最后一段忙等待 */
+  if (!step.mark)
   {
-    m_gpio->high();
-    Thread::usleep(8);
-
     m_gpio->low();
-    Thread::usleep(17);
+    edge += step.cycles * period;
+    Delay::sleep_until(edge);
+    return;
   }
-  while (low_time--)
+
+  /* 边沿统计在翻转引脚后的等待时间内完成, 不推迟下一边沿 */
+  for (uint16_t i = 0; i < step.cycles; i++)
   {
+    m_gpio->high();
+    m_timing.rise(edge, ul_port_system_get_cycles(), 0 != i);
+    Delay::spin_until(edge + high);
+
     m_gpio->low();
-    Thread::usleep(26);
+    m_timing.fall(edge + high, ul_port_system_get_cycles());
+    edge += period;
+    Delay::spin_until(edge);
   }
 }
 
 /**
- * @brief (私有函数) IR 奥克斯红外遥控 输出
+ * @brief (私有函数) IR 软件载波输出一帧 (标记/空闲按载波周期误差扩散, 周期由CPU主频换算)
  *
- * @param  len 指令长度
- * @return bool 成功返回true，失败返回false
  */
-bool IR::m_aux(uint8_t len)
+void IR::m_flash_timeline()
 {
-  // 长度判断
-  if (13 != len)
-    return false;
-
-  uint8_t i = 0;
-  uint8_t j = 0;
-  // 头码
-  m_aux_start();
-  for (i = 0; i < 13; i++)
-  {
-    for (j = 0; j < 8; j++)
-    {
-      if (m_aux_data(i) & (0x01 << j))
-        m_aux_1();
-      else
-        m_aux_0();
-    }
-  }
-  // 结束码
-  m_aux_stop();
-  return true;
+  uint32_t clock  = ul_port_system_get_clock();
+  uint32_t period = (clock + frequency() / 2) / frequency();
+  uint32_t high   = static_cast<uint32_t>(period * duty() / 100.0f + 0.5f);
+  if (0 == period)
+    return;
+
+  IR_Gate_Sequencer sequencer;
+  ir_gate_step_t    step;
+  sequencer.reset(m_frame.timeline.data(), m_frame.timeline.size(), (clock + period / 2) / period);
+
+  uint32_t edge = ul_port_system_get_cycles();
+  m_timing.begin(clock, edge);
+  while (sequencer.next(step))
+    m_ir_flash(step, edge, period, high);
+  m_timing.end(edge, ul_port_system_get_cycles());
 }
 
 /**
- * @brief (私有函数) IR TCL红外遥控 输出
+ * @brief (私有函数) IR 编码一帧 (优先使用时序缓存)
  *
- * @param  len 指令长度
- * @return bool 成功返回true，失败返回false
+ * @param  frame  已编码帧
+ * @param  type   红外遥控品牌类型
+ * @param  data   指令数据
+ * @param  len    指令长度
+ * @return bool   成功返回true，失败返回false
  */
-bool IR::m_tcl(uint8_t len)
+bool IR::m_encode(ir_frame_t& frame, ir_type type, const char* data, uint32_t len)
 {
-  // 长度判断
-  if (28 != len)
+  const ir_protocol_t* protocol = IR_Protocol::get(type);
+  if (nullptr == protocol || len > 0xFF)
     return false;
 
-  uint8_t i = 0;
-  uint8_t j = 0;
-  // 头码
-  m_tcl_start();
-  for (i = 0; i < 14; i++)
+  const uint8_t* payload = reinterpret_cast<const uint8_t*>(data);
+  const uint8_t  length  = static_cast<uint8_t>(len);
+
+  /* 上一帧的缓存条目 */
+  if (frame.entry >= 0)
+  {
+    Atomic_Guard atomic;
+    s_cache.release(static_cast<uint8_t>(frame.entry));
+    frame.entry = -1;
+  }
+  frame.frequency = protocol->frequency;
+  frame.duty      = protocol->duty;
+
+  /* 缓存命中: 直接使用已编码的时序, 无需编码与分配 */
+  ir_cache_key_t key   = IR_Cache::make_key(type, payload, length, protocol->frequency);
+  int            entry = -1;
   {
-    for (j = 0; j < 8; j++)
+    Atomic_Guard atomic;
+    entry = s_cache.find(key, payload);
+    if (entry < 0)
+      entry = s_cache.reserve(key, payload, IR_Protocol::count(*protocol, length));
+    else
     {
-      if (m_tcl_data(1, i) & (0x01 << j))
-        m_tcl_1();
-      else
-        m_tcl_0();
+      frame.entry = entry;
+      frame.timeline.attach(s_cache.data(entry), s_cache.size(entry), s_cache.size(entry));
+      return true;
     }
   }
-  m_tcl_stop();
-  m_tcl_wait();
-  m_tcl_start();
-  for (i = 0; i < 14; i++)
+
+  /* 缓存未命中: 编码至预留的缓存条目, 内存块不足时使用独立缓存区 */
+  if (entry >= 0)
   {
-    for (j = 0; j < 8; j++)
+    frame.timeline.attach(s_cache.data(entry), s_cache.capacity(entry));
+    bool ret = IR_Protocol::encode(*protocol, payload, length, frame.timeline);
+
+    Atomic_Guard atomic;
+    if (ret)
     {
-      if (m_tcl_data(2, i) & (0x01 << j))
-        m_tcl_1();
-      else
-        m_tcl_0();
+      s_cache.commit(static_cast<uint8_t>(entry), frame.timeline.size());
+      frame.entry = entry;
+      return true;
     }
+
+    s_cache.discard(static_cast<uint8_t>(entry));
+    frame.timeline.attach(nullptr, 0);
+    return false;
   }
-  // 结束码
-  m_tcl_stop();
-  return true;
+
+  if (nullptr == frame.pulses)
+  {
+    frame.pulses = m_arena_acquire();
+    if (nullptr == frame.pulses)
+      return false;
+  }
+  frame.timeline.attach(frame.pulses, TIMELINE_CAPACITY);
+
+  if (IR_Protocol::encode(*protocol, payload, length, frame.timeline))
+    return true;
+
+  frame.timeline.clear();
+  return false;
 }
 
 /**
- * @brief (私有函数) IR 格力红外遥控 数据获取
+ * @brief (私有函数) IR 输出一帧已编码的时序
  *
- * @param loaction  数据位置
- * @param num       发送段数
- * @param pos       位移量
- * @return char&
+ * @return bool 成功返回true，失败返回false
  */
-char& IR::m_gree_data(uint8_t loaction, uint8_t num, uint8_t pos)
+bool IR::m_flash()
 {
-  if (1 == loaction)
-    return m_data_tmp[(num - 1) * 10 + pos];
-  else if (2 == loaction)
-    return m_data_tmp[(num - 1) * 10 + 4];
-  else if (3 == loaction)
-    return m_data_tmp[(num - 1) * 10 + 5];
-  else if (4 == loaction)
-    return m_data_tmp[(num - 1) * 10 + pos + 6];
-  else
-    return m_data_tmp[(num - 1) * 10 + 9];
+  if (0 == m_frame.timeline.size())
+    return false;
+
+  /* 硬件载波: 定时器DMA门控输出; 软件载波: 逐脉冲翻转引脚 */
+  if (m_carrier)
+    return m_carrier->transmit(m_carrier_channel, m_frame.timeline.data(), m_frame.timeline.size(), frequency(), duty());
+
+  m_flash_timeline();
+  return true;
 }
 
 /**
- * @brief (私有函数) IR 格力红外遥控 输出
+ * @brief (私有函数) IR 释放已编码帧
  *
- * @param  len 指令长度
- * @return bool 成功返回true，失败返回false
+ * @param frame 已编码帧
  */
-bool IR::m_gree(uint8_t len)
+void IR::m_release(ir_frame_t& frame)
 {
-  // 长度判断
-  if (30 != len)
-    return false;
-
-  uint8_t i = 0;
-  uint8_t j = 0;
-
-  // 第一段
-  // 头码
-  m_gree_start();
-  // 先发送11 12 13 14 寄存器数据，8位发送
-  for (i = 0; i < 4; i++)
+  frame.timeline.attach(nullptr, 0);
+  frame.frequency = 0;
+  frame.duty      = 0;
+  if (frame.entry >= 0)
   {
-    for (j = 0; j < 8; j++)
-    {
-      if (m_gree_data(1, 1, i) & (0x01 << j))
-        m_gree_1();
-      else
-        m_gree_0();
-    }
+    Atomic_Guard atomic;
+    s_cache.release(static_cast<uint8_t>(frame.entry));
+    frame.entry = -1;
   }
-  // 15 寄存器数据，3位发送
-  for (j = 0; j < 3; j++)
+  if (frame.pulses)
   {
-    if (m_gree_data(2, 1) & (0x01 << j))
-      m_gree_1();
-    else
-      m_gree_0();
+    m_arena_release(frame.pulses);
+    frame.pulses = nullptr;
   }
-  // 发送连接码，等待20MS
-  m_gree_wait(20);
-  // 16 寄存器数据，1位发送
-  if (m_gree_data(3, 1) & (0x01))
-    m_gree_1();
-  else
-    m_gree_0();
-  // 先发送17 18 19 寄存器数据，8位发送
-  for (i = 0; i < 3; i++)
+}
+
+/**
+ * @brief (私有函数) IR 取用一个空闲的独立时序缓存区
+ *
+ * @return ir_pulse_t* 独立时序缓存区，均被占用返回nullptr
+ */
+ir_pulse_t* IR::m_arena_acquire()
+{
+  Atomic_Guard atomic;
+  for (uint8_t i = 0; i < ARENA_SLOTS; i++)
   {
-    for (j = 0; j < 8; j++)
+    if (!(m_arena_used & (1U << i)))
     {
-      if (m_gree_data(4, 1, i) & (0x01 << j))
-        m_gree_1();
-      else
-        m_gree_0();
+      m_arena_used |= (1U << i);
+      return m_arena[i];
     }
   }
-  // 先发送28 寄存器数据，7位发送
-  for (j = 0; j < 7; j++)
+  return nullptr;
+}
+
+/**
+ * @brief (私有函数) IR 归还独立时序缓存区
+ *
+ * @param pulses 独立时序缓存区
+ */
+void IR::m_arena_release(ir_pulse_t* pulses)
+{
+  Atomic_Guard atomic;
+  for (uint8_t i = 0; i < ARENA_SLOTS; i++)
   {
-    if (m_gree_data(5, 1) & (0x01 << j))
-      m_gree_1();
-    else
-      m_gree_0();
+    if (pulses == m_arena[i])
+      m_arena_used &= ~(1U << i);
   }
-  // 发送连接码，等待40MS
-  m_gree_wait(40);
-  // 第一段结束
-
-  // 第二段
-  // 头码
-  m_gree_start();
-  // 先发送11 12 13 14 寄存器数据，8位发送
-  for (i = 0; i < 4; i++)
-  {
-    for (j = 0; j < 8; j++)
-    {
-      if (m_gree_data(1, 2, i) & (0x01 << j))
-        m_gree_1();
-      else
-        m_gree_0();
-    }
-  }
-  // 15 寄存器数据，3位发送
-  for (j = 0; j < 3; j++)
+}
+
+/**
+ * @brief (私有函数) IR 异步发送 启动定时器
+ *
+ * @param  time  定时时间(ms)
+ * @return bool  成功返回true，失败返回false
+ */
+bool IR::m_async_arm(uint32_t time)
+{
+  return b_port_os_timer_restart(m_async_timer, (0 == time) ? 1 : time);
+}
+
+/**
+ * @brief (私有函数) IR 异步发送 当前任务结束 (出队并发出完成信号)
+ *
+ * @param success 发送成功
+ */
+void IR::m_async_done(bool success)
+{
+  uint32_t ticket = 0;
+  m_release(m_async_frame);
+  m_async_remain = 0;
+
   {
-    if (m_gree_data(2, 2) & (0x01 << j))
-      m_gree_1();
-    else
-      m_gree_0();
+    Atomic_Guard atomic;
+    ticket        = m_jobs[m_job_head].ticket;
+    m_job_head    = (m_job_head + 1) % ASYNC_QUEUE_SIZE;
+    m_job_count--;
+    m_async_state = (0 != m_job_count) ? ASYNC_START : ASYNC_IDLE;
   }
-  // 发送连接码，等待20MS
-  m_gree_wait(20);
-  // 16 寄存器数据，1位发送
-  if (m_gree_data(3, 2) & (0x01))
-    m_gree_1();
-  else
-    m_gree_0();
-  // 先发送17 18 19 寄存器数据，8位发送
-  for (i = 0; i < 3; i++)
+
+  signal_send_finished(this, ticket, success);
+}
+
+/**
+ * @brief (私有函数) IR 异步发送 状态机 (定时器服务任务中执行, 不阻塞)
+ *
+ */
+void IR::m_async_step()
+{
+  uint32_t now = ul_port_os_get_tick_count();
+
+  /* 帧结束: 进入循环间隔或结束任务 */
+  if (ASYNC_ON_AIR == m_async_state)
   {
-    for (j = 0; j < 8; j++)
+    if (m_carrier->finish(0))
     {
-      if (m_gree_data(4, 2, i) & (0x01 << j))
-        m_gree_1();
-      else
-        m_gree_0();
+      if (0 != --m_async_remain)
+      {
+        m_async_state = ASYNC_START;
+        m_async_arm(m_jobs[m_job_head].delay);
+        return;
+      }
+      m_async_done(true);
     }
-  }
-  // 先发送28 寄存器数据，7位发送
-  for (j = 0; j < 7; j++)
-  {
-    if (m_gree_data(5, 2) & (0x01 << j))
-      m_gree_1();
-    else
-      m_gree_0();
-  }
-  // 发送连接码，等待40MS
-  m_gree_wait(40);
-  // 第二段结束
-
-  // 第三段
-  // 头码
-  m_gree_start();
-  // 先发送21 22 23 24 寄存器数据，8位发送
-  for (i = 0; i < 4; i++)
-  {
-    for (j = 0; j < 8; j++)
+    else if (now - m_async_start <= m_async_timeout)
     {
-      if (m_gree_data(1, 3, i) & (0x01 << j))
-        m_gree_1();
-      else
-        m_gree_0();
+      m_async_arm(ASYNC_RETRY_TIME);
+      return;
     }
-  }
-  // 25 寄存器数据，3位发送
-  for (j = 0; j < 3; j++)
-  {
-    if (m_gree_data(2, 3) & (0x01 << j))
-      m_gree_1();
     else
-      m_gree_0();
+    {
+      m_carrier->abort();
+      m_async_done(false);
+    }
   }
-  // 发送连接码，等待20MS
-  m_gree_wait(20);
-  // 26 寄存器数据，1位发送
-  if (m_gree_data(3, 3) & (0x01))
-    m_gree_1();
-  else
-    m_gree_0();
-  // 先发27 28 29 寄存器数据，8位发送
-  for (i = 0; i < 3; i++)
+
+  if (ASYNC_START != m_async_state)
+    return;
+
+  /* 新任务: 编码(时序缓存命中时无需编码) */
+  const ir_async_job_t& job = m_jobs[m_job_head];
+  if (0 == m_async_remain)
   {
-    for (j = 0; j < 8; j++)
+    if (!m_encode(m_async_frame, job.type, job.data, job.len))
     {
-      if (m_gree_data(4, 3, i) & (0x01 << j))
-        m_gree_1();
-      else
-        m_gree_0();
+      m_async_done(false);
+      if (ASYNC_START == m_async_state)
+        m_async_arm(1);
+      return;
     }
+    m_async_remain = job.count;
   }
-  // 先发送28 寄存器数据，7位发送
-  for (j = 0; j < 7; j++)
+
+  /* 硬件载波被其他通道占用: 稍后重试 */
+  const ir_pulse_t* pulses[IR_Envelope::CHANNEL_COUNT] = {};
+  uint16_t          sizes[IR_Envelope::CHANNEL_COUNT]  = {};
+  pulses[m_carrier_channel - 1]                        = m_async_frame.timeline.data();
+  sizes[m_carrier_channel - 1]                         = m_async_frame.timeline.size();
+  if (!m_carrier->start(pulses, sizes, nullptr, m_frequency(m_async_frame), m_duty(m_async_frame)))
   {
-    if (m_gree_data(5, 3) & (0x01 << j))
-      m_gree_1();
-    else
-      m_gree_0();
+    m_async_arm(ASYNC_RETRY_TIME);
+    return;
   }
-  // 结束码
-  m_gree_stop();
-  return true;
+
+  uint32_t duration = m_async_frame.timeline.duration() / 1000;
+  m_async_state     = ASYNC_ON_AIR;
+  m_async_start     = now;
+  m_async_timeout   = duration + 100;
+  m_async_arm(duration + 1);
 }
 
 /**
- * @brief (私有函数) IR 中广欧斯特红外遥控 输出
+ * @brief (静态) IR 异步发送 定时器回调入口
  *
- * @param  len 指令长度
- * @return bool 成功返回true，失败返回false
+ * @param timer 定时器句柄
+ */
+void IR::async_entry(void* timer)
+{
+  IR* ir = static_cast<IR*>(pv_port_os_timer_get_arg(timer));
+  if (nullptr != ir)
+    ir->m_async_step();
+}
+
+/**
+ * @brief IR 构造函数
+ *
+ * @param name    对象名称
+ * @param parent  父对象(指针)
+ */
+IR::IR(const std::string& name, Object* parent) : Object(name, parent)
+{
+  /* 资源分配 */
+  m_gpio            = new Class::io(name + "_gpio", this);
+  m_pulse_width     = 32;
+  m_carrier         = nullptr;
+  m_carrier_channel = 0;
+  m_frame           = ir_frame_t { IR_Timeline(), nullptr, -1, 0, 0 };
+  m_async_frame     = ir_frame_t { IR_Timeline(), nullptr, -1, 0, 0 };
+  m_suspended_frame = ir_frame_t { IR_Timeline(), nullptr, -1, 0, 0 };
+  m_arena_used      = 0;
+  m_job_head        = 0;
+  m_job_count       = 0;
+  m_async_state     = ASYNC_IDLE;
+  m_async_remain    = 0;
+  m_ticket          = 0;
+  m_async_start     = 0;
+  m_async_timeout   = 0;
+  m_async_timer     = nullptr;
+}
+
+/**
+ * @brief IR 开启端口 (引脚为TIM1/TIM8通道时使用硬件载波, 否则使用软件载波)
+ *
+ * @param  port         端口编号
+ * @param  pin          引脚编号
+ * @param  pulse_width  软件载波周期 (兼容保留, 软件载波按载波频率与CPU主频计时)
+ * @param  carrier      允许使用硬件载波(false时引脚为推挽输出, 供 GPIO 波形引擎输出)
+ * @return bool         成功返回true，失败返回false
  */
-bool IR::m_outes(uint8_t len)
+bool IR::open(Gpio::Port port, uint8_t pin, uint8_t pulse_width, bool carrier)
 {
-  // 长度判断
-  if (15 != len)
+  if (is_open())
     return false;
 
-  uint8_t i = 0;
-  uint8_t j = 0;
-  // 头码
-  m_outes_start();
-  // 中广贴牌奥克斯为15个字节   2025.06.01修改
-  for (i = 0; i < 15; i++)
+  uint8_t timer_num = 0;
+  m_pulse_width     = pulse_width;
+
+  if (carrier && IR_Carrier::lookup(port, pin, timer_num, m_carrier_channel))
   {
-    for (j = 0; j < 8; j++)
+    m_carrier = IR_Carrier::attach(timer_num);
+    if (m_carrier)
     {
-      if (m_outes_data(i) & (0x01 << j))
-        m_outes_1();
+      m_is_open = m_gpio->open(port, pin, ul_port_timer_get_gpio_af(timer_num), Gpio::LEVEL_HIGH, Gpio::AF_PP, Gpio::PULL_DOWN);
+      if (!m_is_open)
+      {
+        IR_Carrier::detach(m_carrier);
+        m_carrier = nullptr;
+      }
       else
-        m_outes_0();
+        m_async_timer = pt_port_os_timer_create(name().c_str(), 1, false, async_entry, this);
+      return m_is_open;
     }
   }
-  // 结束码
-  m_outes_stop();
-  return true;
+
+  /* 定时器不可用: 软件载波 */
+  m_is_open = m_gpio->open(port, pin);
+  return m_is_open;
 }
 
 /**
- * @brief (私有函数) IR 美的红外遥控 输出
+ * @brief  IR 关闭端口
  *
- * @param  len 指令长度
  * @return bool 成功返回true，失败返回false
  */
-bool IR::m_midea(uint8_t len)
+bool IR::close()
 {
-  // 长度判断
-  if (6 != len && 12 != len && 18 != len && 24 != len)
-    return false;
+  m_is_open = false;
 
-  uint8_t i = 0;
-  uint8_t j = 0;
-  // 头码
-  m_midea_start();
-  // 8位数据从高到低位发送
-  for (i = 0; i < 6; i++)
+  /* 异步发送: 停止定时器, 未完成的任务以失败结束 */
+  if (m_async_timer)
   {
-    // 先发送11 12 13 14 15 16寄存器数据，8位发送
-    for (j = 0; j < 8; j++)
-    {
-      if (m_midea_data(1, i) & (0x80 >> j))
-        m_midea_1();
-      else
-        m_midea_0();
-    }
-  }
+    b_port_os_timer_delete(m_async_timer);
+    m_async_timer = nullptr;
 
-  if (6 == len)
-  {
-    m_midea_stop();
-    return true;
+    if (ASYNC_ON_AIR == m_async_state)
+      m_carrier->abort();
+    while (0 != m_job_count)
+      m_async_done(false);
   }
-  else
-    m_midea_wait();
 
-  // 头码
-  m_midea_start();
-  // 8位数据从高到低位发送
-  for (i = 0; i < 6; i++)
+  if (m_carrier)
   {
-    // 先发送17 18 19 20 21 22 寄存器数据，8位发送
-    for (j = 0; j < 8; j++)
-    {
-      if (m_midea_data(2, i) & (0x80 >> j))
-        m_midea_1();
-      else
-        m_midea_0();
-    }
+    IR_Carrier::detach(m_carrier);
+    m_carrier = nullptr;
   }
 
-  if (12 == len)
-  {
-    m_midea_stop();
-    return true;
-  }
-  else
-    m_midea_wait();
+  return m_gpio->close();
+}
+
+/**
+ * @brief IR 编码一帧 (时序保留至下一次编码或释放, 供调度器多次发送)
+ *
+ * @param  type  红外遥控品牌类型
+ * @param  data  指令数据
+ * @param  len   指令长度
+ * @return bool  成功返回true，失败返回false
+ */
+bool IR::prepare(ir_type type, const char* data, uint32_t len)
+{
+  if (!is_open())
+    return false;
+
+  Mutex_Guard locker(m_mutex);
+  return m_encode(m_frame, type, data, len);
+}
+
+/**
+ * @brief IR 载入一帧原始时序 (如学习得到的时序, 保留至下一次编码或释放, 供调度器多次发送)
+ *
+ * @param  pulses     脉冲序列
+ * @param  size       脉冲数量
+ * @param  frequency  载波频率(Hz, 0为默认)
+ * @param  duty       载波占空比(%, 0为默认)
+ * @return bool       成功返回true，失败返回false
+ */
+bool IR::prepare(const ir_pulse_t* pulses, uint16_t size, uint32_t frequency, uint8_t duty)
+{
+  if (!is_open() || nullptr == pulses || 0 == size || size > TIMELINE_CAPACITY)
+    return false;
 
-  // 头码
-  m_midea_start();
-  // 8位数据从高到低位发送
-  for (i = 0; i < 6; i++)
+  Mutex_Guard locker(m_mutex);
+
+  /* 上一帧的缓存条目 */
+  if (m_frame.entry >= 0)
   {
-    // 先发送23 24 25 26 27 28 寄存器数据，8位发送
-    for (j = 0; j < 8; j++)
-    {
-      if (m_midea_data(3, i) & (0x80 >> j))
-        m_midea_1();
-      else
-        m_midea_0();
-    }
+    Atomic_Guard atomic;
+    s_cache.release(static_cast<uint8_t>(m_frame.entry));
+    m_frame.entry = -1;
   }
 
-  if (18 == len)
+  if (nullptr == m_frame.pulses)
   {
-    m_midea_stop();
-    return true;
+    m_frame.pulses = m_arena_acquire();
+    if (nullptr == m_frame.pulses)
+      return false;
   }
-  else
-    m_midea_wait();
+  m_frame.timeline.attach(m_frame.pulses, TIMELINE_CAPACITY);
+  m_frame.frequency = frequency;
+  m_frame.duty      = duty;
 
-  // 头码
-  m_midea_start();
-  // 8位数据从高到低位发送
-  for (i = 0; i < 6; i++)
+  for (uint16_t i = 0; i < size; i++)
   {
-    // 先发送29 30 31 32 33 34 寄存器数据，8位发送
-    for (j = 0; j < 8; j++)
+    if (!m_frame.timeline.push(pulses[i].mark, pulses[i].space))
     {
-      if (m_midea_data(4, i) & (0x80 >> j))
-        m_midea_1();
-      else
-        m_midea_0();
+      m_frame.timeline.clear();
+      return false;
     }
   }
 
-  // 结束码
-  m_midea_stop();
   return true;
 }
 
 /**
- * @brief (私有函数) IR 小米红外遥控 输出
+ * @brief IR 输出一帧已编码的时序 (阻塞至发送完成)
  *
- * @param  len 指令长度
  * @return bool 成功返回true，失败返回false
  */
-bool IR::m_xiaomi(uint8_t len)
+bool IR::flash()
 {
-  // 长度判断
-  if (12 != len && 19 != len)
+  if (!is_open())
     return false;
 
-  uint8_t i = 0;
-  uint8_t j = 0;
-  // 头码
-  m_xiaomi_start();
-  if (12 == len)
-  {
-    // 发12个字节
-    for (i = 0; i < 12; i++)
-    {
-      // 先发送11 12 13 14 寄存器数据，8位发送
-      for (j = 4; j > 0; j--)
-      {
-        if (((m_xiaomi_data(1, i) >> (j * 2 - 2)) & 0x03) == 0x03)
-          m_xiaomi_11();
-        else if (((m_xiaomi_data(1, i) >> (j * 2 - 2)) & 0x01) == 0x01)
-          m_xiaomi_01();
-        else if (((m_xiaomi_data(1, i) >> (j * 2 - 2)) & 0x02) == 0x02)
-          m_xiaomi_10();
-        else
-          m_xiaomi_00();
-      }
-    }
-  }
-  else if (19 == len)
-  {
-    // 第一段码11个字节
-    for (i = 0; i < 11; i++)
-    {
-      // 先发送11 12 13 14 寄存器数据，8位发送
-      for (j = 4; j > 0; j--)
-      {
-        if (((m_xiaomi_data(1, i) >> (j * 2 - 2)) & 0x03) == 0x03)
-          m_xiaomi_11();
-        else if (((m_xiaomi_data(1, i) >> (j * 2 - 2)) & 0x01) == 0x01)
-          m_xiaomi_01();
-        else if (((m_xiaomi_data(1, i) >> (j * 2 - 2)) & 0x02) == 0x02)
-          m_xiaomi_10();
-        else
-          m_xiaomi_00();
-      }
-    }
-    // 2024.3.4小米二段码需要加等待时间
-    m_xiaomi_wait();
-    // 第二段码8个字节
-    for (i = 0; i < 8; i++)
-    {
-      // 先发送11 12 13 14 寄存器数据，8位发送
-      for (j = 4; j > 0; j--)
-      {
-        if (((m_xiaomi_data(2, i) >> (j * 2 - 2)) & 0x03) == 0x03)
-          m_xiaomi_11();
-        else if (((m_xiaomi_data(2, i) >> (j * 2 - 2)) & 0x01) == 0x01)
-          m_xiaomi_01();
-        else if (((m_xiaomi_data(2, i) >> (j * 2 - 2)) & 0x02) == 0x02)
-          m_xiaomi_10();
-        else
-          m_xiaomi_00();
-      }
-    }
-  }
-  // 结束码
-  m_xiaomi_stop();
+  Mutex_Guard locker(m_mutex);
+  return m_flash();
+}
+
+/**
+ * @brief IR 释放已编码的时序
+ *
+ */
+void IR::release()
+{
+  Mutex_Guard locker(m_mutex);
+  m_release(m_frame);
+}
+
+/**
+ * @brief IR 挂起已编码的时序 (被高优先级任务抢占, 替换之前挂起的时序)
+ *
+ * @return bool 成功返回true，无已编码的时序返回false
+ */
+bool IR::suspend()
+{
+  Mutex_Guard locker(m_mutex);
+  if (0 == m_frame.timeline.size())
+    return false;
+
+  /* 时序缓存条目与独立缓存区随帧转移, 当前帧置空供下一次编码 */
+  m_release(m_suspended_frame);
+  m_suspended_frame = m_frame;
+  m_frame           = ir_frame_t { IR_Timeline(), nullptr, -1, 0, 0 };
   return true;
 }
 
 /**
- * @brief (私有函数) IR 海信红外遥控 输出
+ * @brief IR 恢复挂起的时序 (释放当前已编码的时序)
  *
- * @param  len 指令长度
- * @return bool 成功返回true，失败返回false
+ * @return bool 成功返回true，无挂起的时序返回false
  */
-bool IR::m_hisense(uint8_t len)
+bool IR::resume()
 {
-  // 长度判断
-  if (21 != len && 23 != len)
+  Mutex_Guard locker(m_mutex);
+  if (0 == m_suspended_frame.timeline.size())
     return false;
 
-  uint8_t i = 0;
-  uint8_t j = 0;
-  // 头码
-  m_hisense_start();
-  if (21 == len)
-  {
-    // 海信科龙遥控协议 V3.0
-    for (i = 0; i < 6; i++)
-    {
-      for (j = 0; j < 8; j++)
-      {
-        if (m_hisense_data(1, i) & (0x01 << j))
-          m_hisense_1();
-        else
-          m_hisense_0();
-      }
-    }
-    m_hisense_wait();
-    // 海信科龙遥控协议
-    for (i = 0; i < 8; i++)
-    {
-      for (j = 0; j < 8; j++)
-      {
-        if (m_hisense_data(2, i) & (0x01 << j))
-          m_hisense_1();
-        else
-          m_hisense_0();
-      }
-    }
-    m_hisense_wait();
-    // 海信科龙遥控协议
-    for (i = 0; i < 7; i++)
-    {
-      for (j = 0; j < 8; j++)
-      {
-        if (m_hisense_data(3, i) & (0x01 << j))
-          m_hisense_1();
-        else
-          m_hisense_0();
-      }
-    }
-  }
-  else if (23 == len)
-  {
-    // 海信科龙遥控协议 V4.0
-    for (i = 0; i < 23; i++)
-    {
-      for (j = 0; j < 8; j++)
-      {
-        if (m_hisense_data(1, i) & (0x01 << j))
-          m_hisense_1();
-        else
-          m_hisense_0();
-      }
-    }
-  }
-  // 结束码
-  m_hisense_stop();
+  m_release(m_frame);
+  m_frame           = m_suspended_frame;
+  m_suspended_frame = ir_frame_t { IR_Timeline(), nullptr, -1, 0, 0 };
   return true;
 }
 
 /**
- * @brief IR 构造函数
+ * @brief IR 丢弃挂起的时序
  *
- * @param name    对象名称
- * @param parent  父对象(指针)
  */
-IR::IR(const std::string& name, Object* parent) : Object(name, parent)
+void IR::discard()
 {
-  /* 资源分配 */
-  m_data_tmp    = nullptr;
-  m_gpio        = new Class::io(name + "_gpio", this);
-  m_pulse_width = 32;
+  Mutex_Guard locker(m_mutex);
+  m_release(m_suspended_frame);
 }
 
 /**
@@ -625,48 +587,17 @@ IR::IR(const std::string& name, Object* parent) : Object(name, parent)
  */
 bool IR::send(ir_type type, const char* data, uint32_t len, uint8_t count, uint32_t delay_times)
 {
-  if (!is_open())
+  if (!is_open() || 0 == count)
     return false;
 
   Mutex_Guard locker(m_mutex);
 
-  /* 数据隔离 */
-  m_data_tmp = new char[len];
-  std::memcpy(m_data_tmp, data, len);
+  /* 整帧编码为标记/空闲时序 (各次发送共用) */
+  bool ret = m_encode(m_frame, type, data, len);
 
-  bool ret;
-
-  while (count)
+  while (ret && count)
   {
-    /* 协议类型选择 */
-    switch (type)
-    {
-      case ir_type::AUX :
-        ret = m_aux(len);
-        break;
-      case ir_type::TCL :
-        ret = m_tcl(len);
-        break;
-      case ir_type::GREE :
-        ret = m_gree(len);
-        break;
-      case ir_type::OUTES :
-        ret = m_outes(len);
-        break;
-      case ir_type::MIDEA :
-        ret = m_midea(len);
-        break;
-      case ir_type::XIAOMI :
-        ret = m_xiaomi(len);
-        break;
-      case ir_type::HISENSE :
-        ret = m_hisense(len);
-        break;
-      default :
-        ret = false;
-        break;
-    }
-
+    ret = m_flash();
     if (!ret)
       break;
     else
@@ -677,11 +608,62 @@ bool IR::send(ir_type type, const char* data, uint32_t len, uint8_t count, uint3
   }
 
   /* 资源释放 */
-  delete[] m_data_tmp;
-  m_data_tmp = nullptr;
+  m_release(m_frame);
   return ret;
 }
 
+/**
+ * @brief IR 红外遥控异步发送 (仅硬件载波, 立即返回, 循环间隔由定时器计时, 完成时发出 signal_send_finished)
+ *
+ * @param  type         红外遥控品牌类型
+ * @param  data         指令数据(入队时复制)
+ * @param  len          指令长度
+ * @param  count        发送次数
+ * @param  delay_times  循环时间间隔(ms)
+ * @return uint32_t     任务编号，队列已满或不支持返回0
+ */
+uint32_t IR::send_async(ir_type type, const char* data, uint32_t len, uint8_t count, uint32_t delay_times)
+{
+  if (!is_open() || nullptr == m_async_timer || nullptr == data || 0 == count || len > IR_Cache::MAX_PAYLOAD)
+    return 0;
+
+  uint32_t ticket = 0;
+  bool     kick   = false;
+  {
+    Atomic_Guard atomic;
+    if (m_job_count >= ASYNC_QUEUE_SIZE)
+      return 0;
+
+    if (0 == ++m_ticket)
+      ++m_ticket;
+    ticket = m_ticket;
+
+    ir_async_job_t& job = m_jobs[(m_job_head + m_job_count) % ASYNC_QUEUE_SIZE];
+    job.ticket          = ticket;
+    job.type            = type;
+    job.len             = static_cast<uint8_t>(len);
+    job.count           = count;
+    job.delay           = delay_times;
+    memcpy(job.data, data, len);
+    m_job_count++;
+
+    kick = (ASYNC_IDLE == m_async_state);
+    if (kick)
+      m_async_state = ASYNC_START;
+  }
+
+  /* 队列原为空: 由定时器服务任务开始发送 */
+  if (kick && !m_async_arm(1))
+  {
+    Atomic_Guard atomic;
+    m_job_count--;
+    m_async_state = ASYNC_IDLE;
+    return 0;
+  }
+
+  return ticket;
+}
+
 /**
  * @brief IR 析构函数
  */
@@ -690,8 +672,9 @@ IR::~IR()
   close();
 
   /* 资源释放 */
-  if (m_data_tmp)
-    delete[] m_data_tmp;
+  m_release(m_frame);
+  m_release(m_async_frame);
+  m_release(m_suspended_frame);
   if (m_gpio)
     delete m_gpio;
 }
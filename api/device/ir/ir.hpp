@@ -12,6 +12,12 @@
 #define __IR_HPP__
 
 #include "virtual_gpio.hpp"
+#include "ir_carrier.hpp"
+#include "ir_protocol.hpp"
+#include "ir_cache.hpp"
+#include "ir_timing.hpp"
+#include "signal.hpp"
+#include "port_os.h"
 
 /// @brief 名称空间 库名
 namespace OwO
@@ -19,16 +25,15 @@ namespace OwO
 /// @brief 名称空间 设备
 namespace device
 {
-/// @brief 枚举 IR 机型
-enum class ir_type
+/// @brief 结构体 IR 异步发送任务
+struct ir_async_job_t
 {
-  AUX,     /* 奥克斯 */
-  TCL,     /* TCL */
-  GREE,    /* 格力 */
-  OUTES,   /* 中广欧斯特 */
-  MIDEA,   /* 美的 */
-  XIAOMI,  /* 小米 */
-  HISENSE, /* 海信 */
+  uint32_t ticket;                      /* 任务编号 */
+  ir_type  type;                        /* 红外遥控品牌类型 */
+  uint8_t  len;                         /* 指令长度 */
+  uint8_t  count;                       /* 发送次数 */
+  uint32_t delay;                       /* 循环时间间隔(ms) */
+  char     data[IR_Cache::MAX_PAYLOAD]; /* 指令数据 */
 };
 
 /// @brief 类 IR -- 红外遥控
@@ -39,518 +44,364 @@ class IR : public system::Object
   NO_COPY(IR)
   NO_MOVE(IR)
 
+public:
+  /// @brief IR 异步发送任务队列容量
+  static constexpr uint8_t ASYNC_QUEUE_SIZE = 4;
+
 private:
-  enum
+  /// @brief IR 时序缓存区容量(脉冲数)
+  static constexpr uint16_t TIMELINE_CAPACITY = IR_Timeline::MAX_PULSES;
+  /// @brief IR 独立时序缓存区数量 (当前帧与挂起帧各一个, 时序缓存不足时使用)
+  static constexpr uint8_t  ARENA_SLOTS       = 2;
+  /// @brief IR 异步发送重试间隔(ms) (硬件载波被其他通道占用时)
+  static constexpr uint32_t ASYNC_RETRY_TIME  = 2;
+
+  /// @brief 结构体 IR 已编码帧
+  struct ir_frame_t
+  {
+    IR_Timeline timeline;  /* 标记/空闲时序 */
+    ir_pulse_t* pulses;    /* 独立时序缓存区(时序缓存不足时从 m_arena 取用) */
+    int         entry;     /* 时序缓存条目(-1为未使用缓存) */
+    uint32_t    frequency; /* 载波频率(Hz, 0为默认) */
+    uint8_t     duty;      /* 载波占空比(%, 0为默认) */
+  };
+
+  /// @brief 枚举 IR 异步发送状态
+  enum async_state_e : uint8_t
   {
-    _0_32MS  = 320,
-    _0_371MS = 371,
-    _0_44MS  = 440,
-    _0_5MS   = 500,
-    _0_56MS  = 560,
-    _0_67MS  = 670,
-    _0_588MS = 588,
-    _0_882MS = 882,
-    _1MS     = 1000,
-    _1_08MS  = 1080,
-    _1_47MS  = 1470,
-    _1_6MS   = 1600,
-    _1_68MS  = 1680,
-    _1_84MS  = 1840,
-    _20MS    = 2000,
-    _2_21MS  = 2210,
-    _26_37MS = 2637,
-    _3_08MS  = 3080,
-    _3_64MS  = 3640,
-    _40MS    = 4000,
-    _4_5MS   = 4500,
-    _5_22MS  = 5220,
-    _71MS    = 7100,
-    _8MS     = 8000,
-    _9MS     = 9000,
+    ASYNC_IDLE,   /* 空闲 */
+    ASYNC_START,  /* 等待发送下一帧 */
+    ASYNC_ON_AIR, /* 发送中 */
   };
 
   /// @brief IR 互斥锁
   mutable system::kernel::Mutex m_mutex;
   /// @brief IR GPIO 端口数据
   Class::io*                    m_gpio;
-  /// @brief IR 载波周期
+  /// @brief IR 载波周期 (兼容保留)
   uint8_t                       m_pulse_width;
-  /// @brief IR 指令数据缓存区
-  char*                         m_data_tmp;
+  /// @brief IR 硬件载波 (引脚不支持时为nullptr, 使用软件载波)
+  IR_Carrier*                   m_carrier;
+  /// @brief IR 硬件载波通道
+  uint8_t                       m_carrier_channel;
+  /// @brief IR 已编码帧 (同步发送与调度器使用)
+  ir_frame_t                    m_frame;
+  /// @brief IR 已编码帧 (异步发送使用)
+  ir_frame_t                    m_async_frame;
+  /// @brief IR 已编码帧 (被高优先级任务抢占的调度器任务)
+  ir_frame_t                    m_suspended_frame;
+  /// @brief IR 独立时序缓存区 (预先分配, 随帧转移, 释放帧时归还)
+  ir_pulse_t                    m_arena[ARENA_SLOTS][TIMELINE_CAPACITY];
+  /// @brief IR 独立时序缓存区占用掩码
+  uint8_t                       m_arena_used;
+  /// @brief IR 异步发送任务队列
+  ir_async_job_t                m_jobs[ASYNC_QUEUE_SIZE];
+  /// @brief IR 异步发送任务队列头
+  uint8_t                       m_job_head;
+  /// @brief IR 异步发送任务数量
+  uint8_t                       m_job_count;
+  /// @brief IR 异步发送状态
+  volatile async_state_e        m_async_state;
+  /// @brief IR 当前任务剩余发送次数 (0为尚未编码)
+  uint8_t                       m_async_remain;
+  /// @brief IR 异步发送任务编号
+  uint32_t                      m_ticket;
+  /// @brief IR 当前帧开始时刻(ms)
+  uint32_t                      m_async_start;
+  /// @brief IR 当前帧超时时间(ms)
+  uint32_t                      m_async_timeout;
+  /// @brief IR 异步发送定时器 (单次, 帧结束与循环间隔到期时触发)
+  port_os_timer_t               m_async_timer;
+  /// @brief IR 软件载波发送时序统计
+  IR_Timing                     m_timing;
 
-  /**
-   * @brief (私有函数) IR 输出接口
-   *
-   * @param high_time 高电平周期
-   * @param low_time  低电平周期
-   */
-  void m_ir_flash(uint32_t high_time, uint32_t low_time);
+  /// @brief IR 已编码时序缓存 (各通道共享)
+  static IR_Cache               s_cache;
 
-#if 1 /* AUX 奥克斯 */
   /**
-   * @brief (私有内联函数) IR 奥克斯红外遥控 头码
+   * @brief (私有函数) IR 获取帧的载波频率 (同步与异步发送共用, 0为默认)
    *
+   * @param  frame     已编码帧
+   * @return uint32_t  载波频率(Hz)
    */
-  void m_aux_start()
+  static uint32_t m_frequency(const ir_frame_t& frame)
   {
-    m_ir_flash(_9MS, _4_5MS);
+    return (0 != frame.frequency) ? frame.frequency : IR_Carrier::DEFAULT_FREQUENCY;
   }
-  /**
-   * @brief (私有内联函数) IR 奥克斯红外遥控 二进制0
-   *
-   */
-  void m_aux_0()
-  {
-    m_ir_flash(_0_56MS, _0_56MS);
-  }
-  /**
-   * @brief (私有内联函数) IR 奥克斯红外遥控 二进制1
-   *
-   */
-  void m_aux_1()
-  {
-    m_ir_flash(_0_56MS, _1_68MS);
-  }
-  /**
-   * @brief (私有内联函数) IR 奥克斯红外遥控 尾码
-   *
-   */
-  void m_aux_stop()
-  {
-    m_ir_flash(_0_56MS, 0);
-  }
-  /**
-   * @brief (私有内联函数) IR 奥克斯红外遥控 获取数据
-   *
-   */
-  char& m_aux_data(uint8_t pos)
-  {
-    return m_data_tmp[pos];
-  }
-  /**
-   * @brief (私有内联函数) IR 奥克斯红外遥控 输出
-   *
-   * @param  len 指令长度
-   * @return bool 成功返回true，失败返回false
-   */
-  bool m_aux(uint8_t len);
-#endif
 
-#if 1 /* TCL */
-  /**
-   * @brief (私有内联函数) IR TCL红外遥控 头码
-   *
-   */
-  void m_tcl_start()
-  {
-    m_ir_flash(_3_08MS, _1_6MS);
-  }
-  /**
-   * @brief (私有内联函数) IR TCL红外遥控 二进制0
-   *
-   */
-  void m_tcl_0()
-  {
-    m_ir_flash(_0_5MS, _0_32MS);
-  }
-  /**
-   * @brief (私有内联函数) IR TCL红外遥控 二进制1
-   *
-   */
-  void m_tcl_1()
-  {
-    m_ir_flash(_0_5MS, _1_08MS);
-  }
   /**
-   * @brief (私有内联函数) IR TCL红外遥控 延时
+   * @brief (私有函数) IR 获取帧的载波占空比 (同步与异步发送共用, 0为默认)
    *
+   * @param  frame  已编码帧
+   * @return float  载波占空比(%)
    */
-  void m_tcl_wait()
+  static float m_duty(const ir_frame_t& frame)
   {
-    m_ir_flash(0, _71MS);
+    return (0 != frame.duty) ? static_cast<float>(frame.duty) : IR_Carrier::DEFAULT_DUTY;
   }
-  /**
-   * @brief (私有内联函数) IR TCL红外遥控 尾码
-   *
-   */
-  void m_tcl_stop()
-  {
-    m_ir_flash(_0_5MS, 0);
-  }
-  /**
-   * @brief (私有内联函数) IR TCL红外遥控 获取数据
-   *
-   */
-  char& m_tcl_data(uint8_t loaction, uint8_t pos)
-  {
-    return m_data_tmp[pos + (loaction - 1) * 14];
-  }
-  /**
-   * @brief (私有函数) IR TCL红外遥控 输出
-   *
-   * @param  len 指令长度
-   * @return bool 成功返回true，失败返回false
-   */
-  bool m_tcl(uint8_t len);
-#endif
 
-#if 1 /* GREE 格力 */
-  /**
-   * @brief (私有内联函数) IR 格力红外遥控 头码
-   *
-   */
-  void m_gree_start()
-  {
-    m_ir_flash(_9MS, _4_5MS);
-  }
   /**
-   * @brief (私有内联函数) IR 格力红外遥控 二进制0
+   * @brief (私有函数) IR 软件载波输出一个门控步骤 (按CPU周期计数的绝对时刻翻转引脚, 循环开销不累计; 记录每个边沿的实际时刻)
    *
+   * @param step    门控步骤
+   * @param edge    当前载波周期开始时刻(CPU周期计数, 输出为步骤结束时刻)
+   * @param period  载波周期(CPU周期)
+   * @param high    高电平时长(CPU周期)
    */
-  void m_gree_0()
-  {
-    m_ir_flash(_0_56MS, _0_67MS);
-  }
-  /**
-   * @brief (私有内联函数) IR 格力红外遥控 二进制1
-   *
-   */
-  void m_gree_1()
-  {
-    m_ir_flash(_0_56MS, _1_6MS);
-  }
-  /**
-   * @brief (私有内联函数) IR 格力红外遥控 延时
-   *
-   * @param time 延时
-   */
-  void m_gree_wait(uint8_t time)
-  {
-    if (20 == time)
-      m_ir_flash(_0_67MS, _20MS);
-    else if (40 == time)
-      m_ir_flash(_0_67MS, _40MS);
-  }
+  void m_ir_flash(const ir_gate_step_t& step, uint32_t& edge, uint32_t period, uint32_t high);
+
   /**
-   * @brief (私有内联函数) IR 格力红外遥控 尾码
+   * @brief (私有函数) IR 软件载波输出一帧 (标记/空闲按载波周期误差扩散, 周期由CPU主频换算)
    *
    */
-  void m_gree_stop()
-  {
-    m_ir_flash(_0_67MS, _0_56MS);
-  }
+  void m_flash_timeline();
+
   /**
-   * @brief (私有内联函数) IR 格力红外遥控 获取数据
+   * @brief (私有函数) IR 编码一帧 (优先使用时序缓存)
    *
+   * @param  frame  已编码帧
+   * @param  type   红外遥控品牌类型
+   * @param  data   指令数据
+   * @param  len    指令长度
+   * @return bool   成功返回true，失败返回false
    */
-  char& m_gree_data(uint8_t loaction, uint8_t num, uint8_t pos = 0);
+  bool m_encode(ir_frame_t& frame, ir_type type, const char* data, uint32_t len);
+
   /**
-   * @brief (私有函数) IR 格力红外遥控 输出
+   * @brief (私有函数) IR 输出一帧已编码的时序
    *
-   * @param  len 指令长度
    * @return bool 成功返回true，失败返回false
    */
-  bool  m_gree(uint8_t len);
-#endif
+  bool m_flash();
 
-#if 1 /* OUTES 中广欧斯特 */
-  /**
-   * @brief (私有内联函数) IR 中广欧斯特红外遥控 头码
-   *
-   */
-  void m_outes_start()
-  {
-    m_ir_flash(_3_64MS, _1_84MS);
-  }
-  /**
-   * @brief (私有内联函数) IR 中广欧斯特红外遥控 二进制0
-   *
-   */
-  void m_outes_0()
-  {
-    m_ir_flash(_0_44MS, _0_44MS);
-  }
   /**
-   * @brief (私有内联函数) IR 中广欧斯特红外遥控 二进制1
+   * @brief (私有函数) IR 释放已编码帧
    *
+   * @param frame 已编码帧
    */
-  void m_outes_1()
-  {
-    m_ir_flash(_0_44MS, _1_84MS);
-  }
-  /**
-   * @brief (私有内联函数) IR 中广欧斯特红外遥控 尾码
-   *
-   */
-  void m_outes_stop()
-  {
-    m_ir_flash(_0_44MS, 0);
-  }
-  /**
-   * @brief (私有内联函数) IR 中广欧斯特红外遥控 获取数据
-   *
-   */
-  char& m_outes_data(uint8_t pos)
-  {
-    return m_data_tmp[pos];
-  }
+  void m_release(ir_frame_t& frame);
+
   /**
-   * @brief (私有函数) IR 中广欧斯特红外遥控 输出
+   * @brief (私有函数) IR 取用一个空闲的独立时序缓存区
    *
-   * @param  len 指令长度
-   * @return bool 成功返回true，失败返回false
+   * @return ir_pulse_t* 独立时序缓存区，均被占用返回nullptr
    */
-  bool m_outes(uint8_t len);
-#endif
+  ir_pulse_t* m_arena_acquire();
 
-#if 1 /* MIDEA 美的 */
   /**
-   * @brief (私有内联函数) IR 美的红外遥控 头码
+   * @brief (私有函数) IR 归还独立时序缓存区
    *
+   * @param pulses 独立时序缓存区
    */
-  void m_midea_start()
-  {
-    m_ir_flash(_4_5MS, _4_5MS);
-  }
+  void m_arena_release(ir_pulse_t* pulses);
+
   /**
-   * @brief (私有内联函数) IR 美的红外遥控 二进制0
+   * @brief (私有函数) IR 异步发送 启动定时器
    *
+   * @param  time  定时时间(ms)
+   * @return bool  成功返回true，失败返回false
    */
-  void m_midea_0()
-  {
-    m_ir_flash(_0_56MS, _0_56MS);
-  }
+  bool m_async_arm(uint32_t time);
+
   /**
-   * @brief (私有内联函数) IR 美的红外遥控 二进制1
+   * @brief (私有函数) IR 异步发送 当前任务结束 (出队并发出完成信号)
    *
+   * @param success 发送成功
    */
-  void m_midea_1()
-  {
-    m_ir_flash(_0_56MS, _1_6MS);
-  }
+  void m_async_done(bool success);
+
   /**
-   * @brief (私有内联函数) IR 美的红外遥控 延时
+   * @brief (私有函数) IR 异步发送 状态机 (定时器服务任务中执行, 不阻塞)
    *
    */
-  void m_midea_wait()
-  {
-    m_ir_flash(_0_56MS, _5_22MS);
-  }
+  void m_async_step();
+
+  static void async_entry(void* timer);
+
+signals:
+  /// @brief IR 异步发送完成信号 (通道, 任务编号, 是否成功)
+  system::Signal<IR*, uint32_t, bool> signal_send_finished;
+
+public:
   /**
-   * @brief (私有内联函数) IR 美的红外遥控 尾码
+   * @brief IR 构造函数
    *
+   * @param name    对象名称
+   * @param parent  父对象(指针)
    */
-  void m_midea_stop()
-  {
-    m_ir_flash(_0_56MS, _0_56MS);
-  }
+  IR(const std::string& name = "IR", Object* parent = nullptr);
+
   /**
-   * @brief (私有内联函数) IR 美的红外遥控 获取数据
+   * @brief IR 开启端口 (引脚为TIM1/TIM8通道时使用硬件载波, 否则使用软件载波)
    *
+   * @param  port         端口编号
+   * @param  pin          引脚编号
+   * @param  pulse_width  软件载波周期 (兼容保留, 软件载波按载波频率与CPU主频计时)
+   * @param  carrier      允许使用硬件载波(false时引脚为推挽输出, 供 GPIO 波形引擎输出)
+   * @return bool         成功返回true，失败返回false
    */
-  char& m_midea_data(uint8_t loaction, uint8_t pos)
-  {
-    return m_data_tmp[pos + (loaction - 1) * 6];
-  }
+  virtual bool open(Gpio::Port port, uint8_t pin, uint8_t pulse_width = 32, bool carrier = true);
+
   /**
-   * @brief (私有函数) IR 美的红外遥控 输出
+   * @brief  IR 关闭端口
    *
-   * @param  len 指令长度
    * @return bool 成功返回true，失败返回false
    */
-  bool m_midea(uint8_t len);
-#endif
+  virtual bool close();
 
-#if 1 /* XIAOMI 小米 */
-  /**
-   * @brief (私有内联函数) IR 小米红外遥控 头码
-   *
-   */
-  void m_xiaomi_start()
-  {
-    m_ir_flash(_1MS, _0_588MS);
-  }
-  /**
-   * @brief (私有内联函数) IR 小米红外遥控 二进制00
-   *
-   */
-  void m_xiaomi_00()
-  {
-    m_ir_flash(_0_588MS, _0_371MS);
-  }
   /**
-   * @brief (私有内联函数) IR 小米红外遥控 二进制01
+   * @brief IR 是否使用硬件载波
    *
+   * @return bool 使用硬件载波返回true
    */
-  void m_xiaomi_01()
+  bool is_hardware_carrier() const
   {
-    m_ir_flash(_0_588MS, _0_882MS);
-  }
-  /**
-   * @brief (私有内联函数) IR 小米红外遥控 二进制10
-   *
-   */
-  void m_xiaomi_10()
-  {
-    m_ir_flash(_0_588MS, _2_21MS);
+    return nullptr != m_carrier;
   }
+
   /**
-   * @brief (私有内联函数) IR 小米红外遥控 二进制11
+   * @brief IR 设置载波周期 (兼容保留)
    *
+   * @param width 载波周期
    */
-  void m_xiaomi_11()
+  void set_pulse_width(uint8_t width)
   {
-    m_ir_flash(_0_588MS, _1_47MS);
+    m_pulse_width = width;
   }
+
   /**
-   * @brief (私有内联函数) IR 小米红外遥控 延时
+   * @brief IR 获取载波周期 (兼容保留)
    *
+   * @return uint16_t 载波周期
    */
-  void m_xiaomi_wait()
+  uint8_t get_pulse_width() const
   {
-    m_ir_flash(_0_588MS, _26_37MS);
+    return m_pulse_width;
   }
+
   /**
-   * @brief (私有内联函数) IR 小米红外遥控 尾码
+   * @brief IR 获取硬件载波
    *
+   * @return IR_Carrier* 硬件载波，使用软件载波时返回nullptr
    */
-  void m_xiaomi_stop()
+  IR_Carrier* carrier() const
   {
-    m_ir_flash(_0_588MS, 0);
+    return m_carrier;
   }
+
   /**
-   * @brief (私有内联函数) IR 小米红外遥控 获取数据
+   * @brief IR 获取硬件载波通道
    *
+   * @return uint8_t 定时器通道(1~4)
    */
-  char& m_xiaomi_data(uint8_t loaction, uint8_t pos)
+  uint8_t carrier_channel() const
   {
-    return m_data_tmp[pos + (loaction - 1) * 11];
+    return m_carrier_channel;
   }
-  /**
-   * @brief (私有函数) IR 小米红外遥控 输出
-   *
-   * @param  len 指令长度
-   * @return bool 成功返回true，失败返回false
-   */
-  bool m_xiaomi(uint8_t len);
-#endif
 
-#if 1 /* HISENSE 海信 */
   /**
-   * @brief (私有内联函数) IR 海信红外遥控 头码
+   * @brief IR 获取已编码的时序
    *
+   * @return const IR_Timeline& 标记/空闲时序
    */
-  void m_hisense_start()
+  const IR_Timeline& timeline() const
   {
-    m_ir_flash(_9MS, _4_5MS);
+    return m_frame.timeline;
   }
+
   /**
-   * @brief (私有内联函数) IR 海信红外遥控 二进制0
+   * @brief IR 获取已编码帧的载波频率
    *
+   * @return uint32_t 载波频率(Hz)
    */
-  void m_hisense_0()
+  uint32_t frequency() const
   {
-    m_ir_flash(_0_56MS, _0_56MS);
+    return m_frequency(m_frame);
   }
+
   /**
-   * @brief (私有内联函数) IR 海信红外遥控 二进制1
+   * @brief IR 获取已编码帧的载波占空比
    *
+   * @return float 载波占空比(%)
    */
-  void m_hisense_1()
+  float duty() const
   {
-    m_ir_flash(_0_56MS, _1_68MS);
+    return m_duty(m_frame);
   }
+
   /**
-   * @brief (私有内联函数) IR 海信红外遥控 延时
+   * @brief IR 获取软件载波发送时序统计 (硬件载波由定时器输出, 不统计)
    *
+   * @return IR_Timing& 发送时序统计
    */
-  void m_hisense_wait()
+  IR_Timing& timing()
   {
-    m_ir_flash(_0_56MS, _8MS);
+    return m_timing;
   }
+
   /**
-   * @brief (私有内联函数) IR 海信红外遥控 尾码
+   * @brief IR 获取已编码时序缓存 (命中/未命中次数)
    *
+   * @return const IR_Cache& 时序缓存
    */
-  void m_hisense_stop()
+  static const IR_Cache& cache()
   {
-    m_ir_flash(_0_56MS, 0);
+    return s_cache;
   }
+
   /**
-   * @brief (私有内联函数) IR 海信红外遥控 获取数据
+   * @brief IR 编码一帧 (时序保留至下一次编码或释放, 供调度器多次发送)
    *
+   * @param  type  红外遥控品牌类型
+   * @param  data  指令数据
+   * @param  len   指令长度
+   * @return bool  成功返回true，失败返回false
    */
-  char& m_hisense_data(uint8_t loaction, uint8_t pos)
-  {
-    if (1 == loaction)
-      return m_data_tmp[pos];
-    else if (2 == loaction)
-      return m_data_tmp[pos + 6];
-    else
-      return m_data_tmp[pos + 14];
-  }
+  bool prepare(ir_type type, const char* data, uint32_t len);
+
   /**
-   * @brief (私有函数) IR 海信红外遥控 输出
+   * @brief IR 载入一帧原始时序 (如学习得到的时序, 保留至下一次编码或释放, 供调度器多次发送)
    *
-   * @param  len 指令长度
-   * @return bool 成功返回true，失败返回false
+   * @param  pulses     脉冲序列
+   * @param  size       脉冲数量
+   * @param  frequency  载波频率(Hz, 0为默认)
+   * @param  duty       载波占空比(%, 0为默认)
+   * @return bool       成功返回true，失败返回false
    */
-  bool m_hisense(uint8_t len);
-#endif
+  bool prepare(const ir_pulse_t* pulses, uint16_t size, uint32_t frequency = 0, uint8_t duty = 0);
 
-public:
   /**
-   * @brief IR 构造函数
+   * @brief IR 输出一帧已编码的时序 (阻塞至发送完成)
    *
-   * @param name    对象名称
-   * @param parent  父对象(指针)
+   * @return bool 成功返回true，失败返回false
    */
-  IR(const std::string& name = "IR", Object* parent = nullptr);
+  bool flash();
 
   /**
-   * @brief IR 开启端口
+   * @brief IR 释放已编码的时序
    *
-   * @param  port 端口编号
-   * @param  pin  引脚编号
-   * @return bool 成功返回true，失败返回false
    */
-  virtual bool open(Gpio::Port port, uint8_t pin, uint8_t pulse_width = 32)
-  {
-    m_pulse_width = pulse_width;
-    m_is_open     = m_gpio->open(port, pin);
-    return m_is_open;
-  }
+  void release();
 
   /**
-   * @brief  IR 关闭端口
+   * @brief IR 挂起已编码的时序 (被高优先级任务抢占, 替换之前挂起的时序)
    *
-   * @return bool 成功返回true，失败返回false
+   * @return bool 成功返回true，无已编码的时序返回false
    */
-  virtual bool close()
-  {
-    m_is_open = false;
-    return m_gpio->close();
-  }
+  bool suspend();
 
   /**
-   * @brief IR 设置载波周期
+   * @brief IR 恢复挂起的时序 (释放当前已编码的时序)
    *
-   * @param width 载波周期
+   * @return bool 成功返回true，无挂起的时序返回false
    */
-  void set_pulse_width(uint8_t width)
-  {
-    m_pulse_width = width;
-  }
+  bool resume();
 
   /**
-   * @brief IR 获取载波周期
+   * @brief IR 丢弃挂起的时序
    *
-   * @return uint16_t 载波周期
    */
-  uint8_t get_pulse_width() const
-  {
-    return m_pulse_width;
-  }
+  void discard();
 
   /**
    * @brief IR 红外遥控发送
@@ -564,6 +415,28 @@ public:
    */
   bool send(ir_type type, const char* data, uint32_t len, uint8_t count = 1, uint32_t delay_times = 500);
 
+  /**
+   * @brief IR 红外遥控异步发送 (仅硬件载波, 立即返回, 循环间隔由定时器计时, 完成时发出 signal_send_finished)
+   *
+   * @param  type         红外遥控品牌类型
+   * @param  data         指令数据(入队时复制)
+   * @param  len          指令长度
+   * @param  count        发送次数
+   * @param  delay_times  循环时间间隔(ms)
+   * @return uint32_t     任务编号，队列已满或不支持返回0
+   */
+  uint32_t send_async(ir_type type, const char* data, uint32_t len, uint8_t count = 1, uint32_t delay_times = 500);
+
+  /**
+   * @brief IR 获取异步发送任务数量 (含发送中的任务)
+   *
+   * @return uint8_t 任务数量
+   */
+  uint8_t async_pending() const
+  {
+    return m_job_count;
+  }
+
   /**
    * @brief IR 析构函数
    */
@@ -0,0 +1,261 @@
+/**
+ * @file      ir_ac.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for IR device air conditioner frame builder (红外遥控 空调状态指令)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "ir_ac.hpp"
+#include <cstring>
+
+using namespace OwO;
+using namespace device;
+
+struct ir_ac_brand_t;
+
+/// @brief IR 空调 品牌指令生成函数
+using ir_ac_build_t = void (*)(const ir_ac_state_t& state, const ir_ac_brand_t& brand, uint8_t* data);
+
+/// @brief 结构体 IR 空调 品牌指令生成器
+struct ir_ac_brand_t
+{
+  ir_type       type;     /* 红外遥控品牌类型 */
+  uint8_t       min;      /* 最低设定温度(℃) */
+  uint8_t       max;      /* 最高设定温度(℃) */
+  uint8_t       length;   /* 指令长度 (与 IR_Protocol 布局一致) */
+  uint8_t       modes[5]; /* 运行模式编码 (按 ir_ac_mode 索引) */
+  uint8_t       fans[4];  /* 风速编码 (按 ir_ac_fan 索引) */
+  ir_ac_build_t build;    /* 生成函数 */
+};
+
+/**
+ * @brief (静态内联) IR 空调 字节累加和
+ *
+ * @param  data     数据
+ * @param  length   长度
+ * @return uint8_t  累加和(低8位)
+ */
+static inline uint8_t sl_sum(const uint8_t* data, uint8_t length)
+{
+  uint8_t sum = 0;
+  for (uint8_t i = 0; i < length; i++)
+    sum += data[i];
+  return sum;
+}
+
+/**
+ * @brief (静态内联) IR 空调 字节位序反转
+ *
+ * @param  value    字节
+ * @return uint8_t  反转后的字节
+ */
+static inline uint8_t sl_reverse(uint8_t value)
+{
+  value = static_cast<uint8_t>((value & 0xF0) >> 4 | (value & 0x0F) << 4);
+  value = static_cast<uint8_t>((value & 0xCC) >> 2 | (value & 0x33) << 2);
+  value = static_cast<uint8_t>((value & 0xAA) >> 1 | (value & 0x55) << 1);
+  return value;
+}
+
+#if 1 /* AUX 奥克斯 */
+/**
+ * @brief (静态) IR 奥克斯 生成指令 (13字节, 末字节为前12字节累加和)
+ *
+ * @param state 空调状态
+ * @param brand 品牌指令生成器
+ * @param data  指令数据
+ */
+static void s_aux_build(const ir_ac_state_t& state, const ir_ac_brand_t& brand, uint8_t* data)
+{
+  data[0]  = 0xC3;
+  data[1]  = static_cast<uint8_t>((state.temperature - 8) << 3 | (state.swing ? 0x00 : 0x07));
+  data[2]  = 0xE0; /* 左右扫风关闭 */
+  data[4]  = static_cast<uint8_t>(brand.fans[static_cast<uint8_t>(state.fan)] << 5);
+  data[6]  = static_cast<uint8_t>(brand.modes[static_cast<uint8_t>(state.mode)] << 5);
+  data[9]  = state.power ? 0x20 : 0x00;
+  data[11] = 0x08; /* 灯光保持 */
+  data[12] = sl_sum(data, 12);
+}
+#endif
+
+#if 1 /* TCL */
+/**
+ * @brief (静态) IR TCL 生成指令 (14字节, 末字节为前13字节累加和, 重复2段)
+ *
+ * @param state 空调状态
+ * @param brand 品牌指令生成器
+ * @param data  指令数据
+ */
+static void s_tcl_build(const ir_ac_state_t& state, const ir_ac_brand_t& brand, uint8_t* data)
+{
+  data[0]  = 0x23;
+  data[1]  = 0xCB;
+  data[2]  = 0x26;
+  data[3]  = 0x01; /* 普通指令 */
+  data[5]  = static_cast<uint8_t>(0x20 | (state.power ? 0x04 : 0x00));
+  data[6]  = brand.modes[static_cast<uint8_t>(state.mode)];
+  data[7]  = static_cast<uint8_t>(31 - state.temperature);
+  data[8]  = static_cast<uint8_t>(0x40 | (state.swing ? 0x38 : 0x00) | brand.fans[static_cast<uint8_t>(state.fan)]);
+  data[13] = sl_sum(data, 13);
+  memcpy(&data[14], data, 14);
+}
+#endif
+
+#if 1 /* GREE 格力 */
+/**
+ * @brief (静态) IR 格力 生成指令 (8字节状态, 第7字节高4位为半字节校验; 每段前4字节 + 3位连接码, 后4字节按布局拆为1 + 24 + 7位, 重复3段)
+ *
+ * @param state 空调状态
+ * @param brand 品牌指令生成器
+ * @param data  指令数据
+ */
+static void s_gree_build(const ir_ac_state_t& state, const ir_ac_brand_t& brand, uint8_t* data)
+{
+  uint8_t raw[8] = {};
+  raw[0]         = static_cast<uint8_t>(brand.modes[static_cast<uint8_t>(state.mode)] | (state.power ? 0x08 : 0x00) | brand.fans[static_cast<uint8_t>(state.fan)] << 4 | (state.swing ? 0x40 : 0x00));
+  raw[1]         = static_cast<uint8_t>(state.temperature - 16);
+  raw[2]         = 0x20; /* 灯光开启 */
+  raw[3]         = 0x50;
+  raw[4]         = state.swing ? 0x01 : 0x00;
+  raw[5]         = 0x20;
+
+  /* 校验: 10 + 前4字节低4位 + 第4~6字节高4位 */
+  uint8_t sum = 10;
+  for (uint8_t i = 0; i < 4; i++)
+    sum += raw[i] & 0x0F;
+  for (uint8_t i = 4; i < 7; i++)
+    sum += raw[i] >> 4;
+  raw[7] = static_cast<uint8_t>((sum & 0x0F) << 4);
+
+  uint32_t tail = static_cast<uint32_t>(raw[4]) | static_cast<uint32_t>(raw[5]) << 8 | static_cast<uint32_t>(raw[6]) << 16 | static_cast<uint32_t>(raw[7]) << 24;
+  for (uint8_t segment = 0; segment < 3; segment++)
+  {
+    uint8_t* block = &data[segment * 10];
+    memcpy(block, raw, 4);
+    block[4] = 0x02; /* 连接码前3位 010 */
+    block[5] = static_cast<uint8_t>(tail & 0x01);
+    block[6] = static_cast<uint8_t>(tail >> 1);
+    block[7] = static_cast<uint8_t>(tail >> 9);
+    block[8] = static_cast<uint8_t>(tail >> 17);
+    block[9] = static_cast<uint8_t>((tail >> 25) & 0x7F);
+  }
+}
+#endif
+
+#if 1 /* MIDEA 美的 */
+/**
+ * @brief (静态) IR 美的 生成指令 (6字节, 末字节为前5字节位序反转累加和的补码; 第2段为第1段取反)
+ *
+ * @param state 空调状态
+ * @param brand 品牌指令生成器
+ * @param data  指令数据
+ */
+static void s_midea_build(const ir_ac_state_t& state, const ir_ac_brand_t& brand, uint8_t* data)
+{
+  data[0] = 0xA1;
+  data[1] = static_cast<uint8_t>((state.power ? 0x80 : 0x00) | brand.fans[static_cast<uint8_t>(state.fan)] << 3 | brand.modes[static_cast<uint8_t>(state.mode)]);
+  data[2] = static_cast<uint8_t>(0x40 | (state.temperature - 17)); /* 摄氏度 */
+  data[3] = 0xFF;                                                  /* 定时关闭 */
+  data[4] = 0xFF;
+
+  uint8_t sum = 0;
+  for (uint8_t i = 0; i < 5; i++)
+    sum += sl_reverse(data[i]);
+  data[5] = sl_reverse(static_cast<uint8_t>(256 - sum));
+
+  for (uint8_t i = 0; i < 6; i++)
+    data[6 + i] = static_cast<uint8_t>(~data[i]);
+}
+#endif
+
+/// @brief IR 空调 品牌指令生成器表 (仅收录字段布局已知的品牌)
+static constexpr ir_ac_brand_t sc_at_brands[] = {
+  { ir_type::AUX, 16, 32, 13, { 0, 1, 2, 6, 4 }, { 5, 3, 2, 1 }, s_aux_build },
+  { ir_type::TCL, 16, 31, 28, { 8, 3, 2, 7, 1 }, { 0, 2, 3, 5 }, s_tcl_build },
+  { ir_type::GREE, 16, 30, 30, { 0, 1, 2, 3, 4 }, { 0, 1, 2, 3 }, s_gree_build },
+  { ir_type::MIDEA, 17, 30, 12, { 2, 0, 1, 4, 3 }, { 0, 1, 2, 3 }, s_midea_build },
+};
+
+/**
+ * @brief (静态内联) IR 空调 查找品牌指令生成器
+ *
+ * @param  type                  红外遥控品牌类型
+ * @return const ir_ac_brand_t*  品牌指令生成器，不支持返回nullptr
+ */
+static inline const ir_ac_brand_t* sl_find(ir_type type)
+{
+  for (const ir_ac_brand_t& brand : sc_at_brands)
+  {
+    if (brand.type == type)
+      return &brand;
+  }
+  return nullptr;
+}
+
+/**
+ * @brief IR 空调 品牌是否支持状态指令
+ *
+ * @param  type  红外遥控品牌类型
+ * @return bool  支持返回true
+ */
+bool IR_AC::is_supported(ir_type type)
+{
+  return nullptr != sl_find(type);
+}
+
+/**
+ * @brief IR 空调 获取品牌设定温度范围
+ *
+ * @param  type  红外遥控品牌类型
+ * @param  min   最低温度(℃, 输出)
+ * @param  max   最高温度(℃, 输出)
+ * @return bool  品牌支持返回true
+ */
+bool IR_AC::range(ir_type type, uint8_t& min, uint8_t& max)
+{
+  const ir_ac_brand_t* brand = sl_find(type);
+  if (nullptr == brand)
+    return false;
+
+  min = brand->min;
+  max = brand->max;
+  return true;
+}
+
+/**
+ * @brief IR 空调 生成指令数据
+ *
+ * @param  type     红外遥控品牌类型
+ * @param  state    空调状态
+ * @param  data     指令数据(输出)
+ * @param  size     指令数据缓存区大小
+ * @param  length   指令长度(输出)
+ * @return ir_ac_error 生成结果, 失败时指令长度为0
+ */
+ir_ac_error IR_AC::build(ir_type type, const ir_ac_state_t& state, uint8_t* data, uint8_t size, uint8_t& length)
+{
+  length                     = 0;
+  const ir_ac_brand_t* brand = sl_find(type);
+  if (nullptr == brand)
+    return ir_ac_error::BRAND;
+
+  if (static_cast<uint8_t>(state.mode) > static_cast<uint8_t>(ir_ac_mode::HEAT))
+    return ir_ac_error::MODE;
+
+  if (static_cast<uint8_t>(state.fan) > static_cast<uint8_t>(ir_ac_fan::HIGH))
+    return ir_ac_error::FAN;
+
+  if (state.temperature < brand->min || state.temperature > brand->max)
+    return ir_ac_error::TEMPERATURE;
+
+  if (nullptr == data || size < brand->length)
+    return ir_ac_error::SIZE;
+
+  memset(data, 0, brand->length);
+  brand->build(state, *brand, data);
+  length = brand->length;
+  return ir_ac_error::NONE;
+}
@@ -0,0 +1,102 @@
+/**
+ * @file      ir_ac.hpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for IR device air conditioner frame builder (红外遥控 空调状态指令)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#ifndef __IR_AC_HPP__
+#define __IR_AC_HPP__
+
+#include "ir_protocol.hpp"
+
+/// @brief 名称空间 库名
+namespace OwO
+{
+/// @brief 名称空间 设备
+namespace device
+{
+/// @brief 枚举 IR 空调 运行模式
+enum class ir_ac_mode : uint8_t
+{
+  AUTO, /* 自动 */
+  COOL, /* 制冷 */
+  DRY,  /* 除湿 */
+  FAN,  /* 送风 */
+  HEAT, /* 制热 */
+};
+
+/// @brief 枚举 IR 空调 风速
+enum class ir_ac_fan : uint8_t
+{
+  AUTO,   /* 自动 */
+  LOW,    /* 低速 */
+  MEDIUM, /* 中速 */
+  HIGH,   /* 高速 */
+};
+
+/// @brief 枚举 IR 空调 指令生成结果
+enum class ir_ac_error : uint8_t
+{
+  NONE,        /* 生成成功 */
+  BRAND,       /* 品牌不支持 */
+  MODE,        /* 运行模式无效 */
+  FAN,         /* 风速无效 */
+  TEMPERATURE, /* 设定温度超出品牌范围 */
+  SIZE,        /* 输出缓存区不足 */
+};
+
+/// @brief 结构体 IR 空调 状态
+struct ir_ac_state_t
+{
+  bool       power;       /* 开机 */
+  ir_ac_mode mode;        /* 运行模式 */
+  ir_ac_fan  fan;         /* 风速 */
+  bool       swing;       /* 上下扫风 */
+  uint8_t    temperature; /* 设定温度(℃) */
+};
+
+/// @brief 类 IR 空调 -- 按品牌将空调状态生成完整指令数据(含校验), 供 IR_Protocol 编码 (不依赖硬件)
+class IR_AC
+{
+public:
+  /// @brief 指令数据最大长度
+  static constexpr uint8_t MAX_LENGTH = 30;
+
+  /**
+   * @brief IR 空调 品牌是否支持状态指令
+   *
+   * @param  type  红外遥控品牌类型
+   * @return bool  支持返回true
+   */
+  static bool is_supported(ir_type type);
+
+  /**
+   * @brief IR 空调 获取品牌设定温度范围
+   *
+   * @param  type  红外遥控品牌类型
+   * @param  min   最低温度(℃, 输出)
+   * @param  max   最高温度(℃, 输出)
+   * @return bool  品牌支持返回true
+   */
+  static bool range(ir_type type, uint8_t& min, uint8_t& max);
+
+  /**
+   * @brief IR 空调 生成指令数据
+   *
+   * @param  type     红外遥控品牌类型
+   * @param  state    空调状态
+   * @param  data     指令数据(输出)
+   * @param  size     指令数据缓存区大小
+   * @param  length   指令长度(输出)
+   * @return ir_ac_error 生成结果, 失败时指令长度为0
+   */
+  static ir_ac_error build(ir_type type, const ir_ac_state_t& state, uint8_t* data, uint8_t size, uint8_t& length);
+};
+} /* namespace device */
+} /* namespace OwO */
+
+#endif /* __IR_AC_HPP__ */
@@ -0,0 +1,247 @@
+/**
+ * @file      ir_cache.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for IR device timing cache (红外遥控 时序缓存)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "ir_cache.hpp"
+#include <cstring>
+
+using namespace OwO;
+using namespace device;
+
+/**
+ * @brief (静态私有函数) IR 时序缓存 连续内存块掩码
+ *
+ * @param  first     起始内存块
+ * @param  blocks    内存块数量
+ * @return uint64_t  内存块掩码
+ */
+uint64_t IR_Cache::m_run_mask(uint8_t first, uint8_t blocks)
+{
+  if (0 == blocks || first >= 64)
+    return 0;
+
+  uint64_t mask = (blocks >= 64) ? ~0ULL : ((1ULL << blocks) - 1);
+  return mask << first;
+}
+
+/**
+ * @brief (私有函数) IR 时序缓存 查找连续空闲内存块 (首次适配)
+ *
+ * @param  blocks  内存块数量
+ * @return int     起始内存块，不存在返回-1
+ */
+int IR_Cache::m_find_run(uint8_t blocks) const
+{
+  for (uint8_t first = 0; first + blocks <= BLOCK_COUNT; first++)
+  {
+    if (0 == (m_used & m_run_mask(first, blocks)))
+      return first;
+  }
+  return -1;
+}
+
+/**
+ * @brief (私有函数) IR 时序缓存 淘汰最近最少使用且无使用者的条目
+ *
+ * @return bool 成功返回true，无可淘汰条目返回false
+ */
+bool IR_Cache::m_evict()
+{
+  int victim = -1;
+  for (uint8_t i = 0; i < ENTRY_COUNT; i++)
+  {
+    const entry_t& entry = m_entries[i];
+    if (0 == entry.blocks || !entry.valid || 0 != entry.users)
+      continue;
+
+    if (victim < 0 || static_cast<int32_t>(entry.stamp - m_entries[victim].stamp) < 0)
+      victim = i;
+  }
+
+  if (victim < 0)
+    return false;
+
+  m_free(static_cast<uint8_t>(victim));
+  return true;
+}
+
+/**
+ * @brief (私有函数) IR 时序缓存 释放条目及其内存块
+ *
+ * @param index 条目下标
+ */
+void IR_Cache::m_free(uint8_t index)
+{
+  entry_t& entry  = m_entries[index];
+  m_used         &= ~m_run_mask(entry.first, entry.blocks);
+  entry.blocks    = 0;
+  entry.users     = 0;
+  entry.valid     = false;
+}
+
+/**
+ * @brief IR 时序缓存 生成缓存键 (FNV-1a 散列)
+ *
+ * @param  type     红外遥控品牌类型
+ * @param  data     指令数据
+ * @param  length   指令长度
+ * @param  carrier  载波设置
+ * @return ir_cache_key_t 缓存键
+ */
+ir_cache_key_t IR_Cache::make_key(ir_type type, const uint8_t* data, uint8_t length, uint32_t carrier)
+{
+  uint32_t hash = 2166136261U;
+  for (uint8_t i = 0; i < length; i++)
+  {
+    hash ^= data[i];
+    hash *= 16777619U;
+  }
+
+  return ir_cache_key_t { type, length, carrier, hash };
+}
+
+/**
+ * @brief IR 时序缓存 查找 (命中时使用者数量加1, 需调用 release 释放)
+ *
+ * @param  key   缓存键
+ * @param  data  指令数据
+ * @return int   条目下标，未命中返回-1
+ */
+int IR_Cache::find(const ir_cache_key_t& key, const uint8_t* data)
+{
+  for (uint8_t i = 0; i < ENTRY_COUNT; i++)
+  {
+    entry_t& entry = m_entries[i];
+    if (!entry.valid || entry.key.hash != key.hash || entry.key.type != key.type || entry.key.length != key.length || entry.key.carrier != key.carrier)
+      continue;
+
+    if (0 != memcmp(entry.payload, data, key.length))
+      continue;
+
+    entry.users++;
+    entry.stamp = ++m_stamp;
+    m_hits++;
+    return i;
+  }
+
+  m_misses++;
+  return -1;
+}
+
+/**
+ * @brief IR 时序缓存 预留条目 (按需淘汰最近最少使用的条目, 编码完成后调用 commit 或 discard)
+ *
+ * @param  key       缓存键
+ * @param  data      指令数据
+ * @param  capacity  预留脉冲数量
+ * @return int       条目下标(使用者数量为1)，指令过长或内存不足返回-1
+ */
+int IR_Cache::reserve(const ir_cache_key_t& key, const uint8_t* data, uint16_t capacity)
+{
+  const uint32_t blocks = (static_cast<uint32_t>(capacity) + BLOCK_PULSES - 1) / BLOCK_PULSES;
+  if (key.length > MAX_PAYLOAD || 0 == blocks || blocks > BLOCK_COUNT)
+    return -1;
+
+  /* 空闲条目 */
+  int index = -1;
+  while (index < 0)
+  {
+    for (uint8_t i = 0; i < ENTRY_COUNT && index < 0; i++)
+    {
+      if (0 == m_entries[i].blocks)
+        index = i;
+    }
+
+    if (index < 0 && !m_evict())
+      return -1;
+  }
+
+  /* 连续空闲内存块 */
+  int first = m_find_run(static_cast<uint8_t>(blocks));
+  while (first < 0)
+  {
+    if (!m_evict())
+      return -1;
+    first = m_find_run(static_cast<uint8_t>(blocks));
+  }
+
+  entry_t& entry = m_entries[index];
+  entry.key      = key;
+  entry.stamp    = ++m_stamp;
+  entry.size     = 0;
+  entry.first    = static_cast<uint8_t>(first);
+  entry.blocks   = static_cast<uint8_t>(blocks);
+  entry.users    = 1;
+  entry.valid    = false;
+  memcpy(entry.payload, data, key.length);
+
+  m_used |= m_run_mask(entry.first, entry.blocks);
+  return index;
+}
+
+/**
+ * @brief IR 时序缓存 编码完成 (释放多余的内存块)
+ *
+ * @param index 条目下标
+ * @param size  脉冲数量
+ */
+void IR_Cache::commit(uint8_t index, uint16_t size)
+{
+  if (index >= ENTRY_COUNT || 0 == m_entries[index].blocks)
+    return;
+
+  entry_t& entry = m_entries[index];
+
+  if (0 == size || size > capacity(index))
+  {
+    discard(index);
+    return;
+  }
+
+  uint8_t blocks  = static_cast<uint8_t>((size + BLOCK_PULSES - 1) / BLOCK_PULSES);
+  m_used         &= ~m_run_mask(static_cast<uint8_t>(entry.first + blocks), static_cast<uint8_t>(entry.blocks - blocks));
+  entry.blocks    = blocks;
+  entry.size      = size;
+  entry.valid     = true;
+}
+
+/**
+ * @brief IR 时序缓存 放弃预留的条目
+ *
+ * @param index 条目下标
+ */
+void IR_Cache::discard(uint8_t index)
+{
+  if (index < ENTRY_COUNT && 0 != m_entries[index].blocks)
+    m_free(index);
+}
+
+/**
+ * @brief IR 时序缓存 释放条目 (使用者数量减1)
+ *
+ * @param index 条目下标
+ */
+void IR_Cache::release(uint8_t index)
+{
+  if (index < ENTRY_COUNT && 0 != m_entries[index].users)
+    m_entries[index].users--;
+}
+
+/**
+ * @brief IR 时序缓存 清空 (仅清除未使用的条目)
+ *
+ */
+void IR_Cache::clear()
+{
+  for (uint8_t i = 0; i < ENTRY_COUNT; i++)
+  {
+    if (0 != m_entries[i].blocks && m_entries[i].valid && 0 == m_entries[i].users)
+      m_free(i);
+  }
+}
@@ -0,0 +1,193 @@
+/**
+ * @file      ir_cache.hpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for IR device timing cache (红外遥控 时序缓存)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#ifndef __IR_CACHE_HPP__
+#define __IR_CACHE_HPP__
+
+#include "ir_protocol.hpp"
+
+/// @brief 名称空间 库名
+namespace OwO
+{
+/// @brief 名称空间 设备
+namespace device
+{
+/// @brief 结构体 IR 时序缓存键
+struct ir_cache_key_t
+{
+  ir_type  type;    /* 红外遥控品牌类型 */
+  uint8_t  length;  /* 指令长度 */
+  uint32_t carrier; /* 载波设置(频率等, 0为软件载波) */
+  uint32_t hash;    /* 指令数据散列值 */
+};
+
+/// @brief 类 IR 时序缓存 -- 已编码时序的最近最少使用缓存, 存储于固定内存块池 (不依赖硬件, 调用者负责互斥)
+class IR_Cache
+{
+public:
+  /// @brief 缓存条目数量
+  static constexpr uint8_t  ENTRY_COUNT  = 16;
+  /// @brief 内存块数量 (位图为64位)
+  static constexpr uint8_t  BLOCK_COUNT  = 64;
+  /// @brief 每个内存块的脉冲数量
+  static constexpr uint16_t BLOCK_PULSES = 32;
+  /// @brief 可缓存的最大指令长度
+  static constexpr uint8_t  MAX_PAYLOAD  = 32;
+
+private:
+  /// @brief 结构体 IR 时序缓存条目
+  struct entry_t
+  {
+    ir_cache_key_t key;                  /* 缓存键 */
+    uint8_t        payload[MAX_PAYLOAD]; /* 指令数据(校验散列冲突) */
+    uint32_t       stamp;                /* 最近使用时刻(访问序号) */
+    uint16_t       size;                 /* 脉冲数量 */
+    uint8_t        first;                /* 起始内存块 */
+    uint8_t        blocks;               /* 内存块数量(0为空闲条目) */
+    uint8_t        users;                /* 使用者数量(非0时不可淘汰) */
+    bool           valid;                /* 编码完成 */
+  };
+
+  /// @brief 内存块池
+  ir_pulse_t m_arena[BLOCK_COUNT * BLOCK_PULSES];
+  /// @brief 缓存条目
+  entry_t    m_entries[ENTRY_COUNT];
+  /// @brief 内存块占用位图
+  uint64_t   m_used;
+  /// @brief 访问序号
+  uint32_t   m_stamp;
+  /// @brief 命中次数
+  uint32_t   m_hits;
+  /// @brief 未命中次数
+  uint32_t   m_misses;
+
+  static uint64_t m_run_mask(uint8_t first, uint8_t blocks);
+  int             m_find_run(uint8_t blocks) const;
+  bool            m_evict();
+  void            m_free(uint8_t index);
+
+public:
+  IR_Cache() : m_arena {}, m_entries {}, m_used(0), m_stamp(0), m_hits(0), m_misses(0) {}
+
+  /**
+   * @brief IR 时序缓存 生成缓存键
+   *
+   * @param  type     红外遥控品牌类型
+   * @param  data     指令数据
+   * @param  length   指令长度
+   * @param  carrier  载波设置
+   * @return ir_cache_key_t 缓存键
+   */
+  static ir_cache_key_t make_key(ir_type type, const uint8_t* data, uint8_t length, uint32_t carrier);
+
+  /**
+   * @brief IR 时序缓存 查找 (命中时使用者数量加1, 需调用 release 释放)
+   *
+   * @param  key   缓存键
+   * @param  data  指令数据
+   * @return int   条目下标，未命中返回-1
+   */
+  int find(const ir_cache_key_t& key, const uint8_t* data);
+
+  /**
+   * @brief IR 时序缓存 预留条目 (按需淘汰最近最少使用的条目, 编码完成后调用 commit 或 discard)
+   *
+   * @param  key       缓存键
+   * @param  data      指令数据
+   * @param  capacity  预留脉冲数量
+   * @return int       条目下标(使用者数量为1)，指令过长或内存不足返回-1
+   */
+  int reserve(const ir_cache_key_t& key, const uint8_t* data, uint16_t capacity);
+
+  /**
+   * @brief IR 时序缓存 编码完成 (释放多余的内存块)
+   *
+   * @param index 条目下标
+   * @param size  脉冲数量
+   */
+  void commit(uint8_t index, uint16_t size);
+
+  /**
+   * @brief IR 时序缓存 放弃预留的条目
+   *
+   * @param index 条目下标
+   */
+  void discard(uint8_t index);
+
+  /**
+   * @brief IR 时序缓存 释放条目 (使用者数量减1)
+   *
+   * @param index 条目下标
+   */
+  void release(uint8_t index);
+
+  /**
+   * @brief IR 时序缓存 清空 (仅清除未使用的条目)
+   *
+   */
+  void clear();
+
+  /**
+   * @brief IR 时序缓存 获取条目脉冲缓存区
+   *
+   * @param  index        条目下标
+   * @return ir_pulse_t*  脉冲缓存区
+   */
+  ir_pulse_t* data(uint8_t index)
+  {
+    return &m_arena[m_entries[index].first * BLOCK_PULSES];
+  }
+
+  /**
+   * @brief IR 时序缓存 获取条目脉冲数量
+   *
+   * @param  index     条目下标
+   * @return uint16_t  脉冲数量
+   */
+  uint16_t size(uint8_t index) const
+  {
+    return m_entries[index].size;
+  }
+
+  /**
+   * @brief IR 时序缓存 获取条目缓存区容量
+   *
+   * @param  index     条目下标
+   * @return uint16_t  脉冲数量
+   */
+  uint16_t capacity(uint8_t index) const
+  {
+    return static_cast<uint16_t>(m_entries[index].blocks * BLOCK_PULSES);
+  }
+
+  /**
+   * @brief IR 时序缓存 获取命中次数
+   *
+   * @return uint32_t 命中次数
+   */
+  uint32_t hits() const
+  {
+    return m_hits;
+  }
+
+  /**
+   * @brief IR 时序缓存 获取未命中次数
+   *
+   * @return uint32_t 未命中次数
+   */
+  uint32_t misses() const
+  {
+    return m_misses;
+  }
+};
+} /* namespace device */
+} /* namespace OwO */
+
+#endif /* __IR_CACHE_HPP__ */
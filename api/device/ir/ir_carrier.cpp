@@ -0,0 +1,359 @@
+/**
+ * @file      ir_carrier.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for IR device hardware carrier (红外遥控 硬件载波)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "ir_carrier.hpp"
+#include "atomic.hpp"
+
+using namespace OwO;
+using namespace device;
+using namespace system;
+using namespace kernel;
+
+/// @brief IR 硬件载波 共享实例 (TIM1, TIM8)
+IR_Carrier* IR_Carrier::s_carriers[2] = { nullptr, nullptr };
+
+/**
+ * @brief (静态内联) IR 硬件载波 定时器编号转换为共享实例下标
+ *
+ * @param  timer_num  定时器编号
+ * @return int        共享实例下标，不支持返回-1
+ */
+static inline int sl_carrier_index(uint8_t timer_num)
+{
+  if (1 == timer_num)
+    return 0;
+  else if (8 == timer_num)
+    return 1;
+  else
+    return -1;
+}
+
+/**
+ * @brief IR 硬件载波 构造函数
+ *
+ * @param timer_num 定时器编号
+ */
+IR_Carrier::IR_Carrier(uint8_t timer_num) : m_done(1, 0)
+{
+  m_timer_num = timer_num;
+  m_users     = 0;
+  m_is_open   = false;
+  m_busy      = false;
+  m_notify    = nullptr;
+  m_arr       = 0;
+  m_compare   = 0;
+  m_frequency = 0;
+}
+
+/**
+ * @brief (私有函数) IR 硬件载波 初始化定时器 (4个通道均为PWM1模式, 比较值为0即无输出)
+ *
+ * @param  frequency  载波频率(Hz)
+ * @param  duty       载波占空比(%)
+ * @return bool       成功返回true，失败返回false
+ */
+bool IR_Carrier::open(uint32_t frequency, float duty)
+{
+  if (!configure(frequency, duty))
+    return false;
+
+  if (SUCESS != e_port_timer_oc_init(m_timer_num, 0, m_arr, 1, PORT_TIMER_PWM1, PORT_TIMER_UP, 1, true))
+    return false;
+
+  for (uint8_t channel = 1; channel <= 4; channel++)
+  {
+    if (SUCESS != e_port_timer_oc_channel_init(m_timer_num, channel, PORT_TIMER_PWM1, 0))
+    {
+      e_port_timer_deinit(m_timer_num);
+      return false;
+    }
+  }
+
+  if (SUCESS != e_port_timer_start(m_timer_num))
+  {
+    e_port_timer_deinit(m_timer_num);
+    return false;
+  }
+
+  m_is_open = true;
+  return true;
+}
+
+/**
+ * @brief (私有函数) IR 硬件载波 设置载波频率与占空比 (空闲时调用, 与当前设置相同时不重写定时器)
+ *
+ * @param  frequency  载波频率(Hz)
+ * @param  duty       载波占空比(%)
+ * @return bool       成功返回true，失败返回false
+ */
+bool IR_Carrier::configure(uint32_t frequency, float duty)
+{
+  uint32_t clock = ul_port_timer_get_clock(m_timer_num);
+  if (0 == clock || 0 == frequency || clock / frequency > 0x10000)
+    return false;
+
+  /* 不分频, 自动重装载值四舍五入 (36MHz / 38kHz -> 947个计数) */
+  uint16_t arr     = static_cast<uint16_t>((clock + frequency / 2) / frequency - 1);
+  uint16_t compare = static_cast<uint16_t>((arr + 1) * duty / 100.0f + 0.5f);
+  if (m_is_open && arr == m_arr && compare == m_compare)
+    return true;
+
+  /* 门控关闭期间修改, 下一次更新事件生效 */
+  if (m_is_open && SUCESS != e_port_timer_set_autoreload(m_timer_num, arr))
+    return false;
+
+  m_arr       = arr;
+  m_compare   = compare;
+  m_frequency = (clock + (arr + 1) / 2) / (arr + 1); /* 实际频率四舍五入, 供周期数换算 */
+  return true;
+}
+
+/**
+ * @brief (私有函数) IR 硬件载波 写入包络步骤至预装载寄存器 (下一次更新事件生效)
+ *
+ * @param step 包络步骤
+ */
+void IR_Carrier::load(const ir_envelope_step_t& step)
+{
+  e_port_timer_set_repetition(m_timer_num, static_cast<uint8_t>(step.rcr));
+  for (uint8_t channel = 1; channel <= 4; channel++)
+    e_port_timer_set_compare(m_timer_num, channel, step.ccr[channel - 1]);
+}
+
+/**
+ * @brief (静态) IR 硬件载波 DMA传输完成回调入口 (中断上下文, 此时帧已输出完成)
+ *
+ * @param arg IR 硬件载波实例
+ */
+void IR_Carrier::done_entry(void* arg)
+{
+  IR_Carrier* carrier = static_cast<IR_Carrier*>(arg);
+
+  carrier->m_done.release();
+  if (carrier->m_notify)
+    carrier->m_notify->release();
+}
+
+/**
+ * @brief IR 硬件载波 查询引脚对应的定时器通道
+ *
+ * @param  port       端口编号
+ * @param  pin        引脚编号
+ * @param  timer_num  定时器编号(输出)
+ * @param  channel    定时器通道(输出)
+ * @return bool       引脚支持硬件载波返回true
+ */
+bool IR_Carrier::lookup(Gpio::Port port, uint8_t pin, uint8_t& timer_num, uint8_t& channel)
+{
+  /* PA8~PA11: TIM1_CH1~CH4 */
+  if (Gpio::PA == port && 8 <= pin && 11 >= pin)
+  {
+    timer_num = 1;
+    channel   = pin - 7;
+    return true;
+  }
+
+  /* PC6~PC9: TIM8_CH1~CH4 */
+  if (Gpio::PC == port && 6 <= pin && 9 >= pin)
+  {
+    timer_num = 8;
+    channel   = pin - 5;
+    return true;
+  }
+
+  return false;
+}
+
+/**
+ * @brief IR 硬件载波 获取共享实例(首次使用时初始化定时器)
+ *
+ * @param  timer_num    定时器编号(1或8)
+ * @return IR_Carrier*  共享实例，失败返回nullptr
+ */
+IR_Carrier* IR_Carrier::attach(uint8_t timer_num)
+{
+  int index = sl_carrier_index(timer_num);
+  if (index < 0)
+    return nullptr;
+
+  if (nullptr == s_carriers[index])
+  {
+    IR_Carrier* carrier = new IR_Carrier(timer_num);
+    if (!carrier->open(DEFAULT_FREQUENCY, DEFAULT_DUTY))
+    {
+      delete carrier;
+      return nullptr;
+    }
+    s_carriers[index] = carrier;
+  }
+
+  s_carriers[index]->m_users++;
+  return s_carriers[index];
+}
+
+/**
+ * @brief IR 硬件载波 释放共享实例(最后一个使用者释放时关闭定时器)
+ *
+ * @param carrier 共享实例
+ */
+void IR_Carrier::detach(IR_Carrier* carrier)
+{
+  if (nullptr == carrier)
+    return;
+
+  if (0 != --carrier->m_users)
+    return;
+
+  int index = sl_carrier_index(carrier->m_timer_num);
+  if (index >= 0)
+    s_carriers[index] = nullptr;
+  delete carrier;
+}
+
+/**
+ * @brief IR 硬件载波 开始发送多通道脉冲序列(非阻塞, 各通道同时开始, 整帧由DMA播放)
+ *
+ * @param  pulses   各通道脉冲序列(下标0~3对应通道1~4, 不发送的通道为nullptr)
+ * @param  sizes    各通道脉冲数量
+ * @param  notify     发送完成时额外释放的信号量(可为nullptr, 中断上下文释放)
+ * @param  frequency  载波频率(Hz)
+ * @param  duty       载波占空比(%)
+ * @return bool       开始发送返回true，载波忙, 合并包络超出 ENVELOPE_CAPACITY 或失败返回false
+ */
+bool IR_Carrier::start(const ir_pulse_t* const pulses[IR_Envelope::CHANNEL_COUNT], const uint16_t sizes[IR_Envelope::CHANNEL_COUNT], Semaphore* notify, uint32_t frequency, float duty)
+{
+  {
+    Atomic_Guard atomic;
+    if (m_busy)
+      return false;
+    m_busy = true;
+  }
+
+  /* 占用载波后再切换频率, 各通道共用同一定时器 */
+  if (!configure(frequency, duty))
+  {
+    m_busy = false;
+    return false;
+  }
+
+  /* 包络编译至预先分配的包络缓存区 */
+  uint32_t count = IR_Envelope::build(pulses, sizes, m_frequency, m_compare, m_steps, ENVELOPE_CAPACITY);
+  if (0 == count)
+  {
+    m_busy = false;
+    return false;
+  }
+
+  bool ret = false;
+  m_notify = notify;
+  m_done.try_acquire();
+  {
+    /* 首个步骤立即生效, 第二个步骤进入预装载, 其余步骤由更新事件DMA依次写入 */
+    Atomic_Guard atomic;
+    load(m_steps[0]);
+    e_port_timer_generate_update(m_timer_num);
+    load(m_steps[1]);
+
+    port_timer_callback_t cb_t;
+    cb_t.function = done_entry;
+    cb_t.arg      = static_cast<void*>(this);
+    ret           = (SUCESS == e_port_timer_dma_burst_start(m_timer_num, PORT_TIMER_DMA_BASE_RCR, IR_Envelope::BURST_LENGTH, &m_steps[2].rcr, static_cast<uint16_t>(count - 2), &cb_t));
+  }
+
+  if (!ret)
+    abort();
+  return ret;
+}
+
+/**
+ * @brief IR 硬件载波 等待发送完成(完成后释放载波)
+ *
+ * @param  timeout  等待时间(ms), 0为仅查询
+ * @return bool     发送完成返回true，仍在发送返回false
+ */
+bool IR_Carrier::finish(uint32_t timeout)
+{
+  if (!m_busy)
+    return true;
+
+  if (!m_done.try_acquire(timeout))
+    return false;
+
+  m_notify = nullptr;
+  m_busy   = false;
+  return true;
+}
+
+/**
+ * @brief IR 硬件载波 终止发送(关闭门控并释放载波)
+ *
+ */
+void IR_Carrier::abort()
+{
+  e_port_timer_dma_burst_stop(m_timer_num);
+  load(ir_envelope_step_t {});
+  e_port_timer_generate_update(m_timer_num);
+
+  m_notify = nullptr;
+  m_busy   = false;
+}
+
+/**
+ * @brief IR 硬件载波 发送脉冲序列(阻塞至发送完成, 整帧由DMA播放, 仅在完成时产生一次中断)
+ *
+ * @param  channel    定时器通道(1~4)
+ * @param  pulses     脉冲序列
+ * @param  size       脉冲数量
+ * @param  frequency  载波频率(Hz)
+ * @param  duty       载波占空比(%)
+ * @return bool       成功返回true，失败返回false
+ */
+bool IR_Carrier::transmit(uint8_t channel, const ir_pulse_t* pulses, uint16_t size, uint32_t frequency, float duty)
+{
+  if (channel < 1 || channel > IR_Envelope::CHANNEL_COUNT || nullptr == pulses)
+    return false;
+
+  if (0 == size)
+    return true;
+
+  const ir_pulse_t* channels[IR_Envelope::CHANNEL_COUNT] = { nullptr, nullptr, nullptr, nullptr };
+  uint16_t          sizes[IR_Envelope::CHANNEL_COUNT]    = { 0, 0, 0, 0 };
+  channels[channel - 1]                                  = pulses;
+  sizes[channel - 1]                                     = size;
+
+  /* 超时时间: 帧时长 + 100ms 余量 */
+  uint32_t timeout = 100;
+  for (uint16_t i = 0; i < size; i++)
+    timeout += (pulses[i].mark + pulses[i].space) / 1000 + 1;
+
+  Mutex_Guard locker(m_mutex);
+
+  if (!start(channels, sizes, nullptr, frequency, duty))
+    return false;
+
+  if (finish(timeout))
+    return true;
+
+  abort();
+  return false;
+}
+
+/**
+ * @brief IR 硬件载波 析构函数
+ */
+IR_Carrier::~IR_Carrier()
+{
+  if (!m_is_open)
+    return;
+
+  if (m_busy)
+    abort();
+  e_port_timer_deinit(m_timer_num);
+}
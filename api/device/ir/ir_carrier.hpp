@@ -0,0 +1,178 @@
+/**
+ * @file      ir_carrier.hpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for IR device hardware carrier (红外遥控 硬件载波)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#ifndef __IR_CARRIER_HPP__
+#define __IR_CARRIER_HPP__
+
+#include "virtual_gpio.hpp"
+#include "port_tim.h"
+#include "mutex.hpp"
+#include "semaphore.hpp"
+#include "ir_envelope.hpp"
+
+/// @brief 名称空间 库名
+namespace OwO
+{
+/// @brief 名称空间 设备
+namespace device
+{
+/// @brief 类 IR 硬件载波 -- 由高级定时器(TIM1/TIM8)PWM通道产生载波, 更新事件DMA按包络门控输出
+class IR_Carrier
+{
+  O_MEMORY
+  NO_COPY(IR_Carrier)
+  NO_MOVE(IR_Carrier)
+
+public:
+  /// @brief 默认载波频率(Hz)
+  static constexpr uint32_t DEFAULT_FREQUENCY = 38000;
+  /// @brief 默认载波占空比(%)
+  static constexpr float    DEFAULT_DUTY      = 33.3f;
+  /// @brief 包络缓存区容量(步骤数) -- 一帧满容量时序(标记与空闲各一个步骤)及末尾空闲步骤
+  static constexpr uint32_t ENVELOPE_CAPACITY = 2 * IR_Timeline::MAX_PULSES + IR_Envelope::TAIL_STEPS;
+
+  static_assert(ENVELOPE_CAPACITY <= IR_Envelope::MAX_STEPS, "envelope arena exceeds one DMA transfer");
+
+private:
+  /// @brief IR 硬件载波 共享实例 (TIM1, TIM8)
+  static IR_Carrier*            s_carriers[2];
+
+  /// @brief IR 发送互斥锁 (同一定时器的通道依次发送)
+  system::kernel::Mutex         m_mutex;
+  /// @brief IR 发送完成信号量
+  system::kernel::Semaphore     m_done;
+  /// @brief 定时器编号
+  uint8_t                       m_timer_num;
+  /// @brief 引用计数
+  uint8_t                       m_users;
+  /// @brief 定时器已初始化
+  bool                          m_is_open;
+  /// @brief 正在发送
+  volatile bool                 m_busy;
+  /// @brief 包络缓存区 (预先分配, 各次发送共用)
+  ir_envelope_step_t            m_steps[ENVELOPE_CAPACITY];
+  /// @brief 发送完成通知信号量
+  system::kernel::Semaphore*    m_notify;
+  /// @brief 定时器自动重装载值
+  uint16_t                      m_arr;
+  /// @brief 载波标记比较值
+  uint16_t                      m_compare;
+  /// @brief 实际载波频率(Hz)
+  uint32_t                      m_frequency;
+
+  explicit IR_Carrier(uint8_t timer_num);
+
+  bool open(uint32_t frequency, float duty);
+  bool configure(uint32_t frequency, float duty);
+  void load(const ir_envelope_step_t& step);
+
+  static void done_entry(void* arg);
+
+public:
+  /**
+   * @brief IR 硬件载波 查询引脚对应的定时器通道
+   *
+   * @param  port       端口编号
+   * @param  pin        引脚编号
+   * @param  timer_num  定时器编号(输出)
+   * @param  channel    定时器通道(输出)
+   * @return bool       引脚支持硬件载波返回true
+   */
+  static bool lookup(Gpio::Port port, uint8_t pin, uint8_t& timer_num, uint8_t& channel);
+
+  /**
+   * @brief IR 硬件载波 获取共享实例(首次使用时初始化定时器)
+   *
+   * @param  timer_num    定时器编号(1或8)
+   * @return IR_Carrier*  共享实例，失败返回nullptr
+   */
+  static IR_Carrier* attach(uint8_t timer_num);
+
+  /**
+   * @brief IR 硬件载波 释放共享实例(最后一个使用者释放时关闭定时器)
+   *
+   * @param carrier 共享实例
+   */
+  static void detach(IR_Carrier* carrier);
+
+  /**
+   * @brief IR 硬件载波 获取定时器编号
+   *
+   * @return uint8_t 定时器编号
+   */
+  uint8_t timer_num() const
+  {
+    return m_timer_num;
+  }
+
+  /**
+   * @brief IR 硬件载波 获取实际载波频率
+   *
+   * @return uint32_t 载波频率(Hz)
+   */
+  uint32_t frequency() const
+  {
+    return m_frequency;
+  }
+
+  /**
+   * @brief IR 硬件载波 是否正在发送
+   *
+   * @return bool 正在发送返回true
+   */
+  bool is_busy() const
+  {
+    return m_busy;
+  }
+
+  /**
+   * @brief IR 硬件载波 开始发送多通道脉冲序列(非阻塞, 各通道同时开始, 整帧由DMA播放)
+   *
+   * @param  pulses   各通道脉冲序列(下标0~3对应通道1~4, 不发送的通道为nullptr)
+   * @param  sizes    各通道脉冲数量
+   * @param  notify     发送完成时额外释放的信号量(可为nullptr, 中断上下文释放)
+   * @param  frequency  载波频率(Hz)
+   * @param  duty       载波占空比(%)
+   * @return bool       开始发送返回true，载波忙, 合并包络超出 ENVELOPE_CAPACITY 或失败返回false
+   */
+  bool start(const ir_pulse_t* const pulses[IR_Envelope::CHANNEL_COUNT], const uint16_t sizes[IR_Envelope::CHANNEL_COUNT], system::kernel::Semaphore* notify = nullptr, uint32_t frequency = DEFAULT_FREQUENCY, float duty = DEFAULT_DUTY);
+
+  /**
+   * @brief IR 硬件载波 等待发送完成(完成后释放载波)
+   *
+   * @param  timeout  等待时间(ms), 0为仅查询
+   * @return bool     发送完成返回true，仍在发送返回false
+   */
+  bool finish(uint32_t timeout = 0);
+
+  /**
+   * @brief IR 硬件载波 终止发送(关闭门控并释放载波)
+   *
+   */
+  void abort();
+
+  /**
+   * @brief IR 硬件载波 发送脉冲序列(阻塞至发送完成, 整帧由DMA播放, 仅在完成时产生一次中断)
+   *
+   * @param  channel    定时器通道(1~4)
+   * @param  pulses     脉冲序列
+   * @param  size       脉冲数量
+   * @param  frequency  载波频率(Hz)
+   * @param  duty       载波占空比(%)
+   * @return bool       成功返回true，失败返回false
+   */
+  bool transmit(uint8_t channel, const ir_pulse_t* pulses, uint16_t size, uint32_t frequency = DEFAULT_FREQUENCY, float duty = DEFAULT_DUTY);
+
+  ~IR_Carrier();
+};
+} /* namespace device */
+} /* namespace OwO */
+
+#endif /* __IR_CARRIER_HPP__ */
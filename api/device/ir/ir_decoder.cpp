@@ -0,0 +1,191 @@
+/**
+ * @file      ir_decoder.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for IR device protocol decoder (红外遥控 协议解码与发送校验)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "ir_decoder.hpp"
+#include <cstring>
+
+using namespace OwO;
+using namespace device;
+
+/**
+ * @brief (静态内联) IR 协议解码 时长是否在容差范围内
+ *
+ * @param  actual    接收时长(us)
+ * @param  expected  协议时长(us)
+ * @return bool      在容差范围内返回true
+ */
+static inline bool sl_match(uint32_t actual, uint32_t expected)
+{
+  uint32_t delta = expected * IR_Decoder::TOLERANCE / 100;
+  if (delta < IR_Decoder::MIN_DELTA)
+    delta = IR_Decoder::MIN_DELTA;
+  return (actual > expected ? actual - expected : expected - actual) <= delta;
+}
+
+/**
+ * @brief (静态内联) IR 协议解码 脉冲是否与协议脉冲一致
+ *
+ * @param  actual    接收脉冲
+ * @param  expected  协议脉冲
+ * @param  space     比较空闲 (帧末脉冲的空闲为接收结束前的静默, 不比较)
+ * @return bool      一致返回true
+ */
+static inline bool sl_match(const ir_pulse_t& actual, const ir_pulse_t& expected, bool space = true)
+{
+  return sl_match(actual.mark, expected.mark) && (!space || sl_match(actual.space, expected.space));
+}
+
+/**
+ * @brief (静态内联) IR 协议解码 识别数据符号 (距离最近且在容差范围内的符号)
+ *
+ * @param  protocol  协议描述
+ * @param  pulse     接收脉冲
+ * @return int       符号值，无法识别返回-1
+ */
+static inline int sl_symbol(const ir_protocol_t& protocol, const ir_pulse_t& pulse)
+{
+  int      symbol   = -1;
+  uint32_t distance = 0xFFFFFFFF;
+  for (uint8_t i = 0; i < (1U << protocol.symbol_bits); i++)
+  {
+    const ir_pulse_t& expected = protocol.symbols[i];
+    uint32_t          d        = static_cast<uint32_t>((pulse.mark > expected.mark) ? pulse.mark - expected.mark : expected.mark - pulse.mark) + static_cast<uint32_t>((pulse.space > expected.space) ? pulse.space - expected.space : expected.space - pulse.space);
+    if (d < distance)
+    {
+      distance = d;
+      symbol   = i;
+    }
+  }
+
+  return (symbol >= 0 && sl_match(pulse, protocol.symbols[symbol])) ? symbol : -1;
+}
+
+/**
+ * @brief IR 协议解码 解码一帧 (跳过头码之前的脉冲, 忽略尾码之后的脉冲)
+ *
+ * @param  protocol  协议描述
+ * @param  length    指令长度
+ * @param  pulses    接收到的脉冲序列
+ * @param  count     脉冲数量
+ * @param  data      指令数据(输出, length 字节)
+ * @param  known     已解码位掩码(输出, length 字节; 协议未发送的位为0)
+ * @return ir_decode_error 解码结果
+ */
+ir_decode_error IR_Decoder::decode(const ir_protocol_t& protocol, uint8_t length, const ir_pulse_t* pulses, uint16_t count, uint8_t* data, uint8_t* known)
+{
+  const ir_layout_t* layout = IR_Protocol::find(protocol, length);
+  if (nullptr == layout || nullptr == data || nullptr == known)
+    return ir_decode_error::LAYOUT;
+
+  memset(data, 0, length);
+  memset(known, 0, length);
+
+  /* 接收可能在头码前捕获到干扰脉冲: 以首个与头码一致的脉冲为帧开始 */
+  uint16_t index = 0;
+  while (index < count && !sl_match(pulses[index], protocol.leader))
+    index++;
+  if (index >= count)
+    return ir_decode_error::LEADER;
+
+  const uint8_t width = protocol.symbol_bits;
+  const uint8_t mask  = static_cast<uint8_t>((1U << width) - 1);
+
+  /* 按编码顺序逐个比对: 每次 push 对应一个脉冲 (各协议的连接码与尾码标记均非0, 不与前一脉冲合并) */
+  for (uint8_t segment = 0; segment < layout->repeat; segment++)
+  {
+    const uint8_t base = static_cast<uint8_t>(segment * layout->stride);
+
+    for (uint8_t op = 0; op < layout->op_count; op++)
+    {
+      const ir_op_t& code = layout->ops[op];
+      switch (code.code)
+      {
+        case ir_op_code::LEADER :
+          if (index >= count)
+            return ir_decode_error::LENGTH;
+          if (!sl_match(pulses[index++], protocol.leader))
+            return ir_decode_error::LEADER;
+          break;
+        case ir_op_code::GAP :
+          if (index >= count)
+            return ir_decode_error::LENGTH;
+          if (!sl_match(pulses[index++], protocol.gaps[code.offset]))
+            return ir_decode_error::GAP;
+          break;
+        case ir_op_code::DATA :
+          for (uint8_t i = 0; i < code.bytes; i++)
+          {
+            const uint8_t byte = static_cast<uint8_t>(base + code.offset + i);
+            for (uint8_t bit = 0; bit < code.bits; bit += width)
+            {
+              if (index >= count)
+                return ir_decode_error::LENGTH;
+
+              int symbol = sl_symbol(protocol, pulses[index++]);
+              if (symbol < 0)
+                return ir_decode_error::SYMBOL;
+
+              const uint8_t shift  = protocol.msb_first ? static_cast<uint8_t>(8 - width - bit) : bit;
+              data[byte]          |= static_cast<uint8_t>(symbol << shift);
+              known[byte]         |= static_cast<uint8_t>(mask << shift);
+            }
+          }
+          break;
+        default :
+          return ir_decode_error::LAYOUT;
+      }
+    }
+
+    if (segment + 1 < layout->repeat)
+    {
+      if (index >= count)
+        return ir_decode_error::LENGTH;
+      if (!sl_match(pulses[index++], protocol.gaps[layout->separator]))
+        return ir_decode_error::GAP;
+    }
+  }
+
+  if (index >= count)
+    return ir_decode_error::LENGTH;
+
+  return sl_match(pulses[index], protocol.trailer, false) ? ir_decode_error::NONE : ir_decode_error::TRAILER;
+}
+
+/**
+ * @brief IR 协议解码 校验发送 (解码后与请求数据按已解码位比较)
+ *
+ * @param  protocol  协议描述
+ * @param  expected  请求的指令数据
+ * @param  length    指令长度
+ * @param  pulses    接收到的脉冲序列
+ * @param  count     脉冲数量
+ * @param  errors    不一致的位数(输出)
+ * @return ir_decode_error 校验结果, 指令长度超出 MAX_LENGTH 返回 LAYOUT
+ */
+ir_decode_error IR_Decoder::verify(const ir_protocol_t& protocol, const uint8_t* expected, uint8_t length, const ir_pulse_t* pulses, uint16_t count, uint16_t& errors)
+{
+  errors = 0;
+  if (nullptr == expected || length > MAX_LENGTH)
+    return ir_decode_error::LAYOUT;
+
+  uint8_t         data[MAX_LENGTH];
+  uint8_t         known[MAX_LENGTH];
+  ir_decode_error error = decode(protocol, length, pulses, count, data, known);
+  if (ir_decode_error::NONE != error)
+    return error;
+
+  for (uint8_t i = 0; i < length; i++)
+  {
+    for (uint8_t diff = static_cast<uint8_t>((data[i] ^ expected[i]) & known[i]); 0 != diff; diff &= static_cast<uint8_t>(diff - 1))
+      errors++;
+  }
+
+  return (0 == errors) ? ir_decode_error::NONE : ir_decode_error::MISMATCH;
+}
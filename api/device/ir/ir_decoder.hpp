@@ -0,0 +1,75 @@
+/**
+ * @file      ir_decoder.hpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for IR device protocol decoder (红外遥控 协议解码与发送校验)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#ifndef __IR_DECODER_HPP__
+#define __IR_DECODER_HPP__
+
+#include "ir_protocol.hpp"
+
+/// @brief 名称空间 库名
+namespace OwO
+{
+/// @brief 名称空间 设备
+namespace device
+{
+/// @brief 枚举 IR 协议解码 结果
+enum class ir_decode_error : uint8_t
+{
+  NONE,     /* 解码成功 (校验: 数据一致) */
+  LAYOUT,   /* 指令长度不支持 */
+  LEADER,   /* 未找到头码 */
+  LENGTH,   /* 脉冲数量不足 */
+  SYMBOL,   /* 数据符号无法识别 */
+  GAP,      /* 连接码或段间分隔不符 */
+  TRAILER,  /* 尾码不符 */
+  MISMATCH, /* 解码数据与请求数据不符 */
+};
+
+/// @brief 类 IR 协议解码 -- 按 IR_Protocol 的协议描述将接收到的标记/空闲序列还原为指令数据, 与请求数据比较以校验发送 (不依赖硬件)
+class IR_Decoder
+{
+public:
+  /// @brief 时长相对容差(%)
+  static constexpr uint8_t  TOLERANCE  = 25;
+  /// @brief 时长最小容差(us) (解调接收头的标记展宽与空闲缩短, 以及学习解码聚类的量化)
+  static constexpr uint16_t MIN_DELTA  = 250;
+  /// @brief 校验的最大指令长度
+  static constexpr uint8_t  MAX_LENGTH = 32;
+
+  /**
+   * @brief IR 协议解码 解码一帧 (跳过头码之前的脉冲, 忽略尾码之后的脉冲)
+   *
+   * @param  protocol  协议描述
+   * @param  length    指令长度
+   * @param  pulses    接收到的脉冲序列
+   * @param  count     脉冲数量
+   * @param  data      指令数据(输出, length 字节)
+   * @param  known     已解码位掩码(输出, length 字节; 协议未发送的位为0)
+   * @return ir_decode_error 解码结果
+   */
+  static ir_decode_error decode(const ir_protocol_t& protocol, uint8_t length, const ir_pulse_t* pulses, uint16_t count, uint8_t* data, uint8_t* known);
+
+  /**
+   * @brief IR 协议解码 校验发送 (解码后与请求数据按已解码位比较)
+   *
+   * @param  protocol  协议描述
+   * @param  expected  请求的指令数据
+   * @param  length    指令长度
+   * @param  pulses    接收到的脉冲序列
+   * @param  count     脉冲数量
+   * @param  errors    不一致的位数(输出)
+   * @return ir_decode_error 校验结果, 指令长度超出 MAX_LENGTH 返回 LAYOUT
+   */
+  static ir_decode_error verify(const ir_protocol_t& protocol, const uint8_t* expected, uint8_t length, const ir_pulse_t* pulses, uint16_t count, uint16_t& errors);
+};
+} /* namespace device */
+} /* namespace OwO */
+
+#endif /* __IR_DECODER_HPP__ */
@@ -0,0 +1,183 @@
+/**
+ * @file      ir_envelope.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for IR device carrier envelope (红外遥控 载波包络)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "ir_envelope.hpp"
+
+using namespace OwO;
+using namespace device;
+
+/**
+ * @brief (静态内联) 饱和截断为16位
+ *
+ * @param  value    输入值
+ * @return uint16_t 截断值
+ */
+static inline uint16_t sl_saturate(uint32_t value)
+{
+  return (value > 0xFFFF) ? 0xFFFF : static_cast<uint16_t>(value);
+}
+
+/**
+ * @brief IR 载波包络 计算多通道合并所需步骤数量
+ *
+ * @param  pulses     各通道脉冲序列(不发送的通道为nullptr)
+ * @param  sizes      各通道脉冲数量
+ * @param  frequency  载波频率(Hz)
+ * @return uint32_t   步骤数量(包含末尾空闲步骤, 序列均为空时返回0)
+ */
+uint32_t IR_Envelope::count(const ir_pulse_t* const pulses[CHANNEL_COUNT], const uint16_t sizes[CHANNEL_COUNT], uint32_t frequency)
+{
+  IR_Gate_Merger merger;
+  uint32_t       cycles = 0;
+  uint8_t        marks  = 0;
+  uint32_t       number = 0;
+
+  merger.reset(pulses, sizes, CHANNEL_COUNT, frequency);
+  while (merger.next(cycles, marks))
+    number++;
+
+  return (0 != number) ? number + TAIL_STEPS : 0;
+}
+
+/**
+ * @brief IR 载波包络 生成多通道合并包络 (各通道同时开始, 步骤边界取各通道边界的并集)
+ *
+ * @param  pulses     各通道脉冲序列(不发送的通道为nullptr)
+ * @param  sizes      各通道脉冲数量
+ * @param  frequency  载波频率(Hz)
+ * @param  compare    载波标记比较值
+ * @param  steps      包络缓存区
+ * @param  capacity   包络缓存区容量
+ * @return uint32_t   步骤数量(包含末尾空闲步骤), 失败返回0
+ */
+uint32_t IR_Envelope::build(const ir_pulse_t* const pulses[CHANNEL_COUNT], const uint16_t sizes[CHANNEL_COUNT], uint32_t frequency, uint16_t compare, ir_envelope_step_t* steps, uint32_t capacity)
+{
+  if (nullptr == steps)
+    return 0;
+
+  IR_Gate_Merger merger;
+  uint32_t       cycles = 0;
+  uint8_t        marks  = 0;
+  uint32_t       number = 0;
+
+  merger.reset(pulses, sizes, CHANNEL_COUNT, frequency);
+  while (merger.next(cycles, marks))
+  {
+    if (number + TAIL_STEPS >= capacity)
+      return 0;
+
+    steps[number].rcr = static_cast<uint16_t>(cycles - 1);
+    for (uint8_t i = 0; i < CHANNEL_COUNT; i++)
+      steps[number].ccr[i] = (marks & (1U << i)) ? compare : 0;
+    number++;
+  }
+
+  if (0 == number)
+    return 0;
+
+  /* 末尾空闲步骤: 首个空闲步骤生效时(DMA写入最后一个步骤)帧已结束 */
+  for (uint16_t i = 0; i < TAIL_STEPS; i++)
+    steps[number++] = ir_envelope_step_t {};
+
+  return number;
+}
+
+/**
+ * @brief IR 载波包络 计算所需步骤数量
+ *
+ * @param  pulses     脉冲序列
+ * @param  size       脉冲数量
+ * @param  frequency  载波频率(Hz)
+ * @return uint32_t   步骤数量(包含末尾空闲步骤, 序列为空时返回0)
+ */
+uint32_t IR_Envelope::count(const ir_pulse_t* pulses, uint16_t size, uint32_t frequency)
+{
+  const ir_pulse_t* channels[CHANNEL_COUNT] = { pulses, nullptr, nullptr, nullptr };
+  const uint16_t    sizes[CHANNEL_COUNT]    = { size, 0, 0, 0 };
+  return count(channels, sizes, frequency);
+}
+
+/**
+ * @brief IR 载波包络 生成单通道包络
+ *
+ * @param  pulses     脉冲序列
+ * @param  size       脉冲数量
+ * @param  frequency  载波频率(Hz)
+ * @param  channel    定时器通道(1~4)
+ * @param  compare    载波标记比较值
+ * @param  steps      包络缓存区
+ * @param  capacity   包络缓存区容量
+ * @return uint32_t   步骤数量(包含末尾空闲步骤), 失败返回0
+ */
+uint32_t IR_Envelope::build(const ir_pulse_t* pulses, uint16_t size, uint32_t frequency, uint8_t channel, uint16_t compare, ir_envelope_step_t* steps, uint32_t capacity)
+{
+  if (channel < 1 || channel > CHANNEL_COUNT)
+    return 0;
+
+  const ir_pulse_t* channels[CHANNEL_COUNT] = { nullptr, nullptr, nullptr, nullptr };
+  uint16_t          sizes[CHANNEL_COUNT]    = { 0, 0, 0, 0 };
+  channels[channel - 1]                     = pulses;
+  sizes[channel - 1]                        = size;
+  return build(channels, sizes, frequency, compare, steps, capacity);
+}
+
+/**
+ * @brief IR 载波包络 主机模型: 按定时器行为还原通道输出的标记/空闲序列 (不含末尾空闲步骤)
+ *
+ * @param  steps      包络
+ * @param  size       步骤数量(包含末尾空闲步骤)
+ * @param  frequency  载波频率(Hz)
+ * @param  channel    定时器通道(1~4)
+ * @param  output     输出脉冲序列(量化到载波周期)
+ * @param  capacity   输出缓存区容量
+ * @return uint16_t   输出脉冲数量
+ */
+uint16_t IR_Envelope::decode(const ir_envelope_step_t* steps, uint32_t size, uint32_t frequency, uint8_t channel, ir_pulse_t* output, uint16_t capacity)
+{
+  uint32_t mark_cycles  = 0;
+  uint32_t space_cycles = 0;
+  uint16_t count        = 0;
+
+  if (channel < 1 || channel > 4 || size <= TAIL_STEPS)
+    return 0;
+
+  for (uint32_t i = 0; i < size - TAIL_STEPS; i++)
+  {
+    bool     mark   = (0 != steps[i].ccr[channel - 1]);
+    uint32_t cycles = steps[i].rcr + 1U;
+
+    /* 空闲之后重新出现标记: 上一脉冲结束 */
+    if (mark && 0 != space_cycles)
+    {
+      if (count >= capacity)
+        return count;
+
+      output[count].mark  = sl_saturate(IR_Gate_Sequencer::to_time(mark_cycles, frequency));
+      output[count].space = sl_saturate(IR_Gate_Sequencer::to_time(space_cycles, frequency));
+      count++;
+      mark_cycles  = 0;
+      space_cycles = 0;
+    }
+
+    if (mark)
+      mark_cycles += cycles;
+    else
+      space_cycles += cycles;
+  }
+
+  if ((0 != mark_cycles || 0 != space_cycles) && count < capacity)
+  {
+    output[count].mark  = sl_saturate(IR_Gate_Sequencer::to_time(mark_cycles, frequency));
+    output[count].space = sl_saturate(IR_Gate_Sequencer::to_time(space_cycles, frequency));
+    count++;
+  }
+
+  return count;
+}
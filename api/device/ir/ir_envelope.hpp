@@ -0,0 +1,107 @@
+/**
+ * @file      ir_envelope.hpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for IR device carrier envelope (红外遥控 载波包络)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#ifndef __IR_ENVELOPE_HPP__
+#define __IR_ENVELOPE_HPP__
+
+#include "ir_timeline.hpp"
+
+/// @brief 名称空间 库名
+namespace OwO
+{
+/// @brief 名称空间 设备
+namespace device
+{
+/// @brief 结构体 IR 载波包络步骤 (内存布局与高级定时器 RCR、CCR1~CCR4 的DMA突发传输顺序一致)
+struct ir_envelope_step_t
+{
+  uint16_t rcr;    /* 重复计数值(载波周期数 - 1) */
+  uint16_t ccr[4]; /* 通道1~4 比较值(0为无载波输出) */
+};
+
+/// @brief 类 IR 载波包络 -- 将脉冲序列编译为定时器更新事件DMA逐步写入的寄存器值 (不依赖硬件)
+class IR_Envelope
+{
+public:
+  /// @brief 每个步骤突发传输的寄存器数量 (RCR + CCR1~CCR4)
+  static constexpr uint8_t  BURST_LENGTH  = 5;
+  /// @brief 末尾空闲步骤数量 (DMA传输完成时刻与帧结束时刻对齐)
+  static constexpr uint16_t TAIL_STEPS    = 2;
+  /// @brief 最大步骤数量 (DMA单次传输数量为16位)
+  static constexpr uint32_t MAX_STEPS     = 0xFFFF / BURST_LENGTH;
+  /// @brief 定时器通道数量
+  static constexpr uint8_t  CHANNEL_COUNT = 4;
+
+  static_assert(sizeof(ir_envelope_step_t) == BURST_LENGTH * sizeof(uint16_t), "ir_envelope_step_t layout must match TIM DMA burst");
+
+  /**
+   * @brief IR 载波包络 计算多通道合并所需步骤数量
+   *
+   * @param  pulses     各通道脉冲序列(不发送的通道为nullptr)
+   * @param  sizes      各通道脉冲数量
+   * @param  frequency  载波频率(Hz)
+   * @return uint32_t   步骤数量(包含末尾空闲步骤, 序列均为空时返回0)
+   */
+  static uint32_t count(const ir_pulse_t* const pulses[CHANNEL_COUNT], const uint16_t sizes[CHANNEL_COUNT], uint32_t frequency);
+
+  /**
+   * @brief IR 载波包络 生成多通道合并包络 (各通道同时开始, 步骤边界取各通道边界的并集)
+   *
+   * @param  pulses     各通道脉冲序列(不发送的通道为nullptr)
+   * @param  sizes      各通道脉冲数量
+   * @param  frequency  载波频率(Hz)
+   * @param  compare    载波标记比较值
+   * @param  steps      包络缓存区
+   * @param  capacity   包络缓存区容量
+   * @return uint32_t   步骤数量(包含末尾空闲步骤), 失败返回0
+   */
+  static uint32_t build(const ir_pulse_t* const pulses[CHANNEL_COUNT], const uint16_t sizes[CHANNEL_COUNT], uint32_t frequency, uint16_t compare, ir_envelope_step_t* steps, uint32_t capacity);
+
+  /**
+   * @brief IR 载波包络 计算所需步骤数量
+   *
+   * @param  pulses     脉冲序列
+   * @param  size       脉冲数量
+   * @param  frequency  载波频率(Hz)
+   * @return uint32_t   步骤数量(包含末尾空闲步骤, 序列为空时返回0)
+   */
+  static uint32_t count(const ir_pulse_t* pulses, uint16_t size, uint32_t frequency);
+
+  /**
+   * @brief IR 载波包络 生成单通道包络
+   *
+   * @param  pulses     脉冲序列
+   * @param  size       脉冲数量
+   * @param  frequency  载波频率(Hz)
+   * @param  channel    定时器通道(1~4)
+   * @param  compare    载波标记比较值
+   * @param  steps      包络缓存区
+   * @param  capacity   包络缓存区容量
+   * @return uint32_t   步骤数量(包含末尾空闲步骤), 失败返回0
+   */
+  static uint32_t build(const ir_pulse_t* pulses, uint16_t size, uint32_t frequency, uint8_t channel, uint16_t compare, ir_envelope_step_t* steps, uint32_t capacity);
+
+  /**
+   * @brief IR 载波包络 主机模型: 按定时器行为还原通道输出的标记/空闲序列 (不含末尾空闲步骤)
+   *
+   * @param  steps      包络
+   * @param  size       步骤数量(包含末尾空闲步骤)
+   * @param  frequency  载波频率(Hz)
+   * @param  channel    定时器通道(1~4)
+   * @param  output     输出脉冲序列(量化到载波周期)
+   * @param  capacity   输出缓存区容量
+   * @return uint16_t   输出脉冲数量
+   */
+  static uint16_t decode(const ir_envelope_step_t* steps, uint32_t size, uint32_t frequency, uint8_t channel, ir_pulse_t* output, uint16_t capacity);
+};
+} /* namespace device */
+} /* namespace OwO */
+
+#endif /* __IR_ENVELOPE_HPP__ */
@@ -0,0 +1,251 @@
+/**
+ * @file      ir_learn.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for IR device learning decoder (红外遥控 学习解码)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "ir_learn.hpp"
+
+using namespace OwO;
+using namespace device;
+
+/**
+ * @brief (静态内联) 饱和截断为16位
+ *
+ * @param  value    输入值
+ * @return uint16_t 截断值
+ */
+static inline uint16_t sl_saturate(uint32_t value)
+{
+  return (value > 0xFFFF) ? 0xFFFF : static_cast<uint16_t>(value);
+}
+
+/**
+ * @brief (静态内联) 聚类容差
+ *
+ * @param  mean     聚类平均时长(us)
+ * @return uint32_t 容差(us)
+ */
+static inline uint32_t sl_tolerance(uint16_t mean)
+{
+  uint32_t delta = static_cast<uint32_t>(mean) * IR_Learner::CLUSTER_TOLERANCE / 100;
+  return (delta < IR_Learner::CLUSTER_MIN_DELTA) ? IR_Learner::CLUSTER_MIN_DELTA : delta;
+}
+
+/**
+ * @brief (私有函数) IR 学习解码 计数值转换为时长
+ *
+ * @param  ticks    计数值
+ * @return uint32_t 时长(us, 四舍五入)
+ */
+uint32_t IR_Learner::m_to_time(uint32_t ticks) const
+{
+  return static_cast<uint32_t>((static_cast<uint64_t>(ticks) * 1000000U + m_clock / 2) / m_clock);
+}
+
+/**
+ * @brief (私有函数) IR 学习解码 输出一个脉冲 (标记为0时空闲并入上一脉冲)
+ *
+ * @param mark_ticks   标记时长(计数)
+ * @param space_ticks  空闲时长(计数)
+ */
+void IR_Learner::m_emit(uint32_t mark_ticks, uint32_t space_ticks)
+{
+  uint32_t mark  = m_to_time(mark_ticks);
+  uint32_t space = m_to_time(space_ticks);
+
+  if (0 == mark)
+  {
+    if (0 != m_size)
+      m_pulses[m_size - 1].space = sl_saturate(m_pulses[m_size - 1].space + space);
+    return;
+  }
+
+  if (m_size >= m_capacity)
+  {
+    m_overflow = true;
+    return;
+  }
+
+  m_pulses[m_size].mark  = sl_saturate(mark);
+  m_pulses[m_size].space = sl_saturate(space);
+  m_size++;
+}
+
+/**
+ * @brief (私有函数) IR 学习解码 时长聚类并替换为聚类平均值 (分段间隔保持原值)
+ *
+ * @param  mark     true为标记, false为空闲
+ * @return uint8_t  聚类数量
+ */
+uint8_t IR_Learner::m_cluster(bool mark)
+{
+  cluster_t clusters[MAX_CLUSTERS];
+  uint8_t   number = 0;
+
+  for (uint8_t pass = 0; pass < 2; pass++)
+  {
+    for (uint16_t i = 0; i < m_size; i++)
+    {
+      uint16_t& value = mark ? m_pulses[i].mark : m_pulses[i].space;
+      if (0 == value || (!mark && value >= SEGMENT_GAP))
+        continue;
+
+      /* 查找容差内最接近的聚类 */
+      int      best      = -1;
+      uint32_t best_diff = 0xFFFFFFFF;
+      for (uint8_t j = 0; j < number; j++)
+      {
+        uint32_t diff = (value > clusters[j].mean) ? value - clusters[j].mean : clusters[j].mean - value;
+        if (diff <= sl_tolerance(clusters[j].mean) && diff < best_diff)
+        {
+          best      = j;
+          best_diff = diff;
+        }
+      }
+
+      /* 第二轮: 替换为聚类平均值 */
+      if (1 == pass)
+      {
+        if (best >= 0)
+          value = clusters[best].mean;
+        continue;
+      }
+
+      /* 第一轮: 建立聚类 (聚类已满时保持原值) */
+      if (best >= 0)
+      {
+        clusters[best].sum   += value;
+        clusters[best].count++;
+        clusters[best].mean   = static_cast<uint16_t>((clusters[best].sum + clusters[best].count / 2) / clusters[best].count);
+      }
+      else if (number < MAX_CLUSTERS)
+      {
+        clusters[number++] = cluster_t { value, 1, value };
+      }
+    }
+  }
+
+  return number;
+}
+
+/**
+ * @brief IR 学习解码 复位并绑定输出缓存区
+ *
+ * @param buffer    输出缓存区
+ * @param capacity  输出缓存区容量
+ * @param clock     计数时钟频率(Hz)
+ * @param bits      计数器位宽(16或32)
+ */
+void IR_Learner::reset(ir_pulse_t* buffer, uint16_t capacity, uint32_t clock, uint8_t bits)
+{
+  *this      = IR_Learner();
+  m_pulses   = buffer;
+  m_capacity = (nullptr == buffer) ? 0 : capacity;
+  m_clock    = (0 == clock) ? 1000000 : clock;
+  m_mask     = (bits >= 32) ? 0xFFFFFFFF : ((1U << bits) - 1);
+  m_short    = static_cast<uint32_t>(static_cast<uint64_t>(m_clock) * CARRIER_MAX_INTERVAL / 1000000U);
+}
+
+/**
+ * @brief IR 学习解码 输入一个边沿时刻 (首个边沿为标记开始, 可在中断中调用)
+ *
+ * @note  短间隔为载波, 标记持续; 长间隔在无效电平之后(或载波标记之后)为空闲, 否则为解调输入的标记
+ * @param stamp 边沿时刻(计数值)
+ */
+void IR_Learner::feed(uint32_t stamp)
+{
+  if (m_finished)
+    return;
+
+  if (0 == m_edges++)
+  {
+    m_mark_start = stamp;
+    m_last       = stamp;
+    m_active     = true;
+    m_burst      = false;
+    return;
+  }
+
+  uint32_t interval = (stamp - m_last) & m_mask;
+  if (interval < m_short)
+  {
+    /* 载波间隔: 记录载波统计, 标记持续 */
+    m_carrier_sum += interval;
+    m_carrier_count++;
+    if (!m_active)
+    {
+      m_off_sum += interval;
+      m_off_count++;
+    }
+    m_burst = true;
+  }
+  else if (!m_active || m_burst)
+  {
+    /* 空闲结束: 上一边沿为标记结束, 当前边沿为下一标记开始 (同时纠正丢失边沿导致的电平错位) */
+    m_emit((m_last - m_mark_start) & m_mask, interval);
+    m_mark_start = stamp;
+    m_last       = stamp;
+    m_active     = true;
+    m_burst      = false;
+    return;
+  }
+
+  m_last   = stamp;
+  m_active = !m_active;
+}
+
+/**
+ * @brief IR 学习解码 结束输入, 识别载波与分段并聚类压缩时长
+ *
+ * @return uint16_t 脉冲数量
+ */
+uint16_t IR_Learner::finish()
+{
+  if (m_finished)
+    return m_size;
+
+  m_finished = true;
+  if (0 == m_edges)
+    return 0;
+
+  /* 最后一个标记 (末尾空闲由发送方的帧间隔决定) */
+  m_emit((m_last - m_mark_start) & m_mask, 0);
+
+  /* 载波识别: 相邻两个载波间隔之和为一个载波周期 */
+  if (m_carrier_count >= CARRIER_MIN_COUNT && 0 != m_carrier_sum)
+  {
+    m_carrier = static_cast<uint32_t>((static_cast<uint64_t>(m_clock) * m_carrier_count + m_carrier_sum) / (2 * m_carrier_sum));
+
+    /* 标记结束于最后一个载波脉冲的下降沿, 补偿其后的载波关断时长 */
+    if (0 != m_off_count)
+    {
+      uint32_t off = m_to_time(static_cast<uint32_t>(m_off_sum / m_off_count));
+      for (uint16_t i = 0; i < m_size; i++)
+      {
+        m_pulses[i].mark  = sl_saturate(m_pulses[i].mark + off);
+        m_pulses[i].space = (m_pulses[i].space > off) ? static_cast<uint16_t>(m_pulses[i].space - off) : 0;
+      }
+    }
+  }
+
+  /* 分段识别: 超过分段间隔下限的空闲为分段边界 (超出最大分段数量时并入最后一段) */
+  for (uint16_t i = 0; i < m_size; i++)
+  {
+    if (m_pulses[i].space < SEGMENT_GAP && i + 1 != m_size)
+      continue;
+
+    if (m_segments < MAX_SEGMENTS)
+      m_segments++;
+    m_segment_end[m_segments - 1] = i + 1;
+  }
+
+  /* 时长聚类压缩: 消除采样抖动 */
+  m_mark_clusters  = m_cluster(true);
+  m_space_clusters = m_cluster(false);
+  return m_size;
+}
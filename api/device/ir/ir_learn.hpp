@@ -0,0 +1,232 @@
+/**
+ * @file      ir_learn.hpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for IR device learning decoder (红外遥控 学习解码)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#ifndef __IR_LEARN_HPP__
+#define __IR_LEARN_HPP__
+
+#include "ir_timeline.hpp"
+
+/// @brief 名称空间 库名
+namespace OwO
+{
+/// @brief 名称空间 设备
+namespace device
+{
+/// @brief 类 IR 学习解码 -- 将输入捕获的边沿时刻还原为标记/空闲序列, 识别载波与分段并聚类压缩 (不依赖硬件)
+class IR_Learner
+{
+public:
+  /// @brief 载波半周期上限(us) 小于该值的边沿间隔视为同一标记内的载波 (对应载波频率下限约8kHz)
+  static constexpr uint32_t CARRIER_MAX_INTERVAL = 60;
+  /// @brief 识别载波所需的最少载波间隔数量 (解调接收头输出无载波)
+  static constexpr uint32_t CARRIER_MIN_COUNT    = 16;
+  /// @brief 分段间隔下限(us) (各协议符号空闲均不超过4.5ms)
+  static constexpr uint16_t SEGMENT_GAP          = 5000;
+  /// @brief 最大分段数量
+  static constexpr uint8_t  MAX_SEGMENTS         = 8;
+  /// @brief 标记/空闲各自的最大聚类数量
+  static constexpr uint8_t  MAX_CLUSTERS         = 16;
+  /// @brief 聚类相对容差(%)
+  static constexpr uint8_t  CLUSTER_TOLERANCE    = 8;
+  /// @brief 聚类最小容差(us)
+  static constexpr uint16_t CLUSTER_MIN_DELTA    = 100;
+
+private:
+  /// @brief 结构体 IR 学习解码 时长聚类
+  struct cluster_t
+  {
+    uint32_t sum;   /* 时长总和 */
+    uint16_t count; /* 时长数量 */
+    uint16_t mean;  /* 平均时长 */
+  };
+
+  /// @brief 输出脉冲序列
+  ir_pulse_t* m_pulses;
+  /// @brief 输出缓存区容量
+  uint16_t    m_capacity;
+  /// @brief 输出脉冲数量
+  uint16_t    m_size;
+  /// @brief 计数时钟频率(Hz)
+  uint32_t    m_clock;
+  /// @brief 计数器位宽掩码 (边沿间隔按计数器回绕计算)
+  uint32_t    m_mask;
+  /// @brief 载波间隔上限(计数)
+  uint32_t    m_short;
+  /// @brief 边沿数量
+  uint32_t    m_edges;
+  /// @brief 上一边沿时刻
+  uint32_t    m_last;
+  /// @brief 当前标记起始时刻
+  uint32_t    m_mark_start;
+  /// @brief 载波间隔总和(计数)
+  uint64_t    m_carrier_sum;
+  /// @brief 载波间隔数量
+  uint32_t    m_carrier_count;
+  /// @brief 载波关断间隔总和(计数)
+  uint64_t    m_off_sum;
+  /// @brief 载波关断间隔数量
+  uint32_t    m_off_count;
+  /// @brief 载波频率(Hz, 0为无载波)
+  uint32_t    m_carrier;
+  /// @brief 各分段结束位置(不含)
+  uint16_t    m_segment_end[MAX_SEGMENTS];
+  /// @brief 分段数量
+  uint8_t     m_segments;
+  /// @brief 标记聚类数量
+  uint8_t     m_mark_clusters;
+  /// @brief 空闲聚类数量
+  uint8_t     m_space_clusters;
+  /// @brief 上一边沿后为有效电平
+  bool        m_active;
+  /// @brief 当前标记包含载波
+  bool        m_burst;
+  /// @brief 输出缓存区溢出
+  bool        m_overflow;
+  /// @brief 解码完成
+  bool        m_finished;
+
+  uint32_t m_to_time(uint32_t ticks) const;
+  void     m_emit(uint32_t mark_ticks, uint32_t space_ticks);
+  uint8_t  m_cluster(bool mark);
+
+public:
+  IR_Learner() : m_pulses(nullptr), m_capacity(0), m_size(0), m_clock(0), m_mask(0), m_short(0), m_edges(0), m_last(0), m_mark_start(0), m_carrier_sum(0), m_carrier_count(0), m_off_sum(0), m_off_count(0), m_carrier(0), m_segment_end {}, m_segments(0), m_mark_clusters(0), m_space_clusters(0), m_active(false), m_burst(false), m_overflow(false), m_finished(false) {}
+
+  /**
+   * @brief IR 学习解码 复位并绑定输出缓存区
+   *
+   * @param buffer    输出缓存区
+   * @param capacity  输出缓存区容量
+   * @param clock     计数时钟频率(Hz)
+   * @param bits      计数器位宽(16或32)
+   */
+  void reset(ir_pulse_t* buffer, uint16_t capacity, uint32_t clock, uint8_t bits = 32);
+
+  /**
+   * @brief IR 学习解码 输入一个边沿时刻 (首个边沿为标记开始, 可在中断中调用)
+   *
+   * @param stamp 边沿时刻(计数值)
+   */
+  void feed(uint32_t stamp);
+
+  /**
+   * @brief IR 学习解码 输入连续的边沿时刻
+   *
+   * @param stamps  边沿时刻(计数值)
+   * @param count   边沿数量
+   */
+  void feed(const uint32_t* stamps, uint16_t count)
+  {
+    for (uint16_t i = 0; i < count; i++)
+      feed(stamps[i]);
+  }
+
+  /**
+   * @brief IR 学习解码 结束输入, 识别载波与分段并聚类压缩时长
+   *
+   * @return uint16_t 脉冲数量
+   */
+  uint16_t finish();
+
+  /**
+   * @brief IR 学习解码 获取已输入的边沿数量
+   *
+   * @return uint32_t 边沿数量
+   */
+  uint32_t edges() const
+  {
+    return m_edges;
+  }
+
+  /**
+   * @brief IR 学习解码 获取脉冲序列
+   *
+   * @return const ir_pulse_t* 脉冲序列
+   */
+  const ir_pulse_t* data() const
+  {
+    return m_pulses;
+  }
+
+  /**
+   * @brief IR 学习解码 获取脉冲数量
+   *
+   * @return uint16_t 脉冲数量
+   */
+  uint16_t size() const
+  {
+    return m_size;
+  }
+
+  /**
+   * @brief IR 学习解码 获取载波频率 (结束输入后有效)
+   *
+   * @return uint32_t 载波频率(Hz), 解调输入返回0
+   */
+  uint32_t carrier() const
+  {
+    return m_carrier;
+  }
+
+  /**
+   * @brief IR 学习解码 获取分段数量 (结束输入后有效)
+   *
+   * @return uint8_t 分段数量
+   */
+  uint8_t segments() const
+  {
+    return m_segments;
+  }
+
+  /**
+   * @brief IR 学习解码 获取分段结束位置
+   *
+   * @param  index    分段序号
+   * @return uint16_t 分段结束位置(不含), 序号无效返回0
+   */
+  uint16_t segment_end(uint8_t index) const
+  {
+    return (index < m_segments) ? m_segment_end[index] : 0;
+  }
+
+  /**
+   * @brief IR 学习解码 获取标记聚类数量 (结束输入后有效)
+   *
+   * @return uint8_t 标记聚类数量
+   */
+  uint8_t mark_clusters() const
+  {
+    return m_mark_clusters;
+  }
+
+  /**
+   * @brief IR 学习解码 获取空闲聚类数量 (结束输入后有效)
+   *
+   * @return uint8_t 空闲聚类数量
+   */
+  uint8_t space_clusters() const
+  {
+    return m_space_clusters;
+  }
+
+  /**
+   * @brief IR 学习解码 输出缓存区是否溢出
+   *
+   * @return bool 溢出返回true
+   */
+  bool overflow() const
+  {
+    return m_overflow;
+  }
+};
+} /* namespace device */
+} /* namespace OwO */
+
+#endif /* __IR_LEARN_HPP__ */
@@ -0,0 +1,398 @@
+/**
+ * @file      ir_library.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for IR device code library (红外遥控 NOR Flash 指令库)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "ir_library.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+
+using namespace OwO;
+using namespace device;
+
+/**
+ * @brief IR 指令库 CRC16 (多项式0xA001, 与 MODBUS 相同) 累加
+ *
+ * @param  crc      初值
+ * @param  data     数据
+ * @param  length   长度
+ * @return uint16_t CRC16
+ */
+uint16_t IR_Library::crc16(uint16_t crc, const void* data, uint32_t length)
+{
+  const uint8_t* p = static_cast<const uint8_t*>(data);
+  for (uint32_t i = 0; i < length; i++)
+  {
+    crc ^= p[i];
+    for (uint8_t j = 0; j < 8; j++)
+      crc = (crc & 0x0001) ? static_cast<uint16_t>((crc >> 1) ^ 0xA001) : static_cast<uint16_t>(crc >> 1);
+  }
+  return crc;
+}
+
+/**
+ * @brief (私有函数) IR 指令库 查找指令编号的索引位置
+ *
+ * @param  id       指令编号
+ * @param  found    找到(输出)
+ * @return uint16_t 索引位置 (未找到时为插入位置)
+ */
+uint16_t IR_Library::m_search(uint16_t id, bool& found) const
+{
+  uint16_t low  = 0;
+  uint16_t high = m_count;
+  while (low < high)
+  {
+    uint16_t middle = static_cast<uint16_t>((low + high) / 2);
+    if (m_index[middle].id < id)
+      low = static_cast<uint16_t>(middle + 1);
+    else
+      high = middle;
+  }
+
+  found = (low < m_count && m_index[low].id == id);
+  return low;
+}
+
+/**
+ * @brief (私有函数) IR 指令库 设置槽位占用
+ *
+ * @param slot  槽位
+ * @param used  占用
+ */
+void IR_Library::m_mark(uint16_t slot, bool used)
+{
+  if (used)
+    m_used[slot / 32] |= (1UL << (slot % 32));
+  else
+    m_used[slot / 32] &= ~(1UL << (slot % 32));
+}
+
+/**
+ * @brief (私有函数) IR 指令库 槽位写入区域是否已擦除 (写入时无需擦除扇区)
+ *
+ * @param  slot    槽位
+ * @param  length  写入长度(字节)
+ * @return bool    已擦除返回true，未擦除或读取失败返回false
+ */
+bool IR_Library::m_erased(uint16_t slot, uint32_t length)
+{
+  if (length > sizeof(m_buffer) || length != m_io.read(m_io.arg, m_address(slot), m_buffer, length))
+    return false;
+
+  for (uint32_t i = 0; i < length; i++)
+  {
+    if (0xFF != m_buffer[i])
+      return false;
+  }
+  return true;
+}
+
+/**
+ * @brief (私有函数) IR 指令库 分配空闲槽位 (自上次分配位置起轮转查找; 同扇区另一槽位有效时只分配已擦除的槽位)
+ *
+ * @param  length  写入长度(字节)
+ * @return int     槽位，无可安全写入的槽位返回-1
+ */
+int IR_Library::m_allocate(uint32_t length)
+{
+  for (uint16_t i = 0; i < m_slots; i++)
+  {
+    uint16_t slot = static_cast<uint16_t>((m_cursor + i) % m_slots);
+    if (0 != (m_used[slot / 32] & (1UL << (slot % 32))))
+      continue;
+
+    /* 同扇区其他槽位有效: 写入未擦除区域会整扇区擦除重写, 擦除中途掉电将丢失该指令 */
+    bool     shared = false;
+    uint16_t first  = static_cast<uint16_t>(slot - slot % SECTOR_SLOTS);
+    for (uint16_t other = first; other < first + SECTOR_SLOTS && other < m_slots; other++)
+      shared |= (other != slot && 0 != (m_used[other / 32] & (1UL << (other % 32))));
+
+    if (shared && !m_erased(slot, length))
+      continue;
+
+    m_cursor = static_cast<uint16_t>((slot + 1) % m_slots);
+    return slot;
+  }
+  return -1;
+}
+
+/**
+ * @brief (私有函数) IR 指令库 标记槽位删除 (仅清零状态字节, 无需擦除)
+ *
+ * @param  slot  槽位
+ * @return bool  成功返回true
+ */
+bool IR_Library::m_delete(uint16_t slot)
+{
+  uint8_t state = STATE_DELETED;
+  return sizeof(state) == m_io.write(m_io.arg, m_address(slot) + offsetof(slot_t, state), &state, sizeof(state));
+}
+
+/**
+ * @brief (私有函数) IR 指令库 计算槽位校验值
+ *
+ * @param  slot      槽位头部
+ * @param  pulses    脉冲序列
+ * @return uint16_t  CRC16
+ */
+uint16_t IR_Library::m_checksum(const slot_t& slot, const ir_pulse_t* pulses)
+{
+  uint16_t crc = crc16(0xFFFF, &slot, offsetof(slot_t, state));
+  return crc16(crc, pulses, static_cast<uint32_t>(slot.count) * sizeof(ir_pulse_t));
+}
+
+/**
+ * @brief (私有函数) IR 指令库 校验槽位 (头部与脉冲序列读入写入缓存区)
+ *
+ * @param  slot  槽位
+ * @return bool  校验通过返回true，读取失败或校验失败返回false
+ */
+bool IR_Library::m_verify(uint16_t slot)
+{
+  slot_t header;
+  if (sizeof(header) != m_io.read(m_io.arg, m_address(slot), &header, sizeof(header)) || header.count > MAX_PULSES)
+    return false;
+
+  uint32_t length = static_cast<uint32_t>(header.count) * sizeof(ir_pulse_t);
+  if (length != m_io.read(m_io.arg, m_address(slot) + sizeof(header), m_buffer, length))
+    return false;
+
+  return header.crc == m_checksum(header, reinterpret_cast<const ir_pulse_t*>(m_buffer));
+}
+
+/**
+ * @brief IR 指令库 挂载 (扫描全部槽位头部重建索引, 删除写入中途掉电的最新槽位, 同一编号保留写入序号最新的槽位)
+ *
+ * @param  io    存储接口
+ * @param  base  起始地址(扇区对齐)
+ * @param  size  区域大小(字节, 超出 MAX_CODES 个槽位的部分不使用)
+ * @return bool  成功返回true，接口无效或读取失败返回false
+ */
+bool IR_Library::mount(const ir_library_io_t& io, uint32_t base, uint32_t size)
+{
+  m_mounted  = false;
+  m_io       = io;
+  m_base     = base;
+  m_slots    = static_cast<uint16_t>(std::min<uint32_t>(size / SLOT_SIZE, MAX_CODES));
+  m_count    = 0;
+  m_cursor   = 0;
+  m_sequence = 0;
+  memset(m_used, 0, sizeof(m_used));
+  if (nullptr == io.read || nullptr == io.write || 0 == m_slots)
+    return false;
+
+  /* 扫描槽位头部: 有效槽位加入索引 (已删除、已擦除与损坏的头部视为空闲) */
+  uint32_t latest = 0;
+  uint16_t newest = 0;
+  for (uint16_t slot = 0; slot < m_slots; slot++)
+  {
+    slot_t header;
+    if (sizeof(header) != io.read(io.arg, m_address(slot), &header, sizeof(header)))
+      return false;
+
+    if (SLOT_MAGIC != header.magic || STATE_VALID != header.state || 0 == header.id || 0 == header.count || header.count > MAX_PULSES)
+      continue;
+
+    m_index[m_count++] = index_t { header.id, slot };
+    m_mark(slot, true);
+    if (1 == m_count || static_cast<int32_t>(header.sequence - latest) >= 0)
+    {
+      latest   = header.sequence;
+      newest   = static_cast<uint16_t>(m_count - 1);
+      m_cursor = static_cast<uint16_t>((slot + 1) % m_slots);
+    }
+  }
+  m_sequence = (0 != m_count) ? latest + 1 : 0;
+
+  /* 槽位按序号依次写入, 只有最新槽位可能在写入中途掉电: 校验失败时删除 (替换时保留旧槽位) */
+  if (0 != m_count && !m_verify(m_index[newest].slot))
+  {
+    m_delete(m_index[newest].slot);
+    m_mark(m_index[newest].slot, false);
+    m_index[newest] = m_index[--m_count];
+  }
+
+  std::sort(m_index, m_index + m_count, [](const index_t& a, const index_t& b) { return a.id < b.id; });
+
+  /* 同一编号的多个槽位 (替换过程中掉电): 保留写入序号最新的槽位, 删除其余槽位 */
+  uint16_t count = 0;
+  for (uint16_t i = 0; i < m_count; i++)
+  {
+    if (0 == count || m_index[count - 1].id != m_index[i].id)
+    {
+      m_index[count++] = m_index[i];
+      continue;
+    }
+
+    slot_t headers[2];
+    if (sizeof(slot_t) != io.read(io.arg, m_address(m_index[count - 1].slot), &headers[0], sizeof(slot_t)) || sizeof(slot_t) != io.read(io.arg, m_address(m_index[i].slot), &headers[1], sizeof(slot_t)))
+      return false;
+
+    bool     keep  = static_cast<int32_t>(headers[1].sequence - headers[0].sequence) > 0;
+    uint16_t stale = keep ? m_index[count - 1].slot : m_index[i].slot;
+    if (keep)
+      m_index[count - 1].slot = m_index[i].slot;
+
+    m_delete(stale);
+    m_mark(stale, false);
+  }
+  m_count   = count;
+  m_mounted = true;
+  return true;
+}
+
+/**
+ * @brief IR 指令库 存储指令 (编号已存在时替换)
+ *
+ * @param  id         指令编号(1~65535)
+ * @param  pulses     脉冲序列
+ * @param  count      脉冲数量
+ * @param  frequency  载波频率(Hz, 0为默认)
+ * @param  duty       载波占空比(%, 0为默认)
+ * @return ir_library_error 操作结果
+ */
+ir_library_error IR_Library::store(uint16_t id, const ir_pulse_t* pulses, uint16_t count, uint16_t frequency, uint8_t duty)
+{
+  if (!m_mounted)
+    return ir_library_error::MOUNT;
+
+  if (0 == id)
+    return ir_library_error::ID;
+
+  if (nullptr == pulses || 0 == count || count > MAX_PULSES)
+    return ir_library_error::LENGTH;
+
+  if ((0 != frequency && (frequency < MIN_FREQUENCY || frequency > MAX_FREQUENCY)) || (0 != duty && (duty < MIN_DUTY || duty > MAX_DUTY)))
+    return ir_library_error::CARRIER;
+
+  uint32_t length = sizeof(slot_t) + static_cast<uint32_t>(count) * sizeof(ir_pulse_t);
+  int      slot   = m_allocate(length);
+  if (slot < 0)
+    return ir_library_error::FULL;
+
+  /* 头部与脉冲序列一次写入同一扇区, 校验值保护写入中途掉电 */
+  slot_t header = { SLOT_MAGIC, id, m_sequence, count, frequency, duty, STATE_VALID, 0 };
+  header.crc    = m_checksum(header, pulses);
+
+  memcpy(m_buffer, &header, sizeof(slot_t));
+  memcpy(m_buffer + sizeof(slot_t), pulses, length - sizeof(slot_t));
+  if (length != m_io.write(m_io.arg, m_address(static_cast<uint16_t>(slot)), m_buffer, length))
+    return ir_library_error::IO;
+
+  m_sequence++;
+  m_mark(static_cast<uint16_t>(slot), true);
+
+  /* 替换: 新槽位写入后再删除旧槽位 */
+  bool     found = false;
+  uint16_t index = m_search(id, found);
+  if (found)
+  {
+    uint16_t stale      = m_index[index].slot;
+    m_index[index].slot = static_cast<uint16_t>(slot);
+    m_mark(stale, false);
+    return m_delete(stale) ? ir_library_error::NONE : ir_library_error::IO;
+  }
+
+  memmove(&m_index[index + 1], &m_index[index], (m_count - index) * sizeof(index_t));
+  m_index[index] = index_t { id, static_cast<uint16_t>(slot) };
+  m_count++;
+  return ir_library_error::NONE;
+}
+
+/**
+ * @brief IR 指令库 读取指令 (校验 CRC16)
+ *
+ * @param  id        指令编号
+ * @param  pulses    脉冲序列(输出)
+ * @param  capacity  脉冲序列容量
+ * @param  code      指令信息(输出)
+ * @return ir_library_error 操作结果
+ */
+ir_library_error IR_Library::load(uint16_t id, ir_pulse_t* pulses, uint16_t capacity, ir_library_code_t& code)
+{
+  code = ir_library_code_t {};
+  if (!m_mounted)
+    return ir_library_error::MOUNT;
+
+  if (0 == id)
+    return ir_library_error::ID;
+
+  bool     found = false;
+  uint16_t index = m_search(id, found);
+  if (!found)
+    return ir_library_error::MISSING;
+
+  slot_t   header;
+  uint32_t address = m_address(m_index[index].slot);
+  if (sizeof(header) != m_io.read(m_io.arg, address, &header, sizeof(header)))
+    return ir_library_error::IO;
+
+  if (SLOT_MAGIC != header.magic || id != header.id || STATE_VALID != header.state || 0 == header.count || header.count > MAX_PULSES)
+    return ir_library_error::CRC;
+
+  if (nullptr == pulses || header.count > capacity)
+    return ir_library_error::LENGTH;
+
+  uint32_t length = static_cast<uint32_t>(header.count) * sizeof(ir_pulse_t);
+  if (length != m_io.read(m_io.arg, address + sizeof(header), pulses, length))
+    return ir_library_error::IO;
+
+  if (header.crc != m_checksum(header, pulses))
+    return ir_library_error::CRC;
+
+  code = ir_library_code_t { header.count, header.frequency, header.duty };
+  return ir_library_error::NONE;
+}
+
+/**
+ * @brief IR 指令库 删除指令
+ *
+ * @param  id  指令编号
+ * @return ir_library_error 操作结果
+ */
+ir_library_error IR_Library::remove(uint16_t id)
+{
+  if (!m_mounted)
+    return ir_library_error::MOUNT;
+
+  if (0 == id)
+    return ir_library_error::ID;
+
+  bool     found = false;
+  uint16_t index = m_search(id, found);
+  if (!found)
+    return ir_library_error::MISSING;
+
+  uint16_t slot = m_index[index].slot;
+  memmove(&m_index[index], &m_index[index + 1], (m_count - index - 1) * sizeof(index_t));
+  m_count--;
+  m_mark(slot, false);
+  return m_delete(slot) ? ir_library_error::NONE : ir_library_error::IO;
+}
+
+/**
+ * @brief IR 指令库 删除全部指令
+ *
+ * @return ir_library_error 操作结果
+ */
+ir_library_error IR_Library::clear()
+{
+  if (!m_mounted)
+    return ir_library_error::MOUNT;
+
+  bool ret = true;
+  for (uint16_t i = 0; i < m_count; i++)
+  {
+    ret &= m_delete(m_index[i].slot);
+    m_mark(m_index[i].slot, false);
+  }
+  m_count = 0;
+  return ret ? ir_library_error::NONE : ir_library_error::IO;
+}
@@ -0,0 +1,307 @@
+/**
+ * @file      ir_library.hpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for IR device code library (红外遥控 NOR Flash 指令库)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#ifndef __IR_LIBRARY_HPP__
+#define __IR_LIBRARY_HPP__
+
+#include "ir_timeline.hpp"
+
+/// @brief 名称空间 库名
+namespace OwO
+{
+/// @brief 名称空间 设备
+namespace device
+{
+/// @brief 枚举 IR 指令库 操作结果
+enum class ir_library_error : uint8_t
+{
+  NONE,    /* 成功 */
+  MOUNT,   /* 指令库未挂载 */
+  ID,      /* 指令编号无效(0) */
+  MISSING, /* 指令不存在 */
+  LENGTH,  /* 脉冲数量为0或超出容量 */
+  CARRIER, /* 载波设置超出范围 */
+  FULL,    /* 指令库已满 (无可安全写入的槽位) */
+  IO,      /* 存储读写失败 */
+  CRC,     /* 指令数据校验失败 */
+};
+
+/// @brief 结构体 IR 指令库 存储接口 (写入时由存储设备负责扇区擦除, 如 W25Q256 驱动)
+struct ir_library_io_t
+{
+  uint32_t (*read)(void* arg, uint32_t position, void* data, uint32_t len);        /* 读取, 返回读取字节数 */
+  uint32_t (*write)(void* arg, uint32_t position, const void* data, uint32_t len); /* 写入, 返回写入字节数 */
+  void* arg;                                                                        /* 接口参数 */
+};
+
+/// @brief 结构体 IR 指令库 指令信息
+struct ir_library_code_t
+{
+  uint16_t count;     /* 脉冲数量 */
+  uint16_t frequency; /* 载波频率(Hz, 0为默认) */
+  uint8_t  duty;      /* 载波占空比(%, 0为默认) */
+};
+
+/// @brief 类 IR 指令库 -- 已编码时序按固定大小槽位存储于 NOR Flash, 内存中保存按指令编号排序的索引 (不依赖硬件, 调用者负责互斥)
+///        槽位头部含写入序号与 CRC16, 替换指令时先写新槽位再标记旧槽位删除 (仅清零位, 无需擦除), 掉电后挂载按序号保留最新槽位
+///        存储设备写入未擦除区域时整扇区读出-擦除-重写, 因此同扇区另一槽位有效时只使用已擦除的槽位, 擦除中途掉电不会波及其他指令
+class IR_Library
+{
+public:
+  /// @brief 槽位大小(字节, 半个扇区)
+  static constexpr uint32_t SLOT_SIZE     = 2048;
+  /// @brief 槽位最大数量 (同时为索引容量)
+  static constexpr uint16_t MAX_CODES     = 2048;
+  /// @brief 单条指令最大脉冲数量
+  static constexpr uint16_t MAX_PULSES    = 320;
+  /// @brief 载波频率下限(Hz)
+  static constexpr uint16_t MIN_FREQUENCY = 30000;
+  /// @brief 载波频率上限(Hz)
+  static constexpr uint16_t MAX_FREQUENCY = 60000;
+  /// @brief 载波占空比下限(%)
+  static constexpr uint8_t  MIN_DUTY      = 10;
+  /// @brief 载波占空比上限(%)
+  static constexpr uint8_t  MAX_DUTY      = 60;
+
+private:
+  /// @brief 扇区大小(字节, 存储设备擦除单位)
+  static constexpr uint32_t SECTOR_SIZE   = 4096;
+  /// @brief 每扇区槽位数量
+  static constexpr uint16_t SECTOR_SLOTS  = SECTOR_SIZE / SLOT_SIZE;
+  /// @brief 槽位头部标识
+  static constexpr uint16_t SLOT_MAGIC    = 0x5249;
+  /// @brief 槽位状态 有效 (擦除后的值)
+  static constexpr uint8_t  STATE_VALID   = 0xFF;
+  /// @brief 槽位状态 已删除
+  static constexpr uint8_t  STATE_DELETED = 0x00;
+
+  /// @brief 结构体 IR 指令库 槽位头部 (其后为脉冲序列)
+  struct slot_t
+  {
+    uint16_t magic;     /* 槽位头部标识 */
+    uint16_t id;        /* 指令编号 */
+    uint32_t sequence;  /* 写入序号 */
+    uint16_t count;     /* 脉冲数量 */
+    uint16_t frequency; /* 载波频率(Hz, 0为默认) */
+    uint8_t  duty;      /* 载波占空比(%, 0为默认) */
+    uint8_t  state;     /* 槽位状态 */
+    uint16_t crc;       /* CRC16 (头部除状态与校验外的字段 + 脉冲序列) */
+  };
+
+  static_assert(16 == sizeof(slot_t), "slot_t must be packed");
+  static_assert(sizeof(slot_t) + MAX_PULSES * sizeof(ir_pulse_t) <= SLOT_SIZE, "slot too small");
+  static_assert(0 == SECTOR_SIZE % SLOT_SIZE, "slots must not straddle sectors");
+
+  /// @brief 结构体 IR 指令库 索引条目
+  struct index_t
+  {
+    uint16_t id;   /* 指令编号 */
+    uint16_t slot; /* 槽位 */
+  };
+
+  /// @brief 存储接口
+  ir_library_io_t m_io;
+  /// @brief 指令库起始地址
+  uint32_t        m_base;
+  /// @brief 槽位数量
+  uint16_t        m_slots;
+  /// @brief 指令数量
+  uint16_t        m_count;
+  /// @brief 下一次分配的起始槽位 (轮转分配, 均衡擦写)
+  uint16_t        m_cursor;
+  /// @brief 下一写入序号
+  uint32_t        m_sequence;
+  /// @brief 已挂载
+  bool            m_mounted;
+  /// @brief 索引 (按指令编号升序)
+  index_t         m_index[MAX_CODES];
+  /// @brief 槽位占用位图
+  uint32_t        m_used[MAX_CODES / 32];
+  /// @brief 写入缓存区 (头部与脉冲序列一次写入)
+  uint8_t         m_buffer[sizeof(slot_t) + MAX_PULSES * sizeof(ir_pulse_t)];
+
+  /**
+   * @brief (私有函数) IR 指令库 计算槽位地址
+   *
+   * @param  slot     槽位
+   * @return uint32_t 地址
+   */
+  uint32_t m_address(uint16_t slot) const
+  {
+    return m_base + static_cast<uint32_t>(slot) * SLOT_SIZE;
+  }
+
+  /**
+   * @brief (私有函数) IR 指令库 查找指令编号的索引位置
+   *
+   * @param  id       指令编号
+   * @param  found    找到(输出)
+   * @return uint16_t 索引位置 (未找到时为插入位置)
+   */
+  uint16_t m_search(uint16_t id, bool& found) const;
+
+  /**
+   * @brief (私有函数) IR 指令库 设置槽位占用
+   *
+   * @param slot  槽位
+   * @param used  占用
+   */
+  void m_mark(uint16_t slot, bool used);
+
+  /**
+   * @brief (私有函数) IR 指令库 槽位写入区域是否已擦除 (写入时无需擦除扇区)
+   *
+   * @param  slot    槽位
+   * @param  length  写入长度(字节)
+   * @return bool    已擦除返回true，未擦除或读取失败返回false
+   */
+  bool m_erased(uint16_t slot, uint32_t length);
+
+  /**
+   * @brief (私有函数) IR 指令库 分配空闲槽位 (自上次分配位置起轮转查找; 同扇区另一槽位有效时只分配已擦除的槽位)
+   *
+   * @param  length  写入长度(字节)
+   * @return int     槽位，无可安全写入的槽位返回-1
+   */
+  int m_allocate(uint32_t length);
+
+  /**
+   * @brief (私有函数) IR 指令库 标记槽位删除 (仅清零状态字节, 无需擦除)
+   *
+   * @param  slot  槽位
+   * @return bool  成功返回true
+   */
+  bool m_delete(uint16_t slot);
+
+  /**
+   * @brief (私有函数) IR 指令库 校验槽位 (头部与脉冲序列读入写入缓存区)
+   *
+   * @param  slot  槽位
+   * @return bool  校验通过返回true，读取失败或校验失败返回false
+   */
+  bool m_verify(uint16_t slot);
+
+  /**
+   * @brief (私有函数) IR 指令库 计算槽位校验值
+   *
+   * @param  slot      槽位头部
+   * @param  pulses    脉冲序列
+   * @return uint16_t  CRC16
+   */
+  static uint16_t m_checksum(const slot_t& slot, const ir_pulse_t* pulses);
+
+public:
+  IR_Library() : m_io {}, m_base(0), m_slots(0), m_count(0), m_cursor(0), m_sequence(0), m_mounted(false), m_index {}, m_used {}, m_buffer {} {}
+
+  /**
+   * @brief IR 指令库 CRC16 (多项式0xA001, 与 MODBUS 相同) 累加, 供同一存储器中的其他记录使用
+   *
+   * @param  crc      初值
+   * @param  data     数据
+   * @param  length   长度
+   * @return uint16_t CRC16
+   */
+  static uint16_t crc16(uint16_t crc, const void* data, uint32_t length);
+
+  /**
+   * @brief IR 指令库 挂载 (扫描全部槽位头部重建索引, 删除写入中途掉电的最新槽位, 同一编号保留写入序号最新的槽位)
+   *
+   * @param  io    存储接口
+   * @param  base  起始地址(扇区对齐)
+   * @param  size  区域大小(字节, 超出 MAX_CODES 个槽位的部分不使用)
+   * @return bool  成功返回true，接口无效或读取失败返回false
+   */
+  bool mount(const ir_library_io_t& io, uint32_t base, uint32_t size);
+
+  /**
+   * @brief IR 指令库 存储指令 (编号已存在时替换)
+   *
+   * @param  id         指令编号(1~65535)
+   * @param  pulses     脉冲序列
+   * @param  count      脉冲数量
+   * @param  frequency  载波频率(Hz, 0为默认)
+   * @param  duty       载波占空比(%, 0为默认)
+   * @return ir_library_error 操作结果
+   */
+  ir_library_error store(uint16_t id, const ir_pulse_t* pulses, uint16_t count, uint16_t frequency = 0, uint8_t duty = 0);
+
+  /**
+   * @brief IR 指令库 读取指令 (校验 CRC16)
+   *
+   * @param  id        指令编号
+   * @param  pulses    脉冲序列(输出)
+   * @param  capacity  脉冲序列容量
+   * @param  code      指令信息(输出)
+   * @return ir_library_error 操作结果
+   */
+  ir_library_error load(uint16_t id, ir_pulse_t* pulses, uint16_t capacity, ir_library_code_t& code);
+
+  /**
+   * @brief IR 指令库 删除指令
+   *
+   * @param  id  指令编号
+   * @return ir_library_error 操作结果
+   */
+  ir_library_error remove(uint16_t id);
+
+  /**
+   * @brief IR 指令库 删除全部指令
+   *
+   * @return ir_library_error 操作结果
+   */
+  ir_library_error clear();
+
+  /**
+   * @brief IR 指令库 是否包含指令
+   *
+   * @param  id    指令编号
+   * @return bool  包含返回true
+   */
+  bool contains(uint16_t id) const
+  {
+    bool found = false;
+    m_search(id, found);
+    return found;
+  }
+
+  /**
+   * @brief IR 指令库 是否已挂载
+   *
+   * @return bool 已挂载返回true
+   */
+  bool is_mounted() const
+  {
+    return m_mounted;
+  }
+
+  /**
+   * @brief IR 指令库 获取指令数量
+   *
+   * @return uint16_t 指令数量
+   */
+  uint16_t size() const
+  {
+    return m_count;
+  }
+
+  /**
+   * @brief IR 指令库 获取容量(槽位数量)
+   *
+   * @return uint16_t 槽位数量
+   */
+  uint16_t capacity() const
+  {
+    return m_slots;
+  }
+};
+} /* namespace device */
+} /* namespace OwO */
+
+#endif /* __IR_LIBRARY_HPP__ */
@@ -0,0 +1,187 @@
+/**
+ * @file      ir_macro.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for IR device macro sequencer (红外遥控 定时宏指令)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "ir_macro.hpp"
+#include <cstring>
+
+using namespace OwO;
+using namespace device;
+
+/**
+ * @brief (私有函数) IR 宏指令 计算存储记录校验值
+ *
+ * @param  macro     步骤序列
+ * @return uint16_t  CRC16
+ */
+uint16_t IR_Macro::m_checksum(const macro_t& macro)
+{
+  uint16_t crc = IR_Library::crc16(0xFFFF, &macro.count, sizeof(macro.count));
+  return IR_Library::crc16(crc, macro.steps, static_cast<uint32_t>(macro.count) * sizeof(ir_macro_step_t));
+}
+
+/**
+ * @brief IR 宏指令 校验并解码上传区
+ *
+ * @param  regs   上传区寄存器 (宏编号, 步骤数量, 步骤)
+ * @param  size   上传区寄存器数量
+ * @param  id     宏编号(输出)
+ * @param  macro  步骤序列(输出)
+ * @return ir_macro_error 校验结果, 失败时步骤数量为0
+ */
+ir_macro_error IR_Macro::parse(const uint16_t* regs, uint16_t size, uint16_t& id, macro_t& macro)
+{
+  macro.count = 0;
+  id          = 0;
+  if (nullptr == regs || size < 2)
+    return ir_macro_error::LENGTH;
+
+  if (0 == regs[0] || regs[0] > MAX_MACROS)
+    return ir_macro_error::ID;
+
+  uint16_t count = regs[1];
+  if (0 == count || count > MAX_STEPS || size < 2 + count * STEP_SIZE)
+    return ir_macro_error::LENGTH;
+
+  for (uint16_t i = 0; i < count; i++)
+  {
+    const uint16_t*  reg  = &regs[2 + i * STEP_SIZE];
+    ir_macro_step_t& step = macro.steps[i];
+
+    if (0 == (reg[0] & 0xFF))
+      return ir_macro_error::CHANNEL;
+
+    if ((reg[0] >> 8) > static_cast<uint8_t>(ir_macro_kind::AC))
+      return ir_macro_error::KIND;
+
+    step.mask    = static_cast<uint8_t>(reg[0] & 0xFF);
+    step.kind    = static_cast<ir_macro_kind>(reg[0] >> 8);
+    step.delay   = reg[1];
+    step.args[0] = reg[2];
+    step.args[1] = reg[3];
+
+    if (ir_macro_kind::CODE == step.kind && 0 == step.args[0])
+      return ir_macro_error::CODE;
+  }
+
+  id          = regs[0];
+  macro.count = count;
+  return ir_macro_error::NONE;
+}
+
+/**
+ * @brief IR 宏指令 存储 (每个宏占用一个扇区, 写入时由存储设备负责擦除)
+ *
+ * @param  io     存储接口
+ * @param  base   宏存储区起始地址(扇区对齐)
+ * @param  id     宏编号(1~MAX_MACROS)
+ * @param  macro  步骤序列
+ * @return ir_macro_error 操作结果
+ */
+ir_macro_error IR_Macro::save(const ir_library_io_t& io, uint32_t base, uint16_t id, const macro_t& macro)
+{
+  if (0 == id || id > MAX_MACROS)
+    return ir_macro_error::ID;
+
+  if (0 == macro.count || macro.count > MAX_STEPS)
+    return ir_macro_error::LENGTH;
+
+  if (nullptr == io.write)
+    return ir_macro_error::IO;
+
+  /* 先写步骤再写头部: 写入中途掉电时旧头部的校验值与新步骤不符, 读取返回不存在 */
+  record_t record  = { RECORD_MAGIC, macro.count, m_checksum(macro), id };
+  uint32_t address = base + static_cast<uint32_t>(id - 1) * SLOT_SIZE;
+  uint32_t length  = static_cast<uint32_t>(macro.count) * sizeof(ir_macro_step_t);
+  if (length != io.write(io.arg, address + sizeof(record), macro.steps, length) || sizeof(record) != io.write(io.arg, address, &record, sizeof(record)))
+    return ir_macro_error::IO;
+
+  return ir_macro_error::NONE;
+}
+
+/**
+ * @brief IR 宏指令 读取 (校验 CRC16)
+ *
+ * @param  io     存储接口
+ * @param  base   宏存储区起始地址
+ * @param  id     宏编号(1~MAX_MACROS)
+ * @param  macro  步骤序列(输出)
+ * @return ir_macro_error 操作结果
+ */
+ir_macro_error IR_Macro::load(const ir_library_io_t& io, uint32_t base, uint16_t id, macro_t& macro)
+{
+  macro.count = 0;
+  if (0 == id || id > MAX_MACROS)
+    return ir_macro_error::ID;
+
+  if (nullptr == io.read)
+    return ir_macro_error::IO;
+
+  record_t record;
+  uint32_t address = base + static_cast<uint32_t>(id - 1) * SLOT_SIZE;
+  if (sizeof(record) != io.read(io.arg, address, &record, sizeof(record)))
+    return ir_macro_error::IO;
+
+  if (RECORD_MAGIC != record.magic || id != record.id || 0 == record.count || record.count > MAX_STEPS)
+    return ir_macro_error::MISSING;
+
+  uint32_t length = static_cast<uint32_t>(record.count) * sizeof(ir_macro_step_t);
+  if (length != io.read(io.arg, address + sizeof(record), macro.steps, length))
+    return ir_macro_error::IO;
+
+  macro.count = record.count;
+  if (record.crc != m_checksum(macro))
+  {
+    macro.count = 0;
+    return ir_macro_error::MISSING;
+  }
+
+  return ir_macro_error::NONE;
+}
+
+/**
+ * @brief IR 宏指令 启动执行 (替换执行中的宏)
+ *
+ * @param  id     宏编号
+ * @param  macro  步骤序列
+ * @param  now    当前时刻(ms)
+ * @return bool   成功返回true，步骤序列无效返回false
+ */
+bool IR_Macro::start(uint16_t id, const macro_t& macro, uint32_t now)
+{
+  stop();
+  if (0 == id || 0 == macro.count || macro.count > MAX_STEPS)
+    return false;
+
+  if (&macro != &m_macro)
+    m_macro = macro;
+
+  m_id       = id;
+  m_deadline = now + m_macro.steps[0].delay;
+  return true;
+}
+
+/**
+ * @brief IR 宏指令 当前步骤已执行, 转至下一步骤 (最后一个步骤执行后停止)
+ *
+ */
+void IR_Macro::advance()
+{
+  if (0 == m_id)
+    return;
+
+  if (++m_index >= m_macro.count)
+  {
+    stop();
+    return;
+  }
+
+  /* 以上一步骤的计划时刻累加, 执行推迟不累积到后续步骤 */
+  m_deadline += m_macro.steps[m_index].delay;
+}
@@ -0,0 +1,244 @@
+/**
+ * @file      ir_macro.hpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for IR device macro sequencer (红外遥控 定时宏指令)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#ifndef __IR_MACRO_HPP__
+#define __IR_MACRO_HPP__
+
+#include "ir_library.hpp"
+
+/// @brief 名称空间 库名
+namespace OwO
+{
+/// @brief 名称空间 设备
+namespace device
+{
+/// @brief 枚举 IR 宏指令 操作结果
+enum class ir_macro_error : uint8_t
+{
+  NONE,    /* 成功 */
+  ID,      /* 宏编号无效(0或超出数量) */
+  LENGTH,  /* 步骤数量为0、超出容量或寄存器数量不足 */
+  CHANNEL, /* 步骤通道掩码无效 */
+  KIND,    /* 步骤类型无效 */
+  CODE,    /* 步骤指令编号无效(0) */
+  IO,      /* 存储读写失败 */
+  MISSING, /* 宏不存在或校验失败 */
+  STEP,    /* 步骤执行失败 (指令不存在或空调状态无效) */
+};
+
+/// @brief 枚举 IR 宏指令 步骤类型
+enum class ir_macro_kind : uint8_t
+{
+  CODE, /* 指令库指令: 参数0为指令编号 */
+  AC,   /* 空调状态指令: 参数0为 品牌 << 8 | 设定温度, 参数1为 0xPMFS (开机/模式/风速/扫风) */
+};
+
+/// @brief 结构体 IR 宏指令 步骤 (保持寄存器顺序: 通道掩码 | 类型 << 8, 延时, 参数0, 参数1)
+struct ir_macro_step_t
+{
+  uint8_t       mask;    /* 通道掩码 (位0~7对应通道1~8) */
+  ir_macro_kind kind;    /* 步骤类型 */
+  uint16_t      delay;   /* 距上一步骤(首个步骤距启动)的延时(ms) */
+  uint16_t      args[2]; /* 参数 */
+};
+
+/// @brief 类 IR 宏指令 -- 多通道 (通道, 指令, 延时) 步骤序列的校验、存储与定时执行, 时刻由调用者传入 (不依赖硬件与系统时钟)
+///        步骤时刻按启动时刻累加延时得到, 某一步骤推迟执行(通道忙)不影响后续步骤的时刻
+class IR_Macro
+{
+public:
+  /// @brief 单个宏最大步骤数量
+  static constexpr uint8_t  MAX_STEPS   = 28;
+  /// @brief 宏最大数量
+  static constexpr uint8_t  MAX_MACROS  = 64;
+  /// @brief 每个宏占用的存储大小(字节, 一个扇区)
+  static constexpr uint32_t SLOT_SIZE   = 4096;
+  /// @brief 步骤寄存器数量
+  static constexpr uint16_t STEP_SIZE   = sizeof(ir_macro_step_t) / sizeof(uint16_t);
+  /// @brief 上传区寄存器数量 (宏编号, 步骤数量, 步骤; FC16 单次最多写入123个寄存器)
+  static constexpr uint16_t BLOCK_SIZE  = 2 + MAX_STEPS * STEP_SIZE;
+  /// @brief 无执行中的宏
+  static constexpr uint32_t NO_WAKEUP   = 0xFFFFFFFF;
+
+  static_assert(4 == STEP_SIZE, "ir_macro_step_t must match register layout");
+  static_assert(BLOCK_SIZE <= 123, "macro block exceeds FC16 limit");
+
+  /// @brief 结构体 IR 宏指令 步骤序列
+  struct macro_t
+  {
+    uint16_t        count;            /* 步骤数量 */
+    ir_macro_step_t steps[MAX_STEPS]; /* 步骤 */
+  };
+
+private:
+  /// @brief 存储记录标识
+  static constexpr uint16_t RECORD_MAGIC = 0x4D52;
+
+  /// @brief 结构体 IR 宏指令 存储记录头部 (其后为步骤)
+  struct record_t
+  {
+    uint16_t magic; /* 存储记录标识 */
+    uint16_t count; /* 步骤数量 */
+    uint16_t crc;   /* CRC16 (步骤数量 + 步骤) */
+    uint16_t id;    /* 宏编号 */
+  };
+
+  static_assert(sizeof(record_t) + sizeof(macro_t::steps) <= SLOT_SIZE, "slot too small");
+
+  /// @brief 执行中的宏
+  macro_t  m_macro;
+  /// @brief 执行中的宏编号 (0为空闲)
+  uint16_t m_id;
+  /// @brief 当前步骤
+  uint8_t  m_index;
+  /// @brief 当前步骤时刻(ms)
+  uint32_t m_deadline;
+
+  /**
+   * @brief (私有函数) IR 宏指令 时刻是否已到达 (计数回绕安全)
+   *
+   * @param  now   当前时刻(ms)
+   * @param  due   目标时刻(ms)
+   * @return bool  已到达返回true
+   */
+  static bool m_is_due(uint32_t now, uint32_t due)
+  {
+    return static_cast<int32_t>(now - due) >= 0;
+  }
+
+  /**
+   * @brief (私有函数) IR 宏指令 计算存储记录校验值
+   *
+   * @param  macro     步骤序列
+   * @return uint16_t  CRC16
+   */
+  static uint16_t m_checksum(const macro_t& macro);
+
+public:
+  IR_Macro() : m_macro {}, m_id(0), m_index(0), m_deadline(0) {}
+
+  /**
+   * @brief IR 宏指令 校验并解码上传区
+   *
+   * @param  regs   上传区寄存器 (宏编号, 步骤数量, 步骤)
+   * @param  size   上传区寄存器数量
+   * @param  id     宏编号(输出)
+   * @param  macro  步骤序列(输出)
+   * @return ir_macro_error 校验结果, 失败时步骤数量为0
+   */
+  static ir_macro_error parse(const uint16_t* regs, uint16_t size, uint16_t& id, macro_t& macro);
+
+  /**
+   * @brief IR 宏指令 存储 (每个宏占用一个扇区, 写入时由存储设备负责擦除)
+   *
+   * @param  io     存储接口
+   * @param  base   宏存储区起始地址(扇区对齐)
+   * @param  id     宏编号(1~MAX_MACROS)
+   * @param  macro  步骤序列
+   * @return ir_macro_error 操作结果
+   */
+  static ir_macro_error save(const ir_library_io_t& io, uint32_t base, uint16_t id, const macro_t& macro);
+
+  /**
+   * @brief IR 宏指令 读取 (校验 CRC16)
+   *
+   * @param  io     存储接口
+   * @param  base   宏存储区起始地址
+   * @param  id     宏编号(1~MAX_MACROS)
+   * @param  macro  步骤序列(输出)
+   * @return ir_macro_error 操作结果
+   */
+  static ir_macro_error load(const ir_library_io_t& io, uint32_t base, uint16_t id, macro_t& macro);
+
+  /**
+   * @brief IR 宏指令 启动执行 (替换执行中的宏)
+   *
+   * @param  id     宏编号
+   * @param  macro  步骤序列
+   * @param  now    当前时刻(ms)
+   * @return bool   成功返回true，步骤序列无效返回false
+   */
+  bool start(uint16_t id, const macro_t& macro, uint32_t now);
+
+  /**
+   * @brief IR 宏指令 停止执行
+   *
+   */
+  void stop()
+  {
+    m_id    = 0;
+    m_index = 0;
+  }
+
+  /**
+   * @brief IR 宏指令 获取已到期的当前步骤 (由调用者执行后调用 advance; 通道忙时可不调用, 下次再取)
+   *
+   * @param  now                      当前时刻(ms)
+   * @return const ir_macro_step_t*   已到期的步骤，空闲或未到期返回nullptr
+   */
+  const ir_macro_step_t* due(uint32_t now) const
+  {
+    return (0 != m_id && m_is_due(now, m_deadline)) ? &m_macro.steps[m_index] : nullptr;
+  }
+
+  /**
+   * @brief IR 宏指令 当前步骤已执行, 转至下一步骤 (最后一个步骤执行后停止)
+   *
+   */
+  void advance();
+
+  /**
+   * @brief IR 宏指令 获取距当前步骤到期的时间
+   *
+   * @param  now       当前时刻(ms)
+   * @return uint32_t  等待时间(ms)，已到期返回0，空闲返回NO_WAKEUP
+   */
+  uint32_t next_wakeup(uint32_t now) const
+  {
+    if (0 == m_id)
+      return NO_WAKEUP;
+
+    return m_is_due(now, m_deadline) ? 0 : m_deadline - now;
+  }
+
+  /**
+   * @brief IR 宏指令 获取执行中的宏编号
+   *
+   * @return uint16_t 宏编号，空闲返回0
+   */
+  uint16_t id() const
+  {
+    return m_id;
+  }
+
+  /**
+   * @brief IR 宏指令 获取当前步骤序号
+   *
+   * @return uint8_t 步骤序号(从0开始)
+   */
+  uint8_t index() const
+  {
+    return m_index;
+  }
+
+  /**
+   * @brief IR 宏指令 获取当前步骤时刻
+   *
+   * @return uint32_t 时刻(ms)
+   */
+  uint32_t deadline() const
+  {
+    return m_deadline;
+  }
+};
+} /* namespace device */
+} /* namespace OwO */
+
+#endif /* __IR_MACRO_HPP__ */
@@ -0,0 +1,346 @@
+/**
+ * @file      ir_protocol.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for IR device protocol descriptor (红外遥控 协议描述)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "ir_protocol.hpp"
+
+using namespace OwO;
+using namespace device;
+
+/// @brief IR 时序常量(us)
+enum
+{
+  _0_32MS  = 320,
+  _0_371MS = 371,
+  _0_44MS  = 440,
+  _0_5MS   = 500,
+  _0_56MS  = 560,
+  _0_67MS  = 670,
+  _0_588MS = 588,
+  _0_882MS = 882,
+  _1MS     = 1000,
+  _1_08MS  = 1080,
+  _1_47MS  = 1470,
+  _1_6MS   = 1600,
+  _1_68MS  = 1680,
+  _1_84MS  = 1840,
+  _20MS    = 2000,
+  _2_21MS  = 2210,
+  _26_37MS = 2637,
+  _3_08MS  = 3080,
+  _3_64MS  = 3640,
+  _40MS    = 4000,
+  _4_5MS   = 4500,
+  _5_22MS  = 5220,
+  _71MS    = 7100,
+  _8MS     = 8000,
+  _9MS     = 9000,
+};
+
+/// @brief IR 载波频率常量(Hz)
+enum
+{
+  _38KHZ = 38000,
+};
+
+#if 1 /* AUX 奥克斯 */
+/// @brief IR 奥克斯 段操作: 13字节
+static constexpr ir_op_t       sc_at_aux_ops[]     = { ir_op_leader(), ir_op_data(0, 13) };
+/// @brief IR 奥克斯 布局
+static constexpr ir_layout_t   sc_at_aux_layouts[] = {
+  { 13, sc_at_aux_ops, 2, 1, 0, 0 },
+};
+/// @brief IR 奥克斯 协议描述
+static constexpr ir_protocol_t sc_t_aux            = {
+  { _9MS, _4_5MS },
+  { { _0_56MS, _0_56MS }, { _0_56MS, _1_68MS }, { 0, 0 }, { 0, 0 } },
+  1,
+  false,
+  { { 0, 0 }, { 0, 0 } },
+  { _0_56MS, 0 },
+  sc_at_aux_layouts,
+  1,
+  _38KHZ,
+  0,
+};
+#endif
+
+#if 1 /* TCL */
+/// @brief IR TCL 段操作: 14字节, 重复2段
+static constexpr ir_op_t       sc_at_tcl_ops[]     = { ir_op_leader(), ir_op_data(0, 14) };
+/// @brief IR TCL 布局
+static constexpr ir_layout_t   sc_at_tcl_layouts[] = {
+  { 28, sc_at_tcl_ops, 2, 2, 14, 0 },
+};
+/// @brief IR TCL 协议描述 (段间为尾码 + 7.1ms 延时)
+static constexpr ir_protocol_t sc_t_tcl            = {
+  { _3_08MS, _1_6MS },
+  { { _0_5MS, _0_32MS }, { _0_5MS, _1_08MS }, { 0, 0 }, { 0, 0 } },
+  1,
+  false,
+  { { _0_5MS, _71MS }, { 0, 0 } },
+  { _0_5MS, 0 },
+  sc_at_tcl_layouts,
+  1,
+  _38KHZ,
+  0,
+};
+#endif
+
+#if 1 /* GREE 格力 */
+/// @brief IR 格力 段操作: 4字节 + 3位, 连接码, 1位 + 3字节 + 7位, 重复3段
+static constexpr ir_op_t       sc_at_gree_ops[]     = { ir_op_leader(), ir_op_data(0, 4), ir_op_data(4, 1, 3), ir_op_gap(0), ir_op_data(5, 1, 1), ir_op_data(6, 3), ir_op_data(9, 1, 7) };
+/// @brief IR 格力 布局
+static constexpr ir_layout_t   sc_at_gree_layouts[] = {
+  { 30, sc_at_gree_ops, 7, 3, 10, 1 },
+};
+/// @brief IR 格力 协议描述
+static constexpr ir_protocol_t sc_t_gree            = {
+  { _9MS, _4_5MS },
+  { { _0_56MS, _0_67MS }, { _0_56MS, _1_6MS }, { 0, 0 }, { 0, 0 } },
+  1,
+  false,
+  { { _0_67MS, _20MS }, { _0_67MS, _40MS } },
+  { _0_67MS, _0_56MS },
+  sc_at_gree_layouts,
+  1,
+  _38KHZ,
+  0,
+};
+#endif
+
+#if 1 /* OUTES 中广欧斯特 */
+/// @brief IR 中广欧斯特 段操作: 15字节
+static constexpr ir_op_t       sc_at_outes_ops[]     = { ir_op_leader(), ir_op_data(0, 15) };
+/// @brief IR 中广欧斯特 布局
+static constexpr ir_layout_t   sc_at_outes_layouts[] = {
+  { 15, sc_at_outes_ops, 2, 1, 0, 0 },
+};
+/// @brief IR 中广欧斯特 协议描述
+static constexpr ir_protocol_t sc_t_outes            = {
+  { _3_64MS, _1_84MS },
+  { { _0_44MS, _0_44MS }, { _0_44MS, _1_84MS }, { 0, 0 }, { 0, 0 } },
+  1,
+  false,
+  { { 0, 0 }, { 0, 0 } },
+  { _0_44MS, 0 },
+  sc_at_outes_layouts,
+  1,
+  _38KHZ,
+  0,
+};
+#endif
+
+#if 1 /* MIDEA 美的 */
+/// @brief IR 美的 段操作: 6字节, 按指令长度重复1~4段
+static constexpr ir_op_t       sc_at_midea_ops[]     = { ir_op_leader(), ir_op_data(0, 6) };
+/// @brief IR 美的 布局
+static constexpr ir_layout_t   sc_at_midea_layouts[] = {
+  { 6, sc_at_midea_ops, 2, 1, 6, 0 },
+  { 12, sc_at_midea_ops, 2, 2, 6, 0 },
+  { 18, sc_at_midea_ops, 2, 3, 6, 0 },
+  { 24, sc_at_midea_ops, 2, 4, 6, 0 },
+};
+/// @brief IR 美的 协议描述 (高位先发)
+static constexpr ir_protocol_t sc_t_midea            = {
+  { _4_5MS, _4_5MS },
+  { { _0_56MS, _0_56MS }, { _0_56MS, _1_6MS }, { 0, 0 }, { 0, 0 } },
+  1,
+  true,
+  { { _0_56MS, _5_22MS }, { 0, 0 } },
+  { _0_56MS, _0_56MS },
+  sc_at_midea_layouts,
+  4,
+  _38KHZ,
+  0,
+};
+#endif
+
+#if 1 /* XIAOMI 小米 */
+/// @brief IR 小米 段操作: 12字节
+static constexpr ir_op_t       sc_at_xiaomi_12_ops[]  = { ir_op_leader(), ir_op_data(0, 12) };
+/// @brief IR 小米 段操作: 11字节, 连接码, 8字节
+static constexpr ir_op_t       sc_at_xiaomi_19_ops[]  = { ir_op_leader(), ir_op_data(0, 11), ir_op_gap(0), ir_op_data(11, 8) };
+/// @brief IR 小米 布局
+static constexpr ir_layout_t   sc_at_xiaomi_layouts[] = {
+  { 12, sc_at_xiaomi_12_ops, 2, 1, 0, 0 },
+  { 19, sc_at_xiaomi_19_ops, 4, 1, 0, 0 },
+};
+/// @brief IR 小米 协议描述 (2位符号, 高位先发)
+static constexpr ir_protocol_t sc_t_xiaomi            = {
+  { _1MS, _0_588MS },
+  { { _0_588MS, _0_371MS }, { _0_588MS, _0_882MS }, { _0_588MS, _2_21MS }, { _0_588MS, _1_47MS } },
+  2,
+  true,
+  { { _0_588MS, _26_37MS }, { 0, 0 } },
+  { _0_588MS, 0 },
+  sc_at_xiaomi_layouts,
+  2,
+  _38KHZ,
+  0,
+};
+#endif
+
+#if 1 /* HISENSE 海信 */
+/// @brief IR 海信 段操作: V3.0 6字节 + 8字节 + 7字节
+static constexpr ir_op_t       sc_at_hisense_21_ops[]  = { ir_op_leader(), ir_op_data(0, 6), ir_op_gap(0), ir_op_data(6, 8), ir_op_gap(0), ir_op_data(14, 7) };
+/// @brief IR 海信 段操作: V4.0 23字节
+static constexpr ir_op_t       sc_at_hisense_23_ops[]  = { ir_op_leader(), ir_op_data(0, 23) };
+/// @brief IR 海信 布局
+static constexpr ir_layout_t   sc_at_hisense_layouts[] = {
+  { 21, sc_at_hisense_21_ops, 6, 1, 0, 0 },
+  { 23, sc_at_hisense_23_ops, 2, 1, 0, 0 },
+};
+/// @brief IR 海信 协议描述
+static constexpr ir_protocol_t sc_t_hisense            = {
+  { _9MS, _4_5MS },
+  { { _0_56MS, _0_56MS }, { _0_56MS, _1_68MS }, { 0, 0 }, { 0, 0 } },
+  1,
+  false,
+  { { _0_56MS, _8MS }, { 0, 0 } },
+  { _0_56MS, 0 },
+  sc_at_hisense_layouts,
+  2,
+  _38KHZ,
+  0,
+};
+#endif
+
+/**
+ * @brief IR 协议 获取机型协议描述
+ *
+ * @param  type                  红外遥控品牌类型
+ * @return const ir_protocol_t*  协议描述，不支持返回nullptr
+ */
+const ir_protocol_t* IR_Protocol::get(ir_type type)
+{
+  switch (type)
+  {
+    case ir_type::AUX :
+      return &sc_t_aux;
+    case ir_type::TCL :
+      return &sc_t_tcl;
+    case ir_type::GREE :
+      return &sc_t_gree;
+    case ir_type::OUTES :
+      return &sc_t_outes;
+    case ir_type::MIDEA :
+      return &sc_t_midea;
+    case ir_type::XIAOMI :
+      return &sc_t_xiaomi;
+    case ir_type::HISENSE :
+      return &sc_t_hisense;
+    default :
+      return nullptr;
+  }
+}
+
+/**
+ * @brief IR 协议 查找指令长度对应的布局
+ *
+ * @param  protocol            协议描述
+ * @param  length              指令长度
+ * @return const ir_layout_t*  协议布局，不支持返回nullptr
+ */
+const ir_layout_t* IR_Protocol::find(const ir_protocol_t& protocol, uint8_t length)
+{
+  for (uint8_t i = 0; i < protocol.layout_count; i++)
+  {
+    if (protocol.layouts[i].length == length)
+      return &protocol.layouts[i];
+  }
+  return nullptr;
+}
+
+/**
+ * @brief IR 协议 计算一帧的脉冲数量上限 (评估缓存区大小)
+ *
+ * @param  protocol  协议描述
+ * @param  length    指令长度
+ * @return uint16_t  脉冲数量上限，长度不支持返回0
+ */
+uint16_t IR_Protocol::count(const ir_protocol_t& protocol, uint8_t length)
+{
+  const ir_layout_t* layout = find(protocol, length);
+  if (nullptr == layout)
+    return 0;
+
+  /* 每段: 引导码/连接码各1个脉冲, 数据每个符号1个脉冲; 段间分隔与尾码各1个脉冲 */
+  uint32_t number = 0;
+  for (uint8_t op = 0; op < layout->op_count; op++)
+  {
+    const ir_op_t& code = layout->ops[op];
+    if (ir_op_code::DATA == code.code)
+      number += static_cast<uint32_t>(code.bytes) * ((code.bits + protocol.symbol_bits - 1) / protocol.symbol_bits);
+    else
+      number += 1;
+  }
+  number = number * layout->repeat + layout->repeat;
+
+  return (number > 0xFFFF) ? 0xFFFF : static_cast<uint16_t>(number);
+}
+
+/**
+ * @brief IR 协议 编码一帧
+ *
+ * @param  protocol  协议描述
+ * @param  data      指令数据
+ * @param  length    指令长度
+ * @param  timeline  输出时序
+ * @return bool      成功返回true，长度不支持或时序溢出返回false
+ */
+bool IR_Protocol::encode(const ir_protocol_t& protocol, const uint8_t* data, uint8_t length, IR_Timeline& timeline)
+{
+  const ir_layout_t* layout = find(protocol, length);
+  if (nullptr == layout || nullptr == data)
+    return false;
+
+  const uint8_t width = protocol.symbol_bits;
+  const uint8_t mask  = static_cast<uint8_t>((1U << width) - 1);
+
+  for (uint8_t segment = 0; segment < layout->repeat; segment++)
+  {
+    const uint8_t* base = data + segment * layout->stride;
+
+    for (uint8_t op = 0; op < layout->op_count; op++)
+    {
+      const ir_op_t& code = layout->ops[op];
+      switch (code.code)
+      {
+        case ir_op_code::LEADER :
+          timeline.push(protocol.leader.mark, protocol.leader.space);
+          break;
+        case ir_op_code::GAP :
+          timeline.push(protocol.gaps[code.offset].mark, protocol.gaps[code.offset].space);
+          break;
+        case ir_op_code::DATA :
+          for (uint8_t i = 0; i < code.bytes; i++)
+          {
+            const uint8_t byte = base[code.offset + i];
+            /* 低位先发: 自bit0向上; 高位先发: 自bit7向下 */
+            for (uint8_t bit = 0; bit < code.bits; bit += width)
+            {
+              const uint8_t    shift  = protocol.msb_first ? static_cast<uint8_t>(8 - width - bit) : bit;
+              const ir_pulse_t symbol = protocol.symbols[(byte >> shift) & mask];
+              timeline.push(symbol.mark, symbol.space);
+            }
+          }
+          break;
+        default :
+          return false;
+      }
+    }
+
+    if (segment + 1 < layout->repeat)
+      timeline.push(protocol.gaps[layout->separator].mark, protocol.gaps[layout->separator].space);
+  }
+
+  timeline.push(protocol.trailer.mark, protocol.trailer.space);
+  return !timeline.is_overflow();
+}
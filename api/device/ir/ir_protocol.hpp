@@ -0,0 +1,155 @@
+/**
+ * @file      ir_protocol.hpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for IR device protocol descriptor (红外遥控 协议描述)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#ifndef __IR_PROTOCOL_HPP__
+#define __IR_PROTOCOL_HPP__
+
+#include "ir_timeline.hpp"
+
+/// @brief 名称空间 库名
+namespace OwO
+{
+/// @brief 名称空间 设备
+namespace device
+{
+/// @brief 枚举 IR 机型
+enum class ir_type
+{
+  AUX,     /* 奥克斯 */
+  TCL,     /* TCL */
+  GREE,    /* 格力 */
+  OUTES,   /* 中广欧斯特 */
+  MIDEA,   /* 美的 */
+  XIAOMI,  /* 小米 */
+  HISENSE, /* 海信 */
+};
+
+/// @brief 枚举 IR 协议段操作码
+enum class ir_op_code : uint8_t
+{
+  LEADER, /* 头码 */
+  DATA,   /* 数据 (起始字节, 字节数, 每字节位数) */
+  GAP,    /* 连接码 (连接码下标) */
+};
+
+/// @brief 结构体 IR 协议段操作
+struct ir_op_t
+{
+  ir_op_code code;   /* 操作码 */
+  uint8_t    offset; /* DATA: 起始字节; GAP: 连接码下标 */
+  uint8_t    bytes;  /* DATA: 字节数 */
+  uint8_t    bits;   /* DATA: 每字节发送位数 */
+};
+
+/// @brief 结构体 IR 协议布局 (按指令长度区分)
+struct ir_layout_t
+{
+  uint8_t        length;    /* 指令长度 */
+  const ir_op_t* ops;       /* 段操作序列 */
+  uint8_t        op_count;  /* 段操作数量 */
+  uint8_t        repeat;    /* 段重复次数 */
+  uint8_t        stride;    /* 每次重复的数据偏移(字节) */
+  uint8_t        separator; /* 段间连接码下标 */
+};
+
+/// @brief 结构体 IR 协议描述
+struct ir_protocol_t
+{
+  ir_pulse_t         leader;       /* 头码 */
+  ir_pulse_t         symbols[4];   /* 符号时序 (按符号值索引) */
+  uint8_t            symbol_bits;  /* 符号位宽 (1或2) */
+  bool               msb_first;    /* 高位先发 */
+  ir_pulse_t         gaps[2];      /* 连接码 */
+  ir_pulse_t         trailer;      /* 尾码 */
+  const ir_layout_t* layouts;      /* 布局表 */
+  uint8_t            layout_count; /* 布局数量 */
+  uint16_t           frequency;    /* 载波频率(Hz, 0为默认) */
+  uint8_t            duty;         /* 载波占空比(%, 0为默认) */
+};
+
+/**
+ * @brief IR 协议段操作 头码
+ *
+ * @return constexpr ir_op_t 段操作
+ */
+constexpr ir_op_t ir_op_leader()
+{
+  return ir_op_t { ir_op_code::LEADER, 0, 0, 0 };
+}
+
+/**
+ * @brief IR 协议段操作 数据
+ *
+ * @param  offset  起始字节
+ * @param  bytes   字节数
+ * @param  bits    每字节发送位数
+ * @return constexpr ir_op_t 段操作
+ */
+constexpr ir_op_t ir_op_data(uint8_t offset, uint8_t bytes, uint8_t bits = 8)
+{
+  return ir_op_t { ir_op_code::DATA, offset, bytes, bits };
+}
+
+/**
+ * @brief IR 协议段操作 连接码
+ *
+ * @param  index   连接码下标
+ * @return constexpr ir_op_t 段操作
+ */
+constexpr ir_op_t ir_op_gap(uint8_t index)
+{
+  return ir_op_t { ir_op_code::GAP, index, 0, 0 };
+}
+
+/// @brief 类 IR 协议 -- 按协议描述将指令数据编译为标记/空闲时序 (不依赖硬件)
+class IR_Protocol
+{
+public:
+  /**
+   * @brief IR 协议 获取机型协议描述
+   *
+   * @param  type                  红外遥控品牌类型
+   * @return const ir_protocol_t*  协议描述，不支持返回nullptr
+   */
+  static const ir_protocol_t* get(ir_type type);
+
+  /**
+   * @brief IR 协议 查找指令长度对应的布局
+   *
+   * @param  protocol            协议描述
+   * @param  length              指令长度
+   * @return const ir_layout_t*  协议布局，不支持返回nullptr
+   */
+  static const ir_layout_t* find(const ir_protocol_t& protocol, uint8_t length);
+
+  /**
+   * @brief IR 协议 计算一帧的脉冲数量上限 (评估缓存区大小)
+   *
+   * @param  protocol  协议描述
+   * @param  length    指令长度
+   * @return uint16_t  脉冲数量上限，长度不支持返回0
+   */
+  static uint16_t count(const ir_protocol_t& protocol, uint8_t length);
+
+  /**
+   * @brief IR 协议 编码一帧
+   *
+   * @param  protocol  协议描述
+   * @param  data      指令数据
+   * @param  length    指令长度
+   * @param  timeline  输出时序
+   * @return bool      成功返回true，长度不支持或时序溢出返回false
+   */
+  static bool encode(const ir_protocol_t& protocol, const uint8_t* data, uint8_t length, IR_Timeline& timeline);
+};
+} /* namespace device */
+} /* namespace OwO */
+
+#endif /* __IR_PROTOCOL_HPP__ */
@@ -0,0 +1,202 @@
+/**
+ * @file      ir_raw.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for IR device raw timing upload (红外遥控 原始时序上传)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "ir_raw.hpp"
+
+using namespace OwO;
+using namespace device;
+
+/**
+ * @brief (静态内联) IR 原始时序 读取第 index 个4位下标 (每寄存器4个, 高位在前)
+ *
+ * @param  indices  下标寄存器
+ * @param  index    时长序号
+ * @return uint8_t  字典下标
+ */
+static inline uint8_t sl_index(const uint16_t* indices, uint16_t index)
+{
+  return static_cast<uint8_t>((indices[index / 4] >> (12 - 4 * (index % 4))) & 0x0F);
+}
+
+/**
+ * @brief IR 原始时序 计算头部描述的数据所需的寄存器数量(含头部)
+ *
+ * @param  header   头部
+ * @return uint32_t 寄存器数量
+ */
+uint32_t IR_Raw::registers(const ir_raw_header_t& header)
+{
+  if (0 == header.dictionary)
+    return HEADER_SIZE + static_cast<uint32_t>(header.entries);
+
+  return HEADER_SIZE + static_cast<uint32_t>(header.dictionary) + (static_cast<uint32_t>(header.entries) + 3) / 4;
+}
+
+/**
+ * @brief IR 原始时序 校验并解码上传区
+ *
+ * @param  regs       上传区寄存器
+ * @param  size       上传区寄存器数量
+ * @param  header     头部(输出)
+ * @param  pulses     脉冲序列(输出)
+ * @param  capacity   脉冲序列容量
+ * @param  count      脉冲数量(输出)
+ * @return ir_raw_error 校验结果, 失败时脉冲数量为0
+ */
+ir_raw_error IR_Raw::parse(const uint16_t* regs, uint16_t size, ir_raw_header_t& header, ir_pulse_t* pulses, uint16_t capacity, uint16_t& count)
+{
+  count = 0;
+  if (nullptr == regs || size < HEADER_SIZE)
+    return ir_raw_error::SIZE;
+
+  header.mask       = regs[0];
+  header.count      = regs[1];
+  header.frequency  = regs[2];
+  header.duty       = regs[3];
+  header.entries    = regs[4];
+  header.dictionary = regs[5];
+
+  /* 头部校验 */
+  if (0 == header.mask || 0 != (header.mask >> CHANNEL_COUNT))
+    return ir_raw_error::CHANNEL;
+
+  if (0 != header.frequency && (header.frequency < MIN_FREQUENCY || header.frequency > MAX_FREQUENCY))
+    return ir_raw_error::CARRIER;
+
+  if (0 != header.duty && (header.duty < MIN_DUTY || header.duty > MAX_DUTY))
+    return ir_raw_error::DUTY;
+
+  if (header.dictionary > MAX_DICTIONARY)
+    return ir_raw_error::DICTIONARY;
+
+  uint16_t number = static_cast<uint16_t>((static_cast<uint32_t>(header.entries) + 1) / 2);
+  if (0 == header.entries || nullptr == pulses || number > capacity)
+    return ir_raw_error::LENGTH;
+
+  if (registers(header) > size)
+    return ir_raw_error::SIZE;
+
+  /* 逐个时长校验并解码: 标记不为0, 空闲仅末尾可为0 */
+  const uint16_t* data    = regs + HEADER_SIZE;
+  const uint16_t* indices = data + header.dictionary;
+  uint32_t        total   = 0;
+
+  for (uint16_t i = 0; i < header.entries; i++)
+  {
+    uint16_t value = 0;
+    if (0 == header.dictionary)
+      value = data[i];
+    else
+    {
+      uint8_t index = sl_index(indices, i);
+      if (index >= header.dictionary)
+        return ir_raw_error::INDEX;
+      value = data[index];
+    }
+
+    bool mark = (0 == (i & 1));
+    if (0 == value && (mark || i + 1 != header.entries))
+      return ir_raw_error::DURATION;
+
+    total += value;
+    if (total > MAX_FRAME_TIME)
+      return ir_raw_error::FRAME_TIME;
+
+    if (mark)
+      pulses[i / 2] = ir_pulse_t { value, 0 };
+    else
+      pulses[i / 2].space = value;
+  }
+
+  count = number;
+  return ir_raw_error::NONE;
+}
+
+/**
+ * @brief IR 原始时序 编码上传区 (不同时长不超过字典大小时使用字典, 否则直接写入时长)
+ *
+ * @param  pulses     脉冲序列
+ * @param  count      脉冲数量
+ * @param  header     头部(通道掩码、发送次数、载波设置由调用者填写, 时长数量与字典大小由编码输出)
+ * @param  regs       上传区寄存器(输出)
+ * @param  size       上传区寄存器容量
+ * @return uint16_t   写入的寄存器数量(含头部), 容量不足返回0
+ */
+uint16_t IR_Raw::build(const ir_pulse_t* pulses, uint16_t count, ir_raw_header_t& header, uint16_t* regs, uint16_t size)
+{
+  header.entries    = 0;
+  header.dictionary = 0;
+  if (nullptr == pulses || nullptr == regs || 0 == count || count > 0x7FFF)
+    return 0;
+
+  /* 统计不同时长 */
+  uint16_t dictionary[MAX_DICTIONARY];
+  uint16_t number = 0;
+  bool     fits   = true;
+  for (uint16_t i = 0; i < count * 2 && fits; i++)
+  {
+    uint16_t value = (0 == (i & 1)) ? pulses[i / 2].mark : pulses[i / 2].space;
+    uint16_t j     = 0;
+    while (j < number && dictionary[j] != value)
+      j++;
+
+    if (j < number)
+      continue;
+
+    if (number < MAX_DICTIONARY)
+      dictionary[number++] = value;
+    else
+      fits = false;
+  }
+
+  header.entries    = static_cast<uint16_t>(count * 2);
+  header.dictionary = fits ? number : 0;
+
+  uint32_t total = registers(header);
+  if (total > size)
+    return 0;
+
+  regs[0] = header.mask;
+  regs[1] = header.count;
+  regs[2] = header.frequency;
+  regs[3] = header.duty;
+  regs[4] = header.entries;
+  regs[5] = header.dictionary;
+
+  uint16_t* data = regs + HEADER_SIZE;
+  if (0 == header.dictionary)
+  {
+    for (uint16_t i = 0; i < count; i++)
+    {
+      data[i * 2]     = pulses[i].mark;
+      data[i * 2 + 1] = pulses[i].space;
+    }
+    return static_cast<uint16_t>(total);
+  }
+
+  /* 字典 + 4位下标 */
+  uint16_t* indices = data + header.dictionary;
+  for (uint16_t i = 0; i < header.dictionary; i++)
+    data[i] = dictionary[i];
+
+  for (uint16_t i = 0; i < (header.entries + 3) / 4; i++)
+    indices[i] = 0;
+
+  for (uint16_t i = 0; i < header.entries; i++)
+  {
+    uint16_t value = (0 == (i & 1)) ? pulses[i / 2].mark : pulses[i / 2].space;
+    uint16_t j     = 0;
+    while (dictionary[j] != value)
+      j++;
+    indices[i / 4] |= static_cast<uint16_t>(j << (12 - 4 * (i % 4)));
+  }
+
+  return static_cast<uint16_t>(total);
+}
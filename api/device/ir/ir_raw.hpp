@@ -0,0 +1,111 @@
+/**
+ * @file      ir_raw.hpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for IR device raw timing upload (红外遥控 原始时序上传)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#ifndef __IR_RAW_HPP__
+#define __IR_RAW_HPP__
+
+#include "ir_timeline.hpp"
+
+/// @brief 名称空间 库名
+namespace OwO
+{
+/// @brief 名称空间 设备
+namespace device
+{
+/// @brief 枚举 IR 原始时序 校验结果
+enum class ir_raw_error : uint8_t
+{
+  NONE,       /* 校验通过 */
+  SIZE,       /* 寄存器数量不足(头部或数据不完整) */
+  CHANNEL,    /* 通道掩码无效 */
+  CARRIER,    /* 载波频率超出范围 */
+  DUTY,       /* 载波占空比超出范围 */
+  LENGTH,     /* 时长数量为0或超出容量 */
+  DICTIONARY, /* 字典大小超出范围 */
+  INDEX,      /* 字典下标越界 */
+  DURATION,   /* 标记为0, 或非末尾空闲为0 */
+  FRAME_TIME, /* 帧总时长超出上限 */
+};
+
+/// @brief 结构体 IR 原始时序 头部 (保持寄存器顺序)
+struct ir_raw_header_t
+{
+  uint16_t mask;       /* 通道掩码 (位0~7对应通道1~8, 非0即触发) */
+  uint16_t count;      /* 发送次数 (0按1次) */
+  uint16_t frequency;  /* 载波频率(Hz, 0为默认) */
+  uint16_t duty;       /* 载波占空比(%, 0为默认) */
+  uint16_t entries;    /* 时长数量 (标记/空闲交替, 标记在前, 奇数时末尾空闲为0) */
+  uint16_t dictionary; /* 字典大小 (0: 数据为时长; 1~16: 数据为字典时长 + 每寄存器4个4位下标, 高位在前) */
+};
+
+/// @brief 类 IR 原始时序 -- 单次写多个寄存器(FC16)上传的标记/空闲时序的校验、解码与编码 (不依赖硬件)
+class IR_Raw
+{
+public:
+  /// @brief 头部寄存器数量
+  static constexpr uint16_t HEADER_SIZE    = sizeof(ir_raw_header_t) / sizeof(uint16_t);
+  /// @brief 上传区寄存器数量 (FC16 单次最多写入123个寄存器)
+  static constexpr uint16_t BLOCK_SIZE     = 123;
+  /// @brief 最大字典大小 (4位下标)
+  static constexpr uint16_t MAX_DICTIONARY = 16;
+  /// @brief 单个上传区可容纳的最大脉冲数量 (字典大小为1时)
+  static constexpr uint16_t MAX_PULSES     = (BLOCK_SIZE - HEADER_SIZE - 1) * 2;
+  /// @brief 通道数量
+  static constexpr uint8_t  CHANNEL_COUNT  = 8;
+  /// @brief 载波频率下限(Hz)
+  static constexpr uint16_t MIN_FREQUENCY  = 30000;
+  /// @brief 载波频率上限(Hz)
+  static constexpr uint16_t MAX_FREQUENCY  = 60000;
+  /// @brief 载波占空比下限(%)
+  static constexpr uint16_t MIN_DUTY       = 10;
+  /// @brief 载波占空比上限(%)
+  static constexpr uint16_t MAX_DUTY       = 60;
+  /// @brief 帧总时长上限(us)
+  static constexpr uint32_t MAX_FRAME_TIME = 2000000;
+
+  static_assert(6 == HEADER_SIZE, "ir_raw_header_t must match register layout");
+
+  /**
+   * @brief IR 原始时序 计算头部描述的数据所需的寄存器数量(含头部)
+   *
+   * @param  header   头部
+   * @return uint32_t 寄存器数量
+   */
+  static uint32_t registers(const ir_raw_header_t& header);
+
+  /**
+   * @brief IR 原始时序 校验并解码上传区
+   *
+   * @param  regs       上传区寄存器
+   * @param  size       上传区寄存器数量
+   * @param  header     头部(输出)
+   * @param  pulses     脉冲序列(输出)
+   * @param  capacity   脉冲序列容量
+   * @param  count      脉冲数量(输出)
+   * @return ir_raw_error 校验结果, 失败时脉冲数量为0
+   */
+  static ir_raw_error parse(const uint16_t* regs, uint16_t size, ir_raw_header_t& header, ir_pulse_t* pulses, uint16_t capacity, uint16_t& count);
+
+  /**
+   * @brief IR 原始时序 编码上传区 (不同时长不超过字典大小时使用字典, 否则直接写入时长)
+   *
+   * @param  pulses     脉冲序列
+   * @param  count      脉冲数量
+   * @param  header     头部(通道掩码、发送次数、载波设置由调用者填写, 时长数量与字典大小由编码输出)
+   * @param  regs       上传区寄存器(输出)
+   * @param  size       上传区寄存器容量
+   * @return uint16_t   写入的寄存器数量(含头部), 容量不足返回0
+   */
+  static uint16_t build(const ir_pulse_t* pulses, uint16_t count, ir_raw_header_t& header, uint16_t* regs, uint16_t size);
+};
+} /* namespace device */
+} /* namespace OwO */
+
+#endif /* __IR_RAW_HPP__ */
@@ -0,0 +1,239 @@
+/**
+ * @file      ir_receiver.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for IR device learning receiver (红外遥控 学习接收)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "ir_receiver.hpp"
+#include "port_gpio.h"
+#include "port_os.h"
+
+using namespace OwO;
+using namespace device;
+
+/**
+ * @brief IR 学习接收 构造函数
+ */
+IR_Receiver::IR_Receiver() : m_ring {}, m_pulses {}
+{
+  m_read        = 0;
+  m_remaining   = 0;
+  m_halves      = 0;
+  m_seen        = 0;
+  m_start_tick  = 0;
+  m_active_tick = 0;
+  m_timeout     = 0;
+  m_state       = IDLE;
+  m_is_open     = false;
+}
+
+/**
+ * @brief (私有函数) IR 学习接收 解码环形缓存区中从读取位置至指定位置的边沿
+ *
+ * @param end 结束位置(不含, 小于读取位置时表示已回绕)
+ */
+void IR_Receiver::m_drain(uint16_t end)
+{
+  if (end < m_read)
+  {
+    m_learner.feed(&m_ring[m_read], static_cast<uint16_t>(RING_SIZE - m_read));
+    m_read = 0;
+  }
+
+  m_learner.feed(&m_ring[m_read], static_cast<uint16_t>(end - m_read));
+  m_read = (RING_SIZE == end) ? 0 : end;
+}
+
+/**
+ * @brief (私有函数) IR 学习接收 停止捕获并解码剩余边沿
+ *
+ */
+void IR_Receiver::m_stop()
+{
+  /* 先停止捕获再终止DMA, 此后不再产生回调, 剩余传输数量即最终写入位置 */
+  e_port_timer_ic_dma_stop(TIMER_NUM);
+  uint16_t remaining = us_port_timer_dma_get_remaining(TIMER_NUM, static_cast<port_timer_dma_request_e>(PORT_TIMER_DMA_CC1 + CHANNEL - 1));
+  m_drain(static_cast<uint16_t>((RING_SIZE - remaining) % RING_SIZE));
+}
+
+/**
+ * @brief (静态) IR 学习接收 DMA传输过半回调入口 (前半区已写满)
+ *
+ * @param arg IR 学习接收实例
+ */
+void IR_Receiver::half_entry(void* arg)
+{
+  IR_Receiver* receiver = static_cast<IR_Receiver*>(arg);
+  receiver->m_drain(RING_SIZE / 2);
+  receiver->m_halves++;
+}
+
+/**
+ * @brief (静态) IR 学习接收 DMA传输完成回调入口 (后半区已写满)
+ *
+ * @param arg IR 学习接收实例
+ */
+void IR_Receiver::cplt_entry(void* arg)
+{
+  IR_Receiver* receiver = static_cast<IR_Receiver*>(arg);
+  receiver->m_drain(RING_SIZE);
+  receiver->m_halves++;
+}
+
+/**
+ * @brief IR 学习接收 查询引脚是否为接收定时器的捕获通道
+ *
+ * @param  port   端口编号
+ * @param  pin    引脚编号
+ * @return bool   支持返回true
+ */
+bool IR_Receiver::lookup(Gpio::Port port, uint8_t pin)
+{
+  /* PA0, PA5, PA15: TIM2_CH1 */
+  return Gpio::PA == port && (0 == pin || 5 == pin || 15 == pin);
+}
+
+/**
+ * @brief IR 学习接收 初始化引脚与定时器 (不分频, 自动重装载值为32位最大值)
+ *
+ * @param  port   端口编号
+ * @param  pin    引脚编号
+ * @return bool   成功返回true，失败返回false
+ */
+bool IR_Receiver::open(Gpio::Port port, uint8_t pin)
+{
+  if (m_is_open)
+    close();
+
+  if (!lookup(port, pin))
+    return false;
+
+  v_port_gpio_af_init(port, pin, PORT_GPIO_AF_PP, PORT_GPIO_PULL_UP, PORT_GPIO_SPEED_VERY_HIGH, ul_port_timer_get_gpio_af(TIMER_NUM));
+
+  if (SUCESS != e_port_timer_ic_init(TIMER_NUM, 0, 0xFFFF, CHANNEL, 1, PORT_TIMER_UP, 1, false))
+  {
+    v_port_gpio_deinit(port, pin, PORT_GPIO_AF_PP);
+    return false;
+  }
+  e_port_timer_set_autoreload(TIMER_NUM, 0xFFFFFFFF);
+
+  m_is_open = true;
+  return true;
+}
+
+/**
+ * @brief IR 学习接收 关闭定时器
+ *
+ */
+void IR_Receiver::close()
+{
+  if (!m_is_open)
+    return;
+
+  cancel();
+  e_port_timer_deinit(TIMER_NUM);
+  m_is_open = false;
+}
+
+/**
+ * @brief IR 学习接收 开始学习(非阻塞, 之后周期调用 poll 查询)
+ *
+ * @param  timeout  等待首个边沿的超时时间(ms)
+ * @return bool     开始返回true，正在学习或失败返回false
+ */
+bool IR_Receiver::start(uint32_t timeout)
+{
+  if (!m_is_open || LISTENING == m_state || CAPTURING == m_state)
+    return false;
+
+  m_learner.reset(m_pulses, MAX_PULSES, ul_port_timer_get_clock(TIMER_NUM), 32);
+  m_read        = 0;
+  m_remaining   = RING_SIZE;
+  m_halves      = 0;
+  m_seen        = 0;
+  m_start_tick  = ul_port_os_get_tick_count();
+  m_active_tick = m_start_tick;
+  m_timeout     = timeout;
+
+  port_timer_callback_t half_cb;
+  port_timer_callback_t cplt_cb;
+  half_cb.function = half_entry;
+  half_cb.arg      = static_cast<void*>(this);
+  cplt_cb.function = cplt_entry;
+  cplt_cb.arg      = static_cast<void*>(this);
+
+  if (SUCESS != e_port_timer_ic_dma_start(TIMER_NUM, m_ring, RING_SIZE, PORT_DMA_CIRCULAR, &half_cb, &cplt_cb))
+  {
+    m_state = IDLE;
+    return false;
+  }
+
+  m_state = LISTENING;
+  return true;
+}
+
+/**
+ * @brief IR 学习接收 查询学习进度 (线程上下文周期调用, 无新边沿超过帧结束判定时间即完成解码)
+ *
+ * @return state_e 当前状态
+ */
+IR_Receiver::state_e IR_Receiver::poll()
+{
+  if (LISTENING != m_state && CAPTURING != m_state)
+    return m_state;
+
+  uint32_t now       = ul_port_os_get_tick_count();
+  uint16_t remaining = us_port_timer_dma_get_remaining(TIMER_NUM, static_cast<port_timer_dma_request_e>(PORT_TIMER_DMA_CC1 + CHANNEL - 1));
+  uint32_t halves    = m_halves;
+
+  /* 写入位置或半区计数变化即有新边沿 (半区计数区分恰好写满一圈的情况) */
+  if (remaining != m_remaining || halves != m_seen)
+  {
+    m_remaining   = remaining;
+    m_seen        = halves;
+    m_active_tick = now;
+    m_state       = CAPTURING;
+    return m_state;
+  }
+
+  if (LISTENING == m_state)
+  {
+    if (now - m_start_tick >= m_timeout)
+    {
+      e_port_timer_ic_dma_stop(TIMER_NUM);
+      m_state = TIMEOUT;
+    }
+    return m_state;
+  }
+
+  if (now - m_active_tick < END_GAP)
+    return m_state;
+
+  m_stop();
+  m_learner.finish();
+  m_state = (0 != m_learner.size()) ? DONE : TIMEOUT;
+  return m_state;
+}
+
+/**
+ * @brief IR 学习接收 取消学习
+ *
+ */
+void IR_Receiver::cancel()
+{
+  if (LISTENING == m_state || CAPTURING == m_state)
+    e_port_timer_ic_dma_stop(TIMER_NUM);
+  m_state = IDLE;
+}
+
+/**
+ * @brief IR 学习接收 析构函数
+ */
+IR_Receiver::~IR_Receiver()
+{
+  close();
+}
@@ -0,0 +1,125 @@
+/**
+ * @file      ir_receiver.hpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for IR device learning receiver (红外遥控 学习接收)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#ifndef __IR_RECEIVER_HPP__
+#define __IR_RECEIVER_HPP__
+
+#include "virtual_gpio.hpp"
+#include "port_tim.h"
+#include "ir_learn.hpp"
+
+/// @brief 名称空间 库名
+namespace OwO
+{
+/// @brief 名称空间 设备
+namespace device
+{
+/// @brief 类 IR 学习接收 -- 32位定时器双边沿输入捕获, DMA将边沿时刻写入环形缓存区, 传输过半/完成时解码 (不产生逐边沿中断)
+class IR_Receiver
+{
+  O_MEMORY
+  NO_COPY(IR_Receiver)
+  NO_MOVE(IR_Receiver)
+
+public:
+  /// @brief 定时器编号 (32位计数器, 不分频)
+  static constexpr uint8_t  TIMER_NUM  = 2;
+  /// @brief 输入捕获通道
+  static constexpr uint8_t  CHANNEL    = 1;
+  /// @brief 边沿环形缓存区容量 (38kHz原始载波约6.7ms填满)
+  static constexpr uint16_t RING_SIZE  = 512;
+  /// @brief 最大脉冲数量 (与 IR 单帧时序容量一致)
+  static constexpr uint16_t MAX_PULSES = 320;
+  /// @brief 帧结束判定时间(ms) (无新边沿超过该时间视为接收完成)
+  static constexpr uint32_t END_GAP    = 100;
+
+  /// @brief 枚举 IR 学习接收 状态
+  enum state_e
+  {
+    IDLE,      /* 空闲 */
+    LISTENING, /* 等待首个边沿 */
+    CAPTURING, /* 正在接收 */
+    DONE,      /* 接收完成 */
+    TIMEOUT,   /* 等待超时 */
+  };
+
+private:
+  /// @brief 学习解码
+  IR_Learner        m_learner;
+  /// @brief 边沿时刻环形缓存区
+  uint32_t          m_ring[RING_SIZE];
+  /// @brief 学习结果脉冲序列
+  ir_pulse_t        m_pulses[MAX_PULSES];
+  /// @brief 环形缓存区读取位置
+  uint16_t          m_read;
+  /// @brief 上次查询时的DMA剩余传输数量
+  uint16_t          m_remaining;
+  /// @brief 已解码的半区数量 (中断上下文递增)
+  volatile uint32_t m_halves;
+  /// @brief 上次查询时的已解码半区数量
+  uint32_t          m_seen;
+  /// @brief 开始等待时刻(ms)
+  uint32_t          m_start_tick;
+  /// @brief 最近一次收到边沿的时刻(ms)
+  uint32_t          m_active_tick;
+  /// @brief 等待首个边沿的超时时间(ms)
+  uint32_t          m_timeout;
+  /// @brief 当前状态
+  state_e           m_state;
+  /// @brief 定时器已初始化
+  bool              m_is_open;
+
+  void m_drain(uint16_t end);
+  void m_stop();
+
+  static void half_entry(void* arg);
+  static void cplt_entry(void* arg);
+
+public:
+  IR_Receiver();
+
+  static bool lookup(Gpio::Port port, uint8_t pin);
+
+  bool open(Gpio::Port port, uint8_t pin);
+
+  void close();
+
+  bool start(uint32_t timeout);
+
+  state_e poll();
+
+  void cancel();
+
+  /**
+   * @brief IR 学习接收 获取当前状态
+   *
+   * @return state_e 当前状态
+   */
+  state_e state() const
+  {
+    return m_state;
+  }
+
+  /**
+   * @brief IR 学习接收 获取学习结果 (接收完成后有效)
+   *
+   * @return const IR_Learner& 学习解码
+   */
+  const IR_Learner& result() const
+  {
+    return m_learner;
+  }
+
+  ~IR_Receiver();
+};
+} /* namespace device */
+} /* namespace OwO */
+
+#endif /* __IR_RECEIVER_HPP__ */
@@ -0,0 +1,346 @@
+/**
+ * @file      ir_scheduler.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for IR device multi-channel scheduler (红外遥控 多通道调度)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "ir_scheduler.hpp"
+
+using namespace OwO;
+using namespace device;
+
+/**
+ * @brief IR 多通道调度器 复位 (全部通道空闲)
+ *
+ */
+void IR_Scheduler::reset()
+{
+  for (uint8_t i = 0; i < CHANNEL_COUNT; i++)
+  {
+    m_jobs[i]      = ir_job_t { ir_job_state::IDLE, 0, 0, 0, 0 };
+    m_suspended[i] = ir_job_t { ir_job_state::IDLE, 0, 0, 0, 0 };
+  }
+}
+
+/**
+ * @brief IR 多通道调度器 提交发送任务
+ *
+ * @param  channel  通道下标(0~7)
+ * @param  count    发送次数
+ * @param  delay    帧间延时(ms, 最后一帧之后同样延时)
+ * @param  now      当前时刻(ms)
+ * @param  priority 优先级 (数值越大越优先)
+ * @return bool     成功返回true，通道忙或参数错误返回false
+ */
+bool IR_Scheduler::submit(uint8_t channel, uint8_t count, uint32_t delay, uint32_t now, uint8_t priority)
+{
+  if (channel >= CHANNEL_COUNT || 0 == count || is_busy(channel))
+    return false;
+
+  m_jobs[channel] = ir_job_t { ir_job_state::PENDING, count, priority, delay, now };
+  return true;
+}
+
+/**
+ * @brief IR 多通道调度器 提交定时发送任务 (到达指定时刻后等待发送)
+ *
+ * @param  channel  通道下标(0~7)
+ * @param  count    发送次数
+ * @param  delay    帧间延时(ms, 最后一帧之后同样延时)
+ * @param  at       首帧时刻(ms)
+ * @param  priority 优先级 (数值越大越优先)
+ * @return bool     成功返回true，通道忙或参数错误返回false
+ */
+bool IR_Scheduler::submit_at(uint8_t channel, uint8_t count, uint32_t delay, uint32_t at, uint8_t priority)
+{
+  if (channel >= CHANNEL_COUNT || 0 == count || is_busy(channel))
+    return false;
+
+  /* 以帧间延时状态等待, 到期后与普通任务相同 */
+  m_jobs[channel] = ir_job_t { ir_job_state::WAITING, count, priority, delay, at };
+  return true;
+}
+
+/**
+ * @brief IR 多通道调度器 通道能否接受指定优先级的任务 (空闲, 或当前任务优先级更低且不在发送中)
+ *
+ * @param  channel   通道下标(0~7)
+ * @param  priority  优先级
+ * @return bool      能接受返回true
+ */
+bool IR_Scheduler::admit(uint8_t channel, uint8_t priority) const
+{
+  if (channel >= CHANNEL_COUNT)
+    return false;
+
+  if (!is_busy(channel))
+    return true;
+
+  /* 发送中的帧不可打断, 等待其结束后的下一周期 */
+  const ir_job_t& job = m_jobs[channel];
+  return ir_job_state::ON_AIR != job.state && job.priority < priority;
+}
+
+/**
+ * @brief IR 多通道调度器 抢占通道当前任务 (帧间或重复发送之间; 通道回到空闲)
+ *
+ * @param  channel  通道下标(0~7)
+ * @param  policy   被抢占任务的处理策略
+ * @return bool     任务已挂起返回true，任务被丢弃(或无可挂起的任务)返回false
+ */
+bool IR_Scheduler::preempt(uint8_t channel, ir_preempt_policy policy)
+{
+  if (channel >= CHANNEL_COUNT || !is_busy(channel) || ir_job_state::ON_AIR == m_jobs[channel].state)
+    return false;
+
+  /* 每个通道只挂起一个任务: 已有挂起任务时保留优先级较高者 (同优先级保留先挂起的) */
+  ir_job_t& job       = m_jobs[channel];
+  ir_job_t& suspended = m_suspended[channel];
+  bool      keep      = ir_preempt_policy::RESUME == policy && 0 != job.remain && (ir_job_state::IDLE == suspended.state || suspended.priority < job.priority);
+  if (keep)
+  {
+    /* 未到时刻的定时任务保留首帧时刻 */
+    suspended       = job;
+    suspended.state = (ir_job_state::WAITING == job.state) ? ir_job_state::WAITING : ir_job_state::PENDING;
+  }
+
+  job = ir_job_t { ir_job_state::IDLE, 0, 0, 0, 0 };
+  return keep;
+}
+
+/**
+ * @brief IR 多通道调度器 恢复挂起的任务 (所在通道的抢占任务已结束)
+ *
+ * @param  now      当前时刻(ms)
+ * @return uint8_t  恢复的通道掩码
+ */
+uint8_t IR_Scheduler::resume(uint32_t now)
+{
+  uint8_t mask = 0;
+
+  for (uint8_t i = 0; i < CHANNEL_COUNT; i++)
+  {
+    if (ir_job_state::IDLE == m_suspended[i].state || is_busy(i))
+      continue;
+
+    /* 抢占任务最后一帧之后已延时, 恢复后立即等待发送 (定时任务未到时刻时继续等待) */
+    m_jobs[i] = m_suspended[i];
+    if (ir_job_state::PENDING == m_jobs[i].state || m_is_due(now, m_jobs[i].due))
+    {
+      m_jobs[i].state = ir_job_state::PENDING;
+      m_jobs[i].due   = now;
+    }
+    m_suspended[i] = ir_job_t { ir_job_state::IDLE, 0, 0, 0, 0 };
+    mask          |= (1U << i);
+  }
+
+  return mask;
+}
+
+/**
+ * @brief IR 多通道调度器 推进延时并取出待发送的通道 (取出的通道进入发送状态)
+ *
+ * @param  now      当前时刻(ms)
+ * @param  ready    可发送的通道掩码
+ * @return uint8_t  本次需要发送的通道掩码
+ */
+uint8_t IR_Scheduler::poll(uint32_t now, uint8_t ready)
+{
+  uint8_t mask = 0;
+
+  for (uint8_t i = 0; i < CHANNEL_COUNT; i++)
+  {
+    ir_job_t& job = m_jobs[i];
+
+    /* 帧间延时到期: 仍有剩余次数则等待发送, 否则任务完成 */
+    if (ir_job_state::WAITING == job.state && m_is_due(now, job.due))
+      job.state = (0 != job.remain) ? ir_job_state::PENDING : ir_job_state::DONE;
+
+    if (ir_job_state::PENDING == job.state && (ready & (1U << i)))
+    {
+      job.state  = ir_job_state::ON_AIR;
+      mask      |= (1U << i);
+    }
+  }
+
+  return mask;
+}
+
+/**
+ * @brief IR 多通道调度器 通道一帧发送结束
+ *
+ * @param channel 通道下标(0~7)
+ * @param success 发送成功
+ * @param now     当前时刻(ms)
+ */
+void IR_Scheduler::complete(uint8_t channel, bool success, uint32_t now)
+{
+  if (channel >= CHANNEL_COUNT || ir_job_state::ON_AIR != m_jobs[channel].state)
+    return;
+
+  ir_job_t& job = m_jobs[channel];
+  if (!success)
+  {
+    job.state  = ir_job_state::FAILED;
+    job.remain = 0;
+    return;
+  }
+
+  job.remain--;
+  job.state = ir_job_state::WAITING;
+  job.due   = now + job.delay;
+}
+
+/**
+ * @brief IR 多通道调度器 取出的通道本轮未发送 (回到等待发送, 如与同一载波的其他通道载波设置不同)
+ *
+ * @param channel 通道下标(0~7)
+ */
+void IR_Scheduler::defer(uint8_t channel)
+{
+  if (channel < CHANNEL_COUNT && ir_job_state::ON_AIR == m_jobs[channel].state)
+    m_jobs[channel].state = ir_job_state::PENDING;
+}
+
+/**
+ * @brief IR 多通道调度器 取消通道任务 (通道回到空闲, 同时丢弃挂起的任务)
+ *
+ * @param channel 通道下标(0~7)
+ */
+void IR_Scheduler::cancel(uint8_t channel)
+{
+  if (channel < CHANNEL_COUNT)
+  {
+    m_jobs[channel]      = ir_job_t { ir_job_state::IDLE, 0, 0, 0, 0 };
+    m_suspended[channel] = ir_job_t { ir_job_state::IDLE, 0, 0, 0, 0 };
+  }
+}
+
+/**
+ * @brief IR 多通道调度器 通道是否忙 (等待发送/正在发送/帧间延时)
+ *
+ * @param  channel  通道下标(0~7)
+ * @return bool     忙返回true
+ */
+bool IR_Scheduler::is_busy(uint8_t channel) const
+{
+  switch (state(channel))
+  {
+    case ir_job_state::PENDING :
+    case ir_job_state::ON_AIR :
+    case ir_job_state::WAITING :
+      return true;
+    default :
+      return false;
+  }
+}
+
+/**
+ * @brief IR 多通道调度器 获取忙通道掩码
+ *
+ * @return uint8_t 忙通道掩码
+ */
+uint8_t IR_Scheduler::busy_mask() const
+{
+  uint8_t mask = 0;
+  for (uint8_t i = 0; i < CHANNEL_COUNT; i++)
+  {
+    if (is_busy(i))
+      mask |= (1U << i);
+  }
+  return mask;
+}
+
+/**
+ * @brief IR 多通道调度器 获取发送完成通道掩码
+ *
+ * @return uint8_t 发送完成通道掩码
+ */
+uint8_t IR_Scheduler::done_mask() const
+{
+  uint8_t mask = 0;
+  for (uint8_t i = 0; i < CHANNEL_COUNT; i++)
+  {
+    if (ir_job_state::DONE == m_jobs[i].state)
+      mask |= (1U << i);
+  }
+  return mask;
+}
+
+/**
+ * @brief IR 多通道调度器 获取发送失败通道掩码
+ *
+ * @return uint8_t 发送失败通道掩码
+ */
+uint8_t IR_Scheduler::failed_mask() const
+{
+  uint8_t mask = 0;
+  for (uint8_t i = 0; i < CHANNEL_COUNT; i++)
+  {
+    if (ir_job_state::FAILED == m_jobs[i].state)
+      mask |= (1U << i);
+  }
+  return mask;
+}
+
+/**
+ * @brief IR 多通道调度器 获取挂起任务的通道掩码
+ *
+ * @return uint8_t 挂起任务的通道掩码
+ */
+uint8_t IR_Scheduler::suspended_mask() const
+{
+  uint8_t mask = 0;
+  for (uint8_t i = 0; i < CHANNEL_COUNT; i++)
+  {
+    if (ir_job_state::IDLE != m_suspended[i].state)
+      mask |= (1U << i);
+  }
+  return mask;
+}
+
+/**
+ * @brief IR 多通道调度器 获取通道排队帧数 (当前任务与挂起任务的剩余发送次数之和)
+ *
+ * @param  channel   通道下标(0~7)
+ * @return uint16_t  排队帧数
+ */
+uint16_t IR_Scheduler::depth(uint8_t channel) const
+{
+  if (channel >= CHANNEL_COUNT)
+    return 0;
+
+  uint16_t count = 0;
+  if (is_busy(channel))
+    count += m_jobs[channel].remain;
+  if (ir_job_state::IDLE != m_suspended[channel].state)
+    count += m_suspended[channel].remain;
+  return count;
+}
+
+/**
+ * @brief IR 多通道调度器 获取距最近一次延时到期的时间
+ *
+ * @param  now       当前时刻(ms)
+ * @return uint32_t  等待时间(ms)，无延时中的通道返回NO_WAKEUP
+ */
+uint32_t IR_Scheduler::next_wakeup(uint32_t now) const
+{
+  uint32_t wakeup = NO_WAKEUP;
+
+  for (uint8_t i = 0; i < CHANNEL_COUNT; i++)
+  {
+    if (ir_job_state::WAITING != m_jobs[i].state)
+      continue;
+
+    uint32_t wait = m_is_due(now, m_jobs[i].due) ? 0 : m_jobs[i].due - now;
+    if (wait < wakeup)
+      wakeup = wait;
+  }
+
+  return wakeup;
+}
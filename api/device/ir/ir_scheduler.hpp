@@ -0,0 +1,237 @@
+/**
+ * @file      ir_scheduler.hpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for IR device multi-channel scheduler (红外遥控 多通道调度)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#ifndef __IR_SCHEDULER_HPP__
+#define __IR_SCHEDULER_HPP__
+
+#include <cstdint>
+
+/// @brief 名称空间 库名
+namespace OwO
+{
+/// @brief 名称空间 设备
+namespace device
+{
+/// @brief 枚举 IR 通道任务状态
+enum class ir_job_state : uint8_t
+{
+  IDLE,    /* 空闲 */
+  PENDING, /* 等待发送 */
+  ON_AIR,  /* 正在发送 */
+  WAITING, /* 帧间延时 */
+  DONE,    /* 发送完成 */
+  FAILED,  /* 发送失败 */
+};
+
+/// @brief 枚举 IR 被抢占任务的处理策略
+enum class ir_preempt_policy : uint8_t
+{
+  RESUME, /* 挂起, 抢占任务结束后继续发送剩余次数 */
+  DROP,   /* 丢弃 */
+};
+
+/// @brief 结构体 IR 通道任务
+struct ir_job_t
+{
+  ir_job_state state;    /* 任务状态 */
+  uint8_t      remain;   /* 剩余发送次数 */
+  uint8_t      priority; /* 优先级 (数值越大越优先) */
+  uint32_t     delay;    /* 帧间延时(ms) */
+  uint32_t     due;      /* 延时到期时刻(ms) */
+};
+
+/// @brief 类 IR 多通道调度器 -- 各通道独立的发送任务状态机, 高优先级任务在帧间抢占低优先级任务, 时刻由调用者传入 (不依赖硬件与系统时钟)
+class IR_Scheduler
+{
+public:
+  /// @brief 通道数量
+  static constexpr uint8_t  CHANNEL_COUNT = 8;
+  /// @brief 无等待中的任务
+  static constexpr uint32_t NO_WAKEUP     = 0xFFFFFFFF;
+
+private:
+  /// @brief 通道任务
+  ir_job_t m_jobs[CHANNEL_COUNT];
+  /// @brief 通道被抢占挂起的任务 (IDLE 为无)
+  ir_job_t m_suspended[CHANNEL_COUNT];
+
+  /**
+   * @brief (私有函数) IR 多通道调度器 时刻是否已到达 (计数回绕安全)
+   *
+   * @param  now   当前时刻(ms)
+   * @param  due   目标时刻(ms)
+   * @return bool  已到达返回true
+   */
+  static bool m_is_due(uint32_t now, uint32_t due)
+  {
+    return static_cast<int32_t>(now - due) >= 0;
+  }
+
+public:
+  IR_Scheduler()
+  {
+    reset();
+  }
+
+  /**
+   * @brief IR 多通道调度器 复位 (全部通道空闲)
+   *
+   */
+  void reset();
+
+  /**
+   * @brief IR 多通道调度器 提交发送任务
+   *
+   * @param  channel  通道下标(0~7)
+   * @param  count    发送次数
+   * @param  delay    帧间延时(ms, 最后一帧之后同样延时)
+   * @param  now      当前时刻(ms)
+   * @param  priority 优先级 (数值越大越优先)
+   * @return bool     成功返回true，通道忙或参数错误返回false
+   */
+  bool submit(uint8_t channel, uint8_t count, uint32_t delay, uint32_t now, uint8_t priority = 0);
+
+  /**
+   * @brief IR 多通道调度器 提交定时发送任务 (到达指定时刻后等待发送)
+   *
+   * @param  channel  通道下标(0~7)
+   * @param  count    发送次数
+   * @param  delay    帧间延时(ms, 最后一帧之后同样延时)
+   * @param  at       首帧时刻(ms)
+   * @param  priority 优先级 (数值越大越优先)
+   * @return bool     成功返回true，通道忙或参数错误返回false
+   */
+  bool submit_at(uint8_t channel, uint8_t count, uint32_t delay, uint32_t at, uint8_t priority = 0);
+
+  /**
+   * @brief IR 多通道调度器 通道能否接受指定优先级的任务 (空闲, 或当前任务优先级更低且不在发送中)
+   *
+   * @param  channel   通道下标(0~7)
+   * @param  priority  优先级
+   * @return bool      能接受返回true
+   */
+  bool admit(uint8_t channel, uint8_t priority) const;
+
+  /**
+   * @brief IR 多通道调度器 抢占通道当前任务 (帧间或重复发送之间; 通道回到空闲)
+   *
+   * @param  channel  通道下标(0~7)
+   * @param  policy   被抢占任务的处理策略
+   * @return bool     任务已挂起返回true，任务被丢弃(或无可挂起的任务)返回false
+   */
+  bool preempt(uint8_t channel, ir_preempt_policy policy);
+
+  /**
+   * @brief IR 多通道调度器 恢复挂起的任务 (所在通道的抢占任务已结束)
+   *
+   * @param  now      当前时刻(ms)
+   * @return uint8_t  恢复的通道掩码
+   */
+  uint8_t resume(uint32_t now);
+
+  /**
+   * @brief IR 多通道调度器 推进延时并取出待发送的通道 (取出的通道进入发送状态)
+   *
+   * @param  now      当前时刻(ms)
+   * @param  ready    可发送的通道掩码
+   * @return uint8_t  本次需要发送的通道掩码
+   */
+  uint8_t poll(uint32_t now, uint8_t ready);
+
+  /**
+   * @brief IR 多通道调度器 通道一帧发送结束
+   *
+   * @param channel 通道下标(0~7)
+   * @param success 发送成功
+   * @param now     当前时刻(ms)
+   */
+  void complete(uint8_t channel, bool success, uint32_t now);
+
+  /**
+   * @brief IR 多通道调度器 取出的通道本轮未发送 (回到等待发送, 如与同一载波的其他通道载波设置不同)
+   *
+   * @param channel 通道下标(0~7)
+   */
+  void defer(uint8_t channel);
+
+  /**
+   * @brief IR 多通道调度器 取消通道任务 (通道回到空闲, 同时丢弃挂起的任务)
+   *
+   * @param channel 通道下标(0~7)
+   */
+  void cancel(uint8_t channel);
+
+  /**
+   * @brief IR 多通道调度器 获取通道任务状态
+   *
+   * @param  channel       通道下标(0~7)
+   * @return ir_job_state  任务状态
+   */
+  ir_job_state state(uint8_t channel) const
+  {
+    return (channel < CHANNEL_COUNT) ? m_jobs[channel].state : ir_job_state::IDLE;
+  }
+
+  /**
+   * @brief IR 多通道调度器 通道是否忙 (等待发送/正在发送/帧间延时)
+   *
+   * @param  channel  通道下标(0~7)
+   * @return bool     忙返回true
+   */
+  bool is_busy(uint8_t channel) const;
+
+  /**
+   * @brief IR 多通道调度器 获取忙通道掩码
+   *
+   * @return uint8_t 忙通道掩码
+   */
+  uint8_t busy_mask() const;
+
+  /**
+   * @brief IR 多通道调度器 获取发送完成通道掩码
+   *
+   * @return uint8_t 发送完成通道掩码
+   */
+  uint8_t done_mask() const;
+
+  /**
+   * @brief IR 多通道调度器 获取发送失败通道掩码
+   *
+   * @return uint8_t 发送失败通道掩码
+   */
+  uint8_t failed_mask() const;
+
+  /**
+   * @brief IR 多通道调度器 获取挂起任务的通道掩码
+   *
+   * @return uint8_t 挂起任务的通道掩码
+   */
+  uint8_t suspended_mask() const;
+
+  /**
+   * @brief IR 多通道调度器 获取通道排队帧数 (当前任务与挂起任务的剩余发送次数之和)
+   *
+   * @param  channel   通道下标(0~7)
+   * @return uint16_t  排队帧数
+   */
+  uint16_t depth(uint8_t channel) const;
+
+  /**
+   * @brief IR 多通道调度器 获取距最近一次延时到期的时间
+   *
+   * @param  now       当前时刻(ms)
+   * @return uint32_t  等待时间(ms)，无延时中的通道返回NO_WAKEUP
+   */
+  uint32_t next_wakeup(uint32_t now) const;
+};
+} /* namespace device */
+} /* namespace OwO */
+
+#endif /* __IR_SCHEDULER_HPP__ */
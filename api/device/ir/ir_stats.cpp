@@ -0,0 +1,200 @@
+/**
+ * @file      ir_stats.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for IR device per-channel statistics (红外遥控 通道发送统计与健康计数)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "ir_stats.hpp"
+#include <cstring>
+
+using namespace OwO;
+using namespace device;
+
+/**
+ * @brief IR 通道统计 任务已提交 (记录触发时刻)
+ *
+ * @param channel  通道下标(0~7)
+ * @param cycles   当前时刻(CPU周期计数)
+ * @param ms       当前时刻(ms)
+ */
+void IR_Stats::trigger(uint8_t channel, uint32_t cycles, uint32_t ms)
+{
+  if (channel >= CHANNEL_COUNT)
+    return;
+
+  m_trigger_cycles[channel]  = cycles;
+  m_trigger_ms[channel]      = ms;
+  m_job_frames[channel]      = 0;
+  m_pending                 |= (1U << channel);
+}
+
+/**
+ * @brief IR 通道统计 一帧开始发送 (任务首帧记录触发至开始的延迟)
+ *
+ * @param channel  通道下标(0~7)
+ * @param cycles   当前时刻(CPU周期计数)
+ * @param ms       当前时刻(ms)
+ * @param clock    CPU主频(Hz)
+ */
+void IR_Stats::start(uint8_t channel, uint32_t cycles, uint32_t ms, uint32_t clock)
+{
+  if (channel >= CHANNEL_COUNT)
+    return;
+
+  if (m_job_frames[channel] < 0xFF)
+    m_job_frames[channel]++;
+
+  if (!(m_pending & (1U << channel)))
+    return;
+  m_pending &= ~(1U << channel);
+
+  /* 短延迟按CPU周期计数换算(us精度), 长延迟按系统时刻换算 (超出32位us时饱和) */
+  uint32_t elapsed = ms - m_trigger_ms[channel];
+  uint32_t latency;
+  if (elapsed >= LONG_LATENCY || 0 == clock)
+    latency = (elapsed > 0xFFFFFFFF / 1000) ? 0xFFFFFFFF : elapsed * 1000;
+  else
+    latency = static_cast<uint32_t>(static_cast<uint64_t>(cycles - m_trigger_cycles[channel]) * 1000000 / clock);
+
+  slot_t& slot = m_slots[channel];
+  m_begin(slot);
+  m_set(slot, FIELD_LATENCY, latency);
+  if (latency > m_get(slot, FIELD_MAX_LATENCY))
+    m_set(slot, FIELD_MAX_LATENCY, latency);
+  m_end(slot);
+}
+
+/**
+ * @brief IR 通道统计 一帧发送结束
+ *
+ * @param channel   通道下标(0~7)
+ * @param success   发送成功
+ * @param duration  帧时长(us, 成功时计入累计发送时长)
+ */
+void IR_Stats::complete(uint8_t channel, bool success, uint32_t duration)
+{
+  if (channel >= CHANNEL_COUNT)
+    return;
+
+  slot_t& slot = m_slots[channel];
+  m_begin(slot);
+  if (success)
+  {
+    m_increment(slot, FIELD_FRAMES);
+    if (m_job_frames[channel] > 1)
+      m_increment(slot, FIELD_REPEATS);
+
+    uint64_t airtime = (static_cast<uint64_t>(m_get(slot, FIELD_AIRTIME_HIGH)) << 32 | m_get(slot, FIELD_AIRTIME_LOW)) + duration;
+    m_set(slot, FIELD_AIRTIME_LOW, static_cast<uint32_t>(airtime));
+    m_set(slot, FIELD_AIRTIME_HIGH, static_cast<uint32_t>(airtime >> 32));
+  }
+  else
+  {
+    m_increment(slot, FIELD_FAILURES);
+  }
+  m_end(slot);
+}
+
+/**
+ * @brief IR 通道统计 更新排队帧数
+ *
+ * @param channel  通道下标(0~7)
+ * @param depth    排队帧数
+ */
+void IR_Stats::depth(uint8_t channel, uint32_t depth)
+{
+  if (channel >= CHANNEL_COUNT)
+    return;
+
+  /* 未变化时不更新序号, 读取方无需重读 */
+  slot_t& slot = m_slots[channel];
+  if (depth == m_get(slot, FIELD_DEPTH))
+    return;
+
+  m_begin(slot);
+  m_set(slot, FIELD_DEPTH, depth);
+  if (depth > m_get(slot, FIELD_PEAK_DEPTH))
+    m_set(slot, FIELD_PEAK_DEPTH, depth);
+  m_end(slot);
+}
+
+/**
+ * @brief IR 通道统计 清除全部通道的计数 (保留进行中任务的触发时刻)
+ *
+ */
+void IR_Stats::clear()
+{
+  for (slot_t& slot : m_slots)
+  {
+    m_begin(slot);
+    for (uint8_t i = 0; i < FIELD_COUNT; i++)
+      m_set(slot, static_cast<field_e>(i), 0);
+    m_end(slot);
+  }
+}
+
+/**
+ * @brief IR 通道统计 读取通道快照 (可在其他线程调用, 不加锁)
+ *
+ * @param  channel  通道下标(0~7)
+ * @param  stats    快照(输出)
+ * @return bool     成功返回true, 通道下标错误返回false
+ */
+bool IR_Stats::snapshot(uint8_t channel, ir_channel_stats_t& stats) const
+{
+  if (channel >= CHANNEL_COUNT)
+    return false;
+
+  const slot_t& slot = m_slots[channel];
+  uint32_t      fields[FIELD_COUNT];
+  uint32_t      sequence;
+  do
+  {
+    /* 更新中(奇数)或读取期间发生更新时重读 */
+    sequence = slot.sequence.load(std::memory_order_acquire);
+    for (uint8_t i = 0; i < FIELD_COUNT; i++)
+      fields[i] = slot.fields[i].load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+  } while ((sequence & 1) || sequence != slot.sequence.load(std::memory_order_relaxed));
+
+  stats.frames      = fields[FIELD_FRAMES];
+  stats.repeats     = fields[FIELD_REPEATS];
+  stats.failures    = fields[FIELD_FAILURES];
+  stats.airtime     = static_cast<uint64_t>(fields[FIELD_AIRTIME_HIGH]) << 32 | fields[FIELD_AIRTIME_LOW];
+  stats.latency     = fields[FIELD_LATENCY];
+  stats.max_latency = fields[FIELD_MAX_LATENCY];
+  stats.depth       = fields[FIELD_DEPTH];
+  stats.peak_depth  = fields[FIELD_PEAK_DEPTH];
+  return true;
+}
+
+/**
+ * @brief IR 通道统计 导出通道寄存器 (32位计数各占2个寄存器, 累计发送时长换算为ms; 排队帧数超出16位时饱和)
+ *
+ * @param channel  通道下标(0~7)
+ * @param regs     寄存器(输出, REGISTER_COUNT 个)
+ */
+void IR_Stats::registers(uint8_t channel, uint16_t* regs) const
+{
+  ir_channel_stats_t stats;
+  if (!snapshot(channel, stats))
+  {
+    memset(regs, 0, REGISTER_COUNT * sizeof(uint16_t));
+    return;
+  }
+
+  uint64_t milliseconds = stats.airtime / 1000;
+  uint32_t airtime      = (milliseconds > 0xFFFFFFFF) ? 0xFFFFFFFF : static_cast<uint32_t>(milliseconds);
+  memcpy(&regs[0], &stats.frames, sizeof(uint32_t));
+  memcpy(&regs[2], &stats.repeats, sizeof(uint32_t));
+  memcpy(&regs[4], &stats.failures, sizeof(uint32_t));
+  memcpy(&regs[6], &airtime, sizeof(uint32_t));
+  memcpy(&regs[8], &stats.latency, sizeof(uint32_t));
+  memcpy(&regs[10], &stats.max_latency, sizeof(uint32_t));
+  regs[12] = static_cast<uint16_t>((stats.depth > 0xFFFF) ? 0xFFFF : stats.depth);
+  regs[13] = static_cast<uint16_t>((stats.peak_depth > 0xFFFF) ? 0xFFFF : stats.peak_depth);
+}
@@ -0,0 +1,212 @@
+/**
+ * @file      ir_stats.hpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for IR device per-channel statistics (红外遥控 通道发送统计与健康计数)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#ifndef __IR_STATS_HPP__
+#define __IR_STATS_HPP__
+
+#include <atomic>
+#include <cstdint>
+
+/// @brief 名称空间 库名
+namespace OwO
+{
+/// @brief 名称空间 设备
+namespace device
+{
+/// @brief 结构体 IR 通道统计快照
+struct ir_channel_stats_t
+{
+  uint32_t frames;      /* 发送成功帧数 */
+  uint32_t repeats;     /* 其中任务首帧之后的重复帧数 */
+  uint32_t failures;    /* 发送失败帧数 */
+  uint64_t airtime;     /* 累计发送时长(us) */
+  uint32_t latency;     /* 最近一次任务 触发至首帧开始的延迟(us) */
+  uint32_t max_latency; /* 延迟历史最大值(us) */
+  uint32_t depth;       /* 排队帧数 */
+  uint32_t peak_depth;  /* 排队帧数历史最大值 */
+};
+
+/// @brief 类 IR 通道统计 -- 发送路径单线程更新, 任意线程无锁读取一致快照 (每通道序号: 更新期间为奇数, 读取前后序号不同则重读; 不依赖硬件)
+class IR_Stats
+{
+public:
+  /// @brief 通道数量
+  static constexpr uint8_t  CHANNEL_COUNT  = 8;
+  /// @brief 寄存器数量 (帧数(2), 重复帧数(2), 失败帧数(2), 累计发送时长(ms, 2), 最近延迟(2), 最大延迟(2), 排队帧数, 最大排队帧数)
+  static constexpr uint16_t REGISTER_COUNT = 14;
+  /// @brief 触发至首帧超过此时长(ms)时按系统时刻计算延迟 (CPU周期计数约59s回绕)
+  static constexpr uint32_t LONG_LATENCY   = 50000;
+
+private:
+  /// @brief 枚举 IR 通道统计 计数字
+  enum field_e : uint8_t
+  {
+    FIELD_FRAMES,
+    FIELD_REPEATS,
+    FIELD_FAILURES,
+    FIELD_AIRTIME_LOW,
+    FIELD_AIRTIME_HIGH,
+    FIELD_LATENCY,
+    FIELD_MAX_LATENCY,
+    FIELD_DEPTH,
+    FIELD_PEAK_DEPTH,
+    FIELD_COUNT,
+  };
+
+  /// @brief 通道计数 (更新与读取均为单字原子操作)
+  struct slot_t
+  {
+    std::atomic<uint32_t> sequence;
+    std::atomic<uint32_t> fields[FIELD_COUNT];
+  };
+
+  /// @brief 通道计数
+  slot_t   m_slots[CHANNEL_COUNT];
+  /// @brief 任务触发时刻(CPU周期计数) (仅发送路径访问)
+  uint32_t m_trigger_cycles[CHANNEL_COUNT];
+  /// @brief 任务触发时刻(ms) (仅发送路径访问)
+  uint32_t m_trigger_ms[CHANNEL_COUNT];
+  /// @brief 本任务已开始的帧数 (仅发送路径访问)
+  uint8_t  m_job_frames[CHANNEL_COUNT];
+  /// @brief 已触发且首帧未开始的通道掩码 (仅发送路径访问)
+  uint8_t  m_pending;
+
+  /**
+   * @brief (私有函数) IR 通道统计 开始更新 (序号变为奇数)
+   *
+   * @param slot 通道计数
+   */
+  static void m_begin(slot_t& slot)
+  {
+    slot.sequence.store(slot.sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+  }
+
+  /**
+   * @brief (私有函数) IR 通道统计 结束更新 (序号变为偶数)
+   *
+   * @param slot 通道计数
+   */
+  static void m_end(slot_t& slot)
+  {
+    slot.sequence.store(slot.sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+  }
+
+  /**
+   * @brief (私有函数) IR 通道统计 读取计数字
+   *
+   * @param  slot      通道计数
+   * @param  field     计数字
+   * @return uint32_t  值
+   */
+  static uint32_t m_get(const slot_t& slot, field_e field)
+  {
+    return slot.fields[field].load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief (私有函数) IR 通道统计 写入计数字
+   *
+   * @param slot   通道计数
+   * @param field  计数字
+   * @param value  值
+   */
+  static void m_set(slot_t& slot, field_e field, uint32_t value)
+  {
+    slot.fields[field].store(value, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief (私有函数) IR 通道统计 计数字加1 (饱和)
+   *
+   * @param slot   通道计数
+   * @param field  计数字
+   */
+  static void m_increment(slot_t& slot, field_e field)
+  {
+    uint32_t value = m_get(slot, field);
+    if (value < 0xFFFFFFFF)
+      m_set(slot, field, value + 1);
+  }
+
+public:
+  IR_Stats() : m_trigger_cycles {}, m_trigger_ms {}, m_job_frames {}, m_pending(0)
+  {
+    for (slot_t& slot : m_slots)
+    {
+      slot.sequence.store(0, std::memory_order_relaxed);
+      for (std::atomic<uint32_t>& field : slot.fields)
+        field.store(0, std::memory_order_relaxed);
+    }
+  }
+
+  /**
+   * @brief IR 通道统计 任务已提交 (记录触发时刻)
+   *
+   * @param channel  通道下标(0~7)
+   * @param cycles   当前时刻(CPU周期计数)
+   * @param ms       当前时刻(ms)
+   */
+  void trigger(uint8_t channel, uint32_t cycles, uint32_t ms);
+
+  /**
+   * @brief IR 通道统计 一帧开始发送 (任务首帧记录触发至开始的延迟)
+   *
+   * @param channel  通道下标(0~7)
+   * @param cycles   当前时刻(CPU周期计数)
+   * @param ms       当前时刻(ms)
+   * @param clock    CPU主频(Hz)
+   */
+  void start(uint8_t channel, uint32_t cycles, uint32_t ms, uint32_t clock);
+
+  /**
+   * @brief IR 通道统计 一帧发送结束
+   *
+   * @param channel   通道下标(0~7)
+   * @param success   发送成功
+   * @param duration  帧时长(us, 成功时计入累计发送时长)
+   */
+  void complete(uint8_t channel, bool success, uint32_t duration);
+
+  /**
+   * @brief IR 通道统计 更新排队帧数
+   *
+   * @param channel  通道下标(0~7)
+   * @param depth    排队帧数
+   */
+  void depth(uint8_t channel, uint32_t depth);
+
+  /**
+   * @brief IR 通道统计 清除全部通道的计数 (保留进行中任务的触发时刻)
+   *
+   */
+  void clear();
+
+  /**
+   * @brief IR 通道统计 读取通道快照 (可在其他线程调用, 不加锁)
+   *
+   * @param  channel  通道下标(0~7)
+   * @param  stats    快照(输出)
+   * @return bool     成功返回true, 通道下标错误返回false
+   */
+  bool snapshot(uint8_t channel, ir_channel_stats_t& stats) const;
+
+  /**
+   * @brief IR 通道统计 导出通道寄存器 (32位计数各占2个寄存器, 累计发送时长换算为ms; 排队帧数超出16位时饱和)
+   *
+   * @param channel  通道下标(0~7)
+   * @param regs     寄存器(输出, REGISTER_COUNT 个)
+   */
+  void registers(uint8_t channel, uint16_t* regs) const;
+};
+} /* namespace device */
+} /* namespace OwO */
+
+#endif /* __IR_STATS_HPP__ */
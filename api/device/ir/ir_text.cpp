@@ -0,0 +1,434 @@
+/**
+ * @file      ir_text.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for IR device text code import (红外遥控 Pronto/原始时序文本导入)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "ir_text.hpp"
+
+using namespace OwO;
+using namespace device;
+
+/**
+ * @brief (静态内联) IR 文本导入 十六进制字符的值
+ *
+ * @param  c     字符
+ * @return int   值, 非十六进制字符返回-1
+ */
+static inline int sl_hex(char c)
+{
+  if (c >= '0' && c <= '9')
+    return c - '0';
+  if (c >= 'a' && c <= 'f')
+    return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F')
+    return c - 'A' + 10;
+  return -1;
+}
+
+/**
+ * @brief (静态内联) IR 文本导入 是否为分隔符
+ *
+ * @param  c     字符
+ * @return bool  分隔符返回true
+ */
+static inline bool sl_is_separator(char c)
+{
+  switch (c)
+  {
+    case ' ' :
+    case '\t' :
+    case '\r' :
+    case ',' :
+    case '{' :
+    case '}' :
+      return true;
+    default :
+      return false;
+  }
+}
+
+/**
+ * @brief (私有函数) IR 文本导入 清除行状态
+ *
+ */
+void IR_Text::m_clear()
+{
+  m_size       = 0;
+  m_frequency  = 0;
+  m_id         = 0;
+  m_mode       = MODE_NONE;
+  m_error      = ir_text_error::NONE;
+  m_ready      = false;
+  m_comment    = false;
+  m_digits     = 0;
+  m_prefix     = 0;
+  m_alpha      = false;
+  m_hex        = 0;
+  m_decimal    = 0;
+  m_tokens     = 0;
+  m_word       = 0;
+  m_words      = 0;
+  m_mark       = 0;
+  m_zero_space = false;
+  m_duration   = 0;
+}
+
+/**
+ * @brief (私有函数) IR 文本导入 输出一个脉冲 (空闲超过16位时饱和, Pronto 末尾的长静默常见)
+ *
+ * @param mark   标记(us)
+ * @param space  空闲(us)
+ */
+void IR_Text::m_push(uint32_t mark, uint32_t space)
+{
+  m_mark = 0;
+  if (m_zero_space)
+  {
+    m_fail(ir_text_error::DURATION);
+    return;
+  }
+
+  if (m_size >= m_capacity)
+  {
+    m_fail(ir_text_error::LENGTH);
+    return;
+  }
+
+  if (space > 0xFFFF)
+    space = 0xFFFF;
+
+  m_duration += mark + space;
+  if (m_duration > MAX_FRAME_TIME)
+  {
+    m_fail(ir_text_error::FRAME_TIME);
+    return;
+  }
+
+  m_zero_space       = (0 == space);
+  m_pulses[m_size++] = ir_pulse_t { static_cast<uint16_t>(mark), static_cast<uint16_t>(space) };
+}
+
+/**
+ * @brief (私有函数) IR 文本导入 处理 Pronto 数据字
+ *
+ * @param value 数据字
+ */
+void IR_Text::m_pronto(uint32_t value)
+{
+  switch (m_tokens)
+  {
+    case 0 :
+      /* 类型字: 只支持学习格式 (时长字直接为载波周期数) */
+      if (0 != value)
+        m_fail(ir_text_error::PRONTO);
+      break;
+    case 1 :
+    {
+      m_word = static_cast<uint16_t>(value);
+      if (0 == m_word)
+      {
+        m_fail(ir_text_error::CARRIER);
+        break;
+      }
+
+      uint64_t period = static_cast<uint64_t>(m_word) * PRONTO_UNIT; /* 载波周期(10^-6 us) */
+      m_frequency     = static_cast<uint32_t>((1000000000000ULL + period / 2) / period);
+      if (m_frequency < MIN_FREQUENCY || m_frequency > MAX_FREQUENCY)
+        m_fail(ir_text_error::CARRIER);
+      break;
+    }
+    case 2 :
+      m_words = value;
+      break;
+    case 3 :
+      /* 单次序列与重复序列的对数之和, 换算为全部数据字数量 */
+      m_words += value;
+      if (0 == m_words || m_words > m_capacity)
+        m_fail(ir_text_error::LENGTH);
+      m_words = 4 + m_words * 2;
+      break;
+    default :
+    {
+      if (m_tokens >= m_words)
+      {
+        m_fail(ir_text_error::PRONTO);
+        break;
+      }
+
+      uint32_t duration = static_cast<uint32_t>((static_cast<uint64_t>(value) * m_word * PRONTO_UNIT + 500000) / 1000000);
+      if (0 == (m_tokens & 1))
+      {
+        if (0 == duration || duration > 0xFFFF)
+          m_fail(ir_text_error::DURATION);
+        m_mark = duration;
+      }
+      else
+      {
+        m_push(m_mark, duration);
+      }
+      break;
+    }
+  }
+}
+
+/**
+ * @brief (私有函数) IR 文本导入 处理原始时序记号
+ *
+ * @param value   数值
+ * @param prefix  前缀 ('+', '-', '@' 或 0)
+ */
+void IR_Text::m_raw(uint32_t value, char prefix)
+{
+  if ('@' == prefix)
+  {
+    /* 载波频率只能为首个记号 */
+    if (0 != m_tokens)
+    {
+      m_fail(ir_text_error::FORMAT);
+      return;
+    }
+
+    m_frequency = (value < 1000) ? value * 1000 : value;
+    if (m_frequency < MIN_FREQUENCY || m_frequency > MAX_FREQUENCY)
+      m_fail(ir_text_error::CARRIER);
+    return;
+  }
+
+  /* 标记均非0: 无待配对的标记时本记号为标记 */
+  bool mark = (0 == m_mark);
+  if (('+' == prefix && !mark) || ('-' == prefix && mark))
+  {
+    m_fail(ir_text_error::SIGN);
+    return;
+  }
+
+  if (!mark)
+  {
+    m_push(m_mark, value);
+    return;
+  }
+
+  if (0 == value || value > 0xFFFF)
+    m_fail(ir_text_error::DURATION);
+  m_mark = value;
+}
+
+/**
+ * @brief (私有函数) IR 文本导入 结束当前记号
+ *
+ */
+void IR_Text::m_token()
+{
+  if (0 == m_digits)
+  {
+    /* 前缀后无数字 */
+    if (0 != m_prefix)
+      m_fail(ir_text_error::FORMAT);
+    m_prefix = 0;
+    return;
+  }
+
+  /* 首个数据记号为4位且以0开头的十六进制数时按 Pronto 解析 */
+  if (MODE_NONE == m_mode)
+    m_mode = (4 == m_digits && 0 == m_prefix && m_hex < 0x1000) ? MODE_PRONTO : MODE_RAW;
+
+  if (MODE_PRONTO == m_mode)
+  {
+    if (0 != m_prefix)
+      m_fail(ir_text_error::FORMAT);
+    else if (m_digits > 4)
+      m_fail(ir_text_error::NUMBER);
+    else
+      m_pronto(m_hex);
+  }
+  else
+  {
+    if (m_alpha)
+      m_fail(ir_text_error::FORMAT);
+    else if (m_digits > 9)
+      m_fail(ir_text_error::NUMBER);
+    else
+      m_raw(m_decimal, m_prefix);
+  }
+
+  if (m_tokens < 0xFFFF)
+    m_tokens++;
+
+  m_digits  = 0;
+  m_prefix  = 0;
+  m_alpha   = false;
+  m_hex     = 0;
+  m_decimal = 0;
+}
+
+/**
+ * @brief (私有函数) IR 文本导入 结束当前行 (补全末尾脉冲, 检查序列长度)
+ *
+ */
+void IR_Text::m_end_line()
+{
+  m_ready = true;
+  if (ir_text_error::NONE != m_error)
+    return;
+
+  if (MODE_PRONTO == m_mode)
+  {
+    if (m_tokens < 4 || m_tokens != m_words)
+      m_fail(ir_text_error::PRONTO);
+    return;
+  }
+
+  /* 原始时序以标记结束时末尾空闲为0 */
+  if (0 != m_mark)
+    m_push(m_mark, 0);
+
+  if (0 == m_size)
+    m_fail(ir_text_error::LENGTH);
+}
+
+/**
+ * @brief IR 文本导入 复位并绑定输出缓存区 (丢弃未结束的行, 行号清零)
+ *
+ * @param buffer    输出缓存区
+ * @param capacity  输出缓存区容量
+ */
+void IR_Text::reset(ir_pulse_t* buffer, uint16_t capacity)
+{
+  m_pulses   = buffer;
+  m_capacity = (nullptr == buffer) ? 0 : capacity;
+  m_line     = 1;
+  m_clear();
+}
+
+/**
+ * @brief IR 文本导入 输入文本 (一行结束时停止, 取走结果后继续输入剩余文本)
+ *
+ * 每行一个指令, 以 '\n' 结束; '#' 至行尾为注释; 空格、制表符、',', '{', '}', '\r' 为分隔符; 行首可为 "编号:" (十进制, 供存储指令库).
+ * Pronto: 0000 频率字 单次序列对数 重复序列对数 时长字..., 时长字为载波周期数, 转换为单次序列 + 一次重复序列.
+ * 原始时序: 十进制时长(us), 标记/空闲交替, 可带符号 (+标记, -空闲); 首个记号可为 "@频率" (Hz, 小于1000按kHz).
+ *
+ * @param  text      文本
+ * @param  length    文本长度
+ * @return uint32_t  已处理的字符数量
+ */
+uint32_t IR_Text::feed(const char* text, uint32_t length)
+{
+  if (m_ready || nullptr == text)
+    return 0;
+
+  for (uint32_t i = 0; i < length; i++)
+  {
+    char c = text[i];
+    if ('\n' == c)
+    {
+      m_comment = false;
+      m_token();
+
+      /* 空行与纯注释行不产生结果 */
+      if (0 != m_tokens || 0 != m_id || ir_text_error::NONE != m_error)
+      {
+        m_end_line();
+        return i + 1;
+      }
+
+      m_line++;
+      m_clear();
+      continue;
+    }
+
+    /* 出错后忽略至行尾 */
+    if (m_comment || ir_text_error::NONE != m_error)
+      continue;
+
+    if ('#' == c)
+    {
+      m_token();
+      m_comment = true;
+      continue;
+    }
+
+    if (sl_is_separator(c))
+    {
+      m_token();
+      continue;
+    }
+
+    if (':' == c)
+    {
+      /* 编号: 行首的十进制数 */
+      if (0 == m_digits || 0 != m_prefix || m_alpha || 0 != m_tokens || 0 != m_id)
+        m_fail(ir_text_error::FORMAT);
+      else if (m_digits > 5 || 0 == m_decimal || m_decimal > 0xFFFF)
+        m_fail(ir_text_error::NUMBER);
+      else
+        m_id = static_cast<uint16_t>(m_decimal);
+
+      m_digits  = 0;
+      m_hex     = 0;
+      m_decimal = 0;
+      continue;
+    }
+
+    if ('+' == c || '-' == c || '@' == c)
+    {
+      if (0 != m_digits || 0 != m_prefix)
+        m_fail(ir_text_error::FORMAT);
+      m_prefix = c;
+      continue;
+    }
+
+    int value = sl_hex(c);
+    if (value < 0)
+    {
+      m_fail(ir_text_error::FORMAT);
+      continue;
+    }
+
+    /* 十六进制与十进制同时累加, 记号结束时按行格式取值; 位数超出时只计数 */
+    if (m_digits < 0xFF)
+      m_digits++;
+    if (m_digits <= 8)
+      m_hex = (m_hex << 4) | static_cast<uint32_t>(value);
+    if (value > 9)
+      m_alpha = true;
+    else if (m_digits <= 9)
+      m_decimal = m_decimal * 10 + static_cast<uint32_t>(value);
+  }
+
+  return length;
+}
+
+/**
+ * @brief IR 文本导入 结束输入 (末行无换行符时按一行结束)
+ *
+ * @return bool 有待取走的行返回true
+ */
+bool IR_Text::finish()
+{
+  if (m_ready)
+    return true;
+
+  m_comment = false;
+  m_token();
+  if (0 != m_tokens || 0 != m_id || ir_text_error::NONE != m_error)
+    m_end_line();
+  return m_ready;
+}
+
+/**
+ * @brief IR 文本导入 取走当前行结果, 开始下一行
+ *
+ */
+void IR_Text::next()
+{
+  if (!m_ready)
+    return;
+
+  m_line++;
+  m_clear();
+}
@@ -0,0 +1,225 @@
+/**
+ * @file      ir_text.hpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for IR device text code import (红外遥控 Pronto/原始时序文本导入)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#ifndef __IR_TEXT_HPP__
+#define __IR_TEXT_HPP__
+
+#include "ir_timeline.hpp"
+
+/// @brief 名称空间 库名
+namespace OwO
+{
+/// @brief 名称空间 设备
+namespace device
+{
+/// @brief 枚举 IR 文本导入 解析结果
+enum class ir_text_error : uint8_t
+{
+  NONE,       /* 解析成功 */
+  FORMAT,     /* 非法字符或记号 */
+  NUMBER,     /* 数值超出范围 (Pronto 超过4位十六进制, 十进制超过9位, 编号为0或超过65535) */
+  PRONTO,     /* Pronto 类型不是 0000 (学习格式), 或字数与序列长度不符 */
+  CARRIER,    /* 载波频率超出范围 */
+  LENGTH,     /* 脉冲数量为0或超出容量 */
+  SIGN,       /* 原始时序 标记(+)/空闲(-)符号未交替 */
+  DURATION,   /* 标记为0或超过65535us, 或非末尾空闲为0 */
+  FRAME_TIME, /* 帧总时长超出上限 */
+};
+
+/// @brief 类 IR 文本导入 -- 逐字符流式解析 Pronto(学习格式 0000) 与原始时序文本行, 转换为标记/空闲序列 (不依赖硬件)
+class IR_Text
+{
+public:
+  /// @brief 载波频率下限(Hz)
+  static constexpr uint32_t MIN_FREQUENCY  = 30000;
+  /// @brief 载波频率上限(Hz)
+  static constexpr uint32_t MAX_FREQUENCY  = 60000;
+  /// @brief 帧总时长上限(us)
+  static constexpr uint32_t MAX_FRAME_TIME = 2000000;
+  /// @brief Pronto 频率字单位 (载波周期 = 频率字 * 0.241246us)
+  static constexpr uint32_t PRONTO_UNIT    = 241246;
+
+private:
+  /// @brief 枚举 IR 文本导入 行格式
+  enum mode_e : uint8_t
+  {
+    MODE_NONE,   /* 尚无数据记号 */
+    MODE_PRONTO, /* Pronto */
+    MODE_RAW,    /* 原始时序 */
+  };
+
+  /// @brief 输出脉冲序列
+  ir_pulse_t*   m_pulses;
+  /// @brief 输出缓存区容量
+  uint16_t      m_capacity;
+  /// @brief 输出脉冲数量
+  uint16_t      m_size;
+  /// @brief 载波频率(Hz, 0为默认)
+  uint32_t      m_frequency;
+  /// @brief 指令编号 (0为未指定)
+  uint16_t      m_id;
+  /// @brief 行号 (从1开始)
+  uint32_t      m_line;
+  /// @brief 行格式
+  mode_e        m_mode;
+  /// @brief 解析结果 (首个错误, 出错后忽略至行尾)
+  ir_text_error m_error;
+  /// @brief 行解析完成, 等待取走
+  bool          m_ready;
+  /// @brief 注释中
+  bool          m_comment;
+  /// @brief 当前记号 字符数量
+  uint8_t       m_digits;
+  /// @brief 当前记号 前缀 ('+', '-', '@' 或 0)
+  char          m_prefix;
+  /// @brief 当前记号 包含十六进制字母
+  bool          m_alpha;
+  /// @brief 当前记号 十六进制值
+  uint32_t      m_hex;
+  /// @brief 当前记号 十进制值
+  uint32_t      m_decimal;
+  /// @brief 本行数据记号数量 (不含编号)
+  uint16_t      m_tokens;
+  /// @brief Pronto 频率字
+  uint16_t      m_word;
+  /// @brief Pronto 数据字数量 (含头部4字)
+  uint32_t      m_words;
+  /// @brief 待配对的标记(us) (0为无)
+  uint32_t      m_mark;
+  /// @brief 上一空闲为0 (只允许出现在末尾)
+  bool          m_zero_space;
+  /// @brief 帧总时长(us)
+  uint32_t      m_duration;
+
+  void m_clear();
+  void m_token();
+  void m_pronto(uint32_t value);
+  void m_raw(uint32_t value, char prefix);
+  void m_push(uint32_t mark, uint32_t space);
+  void m_end_line();
+
+  /**
+   * @brief (私有函数) IR 文本导入 记录首个错误
+   *
+   * @param error 错误
+   */
+  void m_fail(ir_text_error error)
+  {
+    if (ir_text_error::NONE == m_error)
+      m_error = error;
+  }
+
+public:
+  IR_Text() : m_pulses(nullptr), m_capacity(0), m_size(0), m_frequency(0), m_id(0), m_line(0), m_mode(MODE_NONE), m_error(ir_text_error::NONE), m_ready(false), m_comment(false), m_digits(0), m_prefix(0), m_alpha(false), m_hex(0), m_decimal(0), m_tokens(0), m_word(0), m_words(0), m_mark(0), m_zero_space(false), m_duration(0) {}
+
+  /**
+   * @brief IR 文本导入 复位并绑定输出缓存区 (丢弃未结束的行, 行号清零)
+   *
+   * @param buffer    输出缓存区
+   * @param capacity  输出缓存区容量
+   */
+  void reset(ir_pulse_t* buffer, uint16_t capacity);
+
+  /**
+   * @brief IR 文本导入 输入文本 (一行结束时停止, 取走结果后继续输入剩余文本)
+   *
+   * @param  text      文本
+   * @param  length    文本长度
+   * @return uint32_t  已处理的字符数量
+   */
+  uint32_t feed(const char* text, uint32_t length);
+
+  /**
+   * @brief IR 文本导入 结束输入 (末行无换行符时按一行结束)
+   *
+   * @return bool 有待取走的行返回true
+   */
+  bool finish();
+
+  /**
+   * @brief IR 文本导入 取走当前行结果, 开始下一行
+   *
+   */
+  void next();
+
+  /**
+   * @brief IR 文本导入 一行是否解析完成 (空行与纯注释行不产生结果)
+   *
+   * @return bool 完成返回true
+   */
+  bool ready() const
+  {
+    return m_ready;
+  }
+
+  /**
+   * @brief IR 文本导入 获取当前行解析结果
+   *
+   * @return ir_text_error 解析结果
+   */
+  ir_text_error error() const
+  {
+    return m_error;
+  }
+
+  /**
+   * @brief IR 文本导入 获取脉冲序列
+   *
+   * @return const ir_pulse_t* 脉冲序列
+   */
+  const ir_pulse_t* data() const
+  {
+    return m_pulses;
+  }
+
+  /**
+   * @brief IR 文本导入 获取脉冲数量
+   *
+   * @return uint16_t 脉冲数量 (解析失败为0)
+   */
+  uint16_t size() const
+  {
+    return (ir_text_error::NONE == m_error) ? m_size : 0;
+  }
+
+  /**
+   * @brief IR 文本导入 获取载波频率
+   *
+   * @return uint32_t 载波频率(Hz, 0为默认)
+   */
+  uint32_t frequency() const
+  {
+    return m_frequency;
+  }
+
+  /**
+   * @brief IR 文本导入 获取指令编号
+   *
+   * @return uint16_t 指令编号 (0为未指定)
+   */
+  uint16_t id() const
+  {
+    return m_id;
+  }
+
+  /**
+   * @brief IR 文本导入 获取当前行号
+   *
+   * @return uint32_t 行号 (从1开始)
+   */
+  uint32_t line() const
+  {
+    return m_line;
+  }
+};
+} /* namespace device */
+} /* namespace OwO */
+
+#endif /* __IR_TEXT_HPP__ */
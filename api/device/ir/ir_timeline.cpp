@@ -0,0 +1,257 @@
+/**
+ * @file      ir_timeline.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for IR device timeline (红外遥控 标记/空闲时序)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "ir_timeline.hpp"
+
+using namespace OwO;
+using namespace device;
+
+/**
+ * @brief (静态内联) 饱和截断为16位
+ *
+ * @param  value    输入值
+ * @return uint16_t 截断值
+ */
+static inline uint16_t sl_saturate(uint32_t value)
+{
+  return (value > 0xFFFF) ? 0xFFFF : static_cast<uint16_t>(value);
+}
+
+/**
+ * @brief IR 时序 追加脉冲 (标记时长为0时合并至上一脉冲的空闲时长)
+ *
+ * @param  mark   标记时长(us)
+ * @param  space  空闲时长(us)
+ * @return bool   成功返回true，缓存区溢出返回false
+ */
+bool IR_Timeline::push(uint32_t mark, uint32_t space)
+{
+  if (0 == mark && 0 != m_size)
+  {
+    m_pulses[m_size - 1].space = sl_saturate(m_pulses[m_size - 1].space + space);
+    return true;
+  }
+
+  if (m_size >= m_capacity)
+  {
+    m_overflow = true;
+    return false;
+  }
+
+  m_pulses[m_size].mark  = sl_saturate(mark);
+  m_pulses[m_size].space = sl_saturate(space);
+  m_size++;
+  return true;
+}
+
+/**
+ * @brief IR 时序 获取总时长
+ *
+ * @return uint32_t 总时长(us)
+ */
+uint32_t IR_Timeline::duration() const
+{
+  uint32_t sum = 0;
+  for (uint16_t i = 0; i < m_size; i++)
+    sum += m_pulses[i].mark + m_pulses[i].space;
+  return sum;
+}
+
+/**
+ * @brief (私有函数) IR 门控序列器 转换下一阶段 (按累计时长取整, 误差扩散至后续阶段)
+ *
+ * @param  time     阶段时长(us)
+ * @return uint32_t 阶段载波周期数
+ */
+uint32_t IR_Gate_Sequencer::m_advance(uint32_t time)
+{
+  m_elapsed       += time;
+  uint32_t target  = to_cycles(m_elapsed, m_frequency);
+  uint32_t cycles  = target - m_emitted;
+  m_emitted        = target;
+  return cycles;
+}
+
+/**
+ * @brief IR 门控序列器 复位
+ *
+ * @param pulses    脉冲序列
+ * @param size      脉冲数量
+ * @param frequency 载波频率(Hz)
+ */
+void IR_Gate_Sequencer::reset(const ir_pulse_t* pulses, uint16_t size, uint32_t frequency)
+{
+  m_pulses    = pulses;
+  m_size      = size;
+  m_index     = 0;
+  m_frequency = frequency;
+  m_mark      = true;
+  m_elapsed   = 0;
+  m_emitted   = 0;
+  m_remain    = (0 != size) ? m_advance(pulses[0].mark) : 0;
+}
+
+/**
+ * @brief IR 门控序列器 获取下一门控步骤
+ *
+ * @param  step 门控步骤
+ * @return bool 存在下一步骤返回true，序列结束返回false
+ */
+bool IR_Gate_Sequencer::next(ir_gate_step_t& step)
+{
+  /* 跳过长度为0的阶段 */
+  while (0 == m_remain)
+  {
+    if (m_index >= m_size)
+      return false;
+
+    if (m_mark)
+    {
+      m_mark   = false;
+      m_remain = m_advance(m_pulses[m_index].space);
+    }
+    else
+    {
+      if (++m_index >= m_size)
+        return false;
+
+      m_mark   = true;
+      m_remain = m_advance(m_pulses[m_index].mark);
+    }
+  }
+
+  /* 超过重复计数范围的阶段拆分为多步 */
+  step.mark    = m_mark;
+  step.cycles  = static_cast<uint16_t>((m_remain > MAX_STEP_CYCLES) ? MAX_STEP_CYCLES : m_remain);
+  m_remain    -= step.cycles;
+  return true;
+}
+
+/**
+ * @brief IR 门控序列器 主机模型: 按硬件门控行为重建引脚输出的标记/空闲序列
+ *
+ * @param  pulses     输入脉冲序列
+ * @param  size       输入脉冲数量
+ * @param  frequency  载波频率(Hz)
+ * @param  output     输出脉冲序列(量化到载波周期)
+ * @param  capacity   输出缓存区容量
+ * @return uint16_t   输出脉冲数量
+ */
+uint16_t IR_Gate_Sequencer::model(const ir_pulse_t* pulses, uint16_t size, uint32_t frequency, ir_pulse_t* output, uint16_t capacity)
+{
+  IR_Gate_Sequencer sequencer;
+  ir_gate_step_t    step;
+  uint32_t          mark_cycles  = 0;
+  uint32_t          space_cycles = 0;
+  uint16_t          count        = 0;
+
+  sequencer.reset(pulses, size, frequency);
+  while (sequencer.next(step))
+  {
+    /* 空闲之后重新出现标记: 上一脉冲结束 */
+    if (step.mark && 0 != space_cycles)
+    {
+      if (count >= capacity)
+        return count;
+
+      output[count].mark  = sl_saturate(to_time(mark_cycles, frequency));
+      output[count].space = sl_saturate(to_time(space_cycles, frequency));
+      count++;
+      mark_cycles  = 0;
+      space_cycles = 0;
+    }
+
+    if (step.mark)
+      mark_cycles += step.cycles;
+    else
+      space_cycles += step.cycles;
+  }
+
+  if ((0 != mark_cycles || 0 != space_cycles) && count < capacity)
+  {
+    output[count].mark  = sl_saturate(to_time(mark_cycles, frequency));
+    output[count].space = sl_saturate(to_time(space_cycles, frequency));
+    count++;
+  }
+
+  return count;
+}
+
+/**
+ * @brief (私有函数) IR 门控合并器 取通道的下一门控步骤
+ *
+ * @param channel 通道下标
+ */
+void IR_Gate_Merger::fetch(uint8_t channel)
+{
+  ir_gate_step_t step;
+
+  m_marks &= ~(1U << channel);
+  if (m_sequencer[channel].next(step))
+  {
+    m_remain[channel] = step.cycles;
+    if (step.mark)
+      m_marks |= (1U << channel);
+  }
+  else
+    m_remain[channel] = 0;
+}
+
+/**
+ * @brief IR 门控合并器 复位
+ *
+ * @param pulses    各通道脉冲序列(不发送的通道为nullptr)
+ * @param sizes     各通道脉冲数量
+ * @param count     通道数量(1~MAX_CHANNELS)
+ * @param frequency 载波频率(Hz)
+ */
+void IR_Gate_Merger::reset(const ir_pulse_t* const pulses[], const uint16_t sizes[], uint8_t count, uint32_t frequency)
+{
+  m_count = (count > MAX_CHANNELS) ? MAX_CHANNELS : count;
+  m_marks = 0;
+
+  for (uint8_t i = 0; i < m_count; i++)
+  {
+    m_sequencer[i].reset(pulses[i], (nullptr != pulses[i]) ? sizes[i] : 0, frequency);
+    fetch(i);
+  }
+}
+
+/**
+ * @brief IR 门控合并器 获取下一合并步骤
+ *
+ * @param  cycles  步骤载波周期数
+ * @param  marks   各通道标记掩码(bit0对应通道0)
+ * @return bool    存在下一步骤返回true，全部通道结束返回false
+ */
+bool IR_Gate_Merger::next(uint32_t& cycles, uint8_t& marks)
+{
+  cycles = 0;
+  for (uint8_t i = 0; i < m_count; i++)
+  {
+    if (0 != m_remain[i] && (0 == cycles || m_remain[i] < cycles))
+      cycles = m_remain[i];
+  }
+
+  if (0 == cycles)
+    return false;
+
+  marks = m_marks;
+  for (uint8_t i = 0; i < m_count; i++)
+  {
+    if (0 == m_remain[i])
+      continue;
+
+    m_remain[i] -= cycles;
+    if (0 == m_remain[i])
+      fetch(i);
+  }
+  return true;
+}
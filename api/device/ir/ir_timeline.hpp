@@ -0,0 +1,275 @@
+/**
+ * @file      ir_timeline.hpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for IR device timeline (红外遥控 标记/空闲时序)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#ifndef __IR_TIMELINE_HPP__
+#define __IR_TIMELINE_HPP__
+
+#include <cstdint>
+
+/// @brief 名称空间 库名
+namespace OwO
+{
+/// @brief 名称空间 设备
+namespace device
+{
+/// @brief 结构体 IR 脉冲 (标记(载波)时长 + 空闲时长, 单位us)
+struct ir_pulse_t
+{
+  uint16_t mark;  /* 标记(载波输出)时长 */
+  uint16_t space; /* 空闲(无载波)时长 */
+};
+
+/// @brief 结构体 IR 载波门控步骤
+struct ir_gate_step_t
+{
+  uint16_t cycles; /* 持续载波周期数(1~IR_Gate_Sequencer::MAX_STEP_CYCLES) */
+  bool     mark;   /* 载波门控 开启/关闭 */
+};
+
+/// @brief 类 IR 时序 -- 收集编码器输出的标记/空闲脉冲序列 (不依赖硬件)
+class IR_Timeline
+{
+public:
+  /// @brief 单帧脉冲数量上限 (IR 帧缓存区与硬件载波包络缓存区按此容量预先分配)
+  static constexpr uint16_t MAX_PULSES = 320;
+
+private:
+  /// @brief 脉冲缓存区
+  ir_pulse_t* m_pulses;
+  /// @brief 脉冲缓存区容量
+  uint16_t    m_capacity;
+  /// @brief 脉冲数量
+  uint16_t    m_size;
+  /// @brief 溢出标志位
+  bool        m_overflow;
+
+public:
+  IR_Timeline() : m_pulses(nullptr), m_capacity(0), m_size(0), m_overflow(false) {}
+
+  /**
+   * @brief IR 时序 绑定缓存区
+   *
+   * @param buffer    脉冲缓存区
+   * @param capacity  脉冲缓存区容量
+   */
+  void attach(ir_pulse_t* buffer, uint16_t capacity)
+  {
+    m_pulses   = buffer;
+    m_capacity = capacity;
+    clear();
+  }
+
+  /**
+   * @brief IR 时序 绑定已包含脉冲序列的缓存区 (如已编码时序的缓存)
+   *
+   * @param buffer    脉冲缓存区
+   * @param capacity  脉冲缓存区容量
+   * @param size      脉冲数量
+   */
+  void attach(ir_pulse_t* buffer, uint16_t capacity, uint16_t size)
+  {
+    m_pulses   = buffer;
+    m_capacity = capacity;
+    m_size     = (size > capacity) ? capacity : size;
+    m_overflow = false;
+  }
+
+  /**
+   * @brief IR 时序 清空
+   *
+   */
+  void clear()
+  {
+    m_size     = 0;
+    m_overflow = false;
+  }
+
+  /**
+   * @brief IR 时序 追加脉冲 (标记时长为0时合并至上一脉冲的空闲时长)
+   *
+   * @param  mark   标记时长(us)
+   * @param  space  空闲时长(us)
+   * @return bool   成功返回true，缓存区溢出返回false
+   */
+  bool push(uint32_t mark, uint32_t space);
+
+  /**
+   * @brief IR 时序 获取脉冲序列
+   *
+   * @return const ir_pulse_t* 脉冲序列
+   */
+  const ir_pulse_t* data() const
+  {
+    return m_pulses;
+  }
+
+  /**
+   * @brief IR 时序 获取脉冲数量
+   *
+   * @return uint16_t 脉冲数量
+   */
+  uint16_t size() const
+  {
+    return m_size;
+  }
+
+  /**
+   * @brief IR 时序 是否发生溢出
+   *
+   * @return bool 溢出返回true
+   */
+  bool is_overflow() const
+  {
+    return m_overflow;
+  }
+
+  /**
+   * @brief IR 时序 获取总时长
+   *
+   * @return uint32_t 总时长(us)
+   */
+  uint32_t duration() const;
+};
+
+/// @brief 类 IR 载波门控序列器 -- 将脉冲序列转换为以载波周期计的门控步骤 (包络编译与主机模型共用)
+///        各阶段按累计时长取整后差分得到周期数(误差扩散), 任意边沿的累计误差不超过半个载波周期
+class IR_Gate_Sequencer
+{
+private:
+  /// @brief 脉冲序列
+  const ir_pulse_t* m_pulses;
+  /// @brief 脉冲数量
+  uint16_t          m_size;
+  /// @brief 当前脉冲下标
+  uint16_t          m_index;
+  /// @brief 当前处于标记阶段
+  bool              m_mark;
+  /// @brief 当前阶段剩余载波周期数
+  uint32_t          m_remain;
+  /// @brief 载波频率(Hz)
+  uint32_t          m_frequency;
+  /// @brief 已转换阶段的累计时长(us)
+  uint32_t          m_elapsed;
+  /// @brief 已转换阶段的累计载波周期数
+  uint32_t          m_emitted;
+
+  /**
+   * @brief (私有函数) IR 门控序列器 转换下一阶段 (按累计时长取整, 误差扩散至后续阶段)
+   *
+   * @param  time     阶段时长(us)
+   * @return uint32_t 阶段载波周期数
+   */
+  uint32_t m_advance(uint32_t time);
+
+public:
+  /// @brief 单步最大载波周期数 (高级定时器重复计数器为8位)
+  static constexpr uint32_t MAX_STEP_CYCLES = 256;
+
+  IR_Gate_Sequencer() : m_pulses(nullptr), m_size(0), m_index(0), m_mark(false), m_remain(0), m_frequency(0), m_elapsed(0), m_emitted(0) {}
+
+  /**
+   * @brief IR 门控序列器 时长转换为载波周期数(四舍五入)
+   *
+   * @param  time       时长(us)
+   * @param  frequency  载波频率(Hz)
+   * @return uint32_t   载波周期数
+   */
+  static uint32_t to_cycles(uint32_t time, uint32_t frequency)
+  {
+    return static_cast<uint32_t>((static_cast<uint64_t>(time) * frequency + 500000) / 1000000);
+  }
+
+  /**
+   * @brief IR 门控序列器 载波周期数转换为时长(四舍五入)
+   *
+   * @param  cycles     载波周期数
+   * @param  frequency  载波频率(Hz)
+   * @return uint32_t   时长(us)
+   */
+  static uint32_t to_time(uint32_t cycles, uint32_t frequency)
+  {
+    return static_cast<uint32_t>((static_cast<uint64_t>(cycles) * 1000000 + frequency / 2) / frequency);
+  }
+
+  /**
+   * @brief IR 门控序列器 复位
+   *
+   * @param pulses    脉冲序列
+   * @param size      脉冲数量
+   * @param frequency 载波频率(Hz)
+   */
+  void reset(const ir_pulse_t* pulses, uint16_t size, uint32_t frequency);
+
+  /**
+   * @brief IR 门控序列器 获取下一门控步骤
+   *
+   * @param  step 门控步骤
+   * @return bool 存在下一步骤返回true，序列结束返回false
+   */
+  bool next(ir_gate_step_t& step);
+
+  /**
+   * @brief IR 门控序列器 主机模型: 按硬件门控行为重建引脚输出的标记/空闲序列
+   *
+   * @param  pulses     输入脉冲序列
+   * @param  size       输入脉冲数量
+   * @param  frequency  载波频率(Hz)
+   * @param  output     输出脉冲序列(量化到载波周期)
+   * @param  capacity   输出缓存区容量
+   * @return uint16_t   输出脉冲数量
+   */
+  static uint16_t model(const ir_pulse_t* pulses, uint16_t size, uint32_t frequency, ir_pulse_t* output, uint16_t capacity);
+};
+
+/// @brief 类 IR 门控合并器 -- 并行推进多个通道的门控序列器, 按最近的通道边界切分步骤 (各通道同时开始)
+class IR_Gate_Merger
+{
+public:
+  /// @brief 最大通道数量
+  static constexpr uint8_t MAX_CHANNELS = 8;
+
+private:
+  /// @brief 各通道门控序列器
+  IR_Gate_Sequencer m_sequencer[MAX_CHANNELS];
+  /// @brief 各通道当前步骤剩余载波周期数
+  uint32_t          m_remain[MAX_CHANNELS];
+  /// @brief 各通道当前步骤标记掩码
+  uint8_t           m_marks;
+  /// @brief 通道数量
+  uint8_t           m_count;
+
+  void fetch(uint8_t channel);
+
+public:
+  IR_Gate_Merger() : m_remain {}, m_marks(0), m_count(0) {}
+
+  /**
+   * @brief IR 门控合并器 复位
+   *
+   * @param pulses    各通道脉冲序列(不发送的通道为nullptr)
+   * @param sizes     各通道脉冲数量
+   * @param count     通道数量(1~MAX_CHANNELS)
+   * @param frequency 载波频率(Hz)
+   */
+  void reset(const ir_pulse_t* const pulses[], const uint16_t sizes[], uint8_t count, uint32_t frequency);
+
+  /**
+   * @brief IR 门控合并器 获取下一合并步骤
+   *
+   * @param  cycles  步骤载波周期数
+   * @param  marks   各通道标记掩码(bit0对应通道0)
+   * @return bool    存在下一步骤返回true，全部通道结束返回false
+   */
+  bool next(uint32_t& cycles, uint8_t& marks);
+};
+} /* namespace device */
+} /* namespace OwO */
+
+#endif /* __IR_TIMELINE_HPP__ */
@@ -0,0 +1,108 @@
+/**
+ * @file      ir_timing.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for IR device transmit timing statistics (红外遥控 发送时序自测统计)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "ir_timing.hpp"
+#include <cstring>
+
+using namespace OwO;
+using namespace device;
+
+/**
+ * @brief (静态内联) IR 发送时序统计 饱和为16位寄存器
+ *
+ * @param  value     数值
+ * @return uint16_t  寄存器值
+ */
+static inline uint16_t sl_saturate(uint32_t value)
+{
+  return static_cast<uint16_t>((value > 0xFFFF) ? 0xFFFF : value);
+}
+
+/**
+ * @brief IR 发送时序统计 开始一帧
+ *
+ * @param clock  CPU主频(Hz)
+ * @param start  帧开始时刻(CPU周期计数)
+ */
+void IR_Timing::begin(uint32_t clock, uint32_t start)
+{
+  /* 直方图区间上限按主频换算为CPU周期, 记录边沿时只做比较 */
+  if (clock != m_clock)
+  {
+    m_clock = clock;
+    for (uint8_t i = 0; i < BUCKET_COUNT - 1; i++)
+      m_limits[i] = static_cast<uint32_t>((static_cast<uint64_t>(BUCKET_WIDTH << i) * clock + 999999999ULL) / 1000000000ULL);
+  }
+
+  m_start      = start;
+  m_edges      = 0;
+  m_sum        = 0;
+  m_max        = 0;
+  m_rise       = 0;
+  m_period_sum = 0;
+  m_periods    = 0;
+}
+
+/**
+ * @brief IR 发送时序统计 结束一帧 (计算单帧统计, 累计帧数与历史最大偏差)
+ *
+ * @param intended  计划结束时刻(CPU周期计数)
+ * @param actual    实际结束时刻(CPU周期计数)
+ */
+void IR_Timing::end(uint32_t intended, uint32_t actual)
+{
+  int64_t period = (0 == m_periods) ? 0 : m_period_sum / static_cast<int64_t>(m_periods);
+
+  m_last.edges          = m_edges;
+  m_last.max_deviation  = m_nanoseconds(m_max);
+  m_last.mean_deviation = (0 == m_edges) ? 0 : m_nanoseconds(m_sum / m_edges);
+  m_last.period_error   = (period < 0) ? -static_cast<int32_t>(m_nanoseconds(static_cast<uint64_t>(-period))) : static_cast<int32_t>(m_nanoseconds(static_cast<uint64_t>(period)));
+  m_last.duration       = m_nanoseconds(actual - m_start) / 1000;
+  m_last.expected       = m_nanoseconds(intended - m_start) / 1000;
+
+  m_frames++;
+  if (m_last.max_deviation > m_worst)
+    m_worst = m_last.max_deviation;
+}
+
+/**
+ * @brief IR 发送时序统计 清除全部统计
+ *
+ */
+void IR_Timing::clear()
+{
+  m_frames = 0;
+  m_worst  = 0;
+  m_last   = ir_timing_frame_t {};
+  memset(m_histogram, 0, sizeof(m_histogram));
+}
+
+/**
+ * @brief IR 发送时序统计 导出寄存器 (帧数, 历史最大偏差(ns), 最近一帧的最大偏差(ns)、平均偏差(ns)、周期误差(ns, 有符号)、总时长(us, 2个寄存器), 直方图; 超出16位时饱和)
+ *
+ * @param regs  寄存器(输出, REGISTER_COUNT 个)
+ */
+void IR_Timing::registers(uint16_t* regs) const
+{
+  int32_t error = m_last.period_error;
+  if (error > INT16_MAX)
+    error = INT16_MAX;
+  else if (error < INT16_MIN)
+    error = INT16_MIN;
+
+  regs[0] = sl_saturate(m_frames);
+  regs[1] = sl_saturate(m_worst);
+  regs[2] = sl_saturate(m_last.max_deviation);
+  regs[3] = sl_saturate(m_last.mean_deviation);
+  regs[4] = static_cast<uint16_t>(static_cast<int16_t>(error));
+  memcpy(&regs[5], &m_last.duration, sizeof(m_last.duration));
+  for (uint8_t i = 0; i < BUCKET_COUNT; i++)
+    regs[7 + i] = sl_saturate(m_histogram[i]);
+}
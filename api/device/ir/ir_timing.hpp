@@ -0,0 +1,207 @@
+/**
+ * @file      ir_timing.hpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for IR device transmit timing statistics (红外遥控 发送时序自测统计)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#ifndef __IR_TIMING_HPP__
+#define __IR_TIMING_HPP__
+
+#include <cstdint>
+
+/// @brief 名称空间 库名
+namespace OwO
+{
+/// @brief 名称空间 设备
+namespace device
+{
+/// @brief 结构体 IR 发送时序 单帧统计
+struct ir_timing_frame_t
+{
+  uint32_t edges;          /* 边沿数量 */
+  uint32_t max_deviation;  /* 最大边沿偏差(ns) */
+  uint32_t mean_deviation; /* 平均边沿偏差(ns) */
+  int32_t  period_error;   /* 载波周期平均误差(ns, 实际 - 标称) */
+  uint32_t duration;       /* 帧实际总时长(us) */
+  uint32_t expected;       /* 帧标称总时长(us) */
+};
+
+/// @brief 类 IR 发送时序统计 -- 记录每个输出边沿的计划时刻与实际时刻(CPU周期计数), 汇总单帧统计与边沿偏差直方图 (不依赖硬件)
+class IR_Timing
+{
+public:
+  /// @brief 直方图区间数量 (区间上限 125ns * 2^i, 末区间不设上限)
+  static constexpr uint8_t  BUCKET_COUNT   = 8;
+  /// @brief 首个直方图区间上限(ns)
+  static constexpr uint32_t BUCKET_WIDTH   = 125;
+  /// @brief 寄存器数量 (帧数, 历史最大偏差, 最大偏差, 平均偏差, 周期误差, 总时长(2), 直方图)
+  static constexpr uint16_t REGISTER_COUNT = 7 + BUCKET_COUNT;
+
+private:
+  /// @brief CPU主频(Hz)
+  uint32_t          m_clock;
+  /// @brief 帧开始时刻(CPU周期计数)
+  uint32_t          m_start;
+  /// @brief 直方图区间上限(CPU周期)
+  uint32_t          m_limits[BUCKET_COUNT - 1];
+  /// @brief 本帧边沿数量
+  uint32_t          m_edges;
+  /// @brief 本帧边沿偏差累加(CPU周期)
+  uint64_t          m_sum;
+  /// @brief 本帧最大边沿偏差(CPU周期)
+  uint32_t          m_max;
+  /// @brief 上一上升沿偏差(CPU周期)
+  int32_t           m_rise;
+  /// @brief 本帧载波周期误差累加(CPU周期)
+  int64_t           m_period_sum;
+  /// @brief 本帧载波周期数量
+  uint32_t          m_periods;
+  /// @brief 已统计帧数
+  uint32_t          m_frames;
+  /// @brief 最大边沿偏差历史最大值(ns)
+  uint32_t          m_worst;
+  /// @brief 边沿偏差直方图
+  uint32_t          m_histogram[BUCKET_COUNT];
+  /// @brief 最近一帧统计
+  ir_timing_frame_t m_last;
+
+  /**
+   * @brief (私有函数) IR 发送时序统计 记录一个边沿的偏差
+   *
+   * @param  deviation 偏差(CPU周期, 实际 - 计划)
+   */
+  void m_record(int32_t deviation)
+  {
+    uint32_t value = static_cast<uint32_t>(deviation < 0 ? -deviation : deviation);
+    uint8_t  index = 0;
+    while (index < BUCKET_COUNT - 1 && value >= m_limits[index])
+      index++;
+
+    m_histogram[index]++;
+    m_sum += value;
+    m_edges++;
+    if (value > m_max)
+      m_max = value;
+  }
+
+  /**
+   * @brief (私有函数) IR 发送时序统计 CPU周期换算为纳秒
+   *
+   * @param  cycles    CPU周期
+   * @return uint32_t  纳秒
+   */
+  uint32_t m_nanoseconds(uint64_t cycles) const
+  {
+    return (0 == m_clock) ? 0 : static_cast<uint32_t>(cycles * 1000000000ULL / m_clock);
+  }
+
+public:
+  IR_Timing() : m_clock(0), m_start(0), m_limits {}, m_edges(0), m_sum(0), m_max(0), m_rise(0), m_period_sum(0), m_periods(0), m_frames(0), m_worst(0), m_histogram {}, m_last {} {}
+
+  /**
+   * @brief IR 发送时序统计 开始一帧
+   *
+   * @param clock  CPU主频(Hz)
+   * @param start  帧开始时刻(CPU周期计数)
+   */
+  void begin(uint32_t clock, uint32_t start);
+
+  /**
+   * @brief IR 发送时序统计 记录上升沿 (同一标记内相邻上升沿的偏差之差即为载波周期误差)
+   *
+   * @param intended  计划时刻(CPU周期计数)
+   * @param actual    实际时刻(CPU周期计数)
+   * @param continued 同一标记内的后续载波周期
+   */
+  void rise(uint32_t intended, uint32_t actual, bool continued)
+  {
+    int32_t deviation = static_cast<int32_t>(actual - intended);
+    if (continued)
+    {
+      m_period_sum += deviation - m_rise;
+      m_periods++;
+    }
+    m_rise = deviation;
+    m_record(deviation);
+  }
+
+  /**
+   * @brief IR 发送时序统计 记录下降沿
+   *
+   * @param intended  计划时刻(CPU周期计数)
+   * @param actual    实际时刻(CPU周期计数)
+   */
+  void fall(uint32_t intended, uint32_t actual)
+  {
+    m_record(static_cast<int32_t>(actual - intended));
+  }
+
+  /**
+   * @brief IR 发送时序统计 结束一帧 (计算单帧统计, 累计帧数与历史最大偏差)
+   *
+   * @param intended  计划结束时刻(CPU周期计数)
+   * @param actual    实际结束时刻(CPU周期计数)
+   */
+  void end(uint32_t intended, uint32_t actual);
+
+  /**
+   * @brief IR 发送时序统计 清除全部统计
+   *
+   */
+  void clear();
+
+  /**
+   * @brief IR 发送时序统计 导出寄存器 (帧数, 历史最大偏差(ns), 最近一帧的最大偏差(ns)、平均偏差(ns)、周期误差(ns, 有符号)、总时长(us, 2个寄存器), 直方图; 超出16位时饱和)
+   *
+   * @param regs  寄存器(输出, REGISTER_COUNT 个)
+   */
+  void registers(uint16_t* regs) const;
+
+  /**
+   * @brief IR 发送时序统计 获取最近一帧统计
+   *
+   * @return const ir_timing_frame_t& 单帧统计
+   */
+  const ir_timing_frame_t& last() const
+  {
+    return m_last;
+  }
+
+  /**
+   * @brief IR 发送时序统计 获取已统计帧数
+   *
+   * @return uint32_t 帧数
+   */
+  uint32_t frames() const
+  {
+    return m_frames;
+  }
+
+  /**
+   * @brief IR 发送时序统计 获取最大边沿偏差历史最大值
+   *
+   * @return uint32_t 偏差(ns)
+   */
+  uint32_t worst() const
+  {
+    return m_worst;
+  }
+
+  /**
+   * @brief IR 发送时序统计 获取边沿偏差直方图
+   *
+   * @return const uint32_t* 直方图 (BUCKET_COUNT 个区间)
+   */
+  const uint32_t* histogram() const
+  {
+    return m_histogram;
+  }
+};
+} /* namespace device */
+} /* namespace OwO */
+
+#endif /* __IR_TIMING_HPP__ */
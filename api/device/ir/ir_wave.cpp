@@ -0,0 +1,331 @@
+/**
+ * @file      ir_wave.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for IR device GPIO waveform engine (红外遥控 GPIO 波形引擎)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "ir_wave.hpp"
+#include "port_gpio.h"
+#include "atomic.hpp"
+
+using namespace OwO;
+using namespace device;
+using namespace system;
+using namespace kernel;
+
+/**
+ * @brief IR GPIO 波形引擎 构造函数
+ */
+IR_Wave::IR_Wave() : m_done(1, 0), m_queue {}, m_arr {}, m_bsrr {}, m_pins {}, m_ports {}
+{
+  m_notify    = nullptr;
+  m_queued    = 0;
+  m_last_half = -1;
+  m_busy      = false;
+  m_is_open   = false;
+  m_clock     = 0;
+  m_frequency = DEFAULT_FREQUENCY;
+  m_duty      = DEFAULT_DUTY;
+}
+
+/**
+ * @brief IR GPIO 波形引擎 初始化定时器 (自动重装载值由DMA逐事件写入, 比较通道1/2在计数值为1时请求写入 BSRR)
+ *
+ * @param  frequency  载波频率(Hz)
+ * @param  duty       载波占空比(%)
+ * @return bool       成功返回true，失败返回false
+ */
+bool IR_Wave::open(uint32_t frequency, float duty)
+{
+  if (m_is_open)
+    close();
+
+  m_clock = ul_port_timer_get_clock(TIMER_NUM);
+  if (0 == m_clock || 0 == frequency || m_clock < frequency * 2 * IR_Waveform::MIN_TICKS)
+    return false;
+
+  if (SUCESS != e_port_timer_oc_init(TIMER_NUM, 0, 0xFFFF, 1, PORT_TIMER_TIMING, PORT_TIMER_UP, 1, true))
+    return false;
+
+  for (uint8_t channel = 1; channel <= IR_Waveform::PORT_COUNT; channel++)
+  {
+    if (SUCESS != e_port_timer_oc_channel_init(TIMER_NUM, channel, PORT_TIMER_TIMING, 1))
+    {
+      e_port_timer_deinit(TIMER_NUM);
+      return false;
+    }
+  }
+
+  m_frequency = frequency;
+  m_duty      = duty;
+  m_is_open   = true;
+  return true;
+}
+
+/**
+ * @brief IR GPIO 波形引擎 关闭定时器
+ *
+ */
+void IR_Wave::close()
+{
+  if (!m_is_open)
+    return;
+
+  if (m_busy)
+    abort();
+  e_port_timer_deinit(TIMER_NUM);
+  m_is_open = false;
+}
+
+/**
+ * @brief IR GPIO 波形引擎 设置通道引脚 (引脚需已配置为推挽输出, 最多使用两个端口)
+ *
+ * @param  channel  通道下标(0~7)
+ * @param  port     端口编号
+ * @param  pin      引脚编号
+ * @return bool     成功返回true，端口槽不足返回false
+ */
+bool IR_Wave::set_pin(uint8_t channel, Gpio::Port port, uint8_t pin)
+{
+  if (channel >= IR_Waveform::CHANNEL_COUNT || pin > 15 || m_busy)
+    return false;
+
+  for (uint8_t slot = 0; slot < IR_Waveform::PORT_COUNT; slot++)
+  {
+    if (0 == m_ports[slot])
+      m_ports[slot] = static_cast<uint8_t>(port);
+
+    if (static_cast<uint8_t>(port) == m_ports[slot])
+    {
+      m_pins[channel].slot = slot;
+      m_pins[channel].mask = static_cast<uint16_t>(1U << pin);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/**
+ * @brief (私有函数) IR GPIO 波形引擎 取出下一事件 (波形结束后以一个载波周期的空闲事件填充)
+ *
+ * @return ir_wave_event_t 波形事件
+ */
+ir_wave_event_t IR_Wave::pull()
+{
+  ir_wave_event_t event {};
+  if (m_waveform.next(event))
+  {
+    m_queued++;
+    return event;
+  }
+
+  event.ticks = m_waveform.period();
+  return event;
+}
+
+/**
+ * @brief (私有函数) IR GPIO 波形引擎 填充环形缓存区的一半 (BSRR 与当前事件对应, 自动重装载值领先两个事件)
+ *
+ * @param offset 起始下标(0或RING_SIZE / 2)
+ */
+void IR_Wave::fill(uint16_t offset)
+{
+  for (uint16_t i = offset; i < offset + RING_SIZE / 2; i++)
+  {
+    for (uint8_t slot = 0; slot < IR_Waveform::PORT_COUNT; slot++)
+      m_bsrr[slot][i] = m_queue[0].bsrr[slot];
+    m_arr[i] = static_cast<uint16_t>(m_queue[2].ticks - 1);
+
+    /* 最后一个有效事件写入该半区: 该半区输出完成时波形结束 */
+    if (0 != m_queued && 0 == --m_queued)
+      m_last_half = static_cast<int16_t>(offset);
+
+    m_queue[0] = m_queue[1];
+    m_queue[1] = m_queue[2];
+    m_queue[2] = pull();
+  }
+}
+
+/**
+ * @brief (私有函数) IR GPIO 波形引擎 半区输出完成 (中断上下文)
+ *
+ * @param offset 已输出半区起始下标
+ */
+void IR_Wave::consumed(uint16_t offset)
+{
+  if (!m_busy)
+    return;
+
+  if (static_cast<int16_t>(offset) != m_last_half)
+  {
+    fill(offset);
+    return;
+  }
+
+  stop();
+  m_last_half = -1;
+  m_done.release();
+  if (m_notify)
+    m_notify->release();
+}
+
+/**
+ * @brief (私有函数) IR GPIO 波形引擎 停止定时器与DMA数据流
+ *
+ */
+void IR_Wave::stop()
+{
+  e_port_timer_stop(TIMER_NUM);
+  e_port_timer_dma_stream_stop(TIMER_NUM, PORT_TIMER_DMA_UPDATE);
+  e_port_timer_dma_stream_stop(TIMER_NUM, PORT_TIMER_DMA_CC1);
+  e_port_timer_dma_stream_stop(TIMER_NUM, PORT_TIMER_DMA_CC2);
+}
+
+/**
+ * @brief (静态) IR GPIO 波形引擎 自动重装载DMA传输过半回调入口 (前半区已输出)
+ *
+ * @param arg IR GPIO 波形引擎实例
+ */
+void IR_Wave::half_entry(void* arg)
+{
+  static_cast<IR_Wave*>(arg)->consumed(0);
+}
+
+/**
+ * @brief (静态) IR GPIO 波形引擎 自动重装载DMA传输完成回调入口 (后半区已输出)
+ *
+ * @param arg IR GPIO 波形引擎实例
+ */
+void IR_Wave::cplt_entry(void* arg)
+{
+  static_cast<IR_Wave*>(arg)->consumed(RING_SIZE / 2);
+}
+
+/**
+ * @brief IR GPIO 波形引擎 开始发送多通道脉冲序列(非阻塞, 各通道同时开始)
+ *
+ * @param  pulses     各通道脉冲序列(不发送的通道为nullptr, 需在发送完成前保持有效)
+ * @param  sizes      各通道脉冲数量
+ * @param  notify     发送完成时额外释放的信号量(可为nullptr, 中断上下文释放)
+ * @param  frequency  载波频率(Hz, 0为初始化时的设置)
+ * @param  duty       载波占空比(%, 0为初始化时的设置)
+ * @return bool       开始发送返回true，忙或失败返回false
+ */
+bool IR_Wave::start(const ir_pulse_t* const pulses[IR_Waveform::CHANNEL_COUNT], const uint16_t sizes[IR_Waveform::CHANNEL_COUNT], Semaphore* notify, uint32_t frequency, float duty)
+{
+  if (!m_is_open)
+    return false;
+
+  {
+    Atomic_Guard atomic;
+    if (m_busy)
+      return false;
+    m_busy = true;
+  }
+
+  if (0 == frequency)
+    frequency = m_frequency;
+  if (duty <= 0.0f)
+    duty = m_duty;
+
+  if (!m_waveform.reset(pulses, sizes, m_pins, m_clock, frequency, duty) || m_waveform.is_finished())
+  {
+    m_busy = false;
+    return false;
+  }
+
+  /* 预取三个事件: 前两个事件的时长在启动前写入, 其余由更新事件DMA写入预装载 */
+  m_queued    = 0;
+  m_last_half = -1;
+  for (uint8_t i = 0; i < 3; i++)
+    m_queue[i] = pull();
+
+  const uint32_t first  = m_queue[0].ticks - 1;
+  const uint32_t second = m_queue[1].ticks - 1;
+  fill(0);
+  fill(RING_SIZE / 2);
+
+  port_timer_callback_t half_cb;
+  port_timer_callback_t cplt_cb;
+  half_cb.function = half_entry;
+  half_cb.arg      = static_cast<void*>(this);
+  cplt_cb.function = cplt_entry;
+  cplt_cb.arg      = static_cast<void*>(this);
+
+  bool ret = true;
+  m_notify = notify;
+  m_done.try_acquire();
+  {
+    Atomic_Guard atomic;
+    e_port_timer_stop(TIMER_NUM);
+    e_port_timer_set_autoreload(TIMER_NUM, first);
+    e_port_timer_generate_update(TIMER_NUM);
+    e_port_timer_set_autoreload(TIMER_NUM, second);
+
+    ret = ret && (SUCESS == e_port_timer_dma_stream_start(TIMER_NUM, PORT_TIMER_DMA_CC1, ul_port_gpio_get_bsrr_address(m_ports[0] ? m_ports[0] : Gpio::PA), m_bsrr[0], RING_SIZE, PORT_DMA_WORD, PORT_DMA_CIRCULAR, nullptr, nullptr));
+    ret = ret && (SUCESS == e_port_timer_dma_stream_start(TIMER_NUM, PORT_TIMER_DMA_CC2, ul_port_gpio_get_bsrr_address(m_ports[1] ? m_ports[1] : Gpio::PC), m_bsrr[1], RING_SIZE, PORT_DMA_WORD, PORT_DMA_CIRCULAR, nullptr, nullptr));
+    ret = ret && (SUCESS == e_port_timer_dma_stream_start(TIMER_NUM, PORT_TIMER_DMA_UPDATE, ul_port_timer_get_autoreload_address(TIMER_NUM), m_arr, RING_SIZE, PORT_DMA_HALFWORD, PORT_DMA_CIRCULAR, &half_cb, &cplt_cb));
+    ret = ret && (SUCESS == e_port_timer_start(TIMER_NUM));
+  }
+
+  if (!ret)
+    abort();
+  return ret;
+}
+
+/**
+ * @brief IR GPIO 波形引擎 等待发送完成
+ *
+ * @param  timeout  等待时间(ms), 0为仅查询
+ * @return bool     发送完成返回true，仍在发送返回false
+ */
+bool IR_Wave::finish(uint32_t timeout)
+{
+  if (!m_busy)
+    return true;
+
+  if (!m_done.try_acquire(timeout))
+    return false;
+
+  m_notify = nullptr;
+  m_busy   = false;
+  return true;
+}
+
+/**
+ * @brief IR GPIO 波形引擎 终止发送(全部引脚复位)
+ *
+ */
+void IR_Wave::abort()
+{
+  {
+    Atomic_Guard atomic;
+    stop();
+    m_last_half = -1;
+  }
+
+  for (uint8_t i = 0; i < IR_Waveform::CHANNEL_COUNT; i++)
+  {
+    for (uint8_t pin = 0; pin < 16; pin++)
+    {
+      if (m_pins[i].mask & (1U << pin))
+        v_port_gpio_write(m_ports[m_pins[i].slot], pin, false);
+    }
+  }
+
+  m_notify = nullptr;
+  m_busy   = false;
+}
+
+/**
+ * @brief IR GPIO 波形引擎 析构函数
+ */
+IR_Wave::~IR_Wave()
+{
+  close();
+}
@@ -0,0 +1,154 @@
+/**
+ * @file      ir_wave.hpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for IR device GPIO waveform engine (红外遥控 GPIO 波形引擎)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#ifndef __IR_WAVE_HPP__
+#define __IR_WAVE_HPP__
+
+#include "virtual_gpio.hpp"
+#include "port_tim.h"
+#include "semaphore.hpp"
+#include "ir_waveform.hpp"
+
+/// @brief 名称空间 库名
+namespace OwO
+{
+/// @brief 名称空间 设备
+namespace device
+{
+/// @brief 类 IR GPIO 波形引擎 -- 一个定时器按事件间隔计时, DMA将合并后的波形事件写入 GPIO BSRR (软件载波, 全部通道同时输出)
+class IR_Wave
+{
+  O_MEMORY
+  NO_COPY(IR_Wave)
+  NO_MOVE(IR_Wave)
+
+public:
+  /// @brief 定时器编号 (DMA2可访问GPIO)
+  static constexpr uint8_t  TIMER_NUM         = 8;
+  /// @brief 环形缓存区事件数量 (传输过半/完成时填充已输出的一半)
+  static constexpr uint16_t RING_SIZE         = 128;
+  /// @brief 默认载波频率(Hz)
+  static constexpr uint32_t DEFAULT_FREQUENCY = 38000;
+  /// @brief 默认载波占空比(%)
+  static constexpr float    DEFAULT_DUTY      = 33.3f;
+
+private:
+  /// @brief 发送完成信号量
+  system::kernel::Semaphore  m_done;
+  /// @brief 发送完成通知信号量
+  system::kernel::Semaphore* m_notify;
+  /// @brief 波形事件生成器
+  IR_Waveform                m_waveform;
+  /// @brief 事件预取队列 (自动重装载值领先 BSRR 两个事件)
+  ir_wave_event_t            m_queue[3];
+  /// @brief 事件预取队列中的有效事件数量
+  uint8_t                    m_queued;
+  /// @brief 自动重装载值环形缓存区
+  uint16_t                   m_arr[RING_SIZE];
+  /// @brief BSRR 环形缓存区
+  uint32_t                   m_bsrr[IR_Waveform::PORT_COUNT][RING_SIZE];
+  /// @brief 各通道引脚
+  ir_wave_pin_t              m_pins[IR_Waveform::CHANNEL_COUNT];
+  /// @brief 各端口槽对应的 GPIO 端口 (0为未使用)
+  uint8_t                    m_ports[IR_Waveform::PORT_COUNT];
+  /// @brief 最后一个有效事件所在的半区 (-1为未填充)
+  int16_t                    m_last_half;
+  /// @brief 正在发送
+  volatile bool              m_busy;
+  /// @brief 定时器已初始化
+  bool                       m_is_open;
+  /// @brief 定时器计数频率(Hz)
+  uint32_t                   m_clock;
+  /// @brief 载波频率(Hz)
+  uint32_t                   m_frequency;
+  /// @brief 载波占空比(%)
+  float                      m_duty;
+
+  ir_wave_event_t pull();
+  void            fill(uint16_t offset);
+  void            consumed(uint16_t offset);
+  void            stop();
+
+  static void half_entry(void* arg);
+  static void cplt_entry(void* arg);
+
+public:
+  IR_Wave();
+
+  /**
+   * @brief IR GPIO 波形引擎 初始化定时器
+   *
+   * @param  frequency  载波频率(Hz)
+   * @param  duty       载波占空比(%)
+   * @return bool       成功返回true，失败返回false
+   */
+  bool open(uint32_t frequency = DEFAULT_FREQUENCY, float duty = DEFAULT_DUTY);
+
+  /**
+   * @brief IR GPIO 波形引擎 关闭定时器
+   *
+   */
+  void close();
+
+  /**
+   * @brief IR GPIO 波形引擎 设置通道引脚 (引脚需已配置为推挽输出, 最多使用两个端口)
+   *
+   * @param  channel  通道下标(0~7)
+   * @param  port     端口编号
+   * @param  pin      引脚编号
+   * @return bool     成功返回true，端口槽不足返回false
+   */
+  bool set_pin(uint8_t channel, Gpio::Port port, uint8_t pin);
+
+  /**
+   * @brief IR GPIO 波形引擎 是否正在发送
+   *
+   * @return bool 正在发送返回true
+   */
+  bool is_busy() const
+  {
+    return m_busy;
+  }
+
+  /**
+   * @brief IR GPIO 波形引擎 开始发送多通道脉冲序列(非阻塞, 各通道同时开始)
+   *
+   * @param  pulses     各通道脉冲序列(不发送的通道为nullptr, 需在发送完成前保持有效)
+   * @param  sizes      各通道脉冲数量
+   * @param  notify     发送完成时额外释放的信号量(可为nullptr, 中断上下文释放)
+   * @param  frequency  载波频率(Hz, 0为初始化时的设置)
+   * @param  duty       载波占空比(%, 0为初始化时的设置)
+   * @return bool       开始发送返回true，忙或失败返回false
+   */
+  bool start(const ir_pulse_t* const pulses[IR_Waveform::CHANNEL_COUNT], const uint16_t sizes[IR_Waveform::CHANNEL_COUNT], system::kernel::Semaphore* notify = nullptr, uint32_t frequency = 0, float duty = 0);
+
+  /**
+   * @brief IR GPIO 波形引擎 等待发送完成
+   *
+   * @param  timeout  等待时间(ms), 0为仅查询
+   * @return bool     发送完成返回true，仍在发送返回false
+   */
+  bool finish(uint32_t timeout = 0);
+
+  /**
+   * @brief IR GPIO 波形引擎 终止发送(全部引脚复位)
+   *
+   */
+  void abort();
+
+  /**
+   * @brief IR GPIO 波形引擎 析构函数
+   */
+  ~IR_Wave();
+};
+} /* namespace device */
+} /* namespace OwO */
+
+#endif /* __IR_WAVE_HPP__ */
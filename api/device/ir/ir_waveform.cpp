@@ -0,0 +1,183 @@
+/**
+ * @file      ir_waveform.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for IR device GPIO waveform (红外遥控 GPIO 波形)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "ir_waveform.hpp"
+
+using namespace OwO;
+using namespace device;
+
+/**
+ * @brief (私有函数) IR GPIO 波形 生成当前标记通道的 BSRR 写入值
+ *
+ * @param set   置位(载波高电平)或复位
+ * @param bsrr  各端口槽 BSRR 写入值
+ */
+void IR_Waveform::m_make_bsrr(bool set, uint32_t bsrr[PORT_COUNT]) const
+{
+  for (uint8_t i = 0; i < PORT_COUNT; i++)
+    bsrr[i] = 0;
+
+  for (uint8_t i = 0; i < CHANNEL_COUNT; i++)
+  {
+    if (m_marks & (1U << i))
+      bsrr[m_pins[i].slot] |= set ? m_pins[i].mask : (static_cast<uint32_t>(m_pins[i].mask) << 16);
+  }
+}
+
+/**
+ * @brief IR GPIO 波形 复位 (各通道同时开始)
+ *
+ * @param  pulses     各通道脉冲序列(不发送的通道为nullptr)
+ * @param  sizes      各通道脉冲数量
+ * @param  pins       各通道引脚
+ * @param  clock      定时器计数频率(Hz)
+ * @param  frequency  载波频率(Hz)
+ * @param  duty       载波占空比(%)
+ * @return bool       成功返回true，参数错误返回false
+ */
+bool IR_Waveform::reset(const ir_pulse_t* const pulses[CHANNEL_COUNT], const uint16_t sizes[CHANNEL_COUNT], const ir_wave_pin_t pins[CHANNEL_COUNT], uint32_t clock, uint32_t frequency, float duty)
+{
+  m_finished = true;
+  m_has_held = false;
+  if (0 == frequency || clock < frequency * 2 * MIN_TICKS)
+    return false;
+
+  /* 载波周期四舍五入, 高电平时长限制在 [MIN_TICKS, 周期 - MIN_TICKS] */
+  m_period = (clock + frequency / 2) / frequency;
+  m_high   = static_cast<uint32_t>(m_period * duty / 100.0f + 0.5f);
+  if (m_period > MAX_TICKS)
+    return false;
+  if (m_high < MIN_TICKS)
+    m_high = MIN_TICKS;
+  if (m_high > m_period - MIN_TICKS)
+    m_high = m_period - MIN_TICKS;
+
+  m_active = 0;
+  for (uint8_t i = 0; i < CHANNEL_COUNT; i++)
+  {
+    m_pins[i] = pins[i];
+    if (0 != m_pins[i].mask && m_pins[i].slot < PORT_COUNT)
+      m_active |= (1U << i);
+    else
+      m_pins[i].mask = 0;
+  }
+
+  m_merger.reset(pulses, sizes, CHANNEL_COUNT, (clock + m_period / 2) / m_period);
+  m_cycles   = 0;
+  m_marks    = 0;
+  m_falling  = false;
+  m_finished = false;
+  return true;
+}
+
+/**
+ * @brief IR GPIO 波形 获取下一事件 (各通道同一时刻的边沿合并为一个事件, 空闲合并至上一事件时长)
+ *
+ * @param  event  波形事件
+ * @return bool   存在下一事件返回true，波形结束返回false
+ */
+bool IR_Waveform::next(ir_wave_event_t& event)
+{
+  while (true)
+  {
+    /* 超过自动重装载范围的时长拆分为空事件 */
+    if (m_has_held && m_held.ticks > MAX_TICKS)
+    {
+      event          = m_held;
+      event.ticks    = MAX_TICKS;
+      m_held.ticks  -= MAX_TICKS;
+      m_held.bsrr[0] = 0;
+      m_held.bsrr[1] = 0;
+      return true;
+    }
+
+    if (0 == m_cycles)
+    {
+      uint32_t cycles = 0;
+      uint8_t  marks  = 0;
+
+      if (m_finished || !m_merger.next(cycles, marks))
+      {
+        /* 全部通道结束: 输出最后一个事件 */
+        m_finished = true;
+        if (!m_has_held)
+          return false;
+
+        event      = m_held;
+        m_has_held = false;
+        return true;
+      }
+
+      /* 无标记通道: 空闲累加至上一事件 */
+      marks &= m_active;
+      if (0 == marks)
+      {
+        if (!m_has_held)
+        {
+          m_held     = ir_wave_event_t {};
+          m_has_held = true;
+        }
+        m_held.ticks += cycles * m_period;
+        continue;
+      }
+
+      m_cycles  = cycles;
+      m_marks   = marks;
+      m_falling = false;
+    }
+
+    /* 载波周期: 上升沿置位全部标记通道, 下降沿复位 */
+    ir_wave_event_t edge;
+    m_make_bsrr(!m_falling, edge.bsrr);
+    if (!m_falling)
+    {
+      edge.ticks = m_high;
+      m_falling  = true;
+    }
+    else
+    {
+      edge.ticks = m_period - m_high;
+      m_falling  = false;
+      m_cycles--;
+    }
+
+    bool ready = m_has_held;
+    event      = m_held;
+    m_held     = edge;
+    m_has_held = true;
+    if (ready)
+      return true;
+  }
+}
+
+/**
+ * @brief IR GPIO 波形 计算事件数量 (评估缓存区大小)
+ *
+ * @param  pulses     各通道脉冲序列(不发送的通道为nullptr)
+ * @param  sizes      各通道脉冲数量
+ * @param  pins       各通道引脚
+ * @param  clock      定时器计数频率(Hz)
+ * @param  frequency  载波频率(Hz)
+ * @param  duty       载波占空比(%)
+ * @return uint32_t   事件数量
+ */
+uint32_t IR_Waveform::count(const ir_pulse_t* const pulses[CHANNEL_COUNT], const uint16_t sizes[CHANNEL_COUNT], const ir_wave_pin_t pins[CHANNEL_COUNT], uint32_t clock, uint32_t frequency, float duty)
+{
+  IR_Waveform     waveform;
+  ir_wave_event_t event;
+  uint32_t        number = 0;
+
+  if (!waveform.reset(pulses, sizes, pins, clock, frequency, duty))
+    return 0;
+
+  while (waveform.next(event))
+    number++;
+  return number;
+}
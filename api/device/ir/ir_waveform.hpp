@@ -0,0 +1,135 @@
+/**
+ * @file      ir_waveform.hpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for IR device GPIO waveform (红外遥控 GPIO 波形)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#ifndef __IR_WAVEFORM_HPP__
+#define __IR_WAVEFORM_HPP__
+
+#include "ir_timeline.hpp"
+
+/// @brief 名称空间 库名
+namespace OwO
+{
+/// @brief 名称空间 设备
+namespace device
+{
+/// @brief 结构体 IR 波形通道引脚
+struct ir_wave_pin_t
+{
+  uint8_t  slot; /* BSRR 端口槽(0~IR_Waveform::PORT_COUNT-1) */
+  uint16_t mask; /* 引脚掩码(0为不输出) */
+};
+
+/// @brief 结构体 IR 波形事件 (事件时刻写入各端口 BSRR, 经过 ticks 个定时器计数后进入下一事件)
+struct ir_wave_event_t
+{
+  uint32_t ticks;   /* 距下一事件的定时器计数(MIN_TICKS~MAX_TICKS) */
+  uint32_t bsrr[2]; /* 各端口槽 BSRR 写入值(低16位置位, 高16位复位, 0为不改变) */
+};
+
+/// @brief 类 IR GPIO 波形 -- 将多通道标记/空闲时序合并为按时间排序的 BSRR 置位/复位事件 (不依赖硬件)
+class IR_Waveform
+{
+public:
+  /// @brief 通道数量
+  static constexpr uint8_t  CHANNEL_COUNT = 8;
+  /// @brief 端口槽数量 (每个端口槽对应一路 BSRR 数据流)
+  static constexpr uint8_t  PORT_COUNT    = 2;
+  /// @brief 单个事件最小定时器计数 (DMA请求在计数值为1时产生)
+  static constexpr uint32_t MIN_TICKS     = 2;
+  /// @brief 单个事件最大定时器计数 (16位自动重装载)
+  static constexpr uint32_t MAX_TICKS     = 0x10000;
+
+private:
+  /// @brief 各通道门控合并器
+  IR_Gate_Merger  m_merger;
+  /// @brief 各通道引脚
+  ir_wave_pin_t   m_pins[CHANNEL_COUNT];
+  /// @brief 输出引脚的通道掩码
+  uint8_t         m_active;
+  /// @brief 载波周期(定时器计数)
+  uint32_t        m_period;
+  /// @brief 载波高电平时长(定时器计数)
+  uint32_t        m_high;
+  /// @brief 当前合并步骤剩余载波周期数
+  uint32_t        m_cycles;
+  /// @brief 当前合并步骤标记掩码
+  uint8_t         m_marks;
+  /// @brief 下一边沿为下降沿
+  bool            m_falling;
+  /// @brief 待输出事件 (时长随后续空闲累加)
+  ir_wave_event_t m_held;
+  /// @brief 存在待输出事件
+  bool            m_has_held;
+  /// @brief 波形结束
+  bool            m_finished;
+
+  void m_make_bsrr(bool set, uint32_t bsrr[PORT_COUNT]) const;
+
+public:
+  IR_Waveform() : m_pins {}, m_active(0), m_period(0), m_high(0), m_cycles(0), m_marks(0), m_falling(false), m_held {}, m_has_held(false), m_finished(true) {}
+
+  /**
+   * @brief IR GPIO 波形 复位 (各通道同时开始)
+   *
+   * @param  pulses     各通道脉冲序列(不发送的通道为nullptr)
+   * @param  sizes      各通道脉冲数量
+   * @param  pins       各通道引脚
+   * @param  clock      定时器计数频率(Hz)
+   * @param  frequency  载波频率(Hz)
+   * @param  duty       载波占空比(%)
+   * @return bool       成功返回true，参数错误返回false
+   */
+  bool reset(const ir_pulse_t* const pulses[CHANNEL_COUNT], const uint16_t sizes[CHANNEL_COUNT], const ir_wave_pin_t pins[CHANNEL_COUNT], uint32_t clock, uint32_t frequency, float duty);
+
+  /**
+   * @brief IR GPIO 波形 获取下一事件 (各通道同一时刻的边沿合并为一个事件, 空闲合并至上一事件时长)
+   *
+   * @param  event  波形事件
+   * @return bool   存在下一事件返回true，波形结束返回false
+   */
+  bool next(ir_wave_event_t& event);
+
+  /**
+   * @brief IR GPIO 波形 是否结束
+   *
+   * @return bool 结束返回true
+   */
+  bool is_finished() const
+  {
+    return m_finished && !m_has_held;
+  }
+
+  /**
+   * @brief IR GPIO 波形 获取载波周期
+   *
+   * @return uint32_t 载波周期(定时器计数)
+   */
+  uint32_t period() const
+  {
+    return m_period;
+  }
+
+  /**
+   * @brief IR GPIO 波形 计算事件数量 (评估缓存区大小)
+   *
+   * @param  pulses     各通道脉冲序列(不发送的通道为nullptr)
+   * @param  sizes      各通道脉冲数量
+   * @param  pins       各通道引脚
+   * @param  clock      定时器计数频率(Hz)
+   * @param  frequency  载波频率(Hz)
+   * @param  duty       载波占空比(%)
+   * @return uint32_t   事件数量
+   */
+  static uint32_t count(const ir_pulse_t* const pulses[CHANNEL_COUNT], const uint16_t sizes[CHANNEL_COUNT], const ir_wave_pin_t pins[CHANNEL_COUNT], uint32_t clock, uint32_t frequency, float duty);
+};
+} /* namespace device */
+} /* namespace OwO */
+
+#endif /* __IR_WAVEFORM_HPP__ */
@@ -89,6 +89,42 @@ void Tcp_Client::data_input()
   }
 }
 
+/**
+ * @brief TCP 客户端 零拷贝接收 (不阻塞; 指向套接字接收流中连续的一段, 接收流回绕时只返回回绕点之前的部分)
+ *
+ * @param  data     接收流数据指针 (输出, 在 release_zero_copy 之前有效)
+ * @return int32_t  连续可读字节数, 无数据返回0, 连接关闭或出错返回负值
+ */
+int32_t Tcp_Client::recv_zero_copy(const uint8_t*& data)
+{
+  uint8_t* buffer = nullptr;
+  int32_t  length = FreeRTOS_recv(m_socket, &buffer, 0, FREERTOS_ZERO_COPY | FREERTOS_MSG_DONTWAIT);
+  data            = buffer;
+  return length;
+}
+
+/**
+ * @brief TCP 客户端 释放零拷贝接收的数据 (接收流前移, 窗口随之打开)
+ *
+ * @param  data    recv_zero_copy 返回的数据指针
+ * @param  length  已处理的字节数
+ * @return bool    释放成功返回true
+ */
+bool Tcp_Client::release_zero_copy(const uint8_t* data, uint32_t length)
+{
+  return pdPASS == FreeRTOS_ReleaseTCPPayloadBuffer(m_socket, data, static_cast<BaseType_t>(length));
+}
+
+/**
+ * @brief TCP 客户端 关闭连接的收发 (任意线程调用; 对端确认后套接字报告关闭, 由服务器线程删除客户端)
+ *
+ */
+void Tcp_Client::shutdown()
+{
+  if (m_socket != nullptr)
+    FreeRTOS_shutdown(m_socket, FREERTOS_SHUT_RDWR);
+}
+
 void Tcp_Client::process_addr(freertos_sockaddr* sockaddr, char* ip, uint16_t& port)
 {
   port = FreeRTOS_ntohs(sockaddr->sin_port);
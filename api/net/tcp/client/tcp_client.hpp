@@ -59,6 +59,10 @@ public:
 
   virtual bool close();
 
+  int32_t recv_zero_copy(const uint8_t*& data);
+  bool    release_zero_copy(const uint8_t* data, uint32_t length);
+  void    shutdown();
+
   char* client_ip() const
   {
     return m_client_ip;
@@ -21,7 +21,7 @@ void Server::run()
 
 void Server::server_loop()
 {
-  int cnt = FreeRTOS_select(m_socket_set, portMAX_DELAY);
+  int cnt = FreeRTOS_select(m_socket_set, (WAIT_FOREVER == m_poll_time) ? portMAX_DELAY : pdMS_TO_TICKS(m_poll_time));
 
   if (cnt & eSELECT_READ)
   {
@@ -34,6 +34,8 @@ void Server::server_loop()
   {
     clear_client();
   }
+
+  client_poll();
 }
 
 void Server::add_client()
@@ -44,7 +46,7 @@ void Server::add_client()
 
   if (client_socket != NULL)
   {
-    Tcp_Client* client = new Tcp_Client("tcp_client", this);
+    Tcp_Client* client = create_client();
     if (client->open(client_socket, &client_addr, m_client_istream_size, m_client_ostream_size))
     {
       FreeRTOS_FD_SET(client_socket, m_socket_set, eSELECT_READ | eSELECT_EXCEPT);
@@ -70,10 +72,14 @@ void Server::write_client()
   if (m_clients.empty())
     return;
 
-  for (auto client : m_clients)
+  /* 处理过程中客户端可能被删除, 先移动迭代器 */
+  auto it = m_clients.begin();
+  while (it != m_clients.end())
   {
+    Tcp_Client* client = *it;
+    ++it;
     if (FreeRTOS_FD_ISSET(client->fd(), m_socket_set))
-      client->data_input();
+      client_input(client);
   }
 }
 
@@ -122,14 +128,15 @@ Server::Server(const std::string& name, Object* parent) : Thread(name, parent)
   m_server_port   = 0;
   m_server_socket = nullptr;
   m_socket_set    = nullptr;
+  m_poll_time     = WAIT_FOREVER;
 }
 
-void Server::start(uint16_t port, uint8_t priority, uint32_t client_istream_size, uint32_t client_ostream_size)
+void Server::start(uint16_t port, uint8_t priority, uint32_t client_istream_size, uint32_t client_ostream_size, uint16_t stack_size)
 {
   m_server_port         = port;
   m_client_istream_size = client_istream_size;
   m_client_ostream_size = client_ostream_size;
-  Thread::start(priority, 256, 4);
+  Thread::start(priority, stack_size, 4);
 }
 
 void Server::stop()
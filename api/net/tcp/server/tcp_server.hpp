@@ -27,6 +27,7 @@ private:
   uint32_t               m_client_ostream_size;
   SocketSet_t            m_socket_set;
   std::list<Tcp_Client*> m_clients;
+  uint32_t               m_poll_time;
 
   virtual void run() override;
   virtual void event_loop() {};
@@ -45,14 +46,48 @@ private:
 protected:
   void remove_client(Tcp_Client* client);
 
+  /* 暂停/恢复监听客户端 (交由其他线程处理期间) */
+  void pause_client(Tcp_Client* client)
+  {
+    FreeRTOS_FD_CLR(client->fd(), m_socket_set, eSELECT_READ | eSELECT_EXCEPT);
+  }
+
+  void resume_client(Tcp_Client* client)
+  {
+    FreeRTOS_FD_SET(client->fd(), m_socket_set, eSELECT_READ | eSELECT_EXCEPT);
+  }
+
+  /* 监听等待时间(ms), 到期后即使没有事件也调用 client_poll (默认一直等待) */
+  void set_poll_time(uint32_t timeout = WAIT_FOREVER)
+  {
+    m_poll_time = timeout;
+  }
+
+  const std::list<Tcp_Client*>& clients() const
+  {
+    return m_clients;
+  }
+
   void get_server_addr(char* ip, uint16_t& port)
   {
     port = m_server_port;
     memcpy(ip, m_server_ip, strlen(m_server_ip));
   }
 
+  virtual Tcp_Client* create_client()
+  {
+    return new Tcp_Client("tcp_client", this);
+  }
+
+  virtual void client_input(Tcp_Client* client)
+  {
+    client->data_input();
+  }
+
   virtual void client_connect(Tcp_Client* client) {};
   virtual void client_disconnect(Tcp_Client* client) {};
+  /* 每次监听返回后调用 (事件到达或等待超时), 用于检查停滞的客户端 */
+  virtual void client_poll() {};
 
 public:
   system::Signal<Tcp_Client*> signal_client_connect;
@@ -60,7 +95,7 @@ public:
 
   Server(const std::string& name = "tcp_server", Object* parent = nullptr);
 
-  virtual void start(uint16_t port, uint8_t priority = THREAD_DEF_PRIORITY, uint32_t client_istream_size = 256, uint32_t client_ostream_size = 0);
+  virtual void start(uint16_t port, uint8_t priority = THREAD_DEF_PRIORITY, uint32_t client_istream_size = 256, uint32_t client_ostream_size = 0, uint16_t stack_size = 256);
   virtual void stop();
   uint8_t      client_count() const
   {
@@ -0,0 +1,191 @@
+/**
+ * @file      modbus_codec.hpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for Modbus codec (Modbus 编解码: 查表/四字节并行 CRC16, ADU/PDU 封装与解析, 异常应答)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#ifndef __MODBUS_CODEC_HPP__
+#define __MODBUS_CODEC_HPP__
+
+#include <stdint.h>
+
+/// @brief 名称空间 库名
+namespace OwO
+{
+/// @brief 名称空间 协议
+namespace protocol
+{
+/// @brief 名称空间 Modbus
+namespace modbus
+{
+/**
+ * @brief 类 Modbus 编解码 -- 从机, 主机与设备驱动共用的帧编解码 (不依赖硬件)
+ *
+ * RTU ADU: 地址1 + PDU + CRC2 (低字节在前); TCP ADU: MBAP头7 (事务号2 + 协议号2 + 长度2 + 单元号1) + PDU.
+ * 封装函数假定地址/单元号与 PDU 已写入缓存区, 只补齐长度字段或 CRC, 返回 ADU 长度.
+ * 收发路径的 CRC 按四字节并行查表计算 (4 x 256 表); crc16 为单表逐字节查表.
+ */
+class Modbus_Codec
+{
+public:
+  /// @brief RTU 头长度 (从机地址)
+  static constexpr uint16_t RTU_HEADER_SIZE = 1;
+  /// @brief RTU CRC 长度
+  static constexpr uint16_t CRC_SIZE        = 2;
+  /// @brief MBAP头长度
+  static constexpr uint16_t MBAP_SIZE       = 7;
+  /// @brief 异常应答 PDU 长度 (功能码 | 0x80 + 异常码)
+  static constexpr uint16_t EXCEPTION_SIZE  = 2;
+
+  static uint16_t crc16(const uint8_t* data, uint32_t length);
+  static uint16_t crc16_slice4(const uint8_t* data, uint32_t length);
+
+  /**
+   * @brief Modbus 编解码 读取大端16位
+   *
+   * @param  data      数据
+   * @return uint16_t  数值
+   */
+  static uint16_t read16(const uint8_t* data)
+  {
+    return static_cast<uint16_t>((data[0] << 8) | data[1]);
+  }
+
+  /**
+   * @brief Modbus 编解码 写入大端16位
+   *
+   * @param data   数据
+   * @param value  数值
+   */
+  static void write16(uint8_t* data, uint16_t value)
+  {
+    data[0] = static_cast<uint8_t>(value >> 8);
+    data[1] = static_cast<uint8_t>(value);
+  }
+
+  /**
+   * @brief Modbus 编解码 校验 RTU 帧尾 CRC
+   *
+   * @param  frame   帧 (含 CRC)
+   * @param  length  帧长度
+   * @return bool    校验通过返回true
+   */
+  static bool check_crc(const uint8_t* frame, uint32_t length)
+  {
+    if (length < CRC_SIZE)
+      return false;
+
+    uint16_t crc_value = crc16_slice4(frame, length - CRC_SIZE);
+    return frame[length - 2] == static_cast<uint8_t>(crc_value) && frame[length - 1] == static_cast<uint8_t>(crc_value >> 8);
+  }
+
+  /**
+   * @brief Modbus 编解码 在帧尾追加 CRC (低字节在前)
+   *
+   * @param  frame     帧 (需预留2字节)
+   * @param  length    不含 CRC 的帧长度
+   * @return uint16_t  追加后的帧长度
+   */
+  static uint16_t add_crc(uint8_t* frame, uint16_t length)
+  {
+    uint16_t crc_value = crc16_slice4(frame, length);
+    frame[length]      = static_cast<uint8_t>(crc_value);
+    frame[length + 1]  = static_cast<uint8_t>(crc_value >> 8);
+    return length + CRC_SIZE;
+  }
+
+  /**
+   * @brief Modbus 编解码 写入MBAP头
+   *
+   * @param adu          ADU
+   * @param transaction  事务号
+   * @param protocol     协议号
+   * @param unit         单元号
+   * @param pdu_length   PDU 长度
+   */
+  static void encode_mbap(uint8_t* adu, uint16_t transaction, uint16_t protocol, uint8_t unit, uint16_t pdu_length)
+  {
+    write16(adu, transaction);
+    write16(adu + 2, protocol);
+    write16(adu + 4, pdu_length + 1);
+    adu[6] = unit;
+  }
+
+  /**
+   * @brief Modbus 编解码 读取MBAP头中的 PDU 长度
+   *
+   * @param  adu       ADU
+   * @return uint16_t  PDU 长度 (长度字段为0时返回0)
+   */
+  static uint16_t decode_mbap(const uint8_t* adu)
+  {
+    uint16_t length = read16(adu + 4);
+    return length > 0 ? length - 1 : 0;
+  }
+
+  /**
+   * @brief Modbus 编解码 封装 RTU ADU (地址与 PDU 已写入, 追加 CRC)
+   *
+   * @param  adu         ADU
+   * @param  pdu_length  PDU 长度
+   * @return uint16_t    ADU 长度
+   */
+  static uint16_t encode_rtu(uint8_t* adu, uint16_t pdu_length)
+  {
+    return add_crc(adu, RTU_HEADER_SIZE + pdu_length);
+  }
+
+  /**
+   * @brief Modbus 编解码 封装 TCP ADU (事务号, 协议号, 单元号与 PDU 已写入, 填写长度字段)
+   *
+   * @param  adu         ADU
+   * @param  pdu_length  PDU 长度
+   * @return uint16_t    ADU 长度
+   */
+  static uint16_t encode_tcp(uint8_t* adu, uint16_t pdu_length)
+  {
+    write16(adu + 4, pdu_length + 1);
+    return MBAP_SIZE + pdu_length;
+  }
+
+  /**
+   * @brief Modbus 编解码 解析 RTU ADU
+   *
+   * @param  adu         ADU (含 CRC)
+   * @param  length      ADU 长度
+   * @param  pdu_length  PDU 长度 (输出)
+   * @return bool        长度不足或 CRC 错误返回false
+   */
+  static bool decode_rtu(const uint8_t* adu, uint16_t length, uint16_t& pdu_length)
+  {
+    if (length < RTU_HEADER_SIZE + 1 + CRC_SIZE || !check_crc(adu, length))
+      return false;
+
+    pdu_length = length - RTU_HEADER_SIZE - CRC_SIZE;
+    return true;
+  }
+
+  /**
+   * @brief Modbus 编解码 写入异常应答 PDU
+   *
+   * @param  pdu            PDU
+   * @param  function_code  请求功能码
+   * @param  error_code     异常码
+   * @return uint16_t       PDU 长度
+   */
+  static uint16_t encode_exception(uint8_t* pdu, uint8_t function_code, uint8_t error_code)
+  {
+    pdu[0] = static_cast<uint8_t>(function_code | 0x80);
+    pdu[1] = error_code;
+    return EXCEPTION_SIZE;
+  }
+};
+} /* namespace modbus */
+} /* namespace protocol */
+} /* namespace OwO */
+
+#endif /* __MODBUS_CODEC_HPP__ */
@@ -0,0 +1,525 @@
+/**
+ * @file      modbus_framer.hpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for Modbus framing (Modbus 分帧: TCP按MBAP长度切分字节流, RTU按功能码增量解析; 不阻塞, 帧内字节间隔超时)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#ifndef __MODBUS_FRAMER_HPP__
+#define __MODBUS_FRAMER_HPP__
+
+#include <stdint.h>
+#include <string.h>
+
+/// @brief 名称空间 库名
+namespace OwO
+{
+/// @brief 名称空间 协议
+namespace protocol
+{
+/// @brief 名称空间 Modbus
+namespace modbus
+{
+/**
+ * @brief 类 Modbus TCP 分帧 -- 每个连接一个实例, 处理字节流中的全部完整ADU (流水线请求), 段尾不完整的帧暂存至下一段续接 (不依赖硬件)
+ *
+ * 完整位于输入段内的ADU直接以输入指针回调 (零拷贝), 只有跨段的ADU经过暂存区.
+ * 部分帧超过字节间隔超时仍未续接完整时视为对端停滞: TCP 字节流无法重新定位帧边界, 由调用方关闭连接.
+ * 停滞的对端不再有输入, 调用方在等待输入超时时调用 expire 检查.
+ */
+class Modbus_Tcp_Framer
+{
+public:
+  /// @brief MBAP头长度 (事务号2 + 协议号2 + 长度2 + 单元号1)
+  static constexpr uint16_t MBAP_SIZE = 7;
+  /// @brief ADU 最大长度
+  static constexpr uint16_t ADU_SIZE  = 260;
+  /// @brief 默认字节间隔超时(ms)
+  static constexpr uint32_t TIMEOUT   = 1000;
+
+private:
+  /// @brief 暂存区 (跨段的部分帧)
+  uint8_t  m_buffer[ADU_SIZE];
+  /// @brief 暂存区已有字节数
+  uint16_t m_length;
+  /// @brief 暂存帧的ADU总长度 (MBAP头未收齐时为0)
+  uint16_t m_size;
+  /// @brief 最近一次输入的时刻(ms)
+  uint32_t m_tick;
+  /// @brief 字节间隔超时(ms)
+  uint32_t m_timeout;
+  /// @brief 完整ADU数量
+  uint32_t m_frames;
+  /// @brief 长度字段非法次数
+  uint32_t m_errors;
+  /// @brief 部分帧超时次数
+  uint32_t m_timeouts;
+
+  static void m_count(uint32_t& counter)
+  {
+    if (counter < 0xFFFFFFFF)
+      counter++;
+  }
+
+  bool m_error(uint32_t& counter)
+  {
+    m_length = 0;
+    m_size   = 0;
+    m_count(counter);
+    return false;
+  }
+
+public:
+  explicit Modbus_Tcp_Framer(uint32_t timeout = TIMEOUT)
+  {
+    m_length   = 0;
+    m_size     = 0;
+    m_tick     = 0;
+    m_timeout  = timeout;
+    m_frames   = 0;
+    m_errors   = 0;
+    m_timeouts = 0;
+  }
+
+  /**
+   * @brief Modbus TCP 分帧 ADU 总长度 (由MBAP头长度字段计算)
+   *
+   * @param  header    MBAP头 (MBAP_SIZE 字节)
+   * @return uint16_t  ADU 总长度, 长度字段非法返回0
+   */
+  static uint16_t adu_size(const uint8_t* header)
+  {
+    uint16_t length = (header[4] << 8) | header[5];
+    if (length < 2 || 6 + length > ADU_SIZE)
+      return 0;
+    return 6 + length;
+  }
+
+  /**
+   * @brief Modbus TCP 分帧 输入一段字节流 (全部消费: 完整ADU依次回调, 段尾部分帧暂存)
+   *
+   * 长度字段非法或暂存的部分帧超时时无法重新定位帧边界, 丢弃暂存帧与本段字节.
+   * 回调返回后输入段即可释放 (回调内完成应答生成).
+   *
+   * @tparam Handler  回调 void(const uint8_t* adu, uint16_t size)
+   * @param  data     字节流
+   * @param  length   字节数
+   * @param  now      当前时刻(ms)
+   * @param  handler  完整ADU回调
+   * @return bool     长度字段非法或部分帧超时返回false
+   */
+  template <typename Handler>
+  bool feed(const uint8_t* data, uint32_t length, uint32_t now, Handler&& handler)
+  {
+    if (expire(now))
+      return false;
+    m_tick = now;
+
+    /* 续接暂存的部分帧 */
+    while (m_length > 0 && length > 0)
+    {
+      uint16_t need = (0 == m_size) ? MBAP_SIZE - m_length : m_size - m_length;
+      if (need > length)
+        need = static_cast<uint16_t>(length);
+
+      memcpy(m_buffer + m_length, data, need);
+      m_length += need;
+      data     += need;
+      length   -= need;
+
+      if (0 == m_size)
+      {
+        if (m_length < MBAP_SIZE)
+          continue;
+        m_size = adu_size(m_buffer);
+        if (0 == m_size)
+          return m_error(m_errors);
+      }
+
+      if (m_length == m_size)
+      {
+        handler(static_cast<const uint8_t*>(m_buffer), m_size);
+        m_count(m_frames);
+        m_length = 0;
+        m_size   = 0;
+      }
+    }
+
+    /* 段内完整帧原地回调 */
+    while (length >= MBAP_SIZE)
+    {
+      uint16_t size = adu_size(data);
+      if (0 == size)
+        return m_error(m_errors);
+      if (size > length)
+        break;
+
+      handler(data, size);
+      m_count(m_frames);
+      data   += size;
+      length -= size;
+    }
+
+    /* 段尾部分帧暂存 */
+    if (length > 0)
+    {
+      memcpy(m_buffer, data, length);
+      m_length = static_cast<uint16_t>(length);
+      m_size   = (m_length >= MBAP_SIZE) ? adu_size(m_buffer) : 0;
+    }
+    return true;
+  }
+
+  /**
+   * @brief Modbus TCP 分帧 检查部分帧超时 (对端停滞后不再有输入, 由调用方在等待输入超时时调用)
+   *
+   * @param  now   当前时刻(ms)
+   * @return bool  暂存的部分帧超时返回true (已丢弃, 由调用方关闭连接)
+   */
+  bool expire(uint32_t now)
+  {
+    if (0 == m_length || now - m_tick <= m_timeout)
+      return false;
+    m_error(m_timeouts);
+    return true;
+  }
+
+  /// @brief 丢弃暂存的部分帧
+  void reset()
+  {
+    m_length = 0;
+    m_size   = 0;
+  }
+
+  void set_timeout(uint32_t timeout)
+  {
+    m_timeout = timeout;
+  }
+
+  uint32_t timeout() const
+  {
+    return m_timeout;
+  }
+
+  /// @brief 暂存的部分帧字节数
+  uint16_t pending() const
+  {
+    return m_length;
+  }
+
+  uint32_t frames() const
+  {
+    return m_frames;
+  }
+
+  uint32_t errors() const
+  {
+    return m_errors;
+  }
+
+  uint32_t timeouts() const
+  {
+    return m_timeouts;
+  }
+};
+
+/**
+ * @brief 类 Modbus TCP 应答合并 -- 每个工作线程一个实例, 零拷贝读取一个连接的接收流, 分帧后逐帧生成应答, 合并发送 (不依赖硬件)
+ *
+ * 接收流中的全部完整帧依次处理 (流水线请求), 每段在应答生成后释放, 段尾部分帧由连接的分帧器暂存续接 (不阻塞等待).
+ * 每帧按 ADU_SIZE 预留应答空间, 剩余空间不足时先发送已合并的应答; 应答超过预留长度说明应答生成越界: 丢弃该应答并关闭连接.
+ *
+ * @tparam Size 合并缓存区大小 (一个TCP最大报文段, 不小于一帧应答)
+ */
+template <uint16_t Size>
+class Modbus_Tcp_Batch
+{
+  static_assert(Size >= Modbus_Tcp_Framer::ADU_SIZE, "batch buffer must hold one full response");
+
+private:
+  /// @brief 合并缓存区
+  uint8_t  m_buffer[Size];
+  /// @brief 已合并的应答字节数
+  uint16_t m_length;
+
+  template <typename Socket>
+  void m_flush(Socket& socket)
+  {
+    if (m_length > 0)
+      socket.send(m_buffer, m_length);
+    m_length = 0;
+  }
+
+public:
+  Modbus_Tcp_Batch() : m_length(0) {}
+
+  /**
+   * @brief Modbus TCP 应答合并 处理一个连接 (读完已到达的字节即返回, 不等待输入; 应答发送可能阻塞)
+   *
+   * @tparam Socket     连接: int32_t recv_zero_copy(const uint8_t*&), release_zero_copy(const uint8_t*, uint32_t), send(const uint8_t*, uint16_t), shutdown()
+   * @tparam Responder  应答生成 uint16_t(const uint8_t* adu, uint8_t* response) (response 可写 ADU_SIZE 字节, 返回应答长度, 0为不应答)
+   * @param  socket     连接
+   * @param  framer     连接的分帧器
+   * @param  now        当前时刻(ms)
+   * @param  responder  应答生成
+   * @return bool       连接可继续使用返回true; 连接关闭或出错, 长度字段非法, 部分帧超时或应答越界 (已关闭连接) 返回false
+   */
+  template <typename Socket, typename Responder>
+  bool serve(Socket& socket, Modbus_Tcp_Framer& framer, uint32_t now, Responder&& responder)
+  {
+    const uint8_t* data   = nullptr;
+    int32_t        length = 0;
+    bool           valid  = true;
+
+    while (valid && (length = socket.recv_zero_copy(data)) > 0)
+    {
+      bool ret = framer.feed(data, static_cast<uint32_t>(length), now,
+                             [&](const uint8_t* adu, uint16_t)
+                             {
+                               if (!valid)
+                                 return;
+                               if (m_length + Modbus_Tcp_Framer::ADU_SIZE > Size)
+                                 m_flush(socket);
+
+                               uint16_t response = responder(adu, m_buffer + m_length);
+                               if (response > Modbus_Tcp_Framer::ADU_SIZE)
+                                 valid = false;
+                               else
+                                 m_length += response;
+                             });
+      socket.release_zero_copy(data, static_cast<uint32_t>(length));
+      valid = valid && ret;
+    }
+    m_flush(socket);
+
+    /* 长度字段非法, 部分帧停滞超时或应答越界: 无法重新定位帧边界, 关闭连接 */
+    if (!valid)
+      socket.shutdown();
+    return valid && length >= 0;
+  }
+};
+
+/**
+ * @brief 类 Modbus RTU 请求增量解析 -- 每条串行链路一个实例, 按功能码确定请求长度, 消费任意长度的输入, 不完整的帧保留至下次输入 (不依赖硬件)
+ *
+ * 帧内字节间隔超过超时时丢弃部分帧, 新字节作为新帧开始; 长度非法或调用方判定帧错误 (resync) 后丢弃字节直到出现一次超时间隔 (帧间静默), 再重新同步.
+ */
+class Modbus_Rtu_Parser
+{
+public:
+  /// @brief RTU ADU 最大长度
+  static constexpr uint16_t ADU_SIZE = 256;
+  /// @brief 默认字节间隔超时(ms)
+  static constexpr uint32_t TIMEOUT  = 10;
+
+private:
+  /// @brief 帧缓存区
+  uint8_t  m_buffer[ADU_SIZE];
+  /// @brief 已有字节数
+  uint16_t m_length;
+  /// @brief 帧总长度 (尚不能确定时为0)
+  uint16_t m_size;
+  /// @brief 丢弃字节直到帧间静默
+  bool     m_skip;
+  /// @brief 最近一次输入的时刻(ms)
+  uint32_t m_tick;
+  /// @brief 字节间隔超时(ms)
+  uint32_t m_timeout;
+  /// @brief 完整帧数量
+  uint32_t m_frames;
+  /// @brief 长度非法或帧错误次数
+  uint32_t m_errors;
+  /// @brief 部分帧超时次数
+  uint32_t m_timeouts;
+
+  static void m_count(uint32_t& counter)
+  {
+    if (counter < 0xFFFFFFFF)
+      counter++;
+  }
+
+  /* 确定帧长度所需的字节数: 地址+功能码, 多写类请求另需字节计数所在的头部 */
+  static uint16_t m_header_size(const uint8_t* frame, uint16_t length)
+  {
+    if (length < 2)
+      return 2;
+    switch (frame[1])
+    {
+      case 15 :
+      case 16 :
+        return 7;
+      case 23 :
+        return 11;
+      default :
+        return 2;
+    }
+  }
+
+public:
+  explicit Modbus_Rtu_Parser(uint32_t timeout = TIMEOUT)
+  {
+    m_length   = 0;
+    m_size     = 0;
+    m_skip     = false;
+    m_tick     = 0;
+    m_timeout  = timeout;
+    m_frames   = 0;
+    m_errors   = 0;
+    m_timeouts = 0;
+  }
+
+  /**
+   * @brief Modbus RTU 请求增量解析 请求总长度 (含CRC)
+   *
+   * @param  frame     已收到的字节
+   * @param  length    已收到的字节数
+   * @return uint16_t  请求总长度, 字节不足以确定时返回0 (结果可能超过 ADU_SIZE)
+   */
+  static uint16_t request_size(const uint8_t* frame, uint16_t length)
+  {
+    if (length < m_header_size(frame, length))
+      return 0;
+    switch (frame[1])
+    {
+      case 15 :
+      case 16 :
+        return 9 + frame[6];
+      case 23 :
+        return 13 + frame[10];
+      case 17 :
+        return 4;
+      case 22 :
+        return 10;
+      default :
+        return 8;
+    }
+  }
+
+  /**
+   * @brief Modbus RTU 请求增量解析 输入字节 (全部消费, 不阻塞)
+   *
+   * @tparam Handler  回调 void(const uint8_t* frame, uint16_t size) (帧含CRC, 由调用方校验; 校验失败时调用 resync)
+   * @param  data     字节
+   * @param  length   字节数
+   * @param  now      当前时刻(ms)
+   * @param  handler  完整帧回调
+   */
+  template <typename Handler>
+  void feed(const uint8_t* data, uint32_t length, uint32_t now, Handler&& handler)
+  {
+    if (0 == length)
+      return;
+
+    expire(now);
+    m_tick = now;
+
+    while (length > 0 && !m_skip)
+    {
+      uint16_t need = (0 == m_size) ? m_header_size(m_buffer, m_length) - m_length : m_size - m_length;
+      if (need > length)
+        need = static_cast<uint16_t>(length);
+
+      memcpy(m_buffer + m_length, data, need);
+      m_length += need;
+      data     += need;
+      length   -= need;
+
+      if (0 == m_size)
+      {
+        m_size = request_size(m_buffer, m_length);
+        if (0 == m_size)
+          continue;
+        if (m_size > ADU_SIZE)
+        {
+          resync();
+          return;
+        }
+      }
+
+      if (m_length == m_size)
+      {
+        uint16_t size = m_size;
+        m_length      = 0;
+        m_size        = 0;
+        m_count(m_frames);
+        handler(static_cast<const uint8_t*>(m_buffer), size);
+      }
+    }
+  }
+
+  /**
+   * @brief Modbus RTU 请求增量解析 检查字节间隔超时 (部分帧作废, 重新同步; 链路静默时由调用方定期调用)
+   *
+   * @param  now   当前时刻(ms)
+   * @return bool  丢弃了超时的部分帧返回true
+   */
+  bool expire(uint32_t now)
+  {
+    if ((0 == m_length && !m_skip) || now - m_tick <= m_timeout)
+      return false;
+
+    bool partial = (m_length > 0);
+    if (partial)
+      m_count(m_timeouts);
+    m_length = 0;
+    m_size   = 0;
+    m_skip   = false;
+    return partial;
+  }
+
+  /// @brief 丢弃暂存的部分帧
+  void reset()
+  {
+    m_length = 0;
+    m_size   = 0;
+    m_skip   = false;
+  }
+
+  /// @brief 帧错误 (如CRC校验失败): 丢弃字节直到帧间静默
+  void resync()
+  {
+    m_length = 0;
+    m_size   = 0;
+    m_skip   = true;
+    m_count(m_errors);
+  }
+
+  void set_timeout(uint32_t timeout)
+  {
+    m_timeout = timeout;
+  }
+
+  uint32_t timeout() const
+  {
+    return m_timeout;
+  }
+
+  /// @brief 暂存的部分帧字节数
+  uint16_t pending() const
+  {
+    return m_length;
+  }
+
+  uint32_t frames() const
+  {
+    return m_frames;
+  }
+
+  uint32_t errors() const
+  {
+    return m_errors;
+  }
+
+  uint32_t timeouts() const
+  {
+    return m_timeouts;
+  }
+};
+} /* namespace modbus */
+} /* namespace protocol */
+} /* namespace OwO */
+
+#endif /* __MODBUS_FRAMER_HPP__ */
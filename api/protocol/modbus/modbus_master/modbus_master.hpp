@@ -4,6 +4,7 @@
 #include "register.hpp"
 #include "iostream.hpp"
 #include "thread.hpp"
+#include "modbus_codec.hpp"
 #include <random>
 
 namespace OwO
@@ -56,73 +57,22 @@ protected:
     return distribution(engine);
   }
 
-  bool check_crc(const uint8_t* data, uint32_t length)
-  {
-    uint16_t crc = 0xFFFF;
-    for (uint32_t i = 0; i < length - 2; ++i)
-    {
-      crc ^= data[i];
-      for (int j = 0; j < 8; ++j)
-      {
-        if (crc & 0x0001)
-        {
-          crc = (crc >> 1) ^ 0xA001;
-        }
-        else
-        {
-          crc >>= 1;
-        }
-      }
-    }
-    return (crc == ((data[length - 2] << 8) | data[length - 1]));
-  }
-
-  void add_crc(uint8_t* data, uint32_t length)
-  {
-    uint16_t crc = 0xFFFF;
-    for (uint32_t i = 0; i < length; ++i)
-    {
-      crc ^= data[i];
-      for (int j = 0; j < 8; ++j)
-      {
-        if (crc & 0x0001)
-        {
-          crc = (crc >> 1) ^ 0xA001;
-        }
-        else
-        {
-          crc >>= 1;
-        }
-      }
-    }
-    data[length]     = crc & 0xFF;
-    data[length + 1] = crc >> 8;
-  }
-
   uint16_t creat_tcp_request(modbus_request* request, uint8_t* send_buffer)
   {
-    uint16_t index       = 0;
-    /* 添加MBAP头 */
-    send_buffer[index++] = m_mbap_code >> 24;
-    send_buffer[index++] = m_mbap_code >> 16;
-    send_buffer[index++] = m_mbap_code >> 8;
-    send_buffer[index++] = m_mbap_code;
-    /* 清空数据长度 */
-    send_buffer[index++] = 0x00;
-    send_buffer[index++] = 0x00;
-    /* 添加从机地址 */
-    send_buffer[index++] = request->slave_id;
+    /* 添加MBAP头 (长度字段在PDU写入后填写) */
+    Modbus_Codec::encode_mbap(send_buffer, m_mbap_code >> 16, m_mbap_code & 0xFFFF, request->slave_id, 0);
+    uint16_t index       = Modbus_Codec::MBAP_SIZE;
     /* 添加功能码 */
     send_buffer[index++] = request->function_code;
     /* 添加寄存器地址 */
-    send_buffer[index++] = request->reg_addr >> 8;
-    send_buffer[index++] = request->reg_addr & 0xFF;
+    Modbus_Codec::write16(send_buffer + index, request->reg_addr);
+    index += 2;
 
     if (READ_HOLDING_REGISTERS == request->function_code || READ_INPUT_REGISTERS == request->function_code)
     {
       /* 添加寄存器长度 */
-      send_buffer[index++] = request->reg_length >> 8;
-      send_buffer[index++] = request->reg_length & 0xFF;
+      Modbus_Codec::write16(send_buffer + index, request->reg_length);
+      index += 2;
     }
     else if (WRITE_SINGLE_REGISTER == request->function_code)
     {
@@ -133,8 +83,8 @@ protected:
     else if (WRITE_MULTIPLE_REGISTERS == request->function_code)
     {
       /* 添加寄存器长度 */
-      send_buffer[index++] = request->reg_length >> 8;
-      send_buffer[index++] = request->reg_length & 0xFF;
+      Modbus_Codec::write16(send_buffer + index, request->reg_length);
+      index += 2;
       /* 添加字节计数 */
       send_buffer[index++] = request->reg_length * 2;
       /* 添加数据 */
@@ -145,10 +95,7 @@ protected:
       return 0;
 
     /* 设置数据长度 */
-    send_buffer[4] = (index - 6) >> 8;
-    send_buffer[5] = (index - 6) & 0xFF;
-
-    return index;
+    return Modbus_Codec::encode_tcp(send_buffer, index - Modbus_Codec::MBAP_SIZE);
   }
 
   uint16_t creat_rtu_request(modbus_request* request, uint8_t* send_buffer)
@@ -159,14 +106,14 @@ protected:
     /* 添加功能码 */
     send_buffer[index++] = request->function_code;
     /* 添加寄存器地址 */
-    send_buffer[index++] = request->reg_addr >> 8;
-    send_buffer[index++] = request->reg_addr & 0xFF;
+    Modbus_Codec::write16(send_buffer + index, request->reg_addr);
+    index += 2;
 
     if (READ_HOLDING_REGISTERS == request->function_code || READ_INPUT_REGISTERS == request->function_code)
     {
       /* 添加寄存器长度 */
-      send_buffer[index++] = request->reg_length >> 8;
-      send_buffer[index++] = request->reg_length & 0xFF;
+      Modbus_Codec::write16(send_buffer + index, request->reg_length);
+      index += 2;
     }
     else if (WRITE_SINGLE_REGISTER == request->function_code)
     {
@@ -177,8 +124,8 @@ protected:
     else if (WRITE_MULTIPLE_REGISTERS == request->function_code)
     {
       /* 添加寄存器长度 */
-      send_buffer[index++] = request->reg_length >> 8;
-      send_buffer[index++] = request->reg_length & 0xFF;
+      Modbus_Codec::write16(send_buffer + index, request->reg_length);
+      index += 2;
       /* 添加字节计数 */
       send_buffer[index++] = request->reg_length * 2;
       /* 添加数据 */
@@ -189,8 +136,7 @@ protected:
       return 0;
 
     /* 添加CRC校验码 */
-    add_crc(send_buffer, index);
-    return index + 2;
+    return Modbus_Codec::add_crc(send_buffer, index);
   }
 
   bool anlyze_tcp_response(modbus_request* request, system::IOStream* port)
@@ -213,7 +159,7 @@ protected:
       return false;
     else
     {
-      length  = (m_recv_buffer[index] << 8) | m_recv_buffer[index + 1];
+      length  = Modbus_Codec::read16(m_recv_buffer + index);
       index  += 2;
     }
 
@@ -325,7 +271,7 @@ protected:
           return false;
         else
         {
-          if (check_crc(m_recv_buffer, index + m_recv_buffer[index] + 3))
+          if (!Modbus_Codec::check_crc(m_recv_buffer, index + m_recv_buffer[index] + 3))
             return false;
 
           request->data->write(&m_recv_buffer[index + 1], request->reg_length, request->reg_addr);
@@ -339,7 +285,7 @@ protected:
         return false;
       else
       {
-        if (!check_crc(m_recv_buffer, 8))
+        if (!Modbus_Codec::check_crc(m_recv_buffer, 8))
           return false;
 
         if (m_recv_buffer[index] != (request->reg_addr >> 8) || m_recv_buffer[index + 1] != (request->reg_addr & 0xFF))
@@ -359,7 +305,7 @@ protected:
         return false;
       else
       {
-        if (!check_crc(m_recv_buffer, 10))
+        if (!Modbus_Codec::check_crc(m_recv_buffer, 10))
           return false;
 
         if (m_recv_buffer[index] != (request->reg_addr >> 8) || m_recv_buffer[index + 1] != (request->reg_addr & 0xFF))
@@ -4,5 +4,123 @@ using namespace OwO;
 using namespace protocol;
 using namespace modbus;
 using namespace tcp;
+using namespace system::kernel;
 
+O_METAOBJECT(Modbus_Tcp_Connection, Tcp_Client)
+O_METAOBJECT(Modbus_Tcp_Worker, Thread)
 O_METAOBJECT(Modbus_Tcp_Server, Server)
+
+Modbus_Tcp_Worker::Modbus_Tcp_Worker(const std::string& name, Modbus_Tcp_Server* server, Modbus_Slave* slave, Message_Queue<Tcp_Client*>* queue) : Thread(name, server)
+{
+  m_server = server;
+  m_slave  = slave;
+  m_queue  = queue;
+}
+
+void Modbus_Tcp_Worker::run()
+{
+  tcp::Tcp_Client* client = nullptr;
+  while (!is_finished())
+  {
+    if (m_queue->receive(client, WAIT_TIME))
+      m_serve(client);
+  }
+}
+
+/**
+ * @brief Modbus TCP 工作线程 启动
+ *
+ * @param priority 优先级
+ */
+void Modbus_Tcp_Worker::start(uint8_t priority)
+{
+  Thread::start(priority, 512, 0);
+}
+
+/**
+ * @brief Modbus TCP 工作线程 停止 (等待当前连接处理完成)
+ *
+ */
+void Modbus_Tcp_Worker::stop()
+{
+  Thread::exit(0);
+  while (is_running())
+    msleep(WAIT_TIME);
+}
+
+/**
+ * @brief (私有函数) Modbus TCP 工作线程 处理一个连接 (直接解析套接字接收流, 不经过输入流; 分帧与应答合并见 Modbus_Tcp_Batch)
+ *
+ * 完成后交还服务器线程继续监听; 连接关闭或出错时标记关闭, 由服务器线程删除.
+ *
+ * @param client 客户端
+ */
+void Modbus_Tcp_Worker::m_serve(Tcp_Client* client)
+{
+  static_assert(Modbus_Slave::BUFFER_SIZE == Modbus_Tcp_Framer::ADU_SIZE, "response reservation must match the slave buffer");
+
+  Modbus_Tcp_Connection* connection = static_cast<Modbus_Tcp_Connection*>(client);
+  bool                   valid      = m_batch.serve(*client, connection->framer, ul_port_os_get_tick_count(), [this](const uint8_t* adu, uint8_t* response) { return m_slave->process_tcp_adu(adu, response); });
+
+  if (!valid)
+    connection->closed.store(true, std::memory_order_relaxed);
+
+  m_server->m_release(client);
+}
+
+/**
+ * @brief (私有函数) Modbus TCP 服务器 工作线程交还连接, 恢复监听
+ *
+ * @param client 客户端
+ */
+void Modbus_Tcp_Server::m_release(Tcp_Client* client)
+{
+  static_cast<Modbus_Tcp_Connection*>(client)->dispatched.store(false, std::memory_order_release);
+  resume_client(client);
+}
+
+/**
+ * @brief Modbus TCP 服务器 客户端数据到达 (暂停监听该连接, 放入待处理队列由空闲的工作线程处理)
+ *
+ * @param client 客户端
+ */
+void Modbus_Tcp_Server::client_input(Tcp_Client* client)
+{
+  Modbus_Tcp_Connection* connection = static_cast<Modbus_Tcp_Connection*>(client);
+  if (connection->dispatched.load(std::memory_order_acquire))
+    return;
+
+  /* 连接关闭或出错: 直接删除客户端 (析构时关闭套接字并从服务器移除), 不经过输入流 */
+  if (connection->closed.load(std::memory_order_relaxed))
+  {
+    delete client;
+    return;
+  }
+
+  connection->dispatched.store(true, std::memory_order_relaxed);
+  pause_client(client);
+  if (!m_pending.send(client, 0))
+    m_release(client);
+}
+
+/**
+ * @brief Modbus TCP 服务器 检查停滞的连接 (部分帧超过字节间隔超时仍未续接: 关闭连接, 套接字报告关闭后删除客户端)
+ *
+ * 只检查未派发的连接 (派发期间分帧器由工作线程独占); 对端停滞后不再有输入, 由监听超时保证定期检查.
+ */
+void Modbus_Tcp_Server::client_poll()
+{
+  uint32_t now = ul_port_os_get_tick_count();
+  for (Tcp_Client* client : clients())
+  {
+    Modbus_Tcp_Connection* connection = static_cast<Modbus_Tcp_Connection*>(client);
+    if (connection->dispatched.load(std::memory_order_acquire) || connection->closed.load(std::memory_order_relaxed))
+      continue;
+
+    if (connection->framer.expire(now))
+    {
+      connection->closed.store(true, std::memory_order_relaxed);
+      client->shutdown();
+    }
+  }
+}
@@ -1,8 +1,10 @@
 #ifndef __MODBUS_SERVER_HPP__
 #define __MODBUS_SERVER_HPP__
 
+#include <atomic>
 #include "tcp_server.hpp"
 #include "modbus_slave.hpp"
+#include "message_queue.hpp"
 
 namespace OwO
 {
@@ -10,38 +12,136 @@ namespace protocol
 {
 namespace modbus
 {
+class Modbus_Tcp_Server;
+
+/// @brief 类 Modbus TCP 连接 -- 客户端附带分帧状态与派发状态
+class Modbus_Tcp_Connection : public tcp::Tcp_Client
+{
+  O_MEMORY
+  O_OBJECT
+  NO_COPY(Modbus_Tcp_Connection)
+  NO_MOVE(Modbus_Tcp_Connection)
+
+public:
+  /// @brief 分帧状态 (只由当前处理该连接的工作线程访问)
+  Modbus_Tcp_Framer framer;
+  /// @brief 已派发给工作线程 (期间服务器线程不监听该连接)
+  std::atomic<bool> dispatched;
+  /// @brief 连接已关闭或出错 (工作线程设置; 不再派发, 由服务器线程删除)
+  std::atomic<bool> closed;
+
+  explicit Modbus_Tcp_Connection(const std::string& name, Object* parent) : tcp::Tcp_Client(name, parent), dispatched(false), closed(false) {}
+
+  virtual ~Modbus_Tcp_Connection() {}
+};
+
+/**
+ * @brief 类 Modbus TCP 工作线程 -- 自有应答缓存区, 从服务器的待处理队列取出连接处理; 多个工作线程并行时只共享寄存器/线圈 (各自加锁)
+ *
+ * 一个连接同一时刻只由一个工作线程处理; 各工作线程共用一个队列, 应答发送阻塞 (对端不读取) 只占用该工作线程, 其他连接由空闲的工作线程处理.
+ */
+class Modbus_Tcp_Worker : public system::kernel::Thread
+{
+  O_MEMORY
+  O_OBJECT
+  NO_COPY(Modbus_Tcp_Worker)
+  NO_MOVE(Modbus_Tcp_Worker)
+
+public:
+  /// @brief 应答合并缓存区大小 (一个TCP最大报文段)
+  static constexpr uint16_t BATCH_SIZE = ipconfigTCP_MSS;
+  /// @brief 队列等待时间(ms, 停止时的响应间隔)
+  static constexpr uint32_t WAIT_TIME  = 100;
+
+private:
+  Modbus_Tcp_Server*                               m_server;
+  Modbus_Slave*                                    m_slave;
+  system::kernel::Message_Queue<tcp::Tcp_Client*>* m_queue;
+  /// @brief 应答合并 (同一次输入的多个应答合并为一次发送)
+  Modbus_Tcp_Batch<BATCH_SIZE>                     m_batch;
+
+  virtual void run() override;
+  virtual void event_loop() override {}
+
+  void m_serve(tcp::Tcp_Client* client);
+
+  using system::kernel::Thread::exit;
+  using system::kernel::Thread::is_finished;
+  using system::kernel::Thread::is_running;
+  using system::kernel::Thread::quit;
+
+public:
+  Modbus_Tcp_Worker(const std::string& name, Modbus_Tcp_Server* server, Modbus_Slave* slave, system::kernel::Message_Queue<tcp::Tcp_Client*>* queue);
+
+  void start(uint8_t priority);
+  void stop();
+
+  virtual ~Modbus_Tcp_Worker() {}
+};
+
 class Modbus_Tcp_Server : public tcp::Server
 {
   O_MEMORY
   O_OBJECT
   NO_COPY(Modbus_Tcp_Server)
   NO_MOVE(Modbus_Tcp_Server)
+
+  friend class Modbus_Tcp_Worker;
+
+public:
+  /// @brief 工作线程数量
+  static constexpr uint8_t  WORKER_COUNT = 3;
+  /// @brief 待处理连接队列长度
+  static constexpr uint8_t  QUEUE_SIZE   = 16;
+  /// @brief 监听等待时间(ms, 停滞连接的部分帧超时检查间隔)
+  static constexpr uint32_t POLL_TIME    = Modbus_Tcp_Framer::TIMEOUT / 4;
+
 private:
-  Modbus_Slave* m_modbus_tcp;
+  Modbus_Slave*                                   m_modbus_tcp;
+  Modbus_Tcp_Worker*                              m_workers[WORKER_COUNT];
+  /// @brief 待处理连接队列 (服务器线程写入, 空闲的工作线程取出)
+  system::kernel::Message_Queue<tcp::Tcp_Client*> m_pending;
+
+  void m_release(tcp::Tcp_Client* client);
 
 protected:
-  virtual void client_connect(tcp::Tcp_Client* client) override
+  virtual tcp::Tcp_Client* create_client() override
   {
-    connect(client->signal_recv_finished, m_modbus_tcp, &Modbus_Slave::process, system::Connection_Queued);
-  };
+    return new Modbus_Tcp_Connection("modbus_tcp_client", this);
+  }
+
+  virtual void client_input(tcp::Tcp_Client* client) override;
+
+  virtual void client_connect(tcp::Tcp_Client* client) override {};
 
   virtual void client_disconnect(tcp::Tcp_Client* client) override {};
 
+  virtual void client_poll() override;
+
 public:
-  Modbus_Tcp_Server(const std::string& name, Object* parent) : tcp::Server(name, parent)
+  Modbus_Tcp_Server(const std::string& name, Object* parent) : tcp::Server(name, parent), m_pending(QUEUE_SIZE)
   {
     m_modbus_tcp = new Modbus_Slave("modbus_tcp", this);
+    for (uint8_t i = 0; i < WORKER_COUNT; i++)
+      m_workers[i] = new Modbus_Tcp_Worker("modbus_tcp_worker", this, m_modbus_tcp, &m_pending);
   }
 
   virtual void start(uint16_t port = 502, uint8_t id = 1, Modbus_Mode mode = Modbus_TCP, uint8_t priority = THREAD_DEF_PRIORITY)
   {
-    m_modbus_tcp->start(id, mode, priority, 512);
+    /* 从站只持有寄存器/线圈与单元号, 全部 TCP 请求由工作线程处理, 不启动从站线程 */
+    m_modbus_tcp->set_id(id);
+    m_modbus_tcp->set_mode(mode);
+    for (Modbus_Tcp_Worker* worker : m_workers)
+      worker->start(priority);
+    set_poll_time(POLL_TIME);
     tcp::Server::start(port, priority);
     tcp::Server::set_priority(priority - 1);
   }
 
   virtual void stop()
   {
+    for (Modbus_Tcp_Worker* worker : m_workers)
+      worker->stop();
     tcp::Server::stop();
   }
 
@@ -4,6 +4,8 @@
 #include "iostream.hpp"
 #include "thread.hpp"
 #include "coil.hpp"
+#include "modbus_framer.hpp"
+#include "modbus_codec.hpp"
 
 namespace OwO
 {
@@ -40,6 +42,20 @@ private:
     ILLEGAL_VALUE_CODE = 3,
   };
 
+public:
+  /// @brief 收发缓存区大小 (Modbus TCP ADU 最大长度, 可容纳单次写入123个寄存器)
+  static constexpr uint16_t BUFFER_SIZE            = Modbus_Tcp_Framer::ADU_SIZE;
+  /// @brief 单次读取线圈数量上限 (协议规定, 应答不超过 BUFFER_SIZE)
+  static constexpr uint16_t MAX_READ_COILS         = 2000;
+  /// @brief 单次读取寄存器数量上限 (协议规定, 应答不超过 BUFFER_SIZE)
+  static constexpr uint16_t MAX_READ_REGISTERS     = 125;
+  /// @brief 单次写入线圈数量上限 (协议规定, 请求不超过 BUFFER_SIZE)
+  static constexpr uint16_t MAX_WRITE_COILS        = 1968;
+  /// @brief 单次写入寄存器数量上限 (协议规定, 请求不超过 BUFFER_SIZE)
+  static constexpr uint16_t MAX_WRITE_REGISTERS    = 123;
+  /// @brief 读写寄存器(FC23)单次写入数量上限
+  static constexpr uint16_t MAX_RW_WRITE_REGISTERS = 121;
+
 private:
   uint8_t                       m_slave_address;
   uint8_t*                      m_recv_buffer;
@@ -49,483 +65,281 @@ private:
   Register*                     m_holding_registers;
   Register*                     m_input_registers;
   Modbus_Mode                   m_mode;
+  Modbus_Tcp_Framer             m_tcp_framer;
+  Modbus_Rtu_Parser             m_rtu_parser;
   mutable system::kernel::Mutex m_mutex;
 
 private:
-  bool check_crc(const uint8_t* data, uint32_t length)
+  uint16_t get_response_read_holding_coils(const uint8_t* request, uint8_t* pdu)
   {
-    uint16_t crc = 0xFFFF;
-    for (uint32_t i = 0; i < length; ++i)
-    {
-      crc ^= data[i];
-      for (int j = 0; j < 8; ++j)
-      {
-        if (crc & 0x0001)
-        {
-          crc = (crc >> 1) ^ 0xA001;
-        }
-        else
-        {
-          crc >>= 1;
-        }
-      }
-    }
-    return crc == 0;
-  }
+    uint16_t start_addr  = Modbus_Codec::read16(request + 2);
+    uint16_t coils_count = Modbus_Codec::read16(request + 4);
 
-  void add_crc(uint8_t* data, uint32_t length)
-  {
-    uint16_t crc = 0xFFFF;
-    for (uint32_t i = 0; i < length; ++i)
-    {
-      crc ^= data[i];
-      for (int j = 0; j < 8; ++j)
-      {
-        if (crc & 0x0001)
-        {
-          crc = (crc >> 1) ^ 0xA001;
-        }
-        else
-        {
-          crc >>= 1;
-        }
-      }
-    }
-    data[length]     = crc & 0xFF;
-    data[length + 1] = crc >> 8;
-  }
-
-  uint16_t get_response_read_holding_coils(const uint8_t* request, uint8_t* response)
-  {
-    uint16_t start_addr  = (request[2] << 8) | request[3];
-    uint16_t coils_count = (request[4] << 8) | request[5];
+    if (coils_count < 1 || coils_count > MAX_READ_COILS)
+      return create_exception_response(request, pdu, ILLEGAL_VALUE_CODE);
 
     if (start_addr + coils_count > m_holding_coils->size())
-      return create_exception_response(request, response, ILLEGAL_ADDR_CODE);
+      return create_exception_response(request, pdu, ILLEGAL_ADDR_CODE);
 
     uint16_t coils_byte_count = ((coils_count % 8) ? 1 : 0) + coils_count / 8;
 
-    if (Modbus_RTU == m_mode)
-    {
-      response[0] = m_slave_address;
-      response[1] = READ_HOLDING_COILS;
-      response[2] = coils_byte_count;
-      m_holding_coils->read(response + 3, coils_count, start_addr);
-      add_crc(response, 3 + coils_byte_count);
-      return (5 + coils_byte_count);
-    }
-    else if (Modbus_TCP == m_mode)
-    {
-      response[4] = (coils_byte_count + 3) >> 8;
-      response[5] = (coils_byte_count + 3) & 0xFF;
-      response[6] = m_slave_address;
-      response[7] = READ_HOLDING_COILS;
-      response[8] = coils_byte_count;
-      m_holding_coils->read(response + 9, coils_count, start_addr);
-      return (9 + coils_byte_count);
-    }
-    return 0;
+    pdu[0] = READ_HOLDING_COILS;
+    pdu[1] = coils_byte_count;
+    m_holding_coils->read(pdu + 2, coils_count, start_addr);
+    return (2 + coils_byte_count);
   }
 
-  uint16_t get_response_read_input_coils(const uint8_t* request, uint8_t* response)
+  uint16_t get_response_read_input_coils(const uint8_t* request, uint8_t* pdu)
   {
-    uint16_t start_addr  = (request[2] << 8) | request[3];
-    uint16_t coils_count = (request[4] << 8) | request[5];
+    uint16_t start_addr  = Modbus_Codec::read16(request + 2);
+    uint16_t coils_count = Modbus_Codec::read16(request + 4);
+
+    if (coils_count < 1 || coils_count > MAX_READ_COILS)
+      return create_exception_response(request, pdu, ILLEGAL_VALUE_CODE);
 
     if (start_addr + coils_count > m_input_coils->size())
-      return create_exception_response(request, response, ILLEGAL_ADDR_CODE);
+      return create_exception_response(request, pdu, ILLEGAL_ADDR_CODE);
 
     uint16_t coils_byte_count = ((coils_count % 8) ? 1 : 0) + coils_count / 8;
 
-    if (Modbus_RTU == m_mode)
-    {
-      response[0] = m_slave_address;
-      response[1] = READ_INPUT_COILS;
-      response[2] = coils_byte_count;
-      m_input_coils->read(response + 3, coils_count, start_addr);
-      add_crc(response, 3 + coils_byte_count);
-      return (5 + coils_byte_count);
-    }
-    else if (Modbus_TCP == m_mode)
-    {
-      response[4] = (coils_byte_count + 3) >> 8;
-      response[5] = (coils_byte_count + 3) & 0xFF;
-      response[6] = m_slave_address;
-      response[7] = READ_INPUT_COILS;
-      response[8] = coils_byte_count;
-      m_input_coils->read(response + 9, coils_count, start_addr);
-      return (9 + coils_byte_count);
-    }
-    return 0;
+    pdu[0] = READ_INPUT_COILS;
+    pdu[1] = coils_byte_count;
+    m_input_coils->read(pdu + 2, coils_count, start_addr);
+    return (2 + coils_byte_count);
   }
 
-  uint16_t get_response_read_holding_registers(const uint8_t* request, uint8_t* response)
+  uint16_t get_response_read_holding_registers(const uint8_t* request, uint8_t* pdu)
   {
-    uint16_t start_addr      = (request[2] << 8) | request[3];
-    uint16_t registers_count = (request[4] << 8) | request[5];
+    uint16_t start_addr      = Modbus_Codec::read16(request + 2);
+    uint16_t registers_count = Modbus_Codec::read16(request + 4);
+
+    if (registers_count < 1 || registers_count > MAX_READ_REGISTERS)
+      return create_exception_response(request, pdu, ILLEGAL_VALUE_CODE);
 
     if (start_addr + registers_count > m_holding_registers->size())
-      return create_exception_response(request, response, ILLEGAL_ADDR_CODE);
+      return create_exception_response(request, pdu, ILLEGAL_ADDR_CODE);
 
-    if (Modbus_RTU == m_mode)
-    {
-      response[0] = m_slave_address;
-      response[1] = READ_HOLDING_REGISTERS;
-      response[2] = registers_count * 2;
-      m_holding_registers->read(response + 3, registers_count, start_addr);
-      add_crc(response, 3 + registers_count * 2);
-      return (5 + registers_count * 2);
-    }
-    else if (Modbus_TCP == m_mode)
-    {
-      response[4] = (registers_count * 2 + 3) >> 8;
-      response[5] = (registers_count * 2 + 3) & 0xFF;
-      response[6] = m_slave_address;
-      response[7] = READ_HOLDING_REGISTERS;
-      response[8] = registers_count * 2;
-      m_holding_registers->read(response + 9, registers_count, start_addr);
-      return (9 + registers_count * 2);
-    }
-    return 0;
+    pdu[0] = READ_HOLDING_REGISTERS;
+    pdu[1] = registers_count * 2;
+    m_holding_registers->read(pdu + 2, registers_count, start_addr);
+    return (2 + registers_count * 2);
   }
 
-  uint16_t get_response_read_input_registers(const uint8_t* request, uint8_t* response)
+  uint16_t get_response_read_input_registers(const uint8_t* request, uint8_t* pdu)
   {
-    uint16_t start_addr      = (request[2] << 8) | request[3];
-    uint16_t registers_count = (request[4] << 8) | request[5];
+    uint16_t start_addr      = Modbus_Codec::read16(request + 2);
+    uint16_t registers_count = Modbus_Codec::read16(request + 4);
+
+    if (registers_count < 1 || registers_count > MAX_READ_REGISTERS)
+      return create_exception_response(request, pdu, ILLEGAL_VALUE_CODE);
 
     if (start_addr + registers_count > m_input_registers->size())
-      return create_exception_response(request, response, ILLEGAL_ADDR_CODE);
+      return create_exception_response(request, pdu, ILLEGAL_ADDR_CODE);
 
-    if (Modbus_RTU == m_mode)
-    {
-      response[0] = m_slave_address;
-      response[1] = READ_INPUT_REGISTERS;
-      response[2] = registers_count * 2;
-      m_input_registers->read(response + 3, registers_count, start_addr);
-      add_crc(response, 3 + registers_count * 2);
-      return (5 + registers_count * 2);
-    }
-    else if (Modbus_TCP == m_mode)
-    {
-      response[4] = (registers_count * 2 + 3) >> 8;
-      response[5] = (registers_count * 2 + 3) & 0xFF;
-      response[6] = m_slave_address;
-      response[7] = READ_INPUT_REGISTERS;
-      response[8] = registers_count * 2;
-      m_input_registers->read(response + 9, registers_count, start_addr);
-      return (9 + registers_count * 2);
-    }
-    return 0;
+    pdu[0] = READ_INPUT_REGISTERS;
+    pdu[1] = registers_count * 2;
+    m_input_registers->read(pdu + 2, registers_count, start_addr);
+    return (2 + registers_count * 2);
   }
 
-  uint16_t get_response_write_single_coil(const uint8_t* request, uint8_t* response)
+  uint16_t get_response_write_single_coil(const uint8_t* request, uint8_t* pdu)
   {
-    uint16_t addr = (request[2] << 8) | request[3];
+    uint16_t addr = Modbus_Codec::read16(request + 2);
 
     if (addr >= m_holding_coils->size())
-      return create_exception_response(request, response, ILLEGAL_ADDR_CODE);
+      return create_exception_response(request, pdu, ILLEGAL_ADDR_CODE);
 
     m_holding_coils->write(request[4], addr);
 
-    if (Modbus_RTU == m_mode)
-    {
-      memcpy(response, request, 8);
-      return 8;
-    }
-    else if (Modbus_TCP == m_mode)
-    {
-      response[4] = 0x00;
-      response[5] = 0x06;
-      memcpy(response + 6, request, 6);
-      return 12;
-    }
-    return 0;
+    /* 应答为请求回显 */
+    memcpy(pdu, request + 1, 5);
+    return 5;
   }
 
-  uint16_t get_response_write_multiple_coils(const uint8_t* request, uint8_t* response)
+  uint16_t get_response_write_multiple_coils(const uint8_t* request, uint8_t* pdu)
   {
-    uint16_t start_addr  = (request[2] << 8) | request[3];
-    uint16_t coils_count = (request[4] << 8) | request[5];
+    uint16_t start_addr  = Modbus_Codec::read16(request + 2);
+    uint16_t coils_count = Modbus_Codec::read16(request + 4);
     uint8_t  byte_count  = request[6];
 
-    if (start_addr + coils_count > m_holding_coils->size() || byte_count != ((coils_count % 8) ? 1 : 0 + coils_count / 8))
-      return create_exception_response(request, response, ILLEGAL_ADDR_CODE);
+    if (coils_count < 1 || coils_count > MAX_WRITE_COILS || byte_count != (((coils_count % 8) ? 1 : 0) + coils_count / 8))
+      return create_exception_response(request, pdu, ILLEGAL_VALUE_CODE);
+
+    if (start_addr + coils_count > m_holding_coils->size())
+      return create_exception_response(request, pdu, ILLEGAL_ADDR_CODE);
 
     m_holding_coils->write(request + 7, coils_count, start_addr);
 
-    if (Modbus_RTU == m_mode)
-    {
-      memcpy(response, request, 6);
-      add_crc(response, 6);
-      return 8;
-    }
-    else if (Modbus_TCP == m_mode)
-    {
-      response[4] = 0x00;
-      response[5] = 0x06;
-      memcpy(response + 6, request, 6);
-      return 12;
-    }
-    return 0;
+    memcpy(pdu, request + 1, 5);
+    return 5;
   }
 
-  uint16_t get_response_write_single_register(const uint8_t* request, uint8_t* response)
+  uint16_t get_response_write_single_register(const uint8_t* request, uint8_t* pdu)
   {
-    uint16_t addr = (request[2] << 8) | request[3];
+    uint16_t addr = Modbus_Codec::read16(request + 2);
 
     if (addr >= m_holding_registers->size())
-      return create_exception_response(request, response, ILLEGAL_ADDR_CODE);
+      return create_exception_response(request, pdu, ILLEGAL_ADDR_CODE);
 
     m_holding_registers->write(request + 4, 1, addr);
 
-    if (Modbus_RTU == m_mode)
-    {
-      memcpy(response, request, 8);
-      return 8;
-    }
-    else if (Modbus_TCP == m_mode)
-    {
-      response[4] = 0x00;
-      response[5] = 0x06;
-      memcpy(response + 6, request, 6);
-      return 12;
-    }
-    return 0;
+    /* 应答为请求回显 */
+    memcpy(pdu, request + 1, 5);
+    return 5;
   }
 
-  uint16_t get_response_write_multiple_registers(const uint8_t* request, uint8_t* response)
+  uint16_t get_response_write_multiple_registers(const uint8_t* request, uint8_t* pdu)
   {
-    uint16_t start_addr      = (request[2] << 8) | request[3];
-    uint16_t registers_count = (request[4] << 8) | request[5];
+    uint16_t start_addr      = Modbus_Codec::read16(request + 2);
+    uint16_t registers_count = Modbus_Codec::read16(request + 4);
     uint8_t  byte_count      = request[6];
 
-    if (start_addr + registers_count > m_holding_registers->size() || byte_count != registers_count * 2)
-      return create_exception_response(request, response, ILLEGAL_ADDR_CODE);
+    if (registers_count < 1 || registers_count > MAX_WRITE_REGISTERS || byte_count != registers_count * 2)
+      return create_exception_response(request, pdu, ILLEGAL_VALUE_CODE);
+
+    if (start_addr + registers_count > m_holding_registers->size())
+      return create_exception_response(request, pdu, ILLEGAL_ADDR_CODE);
 
     m_holding_registers->write(request + 7, registers_count, start_addr);
 
-    if (Modbus_RTU == m_mode)
-    {
-      memcpy(response, request, 6);
-      add_crc(response, 6);
-      return 8;
-    }
-    else if (Modbus_TCP == m_mode)
-    {
-      response[4] = 0x00;
-      response[5] = 0x06;
-      memcpy(response + 6, request, 6);
-      return 12;
-    }
-    return 0;
+    memcpy(pdu, request + 1, 5);
+    return 5;
   }
 
-  uint16_t get_response_report_slave_id(const uint8_t* request, uint8_t* response)
+  uint16_t get_response_report_slave_id(const uint8_t* request, uint8_t* pdu)
   {
-    if (Modbus_RTU == m_mode)
-    {
-      response[0] = m_slave_address;
-      response[1] = REPORT_SLAVE_ID;
-      response[2] = 0x09;
-      response[3] = 0xFF;
+    pdu[0] = REPORT_SLAVE_ID;
+    pdu[1] = 0x09;
+    pdu[2] = 0xFF;
 
-      memset(response + 4, 0, 10);
+    memset(pdu + 3, 0, 8);
 
-      if (m_holding_coils)
-      {
-        response[4] = m_holding_coils->size() << 8;
-        response[5] = m_holding_coils->size() & 0xFF;
-      }
+    if (m_holding_coils)
+      Modbus_Codec::write16(pdu + 3, m_holding_coils->size());
 
-      if (m_input_coils)
-      {
-        response[6] = m_input_coils->size() << 8;
-        response[7] = m_input_coils->size() & 0xFF;
-      }
+    if (m_input_coils)
+      Modbus_Codec::write16(pdu + 5, m_input_coils->size());
 
-      if (m_holding_registers)
-      {
-        response[8] = m_holding_registers->size() << 8;
-        response[9] = m_holding_registers->size() & 0xFF;
-      }
+    if (m_holding_registers)
+      Modbus_Codec::write16(pdu + 7, m_holding_registers->size());
 
-      if (m_input_registers)
-      {
-        response[10] = m_input_registers->size() << 8;
-        response[11] = m_input_registers->size() & 0xFF;
-      }
+    if (m_input_registers)
+      Modbus_Codec::write16(pdu + 9, m_input_registers->size());
 
-      add_crc(response, 12);
-      return 14;
-    }
-    else if (Modbus_TCP == m_mode)
-    {
-      response[4] = 0x00;
-      response[5] = 0x0C;
-      response[6] = m_slave_address;
-      response[7] = REPORT_SLAVE_ID;
-      response[8] = 0x09;
-      response[9] = 0xFF;
-
-      memset(response + 10, 0, 10);
-
-      if (m_holding_coils)
-      {
-        response[10] = m_holding_coils->size() >> 8;
-        response[11] = m_holding_coils->size() & 0xFF;
-      }
-
-      if (m_input_coils)
-      {
-        response[12] = m_input_coils->size() >> 8;
-        response[13] = m_input_coils->size() & 0xFF;
-      }
-
-      if (m_holding_registers)
-      {
-        response[14] = m_holding_registers->size() >> 8;
-        response[15] = m_holding_registers->size() & 0xFF;
-      }
-
-      if (m_input_registers)
-      {
-        response[16] = m_input_registers->size() >> 8;
-        response[17] = m_input_registers->size() & 0xFF;
-      }
-
-      return 18;
-    }
-    return 0;
+    return 11;
   }
 
-  uint16_t get_response_mask_write_register(const uint8_t* request, uint8_t* response)
+  uint16_t get_response_mask_write_register(const uint8_t* request, uint8_t* pdu)
   {
-    uint16_t addr = (request[2] << 8) | request[3];
+    uint16_t addr = Modbus_Codec::read16(request + 2);
 
     if (addr >= m_holding_registers->size())
-      return create_exception_response(request, response, ILLEGAL_ADDR_CODE);
+      return create_exception_response(request, pdu, ILLEGAL_ADDR_CODE);
 
-    uint16_t and_mask = (request[4] << 8) | request[5];
-    uint16_t or_mask  = (request[6] << 8) | request[7];
+    uint16_t and_mask = Modbus_Codec::read16(request + 4);
+    uint16_t or_mask  = Modbus_Codec::read16(request + 6);
 
     m_holding_registers->mask_write(and_mask, or_mask, addr);
 
-    if (Modbus_RTU == m_mode)
-    {
-      memcpy(response, request, 8);
-      add_crc(response, 8);
-      return 10;
-    }
-    else if (Modbus_TCP == m_mode)
-    {
-      response[4] = 0x00;
-      response[5] = 0x06;
-      memcpy(response + 6, request, 6);
-      return 12;
-    }
-    return 0;
+    /* 应答为请求回显 (地址 + 与掩码 + 或掩码) */
+    memcpy(pdu, request + 1, 7);
+    return 7;
   }
 
-  uint16_t get_response_read_write_registers(const uint8_t* request, uint8_t* response)
+  uint16_t get_response_read_write_registers(const uint8_t* request, uint8_t* pdu)
   {
-    uint16_t read_start_addr       = (request[2] << 8) | request[3];
-    uint16_t read_registers_count  = (request[4] << 8) | request[5];
-    uint16_t write_start_addr      = (request[6] << 8) | request[7];
-    uint16_t write_registers_count = (request[8] << 8) | request[9];
+    uint16_t read_start_addr       = Modbus_Codec::read16(request + 2);
+    uint16_t read_registers_count  = Modbus_Codec::read16(request + 4);
+    uint16_t write_start_addr      = Modbus_Codec::read16(request + 6);
+    uint16_t write_registers_count = Modbus_Codec::read16(request + 8);
     uint8_t  byte_count            = request[10];
 
-    if (read_start_addr + read_registers_count > m_holding_registers->size() || write_start_addr + write_registers_count > m_holding_registers->size() || byte_count != write_registers_count * 2)
-      return create_exception_response(request, response, ILLEGAL_ADDR_CODE);
+    if (read_registers_count < 1 || read_registers_count > MAX_READ_REGISTERS || write_registers_count < 1 || write_registers_count > MAX_RW_WRITE_REGISTERS || byte_count != write_registers_count * 2)
+      return create_exception_response(request, pdu, ILLEGAL_VALUE_CODE);
+
+    if (read_start_addr + read_registers_count > m_holding_registers->size() || write_start_addr + write_registers_count > m_holding_registers->size())
+      return create_exception_response(request, pdu, ILLEGAL_ADDR_CODE);
 
     m_holding_registers->write(request + 11, write_registers_count, write_start_addr);
 
-    if (Modbus_RTU == m_mode)
-    {
-      response[0] = m_slave_address;
-      response[1] = READ_WRITE_REGISTERS;
-      response[2] = read_registers_count * 2;
-      m_holding_registers->read(response + 3, read_registers_count, read_start_addr);
-      response[3 + read_registers_count * 2] = write_registers_count * 2;
-      add_crc(response, 3 + read_registers_count * 2);
-      return (5 + read_registers_count * 2);
-    }
-    else if (Modbus_TCP == m_mode)
-    {
-      response[4] = (read_registers_count * 2 + 3) >> 8;
-      response[5] = (read_registers_count * 2 + 3) & 0xFF;
-      response[6] = m_slave_address;
-      response[7] = READ_WRITE_REGISTERS;
-      response[8] = read_registers_count * 2;
-      m_holding_registers->read(response + 9, read_registers_count, read_start_addr);
-      return (9 + read_registers_count * 2);
-    }
-    return 0;
+    pdu[0] = READ_WRITE_REGISTERS;
+    pdu[1] = read_registers_count * 2;
+    m_holding_registers->read(pdu + 2, read_registers_count, read_start_addr);
+    return (2 + read_registers_count * 2);
+  }
+
+  uint16_t create_exception_response(const uint8_t* request, uint8_t* pdu, uint8_t error_code)
+  {
+    return Modbus_Codec::encode_exception(pdu, request[1], error_code);
+  }
+
+  /* 应答 PDU 位置: RTU 从机地址之后, TCP MBAP头之后 (两种模式的 PDU 内容相同) */
+  uint8_t* response_pdu(uint8_t* response) const
+  {
+    return response + (Modbus_TCP == m_mode ? Modbus_Codec::MBAP_SIZE : Modbus_Codec::RTU_HEADER_SIZE);
   }
 
-  uint16_t create_exception_response(const uint8_t* request, uint8_t* response, uint8_t error_code)
+  uint16_t encode_response(uint8_t* response, uint16_t pdu_length)
   {
     if (Modbus_RTU == m_mode)
     {
       response[0] = m_slave_address;
-      response[1] = static_cast<uint8_t>(request[1] | 0x80);
-      response[2] = error_code;
-      add_crc(response, 3);
-      return 5;
+      return Modbus_Codec::encode_rtu(response, pdu_length);
     }
     else if (Modbus_TCP == m_mode)
     {
-      response[4] = 0x00;
-      response[5] = 0x03;
       response[6] = m_slave_address;
-      response[7] = static_cast<uint8_t>(request[1] | 0x80);
-      response[8] = error_code;
-      return 9;
+      return Modbus_Codec::encode_tcp(response, pdu_length);
     }
     return 0;
   }
 
-  uint16_t process_request(const uint8_t* request, uint8_t* response)
+  uint16_t process_pdu(const uint8_t* request, uint8_t* pdu)
   {
     switch (request[1])
     {
       case READ_HOLDING_COILS :
         if (m_holding_coils)
-          return get_response_read_holding_coils(request, response);
+          return get_response_read_holding_coils(request, pdu);
       case READ_INPUT_COILS :
         if (m_input_coils)
-          return get_response_read_input_coils(request, response);
+          return get_response_read_input_coils(request, pdu);
       case READ_HOLDING_REGISTERS :
         if (m_holding_registers)
-          return get_response_read_holding_registers(request, response);
+          return get_response_read_holding_registers(request, pdu);
       case READ_INPUT_REGISTERS :
         if (m_input_registers)
-          return get_response_read_input_registers(request, response);
+          return get_response_read_input_registers(request, pdu);
       case WRITE_SINGLE_COIL :
         if (m_holding_coils)
-          return get_response_write_single_coil(request, response);
+          return get_response_write_single_coil(request, pdu);
       case WRITE_SINGLE_REGISTER :
         if (m_holding_registers)
-          return get_response_write_single_register(request, response);
+          return get_response_write_single_register(request, pdu);
       case WRITE_MULTIPLE_COILS :
         if (m_holding_coils)
-          return get_response_write_multiple_coils(request, response);
+          return get_response_write_multiple_coils(request, pdu);
       case WRITE_MULTIPLE_REGISTERS :
         if (m_holding_registers)
-          return get_response_write_multiple_registers(request, response);
+          return get_response_write_multiple_registers(request, pdu);
       case REPORT_SLAVE_ID :
-        return get_response_report_slave_id(request, response);
+        return get_response_report_slave_id(request, pdu);
       case MASK_WRITE_REGISTER :
         if (m_holding_registers)
-          return get_response_mask_write_register(request, response);
+          return get_response_mask_write_register(request, pdu);
       case READ_WRITE_REGISTERS :
         if (m_holding_registers)
-          return get_response_read_write_registers(request, response);
+          return get_response_read_write_registers(request, pdu);
       default :
-        return create_exception_response(request, response, ILLEGAL_FUNC_CODE);
+        return create_exception_response(request, pdu, ILLEGAL_FUNC_CODE);
     }
   }
 
+  uint16_t process_request(const uint8_t* request, uint8_t* response)
+  {
+    return encode_response(response, process_pdu(request, response_pdu(response)));
+  }
+
   int32_t get_length(uint8_t func_code)
   {
     switch (func_code)
@@ -549,116 +363,101 @@ private:
     }
   }
 
-  void process_tcp_frame(system::IOStream* iostream)
+  bool tcp_request_complete(const uint8_t* request, uint16_t length)
   {
-    system::kernel::Mutex_Guard locker(m_mutex);
-    if (iostream->recv(m_recv_buffer, 7) != 7)
-    {
-      iostream->istream_reset();
-      return;
-    }
-
-    if (m_recv_buffer[6] != m_slave_address)
-    {
-      iostream->istream_reset();
-      return;
-    }
+    uint8_t func_code = request[1];
+    if (WRITE_MULTIPLE_COILS == func_code || WRITE_MULTIPLE_REGISTERS == func_code)
+      return length >= 7 && length >= 7 + request[6];
+    if (READ_WRITE_REGISTERS == func_code)
+      return length >= 11 && length >= 11 + request[10];
+    return length >= get_length(func_code);
+  }
 
-    uint16_t length = (m_recv_buffer[4] << 8) | m_recv_buffer[5];
-    if (iostream->recv(m_recv_buffer + 7, length - 1) != length - 1)
-    {
-      iostream->istream_reset();
-      return;
-    }
+  uint16_t process_tcp_request(const uint8_t* adu, uint8_t* response)
+  {
+    if (adu[6] != m_slave_address)
+      return 0;
 
-    length = process_request(m_recv_buffer + 6, m_send_buffer);
-    memcpy(m_send_buffer, m_recv_buffer, 4);
-    iostream->send(m_send_buffer, length);
-    iostream->istream_reset();
+    uint16_t length = Modbus_Codec::read16(adu + 4);
+    if (tcp_request_complete(adu + 6, length))
+      length = process_request(adu + 6, response);
+    else
+      length = encode_response(response, create_exception_response(adu + 6, response_pdu(response), ILLEGAL_VALUE_CODE));
+    memcpy(response, adu, 4);
+    return length;
   }
 
-  void process_rtu_frame(system::IOStream* iostream)
+  void process_tcp_frame(system::IOStream* iostream)
   {
     system::kernel::Mutex_Guard locker(m_mutex);
-    if (iostream->recv(m_recv_buffer, 2) != 2)
-    {
-      iostream->istream_reset();
-      return;
-    }
-
-    if (m_recv_buffer[0] != m_slave_address)
-    {
-      iostream->istream_reset();
-      return;
-    }
-
-    uint8_t  func_code = m_recv_buffer[1];
-    uint16_t length    = get_length(func_code);
-    if (-1 == get_length(func_code))
-    {
-      if (func_code == WRITE_MULTIPLE_COILS || func_code == WRITE_MULTIPLE_REGISTERS)
-      {
-        if (iostream->recv(m_recv_buffer + 2, 5) != 5)
-        {
-          iostream->istream_reset();
-          return;
-        }
-
-        if (iostream->recv(m_recv_buffer + 7, m_recv_buffer[6] + 2) != m_recv_buffer[6] + 2)
-        {
-          iostream->istream_reset();
-          return;
-        }
-
-        length = m_recv_buffer[6] + 9;
-      }
-      else if (func_code == READ_WRITE_REGISTERS)
-      {
-        if (iostream->recv(m_recv_buffer + 2, 9) != 9)
-        {
-          iostream->istream_reset();
-          return;
-        }
-
-        if (iostream->recv(m_recv_buffer + 11, m_recv_buffer[10] + 2) != m_recv_buffer[10] + 2)
-        {
-          iostream->istream_reset();
-          return;
-        }
-
-        length = m_recv_buffer[10] + 13;
-      }
-    }
-    else
-    {
-      if (iostream->recv(m_recv_buffer + 2, length) != length)
+    int                         length = 0;
+
+    /* 只读取已到达的字节, 不完整的帧由分帧器保留至下次输入 (不阻塞) */
+    while ((length = iostream->recv(m_recv_buffer, BUFFER_SIZE, 0)) > 0)
+    {
+      bool ret = m_tcp_framer.feed(m_recv_buffer, length, ul_port_os_get_tick_count(),
+                                   [this, iostream](const uint8_t* adu, uint16_t size)
+                                   {
+                                     uint16_t response = process_tcp_request(adu, m_send_buffer);
+                                     if (response > 0)
+                                       iostream->send(m_send_buffer, response);
+                                   });
+      if (!ret)
       {
         iostream->istream_reset();
         return;
       }
-
-      length += 2;
     }
+  }
 
-    if (!check_crc(m_recv_buffer, length))
+  void process_rtu_frame(system::IOStream* iostream)
+  {
+    system::kernel::Mutex_Guard locker(m_mutex);
+    int                         length = 0;
+
+    /* 只读取已到达的字节, 不完整的帧由解析器保留至下次输入 (不阻塞) */
+    while ((length = iostream->recv(m_recv_buffer, BUFFER_SIZE, 0)) > 0)
     {
-      iostream->istream_reset();
-      return;
-    }
+      m_rtu_parser.feed(m_recv_buffer, length, ul_port_os_get_tick_count(),
+                        [this, iostream](const uint8_t* frame, uint16_t size)
+                        {
+                          if (!Modbus_Codec::check_crc(frame, size))
+                          {
+                            m_rtu_parser.resync();
+                            return;
+                          }
+
+                          if (frame[0] != m_slave_address)
+                            return;
 
-    length = process_request(m_recv_buffer, m_send_buffer);
-    iostream->send(m_send_buffer, length);
-    iostream->istream_reset();
+                          uint16_t response = process_request(frame, m_send_buffer);
+                          iostream->send(m_send_buffer, response);
+                        });
+    }
   }
 
 protected:
-  virtual void event_loop() override {}
+  virtual void event_loop() override
+  {
+    system::kernel::Mutex_Guard locker(m_mutex);
+    uint32_t                    now = ul_port_os_get_tick_count();
+
+    /* 对端停滞后不再有输入: 超时的部分帧在此丢弃; 有部分帧暂存时按字节间隔超时唤醒, 否则一直等待输入 */
+    m_tcp_framer.expire(now);
+    m_rtu_parser.expire(now);
+    if (m_tcp_framer.pending() > 0)
+      set_wait_time(m_tcp_framer.timeout() + 1);
+    else if (m_rtu_parser.pending() > 0)
+      set_wait_time(m_rtu_parser.timeout() + 1);
+    else
+      set_wait_time(WAIT_FOREVER);
+  }
 
 public:
   Modbus_Slave(const std::string& name, Object* parent) : Thread(name, parent)
   {
-    m_recv_buffer       = static_cast<uint8_t*>(Malloc(256));
-    m_send_buffer       = static_cast<uint8_t*>(Malloc(256));
+    m_recv_buffer       = static_cast<uint8_t*>(Malloc(BUFFER_SIZE));
+    m_send_buffer       = static_cast<uint8_t*>(Malloc(BUFFER_SIZE));
     m_slave_address     = 0x01;
     m_holding_coils     = nullptr;
     m_input_coils       = nullptr;
@@ -683,10 +482,42 @@ public:
       process_rtu_frame(iostream);
   }
 
+  /**
+   * @brief Modbus TCP 处理完整ADU (请求只读, 可直接位于网络接收缓存区; 应答写入调用方缓存区)
+   *
+   * 长度字段短于功能码所需字段时应答非法数据值, 处理函数不会读出ADU之外.
+   * 不使用从站的收发缓存区, 不持有从站锁, 可由多个线程并行调用; 寄存器/线圈访问由各自的锁保护.
+   *
+   * @param  adu       完整ADU (由 Modbus_Tcp_Framer 切分)
+   * @param  response  应答缓存区 (BUFFER_SIZE 字节)
+   * @return uint16_t  应答长度, 单元号不匹配或非TCP模式返回0
+   */
+  uint16_t process_tcp_adu(const uint8_t* adu, uint8_t* response)
+  {
+    if (Modbus_TCP != m_mode)
+      return 0;
+    return process_tcp_request(adu, response);
+  }
+
   void set_mode(Modbus_Mode mode)
   {
     system::kernel::Mutex_Guard locker(m_mutex);
     m_mode = mode;
+    m_tcp_framer.reset();
+    m_rtu_parser.reset();
+  }
+
+  /**
+   * @brief Modbus 从站 设置输入流路径的帧内字节间隔超时
+   *
+   * @param tcp_timeout  TCP 部分帧超时(ms)
+   * @param rtu_timeout  RTU 字节间隔超时(ms, 不小于3.5字符时间)
+   */
+  void set_frame_timeout(uint32_t tcp_timeout, uint32_t rtu_timeout)
+  {
+    system::kernel::Mutex_Guard locker(m_mutex);
+    m_tcp_framer.set_timeout(tcp_timeout);
+    m_rtu_parser.set_timeout(rtu_timeout);
   }
 
   void set_id(uint8_t id)
@@ -0,0 +1,561 @@
+/**
+ * @file      ptp.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for PTP-style network time sync (PTP 网络时间同步: UDP报文, MAC接收时间戳)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "ptp.hpp"
+#include <cstring>
+
+using namespace OwO;
+using namespace protocol::ptp;
+using namespace system::kernel;
+
+O_METAOBJECT(Ptp, Thread)
+
+/// @brief PTP 报文头长度
+static constexpr uint16_t sc_header_size    = 34;
+/// @brief PTP 时间戳长度 (秒48位 + 纳秒32位)
+static constexpr uint16_t sc_timestamp_size = 10;
+/// @brief PTP 端口标识长度
+static constexpr uint16_t sc_identity_size  = 10;
+
+/**
+ * @brief (静态内联) PTP 读取MAC系统时间
+ *
+ * @return int64_t 时间(ns)
+ */
+static inline int64_t sl_now()
+{
+  port_net_ptp_time_t time;
+  v_port_net_ptp_get_time(&time);
+  return static_cast<int64_t>(time.seconds) * 1000000000LL + time.nanoseconds;
+}
+
+/**
+ * @brief (静态内联) PTP 数值饱和为32位有符号数
+ *
+ * @param  value    数值
+ * @return int32_t  饱和后的数值
+ */
+static inline int32_t sl_saturate(int64_t value)
+{
+  if (value > INT32_MAX)
+    return INT32_MAX;
+  if (value < INT32_MIN)
+    return INT32_MIN;
+  return static_cast<int32_t>(value);
+}
+
+/**
+ * @brief (静态内联) PTP 读取大端数值
+ *
+ * @param  data      数据
+ * @param  size      字节数
+ * @return uint64_t  数值
+ */
+static inline uint64_t sl_read(const uint8_t* data, uint8_t size)
+{
+  uint64_t value = 0;
+  for (uint8_t i = 0; i < size; i++)
+    value = (value << 8) | data[i];
+  return value;
+}
+
+/**
+ * @brief (静态内联) PTP 写入大端数值
+ *
+ * @param data   数据
+ * @param size   字节数
+ * @param value  数值
+ */
+static inline void sl_write(uint8_t* data, uint8_t size, uint64_t value)
+{
+  for (uint8_t i = size; i > 0; i--)
+  {
+    data[i - 1]   = static_cast<uint8_t>(value);
+    value       >>= 8;
+  }
+}
+
+Ptp::Ptp(const std::string& name, Object* parent) : Thread(name, parent), m_role(static_cast<uint8_t>(ptp_role::OFF)), m_domain(0), m_state(static_cast<uint8_t>(ptp_sync_state::OFF)), m_offset(0), m_ppb(0), m_delay(0), m_samples(0), m_outliers(0), m_sample_tick(0)
+{
+  m_event          = nullptr;
+  m_general        = nullptr;
+  m_socket_set     = nullptr;
+  m_active_role    = ptp_role::OFF;
+  m_sync_sequence  = 0;
+  m_sync_tick      = 0;
+  m_master         = 0;
+  m_sequence       = 0;
+  m_delay_sequence = 0;
+  m_wait_follow    = false;
+  m_wait_resp      = false;
+  m_t1             = 0;
+  m_t2             = 0;
+  m_t3             = 0;
+}
+
+/**
+ * @brief PTP 网络时间同步 启动同步线程
+ *
+ * @param priority 线程优先级
+ */
+void Ptp::start(uint8_t priority)
+{
+  Thread::start(priority, 512, 0);
+}
+
+/**
+ * @brief PTP 网络时间同步 停止同步线程 (关闭套接字)
+ *
+ */
+void Ptp::stop()
+{
+  Thread::exit(1);
+  join();
+  m_close();
+}
+
+/**
+ * @brief (私有函数) PTP 网络时间同步 打开MAC时间戳与套接字 (事件端口319, 普通端口320)
+ *
+ * @return bool 成功返回true
+ */
+bool Ptp::m_open()
+{
+  if (SUCESS != e_port_net_ptp_init())
+    return false;
+
+  struct freertos_sockaddr addr;
+  TickType_t               timeout = 0;
+
+  m_event      = FreeRTOS_socket(FREERTOS_AF_INET, FREERTOS_SOCK_DGRAM, FREERTOS_IPPROTO_UDP);
+  m_general    = FreeRTOS_socket(FREERTOS_AF_INET, FREERTOS_SOCK_DGRAM, FREERTOS_IPPROTO_UDP);
+  m_socket_set = FreeRTOS_CreateSocketSet();
+  if (FREERTOS_INVALID_SOCKET == m_event || FREERTOS_INVALID_SOCKET == m_general || nullptr == m_socket_set)
+  {
+    m_close();
+    return false;
+  }
+
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = FREERTOS_AF_INET;
+  addr.sin_addr   = FreeRTOS_htonl(FREERTOS_INADDR_ANY);
+
+  addr.sin_port   = FreeRTOS_htons(PORT_NET_PTP_EVENT_PORT);
+  if (0 != FreeRTOS_bind(m_event, &addr, sizeof(addr)))
+  {
+    m_close();
+    return false;
+  }
+
+  addr.sin_port = FreeRTOS_htons(PORT_NET_PTP_GENERAL_PORT);
+  if (0 != FreeRTOS_bind(m_general, &addr, sizeof(addr)))
+  {
+    m_close();
+    return false;
+  }
+
+  FreeRTOS_setsockopt(m_event, 0, FREERTOS_SO_RCVTIMEO, &timeout, sizeof(timeout));
+  FreeRTOS_setsockopt(m_general, 0, FREERTOS_SO_RCVTIMEO, &timeout, sizeof(timeout));
+  FreeRTOS_FD_SET(m_event, m_socket_set, eSELECT_READ);
+  FreeRTOS_FD_SET(m_general, m_socket_set, eSELECT_READ);
+  return true;
+}
+
+/**
+ * @brief (私有函数) PTP 网络时间同步 关闭套接字
+ *
+ */
+void Ptp::m_close()
+{
+  if (nullptr != m_socket_set)
+  {
+    FreeRTOS_DeleteSocketSet(m_socket_set);
+    m_socket_set = nullptr;
+  }
+
+  if (nullptr != m_event && FREERTOS_INVALID_SOCKET != m_event)
+    FreeRTOS_closesocket(m_event);
+  if (nullptr != m_general && FREERTOS_INVALID_SOCKET != m_general)
+    FreeRTOS_closesocket(m_general);
+  m_event   = nullptr;
+  m_general = nullptr;
+}
+
+void Ptp::run()
+{
+  /* 网络接口初始化完成前MAC时间戳不可用, 每秒重试 */
+  while (!is_finished() && !m_open())
+  {
+    m_state.store(static_cast<uint8_t>(ptp_sync_state::ERROR), std::memory_order_relaxed);
+    msleep(1000);
+  }
+
+  while (!is_finished())
+  {
+    ptp_role role = this->role();
+    if (role != m_active_role)
+      m_set_role(role);
+
+    if (ptp_role::OFF == m_active_role)
+    {
+      msleep(100);
+      continue;
+    }
+
+    if (FreeRTOS_select(m_socket_set, pdMS_TO_TICKS(10)) > 0)
+    {
+      m_receive(m_event);
+      m_receive(m_general);
+    }
+
+    if (ptp_role::MASTER == m_active_role)
+      m_master_poll();
+    else
+      m_slave_poll();
+
+    m_publish();
+  }
+}
+
+/**
+ * @brief (私有函数) PTP 网络时间同步 切换角色 (伺服复位, 频率调整归零)
+ *
+ * @param role 角色
+ */
+void Ptp::m_set_role(ptp_role role)
+{
+  m_active_role = role;
+  m_servo.reset();
+  e_port_net_ptp_set_ppb(0);
+  m_wait_follow = false;
+  m_wait_resp   = false;
+  m_sync_tick   = ul_port_os_get_tick_count() - SYNC_INTERVAL;
+  m_sample_tick.store(ul_port_os_get_tick_count() - LOSS_TIMEOUT, std::memory_order_relaxed);
+  m_publish();
+}
+
+/**
+ * @brief (私有函数) PTP 网络时间同步 发布同步状态 (供其他线程读取)
+ *
+ */
+void Ptp::m_publish()
+{
+  ptp_sync_state state;
+  switch (m_active_role)
+  {
+    case ptp_role::MASTER :
+      state = ptp_sync_state::MASTER;
+      break;
+    case ptp_role::SLAVE :
+      if (ul_port_os_get_tick_count() - m_sample_tick.load(std::memory_order_relaxed) >= LOSS_TIMEOUT)
+        state = (ptp_servo_state::LOCKED == m_servo.state()) ? ptp_sync_state::HOLDOVER : ptp_sync_state::LISTEN;
+      else
+        state = m_servo.synced() ? ptp_sync_state::SYNCED : ptp_sync_state::LISTEN;
+      break;
+    default :
+      state = ptp_sync_state::OFF;
+      break;
+  }
+
+  m_state.store(static_cast<uint8_t>(state), std::memory_order_relaxed);
+  m_offset.store(sl_saturate(m_servo.offset()), std::memory_order_relaxed);
+  m_ppb.store(m_servo.ppb(), std::memory_order_relaxed);
+  m_delay.store(static_cast<uint32_t>(sl_saturate(m_servo.delay())), std::memory_order_relaxed);
+  m_samples.store(m_servo.samples(), std::memory_order_relaxed);
+  m_outliers.store(m_servo.outliers(), std::memory_order_relaxed);
+}
+
+/**
+ * @brief (私有函数) PTP 网络时间同步 读取套接字中的全部报文
+ *
+ * @param socket 套接字
+ */
+void Ptp::m_receive(Socket_t socket)
+{
+  struct freertos_sockaddr addr;
+  socklen_t                addr_len = sizeof(addr);
+  int32_t                  length;
+
+  while ((length = FreeRTOS_recvfrom(socket, m_buffer, sizeof(m_buffer), FREERTOS_MSG_DONTWAIT, &addr, &addr_len)) > 0)
+  {
+    /* 只处理 PTPv2, 本域, 带时间戳的报文 */
+    if (length < sc_header_size + sc_timestamp_size || 2 != (m_buffer[1] & 0x0F) || domain() != m_buffer[4])
+      continue;
+
+    uint8_t  type     = m_buffer[0] & 0x0F;
+    uint16_t sequence = static_cast<uint16_t>(sl_read(&m_buffer[30], 2));
+    int64_t  time     = static_cast<int64_t>(sl_read(&m_buffer[sc_header_size], 6)) * 1000000000LL + static_cast<int64_t>(sl_read(&m_buffer[sc_header_size + 6], 4));
+
+    switch (type)
+    {
+      case MESSAGE_SYNC :
+        if (ptp_role::SLAVE == m_active_role)
+          m_on_sync(addr.sin_addr, sequence);
+        break;
+      case MESSAGE_FOLLOW_UP :
+        if (ptp_role::SLAVE == m_active_role)
+          m_on_follow_up(addr.sin_addr, sequence, time);
+        break;
+      case MESSAGE_DELAY_REQ :
+        if (ptp_role::MASTER == m_active_role)
+          m_on_delay_req(addr.sin_addr, sequence, &m_buffer[20]);
+        break;
+      case MESSAGE_DELAY_RESP :
+        if (ptp_role::SLAVE == m_active_role && length >= sc_header_size + sc_timestamp_size + sc_identity_size)
+          m_on_delay_resp(addr.sin_addr, sequence, time);
+        break;
+      default :
+        break;
+    }
+  }
+}
+
+/**
+ * @brief (私有函数) PTP 网络时间同步 主时钟 到期时广播 Sync 与携带发送时刻的 Follow_Up
+ *
+ */
+void Ptp::m_master_poll()
+{
+  uint32_t now = ul_port_os_get_tick_count();
+  if (now - m_sync_tick < SYNC_INTERVAL)
+    return;
+  m_sync_tick = now;
+
+  m_sync_sequence++;
+  int64_t t1 = sl_now();
+  if (m_send(m_event, FreeRTOS_htonl(ipBROADCAST_IP_ADDRESS), PORT_NET_PTP_EVENT_PORT, MESSAGE_SYNC, m_sync_sequence, 0))
+    m_send(m_general, FreeRTOS_htonl(ipBROADCAST_IP_ADDRESS), PORT_NET_PTP_GENERAL_PORT, MESSAGE_FOLLOW_UP, m_sync_sequence, t1);
+}
+
+/**
+ * @brief (私有函数) PTP 网络时间同步 从时钟 丢弃超时未完成的交换
+ *
+ */
+void Ptp::m_slave_poll()
+{
+  if ((m_wait_follow || m_wait_resp) && ul_port_os_get_tick_count() - m_sample_tick.load(std::memory_order_relaxed) >= LOSS_TIMEOUT)
+  {
+    m_wait_follow = false;
+    m_wait_resp   = false;
+  }
+}
+
+/**
+ * @brief (私有函数) PTP 网络时间同步 从时钟 收到 Sync (记录 t2, 跟随发送方为主时钟)
+ *
+ * @param source    发送方地址
+ * @param sequence  序号
+ */
+void Ptp::m_on_sync(uint32_t source, uint16_t sequence)
+{
+  m_master      = source;
+  m_sequence    = sequence;
+  m_t2          = m_rx_time(source, MESSAGE_SYNC, sequence);
+  m_wait_follow = true;
+  m_wait_resp   = false;
+}
+
+/**
+ * @brief (私有函数) PTP 网络时间同步 从时钟 收到 Follow_Up (记录 t1, 发送 Delay_Req 并记录 t3)
+ *
+ * @param source    发送方地址
+ * @param sequence  序号
+ * @param t1        主时钟发送 Sync 时刻(ns)
+ */
+void Ptp::m_on_follow_up(uint32_t source, uint16_t sequence, int64_t t1)
+{
+  if (!m_wait_follow || source != m_master || sequence != m_sequence)
+    return;
+
+  m_wait_follow = false;
+  m_t1          = t1;
+  m_delay_sequence++;
+  m_t3          = sl_now();
+  m_wait_resp   = m_send(m_event, m_master, PORT_NET_PTP_EVENT_PORT, MESSAGE_DELAY_REQ, m_delay_sequence, 0);
+}
+
+/**
+ * @brief (私有函数) PTP 网络时间同步 主时钟 收到 Delay_Req (以接收时间戳 t4 应答)
+ *
+ * @param source    发送方地址
+ * @param sequence  序号
+ * @param identity  请求方端口标识
+ */
+void Ptp::m_on_delay_req(uint32_t source, uint16_t sequence, const uint8_t* identity)
+{
+  uint8_t requester[sc_identity_size];
+  memcpy(requester, identity, sc_identity_size);
+  m_send(m_general, source, PORT_NET_PTP_GENERAL_PORT, MESSAGE_DELAY_RESP, sequence, m_rx_time(source, MESSAGE_DELAY_REQ, sequence), requester);
+}
+
+/**
+ * @brief (私有函数) PTP 网络时间同步 从时钟 收到 Delay_Resp (得到 t4, 输入伺服并调整本地时钟)
+ *
+ * @param source    发送方地址
+ * @param sequence  序号
+ * @param t4        主时钟接收 Delay_Req 时刻(ns)
+ */
+void Ptp::m_on_delay_resp(uint32_t source, uint16_t sequence, int64_t t4)
+{
+  if (!m_wait_resp || source != m_master || sequence != m_delay_sequence)
+    return;
+  m_wait_resp = false;
+
+  int64_t offset;
+  int64_t delay;
+  if (!Ptp_Servo::measure(m_t1, m_t2, m_t3, t4, offset, delay))
+    return;
+
+  m_sample_tick.store(ul_port_os_get_tick_count(), std::memory_order_relaxed);
+  switch (m_servo.sample(offset, delay, m_t2))
+  {
+    case ptp_servo_action::STEP :
+      e_port_net_ptp_step(m_servo.step());
+      e_port_net_ptp_set_ppb(m_servo.ppb());
+      break;
+    case ptp_servo_action::ADJUST :
+      e_port_net_ptp_set_ppb(m_servo.ppb());
+      break;
+    default :
+      break;
+  }
+}
+
+/**
+ * @brief (私有函数) PTP 网络时间同步 发送报文
+ *
+ * @param  socket    套接字
+ * @param  address   目标地址(网络字节序)
+ * @param  port      目标端口
+ * @param  type      报文类型
+ * @param  sequence  序号
+ * @param  time      报文时间戳(ns)
+ * @param  identity  请求方端口标识 (仅 Delay_Resp)
+ * @return bool      成功返回true
+ */
+bool Ptp::m_send(Socket_t socket, uint32_t address, uint16_t port, message_e type, uint16_t sequence, int64_t time, const uint8_t* identity)
+{
+  uint16_t length = sc_header_size + sc_timestamp_size + ((MESSAGE_DELAY_RESP == type) ? sc_identity_size : 0);
+  uint8_t  control;
+  switch (type)
+  {
+    case MESSAGE_SYNC :
+      control = 0;
+      break;
+    case MESSAGE_DELAY_REQ :
+      control = 1;
+      break;
+    case MESSAGE_FOLLOW_UP :
+      control = 2;
+      break;
+    default :
+      control = 3;
+      break;
+  }
+
+  memset(m_buffer, 0, length);
+  m_buffer[0] = type;
+  m_buffer[1] = 2;
+  sl_write(&m_buffer[2], 2, length);
+  m_buffer[4] = domain();
+  /* 两步时钟: Sync 的发送时刻由 Follow_Up 携带 */
+  if (MESSAGE_SYNC == type)
+    m_buffer[6] = 0x02;
+  /* 端口标识: 时钟标识取本机地址, 端口号1 */
+  uint32_t local = FreeRTOS_GetIPAddress();
+  memcpy(&m_buffer[20], &local, sizeof(local));
+  sl_write(&m_buffer[28], 2, 1);
+  sl_write(&m_buffer[30], 2, sequence);
+  m_buffer[32] = control;
+  m_buffer[33] = (MESSAGE_DELAY_RESP == type) ? 0x7F : 0;
+
+  if (time < 0)
+    time = 0;
+  sl_write(&m_buffer[sc_header_size], 6, static_cast<uint64_t>(time / 1000000000LL));
+  sl_write(&m_buffer[sc_header_size + 6], 4, static_cast<uint64_t>(time % 1000000000LL));
+  if (nullptr != identity)
+    memcpy(&m_buffer[sc_header_size + sc_timestamp_size], identity, sc_identity_size);
+
+  struct freertos_sockaddr addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = FREERTOS_AF_INET;
+  addr.sin_port   = FreeRTOS_htons(port);
+  addr.sin_addr   = address;
+  return FreeRTOS_sendto(socket, m_buffer, length, 0, &addr, sizeof(addr)) == length;
+}
+
+/**
+ * @brief (私有函数) PTP 网络时间同步 事件报文接收时刻 (MAC接收时间戳, 未记录时取当前MAC时间)
+ *
+ * @param  source    发送方地址
+ * @param  type      报文类型
+ * @param  sequence  序号
+ * @return int64_t   接收时刻(ns)
+ */
+int64_t Ptp::m_rx_time(uint32_t source, message_e type, uint16_t sequence)
+{
+  port_net_ptp_time_t time;
+  if (!b_port_net_ptp_rx_stamp(source, type, sequence, &time))
+    return sl_now();
+  return static_cast<int64_t>(time.seconds) * 1000000000LL + time.nanoseconds;
+}
+
+/**
+ * @brief PTP 网络时间同步 是否已同步 (主时钟总为已同步)
+ *
+ * @return bool 已同步返回true
+ */
+bool Ptp::synced() const
+{
+  ptp_sync_state state = static_cast<ptp_sync_state>(m_state.load(std::memory_order_relaxed));
+  return ptp_sync_state::SYNCED == state || ptp_sync_state::MASTER == state;
+}
+
+/**
+ * @brief PTP 网络时间同步 读取网络时间 (任意线程调用)
+ *
+ * @param  ns    网络时间(ns, 输出)
+ * @return bool  已同步返回true, 未同步时仍输出本地MAC时间
+ */
+bool Ptp::now(uint64_t& ns) const
+{
+  if (!b_port_net_ptp_is_init())
+  {
+    ns = 0;
+    return false;
+  }
+
+  ns = static_cast<uint64_t>(sl_now());
+  return synced();
+}
+
+/**
+ * @brief PTP 网络时间同步 读取同步状态快照 (任意线程调用)
+ *
+ * @return ptp_status_t 同步状态
+ */
+ptp_status_t Ptp::status() const
+{
+  ptp_status_t status;
+  status.state    = static_cast<ptp_sync_state>(m_state.load(std::memory_order_relaxed));
+  status.offset   = m_offset.load(std::memory_order_relaxed);
+  status.ppb      = m_ppb.load(std::memory_order_relaxed);
+  status.delay    = m_delay.load(std::memory_order_relaxed);
+  status.samples  = m_samples.load(std::memory_order_relaxed);
+  status.outliers = m_outliers.load(std::memory_order_relaxed);
+  return status;
+}
+
+Ptp::~Ptp()
+{
+  if (is_running())
+    stop();
+  m_close();
+}
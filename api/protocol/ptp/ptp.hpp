@@ -0,0 +1,188 @@
+/**
+ * @file      ptp.hpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for PTP-style network time sync (PTP 网络时间同步: UDP报文, MAC接收时间戳)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#ifndef __PTP_HPP__
+#define __PTP_HPP__
+
+#include <atomic>
+#include "thread.hpp"
+#include "ptp_servo.hpp"
+#include "port_net_ptp.h"
+
+#include "FreeRTOS_IP.h"
+#include "FreeRTOS_Sockets.h"
+
+/// @brief 名称空间 库名
+namespace OwO
+{
+/// @brief 名称空间 协议
+namespace protocol
+{
+/// @brief 名称空间 PTP
+namespace ptp
+{
+/// @brief 枚举 PTP 角色
+enum class ptp_role : uint8_t
+{
+  OFF    = 0, /* 关闭 */
+  SLAVE  = 1, /* 从时钟: 跟随收到的 Sync */
+  MASTER = 2, /* 主时钟: 广播 Sync, 应答 Delay_Req */
+};
+
+/// @brief 枚举 PTP 同步状态
+enum class ptp_sync_state : uint8_t
+{
+  OFF      = 0, /* 关闭 */
+  ERROR    = 1, /* MAC时间戳或套接字初始化失败 */
+  LISTEN   = 2, /* 从时钟 未同步 */
+  HOLDOVER = 3, /* 从时钟 超过 LOSS_TIMEOUT 未收到样本, 保持最近频率 */
+  SYNCED   = 4, /* 从时钟 已同步 */
+  MASTER   = 5, /* 主时钟 */
+};
+
+/// @brief 结构体 PTP 同步状态快照
+struct ptp_status_t
+{
+  ptp_sync_state state;
+  int32_t        offset;   /* 最近偏差(ns, 本地 - 主时钟, 饱和) */
+  int32_t        ppb;      /* 频率调整(ppb) */
+  uint32_t       delay;    /* 单向路径延迟(ns, 饱和) */
+  uint32_t       samples;  /* 样本数量 */
+  uint32_t       outliers; /* 丢弃的样本数量 */
+};
+
+/**
+ * @brief 类 PTP 网络时间同步 -- IEEE 1588v2 报文格式的精简子集 (两步 Sync/Follow_Up, Delay_Req/Delay_Resp, 无最佳主时钟选择, 角色由配置指定)
+ *
+ * 网络时间为MAC系统时间 (ns): 主时钟自由运行, 从时钟按 Ptp_Servo 步进并调整频率.
+ * t2 / t4 为MAC接收时间戳; t1 / t3 为发送前读取的MAC时间 (软件时间戳, 协议栈发送延迟两端相近, 在偏差中大部分抵消).
+ */
+class Ptp : public system::kernel::Thread
+{
+  O_MEMORY
+  O_OBJECT
+  NO_COPY(Ptp)
+  NO_MOVE(Ptp)
+
+public:
+  /// @brief 主时钟 Sync 间隔(ms)
+  static constexpr uint32_t SYNC_INTERVAL = 1000;
+  /// @brief 从时钟超过此时长(ms)未收到样本时进入保持状态
+  static constexpr uint32_t LOSS_TIMEOUT  = 5000;
+  /// @brief 报文缓存区长度 (PTP头34 + 时间戳10 + 请求端口10)
+  static constexpr uint16_t MESSAGE_SIZE  = 54;
+
+private:
+  /// @brief 枚举 PTP 报文类型
+  enum message_e : uint8_t
+  {
+    MESSAGE_SYNC       = 0x0,
+    MESSAGE_DELAY_REQ  = 0x1,
+    MESSAGE_FOLLOW_UP  = 0x8,
+    MESSAGE_DELAY_RESP = 0x9,
+  };
+
+  Socket_t              m_event;
+  Socket_t              m_general;
+  SocketSet_t           m_socket_set;
+  Ptp_Servo             m_servo;
+  ptp_role              m_active_role;
+  std::atomic<uint8_t>  m_role;
+  std::atomic<uint8_t>  m_domain;
+  std::atomic<uint8_t>  m_state;
+  std::atomic<int32_t>  m_offset;
+  std::atomic<int32_t>  m_ppb;
+  std::atomic<uint32_t> m_delay;
+  std::atomic<uint32_t> m_samples;
+  std::atomic<uint32_t> m_outliers;
+  std::atomic<uint32_t> m_sample_tick;
+  uint8_t               m_buffer[MESSAGE_SIZE];
+  /* 主时钟 */
+  uint16_t              m_sync_sequence;
+  uint32_t              m_sync_tick;
+  /* 从时钟 */
+  uint32_t              m_master;
+  uint16_t              m_sequence;
+  uint16_t              m_delay_sequence;
+  bool                  m_wait_follow;
+  bool                  m_wait_resp;
+  int64_t               m_t1;
+  int64_t               m_t2;
+  int64_t               m_t3;
+
+  virtual void run() override;
+  virtual void event_loop() override {};
+
+  bool    m_open();
+  void    m_close();
+  void    m_set_role(ptp_role role);
+  void    m_publish();
+  void    m_receive(Socket_t socket);
+  void    m_master_poll();
+  void    m_slave_poll();
+  void    m_on_sync(uint32_t source, uint16_t sequence);
+  void    m_on_follow_up(uint32_t source, uint16_t sequence, int64_t t1);
+  void    m_on_delay_req(uint32_t source, uint16_t sequence, const uint8_t* identity);
+  void    m_on_delay_resp(uint32_t source, uint16_t sequence, int64_t t4);
+  bool    m_send(Socket_t socket, uint32_t address, uint16_t port, message_e type, uint16_t sequence, int64_t time, const uint8_t* identity = nullptr);
+  int64_t m_rx_time(uint32_t source, message_e type, uint16_t sequence);
+
+  using system::kernel::Thread::exit;
+  using system::kernel::Thread::is_finished;
+  using system::kernel::Thread::is_running;
+  using system::kernel::Thread::quit;
+
+public:
+  explicit Ptp(const std::string& name, Object* parent = nullptr);
+
+  void start(uint8_t priority);
+  void stop();
+
+  /**
+   * @brief PTP 网络时间同步 设置角色 (任意线程调用, 由同步线程切换; 切换时伺服复位)
+   *
+   * @param role 角色
+   */
+  void set_role(ptp_role role)
+  {
+    m_role.store(static_cast<uint8_t>(role), std::memory_order_relaxed);
+  }
+
+  ptp_role role() const
+  {
+    return static_cast<ptp_role>(m_role.load(std::memory_order_relaxed));
+  }
+
+  /**
+   * @brief PTP 网络时间同步 设置域号 (忽略其他域的报文)
+   *
+   * @param domain 域号
+   */
+  void set_domain(uint8_t domain)
+  {
+    m_domain.store(domain, std::memory_order_relaxed);
+  }
+
+  uint8_t domain() const
+  {
+    return m_domain.load(std::memory_order_relaxed);
+  }
+
+  bool         synced() const;
+  bool         now(uint64_t& ns) const;
+  ptp_status_t status() const;
+
+  virtual ~Ptp();
+};
+} /* namespace ptp */
+} /* namespace protocol */
+} /* namespace OwO */
+
+#endif /* __PTP_HPP__ */
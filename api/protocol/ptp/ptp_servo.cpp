@@ -0,0 +1,176 @@
+/**
+ * @file      ptp_servo.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for PTP clock servo (PTP 时钟伺服: 偏差/路径延迟计算, 步进与PI频率调整)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "ptp_servo.hpp"
+
+using namespace OwO;
+using namespace protocol::ptp;
+
+/**
+ * @brief (私有函数) PTP 时钟伺服 路径延迟窗口最小值
+ *
+ * @return int64_t 最小值(ns)
+ */
+int64_t Ptp_Servo::m_min_delay() const
+{
+  int64_t min = m_delays[0];
+  for (uint8_t i = 1; i < m_delay_count; i++)
+  {
+    if (m_delays[i] < min)
+      min = m_delays[i];
+  }
+  return min;
+}
+
+/**
+ * @brief (私有函数) PTP 时钟伺服 记录路径延迟 (被丢弃的样本同样记录, 路径长期变化后基准随窗口更新)
+ *
+ * @param delay 路径延迟(ns)
+ */
+void Ptp_Servo::m_push_delay(int64_t delay)
+{
+  m_delays[m_delay_index] = delay;
+  m_delay_index           = (m_delay_index + 1) % DELAY_WINDOW;
+  if (m_delay_count < DELAY_WINDOW)
+    m_delay_count++;
+}
+
+/**
+ * @brief (私有函数) PTP 时钟伺服 频率调整限幅
+ *
+ * @param  ppb      频率调整(ppb)
+ * @return int32_t  限幅后的频率调整(ppb)
+ */
+int32_t Ptp_Servo::m_clamp(int64_t ppb) const
+{
+  if (ppb > MAX_PPB)
+    return MAX_PPB;
+  if (ppb < -MAX_PPB)
+    return -MAX_PPB;
+  return static_cast<int32_t>(ppb);
+}
+
+/**
+ * @brief PTP 时钟伺服 复位 (频率调整归零, 调用方需同步复位硬件频率)
+ *
+ */
+void Ptp_Servo::reset()
+{
+  m_state       = ptp_servo_state::UNLOCKED;
+  m_last_offset = 0;
+  m_last_time   = 0;
+  m_drift       = 0;
+  m_ppb         = 0;
+  m_step        = 0;
+  m_offset      = 0;
+  m_delay       = 0;
+  m_delay_index = 0;
+  m_delay_count = 0;
+  m_samples     = 0;
+  m_outliers    = 0;
+  for (int64_t& delay : m_delays)
+    delay = 0;
+}
+
+/**
+ * @brief PTP 时钟伺服 输入样本
+ *
+ * 频率调整 f 作用于本地时钟后, 偏差变化率 = 频率偏差 + f;
+ * 步进后的第二个样本按偏差变化率估计频率偏差, 其后每个样本:
+ *   频率偏差估计 += KI * 偏差 / 间隔, f = -(频率偏差估计 + KP * 偏差 / 间隔).
+ *
+ * @param  offset            偏差(ns, 本地 - 主时钟)
+ * @param  delay             单向路径延迟(ns)
+ * @param  local             样本本地时刻(ns, t2)
+ * @return ptp_servo_action  需执行的动作 (STEP 时先步进 step() ns; STEP/ADJUST 后频率调整为 ppb())
+ */
+ptp_servo_action Ptp_Servo::sample(int64_t offset, int64_t delay, int64_t local)
+{
+  if (m_samples < 0xFFFFFFFF)
+    m_samples++;
+
+  /* 路径延迟远大于近期基准时, 往返不对称, 偏差不可信 */
+  if (m_delay_count >= 2 && delay > 2 * m_min_delay() + DELAY_MARGIN)
+  {
+    if (m_outliers < 0xFFFFFFFF)
+      m_outliers++;
+    m_push_delay(delay);
+    return ptp_servo_action::NONE;
+  }
+  m_push_delay(delay);
+
+  m_offset = offset;
+  m_delay  = delay;
+
+  if (ptp_servo_state::UNLOCKED != m_state && (offset > STEP_THRESHOLD || offset < -STEP_THRESHOLD))
+    m_state = ptp_servo_state::UNLOCKED;
+
+  switch (m_state)
+  {
+    case ptp_servo_state::UNLOCKED :
+      m_state = ptp_servo_state::STEPPED;
+      if (offset > STEP_THRESHOLD || offset < -STEP_THRESHOLD)
+      {
+        m_step        = -offset;
+        m_last_offset = 0;
+        m_last_time   = local - offset;
+        return ptp_servo_action::STEP;
+      }
+      m_last_offset = offset;
+      m_last_time   = local;
+      return ptp_servo_action::NONE;
+
+    case ptp_servo_state::STEPPED :
+    {
+      int64_t interval = local - m_last_time;
+      if (interval < MIN_INTERVAL)
+      {
+        /* 时间倒退(外部修改本地时钟)时重新开始 */
+        if (interval < 0)
+        {
+          m_last_offset = offset;
+          m_last_time   = local;
+        }
+        return ptp_servo_action::NONE;
+      }
+
+      /* 偏差变化率包含当前频率调整 */
+      m_drift       = (offset - m_last_offset) * 1000000000LL / interval - m_ppb;
+      m_ppb         = m_clamp(-(m_drift + KP_NUM * offset * 1000000000LL / interval / GAIN_DEN));
+      m_state       = ptp_servo_state::LOCKED;
+      m_last_offset = offset;
+      m_last_time   = local;
+      return ptp_servo_action::ADJUST;
+    }
+
+    case ptp_servo_state::LOCKED :
+    default :
+    {
+      int64_t interval = local - m_last_time;
+      if (interval <= 0)
+      {
+        m_last_time = local;
+        return ptp_servo_action::NONE;
+      }
+
+      int64_t rate  = offset * 1000000000LL / interval;
+      m_drift      += KI_NUM * rate / GAIN_DEN;
+      if (m_drift > MAX_PPB)
+        m_drift = MAX_PPB;
+      else if (m_drift < -MAX_PPB)
+        m_drift = -MAX_PPB;
+
+      m_ppb         = m_clamp(-(m_drift + KP_NUM * rate / GAIN_DEN));
+      m_last_offset = offset;
+      m_last_time   = local;
+      return ptp_servo_action::ADJUST;
+    }
+  }
+}
@@ -0,0 +1,167 @@
+/**
+ * @file      ptp_servo.hpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for PTP clock servo (PTP 时钟伺服: 偏差/路径延迟计算, 步进与PI频率调整)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#ifndef __PTP_SERVO_HPP__
+#define __PTP_SERVO_HPP__
+
+#include <stdint.h>
+
+/// @brief 名称空间 库名
+namespace OwO
+{
+/// @brief 名称空间 协议
+namespace protocol
+{
+/// @brief 名称空间 PTP
+namespace ptp
+{
+/// @brief 枚举 PTP 伺服状态
+enum class ptp_servo_state : uint8_t
+{
+  UNLOCKED, /* 无样本 */
+  STEPPED,  /* 已对齐时间, 等待第二个样本估计频率偏差 */
+  LOCKED,   /* PI 频率调整 */
+};
+
+/// @brief 枚举 PTP 伺服动作
+enum class ptp_servo_action : uint8_t
+{
+  NONE,   /* 无需调整 (首个样本或样本被丢弃) */
+  STEP,   /* 本地时钟步进 step() ns */
+  ADJUST, /* 本地时钟频率调整为 ppb() */
+};
+
+/// @brief 类 PTP 时钟伺服 -- 由 t1..t4 计算偏差与路径延迟, 偏差过大时步进, 其后两样本估计频率偏差, 再以PI调整频率 (不依赖硬件)
+class Ptp_Servo
+{
+public:
+  /// @brief 偏差超过此值(ns)时步进本地时钟
+  static constexpr int64_t STEP_THRESHOLD = 1000000;
+  /// @brief 锁定后偏差低于此值(ns)视为已同步
+  static constexpr int64_t SYNC_THRESHOLD = 100000;
+  /// @brief 频率调整上限(ppb)
+  static constexpr int32_t MAX_PPB        = 500000;
+  /// @brief 路径延迟窗口长度 (取窗口内最小值为基准)
+  static constexpr uint8_t DELAY_WINDOW   = 8;
+  /// @brief 路径延迟超过 2倍基准 + 此值(ns) 时丢弃样本 (排队导致的不对称)
+  static constexpr int64_t DELAY_MARGIN   = 50000;
+  /// @brief 估计频率偏差所需的最短样本间隔(ns)
+  static constexpr int64_t MIN_INTERVAL   = 100000000;
+  /// @brief 比例增益 (KP_NUM / GAIN_DEN)
+  static constexpr int64_t KP_NUM         = 7;
+  /// @brief 积分增益 (KI_NUM / GAIN_DEN)
+  static constexpr int64_t KI_NUM         = 3;
+  /// @brief 增益分母
+  static constexpr int64_t GAIN_DEN       = 10;
+
+private:
+  ptp_servo_state m_state;
+  /// @brief 上一样本的偏差(ns, 步进后为步进后的偏差)
+  int64_t         m_last_offset;
+  /// @brief 上一样本的本地时刻(ns, 步进后为步进后的时刻)
+  int64_t         m_last_time;
+  /// @brief 频率偏差估计(ppb, 本地相对主时钟偏快为正)
+  int64_t         m_drift;
+  /// @brief 当前频率调整(ppb)
+  int32_t         m_ppb;
+  /// @brief 最近一次步进(ns)
+  int64_t         m_step;
+  /// @brief 最近样本偏差(ns)
+  int64_t         m_offset;
+  /// @brief 最近样本路径延迟(ns)
+  int64_t         m_delay;
+  /// @brief 路径延迟窗口
+  int64_t         m_delays[DELAY_WINDOW];
+  uint8_t         m_delay_index;
+  uint8_t         m_delay_count;
+  /// @brief 样本数量
+  uint32_t        m_samples;
+  /// @brief 丢弃的样本数量
+  uint32_t        m_outliers;
+
+  int64_t m_min_delay() const;
+  void    m_push_delay(int64_t delay);
+  int32_t m_clamp(int64_t ppb) const;
+
+public:
+  Ptp_Servo()
+  {
+    reset();
+  }
+
+  /**
+   * @brief PTP 时钟伺服 计算偏差与路径延迟 (假设往返路径对称)
+   *
+   * @param  t1      主时钟发送 Sync 时刻(ns, 主时钟)
+   * @param  t2      从时钟接收 Sync 时刻(ns, 本地时钟)
+   * @param  t3      从时钟发送 Delay_Req 时刻(ns, 本地时钟)
+   * @param  t4      主时钟接收 Delay_Req 时刻(ns, 主时钟)
+   * @param  offset  偏差(ns, 本地 - 主时钟, 输出)
+   * @param  delay   单向路径延迟(ns, 输出)
+   * @return bool    路径延迟为负(时间戳错误)返回false
+   */
+  static bool measure(int64_t t1, int64_t t2, int64_t t3, int64_t t4, int64_t& offset, int64_t& delay)
+  {
+    int64_t forward  = t2 - t1;
+    int64_t backward = t4 - t3;
+    delay            = (forward + backward) / 2;
+    offset           = (forward - backward) / 2;
+    return delay >= 0;
+  }
+
+  void             reset();
+  ptp_servo_action sample(int64_t offset, int64_t delay, int64_t local);
+
+  ptp_servo_state state() const
+  {
+    return m_state;
+  }
+
+  /// @brief 是否已同步 (锁定且偏差低于 SYNC_THRESHOLD)
+  bool synced() const
+  {
+    return ptp_servo_state::LOCKED == m_state && m_offset < SYNC_THRESHOLD && m_offset > -SYNC_THRESHOLD;
+  }
+
+  int64_t step() const
+  {
+    return m_step;
+  }
+
+  int32_t ppb() const
+  {
+    return m_ppb;
+  }
+
+  int64_t offset() const
+  {
+    return m_offset;
+  }
+
+  int64_t delay() const
+  {
+    return m_delay;
+  }
+
+  uint32_t samples() const
+  {
+    return m_samples;
+  }
+
+  uint32_t outliers() const
+  {
+    return m_outliers;
+  }
+};
+} /* namespace ptp */
+} /* namespace protocol */
+} /* namespace OwO */
+
+#endif /* __PTP_SERVO_HPP__ */
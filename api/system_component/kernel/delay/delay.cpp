@@ -0,0 +1,219 @@
+/**
+ * @file      delay.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for precise delay (精确延时: 短间隔忙等待, 长间隔硬件单次定时让出CPU)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "delay.hpp"
+
+using namespace OwO;
+using namespace system;
+using namespace kernel;
+
+Delay_Clock             Delay::s_clock;
+Delay_Core<Delay_Clock> Delay::s_core(Delay::s_clock);
+Mutex*                  Delay::s_lock = nullptr;
+
+/**
+ * @brief (静态) 精确延时 单次定时到期中断回调 (停止定时器, 释放信号量唤醒等待线程)
+ *
+ * @param arg 目标板时钟
+ */
+void Delay_Clock::timer_entry(void* arg)
+{
+  Delay_Clock* clock = static_cast<Delay_Clock*>(arg);
+  if (nullptr == clock || nullptr == clock->m_done)
+    return;
+
+  e_port_timer_stop(clock->m_timer_num);
+  clock->m_done->release();
+}
+
+/**
+ * @brief 精确延时 目标板时钟 打开 (定时器按1MHz计数)
+ *
+ * @param  timer_num  定时器编号
+ * @return bool       成功返回true
+ */
+bool Delay_Clock::open(uint8_t timer_num)
+{
+  if (is_open())
+    return false;
+
+  uint32_t clock = ul_port_timer_get_clock(timer_num);
+  if (clock < 1000000)
+    return false;
+
+  port_timer_callback_t cb_t;
+  cb_t.function = timer_entry;
+  cb_t.arg      = static_cast<void*>(this);
+
+  m_done        = new Semaphore(1, 0);
+  if (SUCESS != e_port_timer_normal_init(timer_num, static_cast<uint16_t>(clock / 1000000 - 1), 0xFFFF, PORT_TIMER_UP, 1, &cb_t))
+  {
+    delete m_done;
+    m_done = nullptr;
+    return false;
+  }
+
+  m_timer_num = timer_num;
+  return true;
+}
+
+/**
+ * @brief 精确延时 目标板时钟 关闭
+ *
+ */
+void Delay_Clock::close()
+{
+  if (!is_open())
+    return;
+
+  e_port_timer_stop(m_timer_num);
+  e_port_timer_deinit(m_timer_num);
+  delete m_done;
+  m_done      = nullptr;
+  m_timer_num = 0;
+}
+
+/**
+ * @brief 精确延时 目标板时钟 启动单次定时 (计数器清零后开始计数, 到期中断中停止)
+ *
+ * @param  us    定时时长(us, 1 ~ 65536)
+ * @return bool  成功返回true
+ */
+bool Delay_Clock::arm(uint32_t us)
+{
+  if (!is_open() || 0 == us || us > 0x10000)
+    return false;
+
+  if (SUCESS != e_port_timer_set_autoreload(m_timer_num, us - 1))
+    return false;
+
+  /* 装载自动重装载值并清零计数器 (不触发更新中断) */
+  if (SUCESS != e_port_timer_generate_update(m_timer_num))
+    return false;
+
+  return SUCESS == e_port_timer_start(m_timer_num);
+}
+
+/**
+ * @brief 精确延时 目标板时钟 等待单次定时到期
+ *
+ * @param  ms    超时时间(ms)
+ * @return bool  到期返回true, 超时返回false
+ */
+bool Delay_Clock::wait(uint32_t ms)
+{
+  if (!is_open())
+    return false;
+
+  return m_done->try_acquire(ms);
+}
+
+/**
+ * @brief 精确延时 目标板时钟 取消单次定时 (清除可能已释放的到期信号量)
+ *
+ */
+void Delay_Clock::cancel()
+{
+  if (!is_open())
+    return;
+
+  e_port_timer_stop(m_timer_num);
+  m_done->try_acquire();
+}
+
+/**
+ * @brief 精确延时 打开 (占用一个基本定时器供 sleep_us 使用)
+ *
+ * @param  timer_num  定时器编号
+ * @return bool       成功返回true
+ */
+bool Delay::open(uint8_t timer_num)
+{
+  if (nullptr != s_lock)
+    return false;
+
+  if (!s_clock.open(timer_num))
+    return false;
+
+  s_lock = new Mutex();
+  return true;
+}
+
+/**
+ * @brief 精确延时 关闭
+ *
+ */
+void Delay::close()
+{
+  if (nullptr == s_lock)
+    return;
+
+  s_lock->lock();
+  s_clock.close();
+  s_lock->unlock();
+  delete s_lock;
+  s_lock = nullptr;
+}
+
+/**
+ * @brief 精确延时 阻塞延时 (单次定时期间让出CPU; 20us以下或定时失败时忙等待; 多线程同时调用时依次占用定时器)
+ *
+ * @param  us    延时时间(us)
+ * @return bool  使用单次定时返回true, 回退为忙等待返回false
+ */
+bool Delay::sleep_us(uint32_t us)
+{
+  if (us <= Delay_Core<Delay_Clock>::SPIN_LIMIT)
+  {
+    spin_us(us);
+    return false;
+  }
+
+  /* 未打开时按原方式延时 (忙等待期间让出CPU) */
+  if (nullptr == s_lock)
+  {
+    v_port_system_delay_us(us);
+    return false;
+  }
+
+  Mutex_Guard guard(*s_lock);
+  return s_core.sleep_us(us);
+}
+
+/**
+ * @brief 精确延时 阻塞至指定时刻 (剩余20us以下时忙等待; 等待定时器占用的时间计入延时, 不推迟目标时刻)
+ *
+ * @param  deadline  目标时刻(CPU周期计数)
+ * @return bool      使用单次定时返回true, 回退为忙等待返回false
+ */
+bool Delay::sleep_until(uint32_t deadline)
+{
+  uint32_t now = ul_port_system_get_cycles();
+  if (Delay_Core<Delay_Clock>::expired(now, deadline))
+    return false;
+
+  uint32_t left = (deadline - now) / s_clock.cycles_per_us();
+  if (left <= Delay_Core<Delay_Clock>::SPIN_LIMIT)
+  {
+    s_core.spin_until(deadline);
+    return false;
+  }
+
+  /* 未打开时按原方式延时 (忙等待期间让出CPU), 最后一段忙等待至目标时刻 */
+  if (nullptr == s_lock)
+  {
+    v_port_system_delay_us(left - Delay_Core<Delay_Clock>::SPIN_LIMIT);
+    s_core.spin_until(deadline);
+    return false;
+  }
+
+  Mutex_Guard guard(*s_lock);
+  return s_core.sleep_until(deadline);
+}
@@ -0,0 +1,115 @@
+/**
+ * @file      delay.hpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for precise delay (精确延时: 短间隔忙等待, 长间隔硬件单次定时让出CPU)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#ifndef __DELAY_HPP__
+#define __DELAY_HPP__
+
+#include "port_tim.h"
+#include "port_system.h"
+#include "mutex.hpp"
+#include "semaphore.hpp"
+#include "delay_core.hpp"
+
+/// @brief Delay 默认单次定时器 (TIM7 基本定时器)
+#define DELAY_DEF_TIMER_NUM 7
+
+/// @brief 名称空间 库名
+namespace OwO
+{
+/// @brief 名称空间 基础元素
+namespace system
+{
+/// @brief 名称空间 系统接口
+namespace kernel
+{
+/// @brief 类 精确延时 目标板时钟 (CPU周期计数 + 1MHz计数的硬件单次定时器, 到期中断释放信号量唤醒等待线程)
+class Delay_Clock
+{
+  O_MEMORY
+
+private:
+  /// @brief 定时器编号 (0为未打开)
+  uint8_t    m_timer_num;
+  /// @brief 到期信号量
+  Semaphore* m_done;
+
+  static void timer_entry(void* arg);
+
+public:
+  Delay_Clock() : m_timer_num(0), m_done(nullptr) {}
+
+  bool open(uint8_t timer_num);
+  void close();
+
+  bool is_open() const
+  {
+    return 0 != m_timer_num;
+  }
+
+  uint32_t cycles() const
+  {
+    return ul_port_system_get_cycles();
+  }
+
+  uint32_t cycles_per_us() const
+  {
+    return ul_port_system_get_clock() / 1000000;
+  }
+
+  bool arm(uint32_t us);
+  bool wait(uint32_t ms);
+  void cancel();
+
+  ~Delay_Clock()
+  {
+    close();
+  }
+};
+
+/// @brief 类 精确延时 -- 调用者按间隔显式选择: spin_us/spin_until 忙等待 (不让出CPU, 用于20us以下), sleep_us/sleep_until 硬件单次定时 (让出CPU)
+class Delay
+{
+private:
+  static Delay_Clock             s_clock;
+  static Delay_Core<Delay_Clock> s_core;
+  static Mutex*                  s_lock;
+
+public:
+  static bool open(uint8_t timer_num = DELAY_DEF_TIMER_NUM);
+  static void close();
+
+  /**
+   * @brief 精确延时 忙等待延时 (不让出CPU, 周期精度)
+   *
+   * @param us 延时时间(us)
+   */
+  static void spin_us(uint32_t us)
+  {
+    v_port_system_spin_us(us);
+  }
+
+  /**
+   * @brief 精确延时 忙等待至指定时刻 (不让出CPU, 周期精度, 计数器回绕安全)
+   *
+   * @param deadline 目标时刻(CPU周期计数)
+   */
+  static void spin_until(uint32_t deadline)
+  {
+    v_port_system_spin_until(deadline);
+  }
+
+  static bool sleep_us(uint32_t us);
+  static bool sleep_until(uint32_t deadline);
+};
+} /* namespace kernel */
+} /* namespace system */
+} /* namespace OwO */
+
+#endif /* __DELAY_HPP__ */
@@ -0,0 +1,157 @@
+/**
+ * @file      delay_core.hpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library API for precise delay timing core (精确延时 计时核心)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#ifndef __DELAY_CORE_HPP__
+#define __DELAY_CORE_HPP__
+
+#include <stdint.h>
+
+/// @brief 名称空间 库名
+namespace OwO
+{
+/// @brief 名称空间 基础元素
+namespace system
+{
+/// @brief 名称空间 系统接口
+namespace kernel
+{
+/**
+ * @brief 类 精确延时 计时核心 (不依赖硬件, 时钟由模板参数注入)
+ *
+ * 时钟类需提供:
+ *   uint32_t cycles()          当前周期计数 (回绕计数)
+ *   uint32_t cycles_per_us()   每微秒周期数
+ *   bool     arm(uint32_t us)  启动单次定时 (1 ~ MAX_SHOT us), 失败返回false
+ *   bool     wait(uint32_t ms) 阻塞等待单次定时到期, 超时返回false
+ *   void     cancel()          取消单次定时
+ *
+ * @tparam Clock 时钟类
+ */
+template <typename Clock>
+class Delay_Core
+{
+public:
+  /// @brief 忙等待上限(us) -- 短于此的间隔不让出CPU; 长间隔最后这段同样忙等待, 吸收唤醒延迟
+  static constexpr uint32_t SPIN_LIMIT = 20;
+  /// @brief 单次定时上限(us) (16位定时器, 1MHz计数)
+  static constexpr uint32_t MAX_SHOT   = 65536;
+  /// @brief 延时上限(us) (周期计数差按有符号比较, 超出按上限)
+  static constexpr uint32_t MAX_DELAY  = 10000000;
+
+private:
+  Clock& m_clock;
+
+public:
+  explicit Delay_Core(Clock& clock) : m_clock(clock) {}
+
+  /**
+   * @brief 精确延时 是否到达指定时刻 (周期计数回绕安全)
+   *
+   * @param  now       当前时刻(周期计数)
+   * @param  deadline  目标时刻(周期计数)
+   * @return bool      到达返回true
+   */
+  static bool expired(uint32_t now, uint32_t deadline)
+  {
+    return static_cast<int32_t>(now - deadline) >= 0;
+  }
+
+  /**
+   * @brief 精确延时 计算从当前起指定时长后的时刻
+   *
+   * @param  us        时长(us)
+   * @return uint32_t  目标时刻(周期计数)
+   */
+  uint32_t deadline(uint32_t us)
+  {
+    if (us > MAX_DELAY)
+      us = MAX_DELAY;
+    return m_clock.cycles() + us * m_clock.cycles_per_us();
+  }
+
+  /**
+   * @brief 精确延时 忙等待至指定时刻 (不让出CPU)
+   *
+   * @param deadline 目标时刻(周期计数)
+   */
+  void spin_until(uint32_t deadline)
+  {
+    while (!expired(m_clock.cycles(), deadline))
+    {
+    }
+  }
+
+  /**
+   * @brief 精确延时 忙等待延时 (不让出CPU)
+   *
+   * @param us 延时时间(us)
+   */
+  void spin_us(uint32_t us)
+  {
+    spin_until(deadline(us));
+  }
+
+  /**
+   * @brief 精确延时 阻塞延时 (单次定时期间让出CPU, 最后 SPIN_LIMIT us 忙等待至目标时刻; 定时失败时忙等待完成)
+   *
+   * @param  us    延时时间(us)
+   * @return bool  全程使用单次定时返回true, 回退为忙等待返回false
+   */
+  bool sleep_us(uint32_t us)
+  {
+    return sleep_until(deadline(us));
+  }
+
+  /**
+   * @brief 精确延时 阻塞至指定时刻 (同 sleep_us, 按绝对时刻计算, 调用前的延迟不累计; 已过期时立即返回)
+   *
+   * @param  end   目标时刻(周期计数)
+   * @return bool  全程使用单次定时返回true, 回退为忙等待返回false
+   */
+  bool sleep_until(uint32_t end)
+  {
+    while (true)
+    {
+      uint32_t now = m_clock.cycles();
+      if (expired(now, end))
+        return true;
+
+      uint32_t left = (end - now) / m_clock.cycles_per_us();
+      if (left <= SPIN_LIMIT)
+      {
+        spin_until(end);
+        return true;
+      }
+
+      uint32_t shot = left - SPIN_LIMIT;
+      if (shot > MAX_SHOT)
+        shot = MAX_SHOT;
+
+      if (!m_clock.arm(shot))
+      {
+        spin_until(end);
+        return false;
+      }
+
+      /* 等待超时(定时器未触发)时取消定时, 避免迟到的到期事件影响下一次延时 */
+      if (!m_clock.wait(shot / 1000 + 2))
+      {
+        m_clock.cancel();
+        spin_until(end);
+        return false;
+      }
+    }
+  }
+};
+} /* namespace kernel */
+} /* namespace system */
+} /* namespace OwO */
+
+#endif /* __DELAY_CORE_HPP__ */
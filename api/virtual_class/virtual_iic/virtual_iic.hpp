@@ -2,6 +2,7 @@
 #define __VIRTUAL_IIC_HPP__
 
 #include "thread.hpp"
+#include "delay.hpp"
 #include "ioport.hpp"
 #include "virtual_gpio.hpp"
 
@@ -26,7 +27,8 @@ private:
 private:
   void clk_delay()
   {
-    system::kernel::Thread::usleep(m_clk_time);
+    /* 时钟半周期仅数微秒, 忙等待不让出CPU, 避免调度打乱时序 */
+    system::kernel::Delay::spin_us(m_clk_time);
   }
 
   void byte_delay(uint32_t time)
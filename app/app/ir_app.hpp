@@ -4,6 +4,24 @@
 #include "modbus_server.hpp"
 #include "rom.hpp"
 #include "ir.hpp"
+#include "ir_scheduler.hpp"
+#include "ir_wave.hpp"
+#include "ir_receiver.hpp"
+#include "ir_raw.hpp"
+#include "ir_ac.hpp"
+#include "ir_library.hpp"
+#include "ir_macro.hpp"
+#include "ir_decoder.hpp"
+#include "ir_text.hpp"
+#include "ir_stats.hpp"
+#include "nor_flash.hpp"
+#include "delay.hpp"
+#include "ptp.hpp"
+
+/// @brief IR 使用 GPIO 波形引擎输出全部通道 (1: 单定时器 DMA 写 BSRR, 0: TIM1/TIM8 硬件载波)
+#ifndef IR_APP_WAVE_ENGINE
+#define IR_APP_WAVE_ENGINE 0
+#endif
 
 namespace OwO
 {
@@ -16,44 +34,198 @@ class ir_app : public system::kernel::Thread
   NO_COPY(ir_app)
   NO_MOVE(ir_app)
 private:
+  /// @brief 硬件载波发送中的帧
+  struct ir_flight_t
+  {
+    device::IR_Carrier* carrier; /* 硬件载波 */
+    uint8_t             mask;    /* 发送中的通道掩码 */
+    uint32_t            start;   /* 开始时刻(ms) */
+    uint32_t            timeout; /* 超时时间(ms) */
+  };
+
+  /// @brief 发送校验中的帧 (学习接收引脚接收发送的信号, 解码后与请求数据比较)
+  struct ir_verify_t
+  {
+    uint8_t         channel;                         /* 校验中的通道 (CHANNEL_COUNT 为空闲) */
+    device::ir_type type;                            /* 红外遥控品牌类型 */
+    uint8_t         length;                          /* 指令长度 */
+    uint8_t         retries;                         /* 校验失败时的剩余重发次数 */
+    uint8_t         priority;                        /* 重发任务的优先级 */
+    uint8_t         data[device::IR_AC::MAX_LENGTH]; /* 请求的指令数据 */
+  };
+
+  /// @brief 任务来源 (各来源的优先级寄存器下标)
+  enum ir_source_e : uint8_t
+  {
+    SOURCE_SEND,    /* 寄存器指令 */
+    SOURCE_AC,      /* 空调状态指令 */
+    SOURCE_RAW,     /* 原始时序 */
+    SOURCE_LEARN,   /* 学习结果重放 */
+    SOURCE_LIBRARY, /* 指令库按编号发送 */
+    SOURCE_MACRO,   /* 宏指令步骤 */
+    SOURCE_COUNT,
+  };
+
+  /// @brief 定时发射状态
+  enum ir_fire_status_e : uint16_t
+  {
+    FIRE_IDLE,      /* 未设置发射时刻 */
+    FIRE_ARMED,     /* 已设置发射时刻, 此后提交的任务在该时刻发送 */
+    FIRE_SCHEDULED, /* 已提交定时任务 */
+    FIRE_UNSYNCED,  /* 网络时间未同步, 任务被拒绝 */
+    FIRE_LATE,      /* 发射时刻已过或超出 ir_fire_max_wait, 任务被拒绝 */
+  };
+
+  /// @brief 通道引脚
+  struct ir_pin_t
+  {
+    Gpio::Port port;
+    uint8_t    pin;
+  };
+
   protocol::modbus::Register& holding_register;
+  protocol::modbus::Register& input_register;
   rom&                        eeprom;
 
-  device::IR& ir_1;
-  device::IR& ir_2;
-  device::IR& ir_3;
-  device::IR& ir_4;
-  device::IR& ir_5;
-  device::IR& ir_6;
-  device::IR& ir_7;
-  device::IR& ir_8;
-
-  bool    m_addvance_flag = false;
-  bool    m_refresh_flag  = false;
-  uint8_t ir_channel;
-  uint8_t ir_data_count;
-  uint8_t ir_data_len;
-  char    ir_data[30];
+  device::IR*                 ir_channels[device::IR_Scheduler::CHANNEL_COUNT];
+  device::IR_Scheduler        scheduler;
+  system::kernel::Semaphore   m_event;
+  ir_flight_t                 m_flights[2]    = {};
+#if IR_APP_WAVE_ENGINE
+  device::IR_Wave             m_wave;
+  ir_flight_t                 m_wave_flight   = {};
+#endif
+  device::IR_Receiver         m_receiver;
+  uint16_t                    m_raw_regs[device::IR_Raw::BLOCK_SIZE];
+  device::ir_pulse_t          m_raw_pulses[device::IR_Raw::MAX_PULSES];
+  device::ir_raw_header_t     m_raw_header    = {};
+  uint16_t                    m_raw_count     = 0;
+  uint8_t                     m_ac_data[device::IR_AC::MAX_LENGTH];
+  device::Nor_Flash*          m_nor_flash;
+  device::IR_Library          m_library;
+  device::ir_pulse_t          m_library_pulses[device::IR_Library::MAX_PULSES];
+  device::IR_Macro            m_macro;
+  device::IR_Macro::macro_t   m_macro_steps;
+  uint16_t                    m_macro_regs[device::IR_Macro::BLOCK_SIZE];
+  bool                        m_macro_blocked = false;
+  ir_verify_t                 m_verify        = { device::IR_Scheduler::CHANNEL_COUNT };
+  uint16_t                    m_verify_errors[device::IR_Scheduler::CHANNEL_COUNT];
+  uint8_t                     m_prepared      = 0;
+  uint16_t                    m_preemptions   = 0;
+  device::IR_Text             m_text;
+  device::ir_pulse_t          m_text_pulses[device::IR_Library::MAX_PULSES];
+  uint16_t                    m_text_accepted = 0;
+  uint16_t                    m_text_rejected = 0;
+  device::IR_Stats            m_stats;
+  protocol::ptp::Ptp*         m_sync;
+  uint64_t                    m_fire_at[device::IR_Scheduler::CHANNEL_COUNT] = {};
+  uint64_t                    m_fire_last                                    = 0;
+  uint16_t                    m_fire_status                                  = FIRE_IDLE;
+
+  bool                        m_addvance_flag = false;
+  bool                        m_refresh_flag  = false;
+  uint8_t                     ir_channel;
+  uint8_t                     ir_data_count;
+  uint8_t                     ir_data_len;
+  char                        ir_data[30];
 
   static constexpr inline uint16_t ir_holding_reg_start_addr = 23;
+  static constexpr inline uint16_t ir_input_reg_start_addr   = 13;
+  static constexpr inline uint16_t ir_ac_reg_start_addr      = 56;
+  static constexpr inline uint16_t ir_raw_reg_start_addr     = 60;
+  static constexpr inline uint16_t ir_library_reg_start_addr = 183;
+  static constexpr inline uint8_t  ir_library_spi            = 1;
+  static constexpr inline ir_pin_t ir_library_cs_pin         = { Gpio::PA, 4 };
+  static constexpr inline uint32_t ir_library_size           = device::IR_Library::MAX_CODES * device::IR_Library::SLOT_SIZE;
+  static constexpr inline uint16_t ir_macro_reg_start_addr   = 193;
+  static constexpr inline uint32_t ir_macro_base             = ir_library_size;
+  static constexpr inline uint16_t ir_timing_reg_start_addr  = 31;
+  static constexpr inline uint16_t ir_timing_clear_addr      = 308;
+  static constexpr inline uint16_t ir_verify_enable_addr     = 309;
+  static constexpr inline uint16_t ir_verify_reg_start_addr  = 151;
+  static constexpr inline uint16_t ir_priority_start_addr    = 310;
+  static constexpr inline uint16_t ir_preempt_policy_addr    = ir_priority_start_addr + SOURCE_COUNT;
+  static constexpr inline uint16_t ir_preempt_reg_start_addr = 161;
+  static constexpr inline uint16_t ir_text_reg_start_addr    = 317;
+  static constexpr inline uint16_t ir_text_input_start_addr  = 163;
+  static constexpr inline uint16_t ir_text_max_length        = (device::IR_Raw::BLOCK_SIZE - 3) * 2;
+  static constexpr inline uint16_t ir_stats_clear_addr       = 440;
+  static constexpr inline uint16_t ir_stats_reg_start_addr   = 170;
+  static constexpr inline uint16_t ir_sync_role_addr         = 441;
+  static constexpr inline uint16_t ir_sync_domain_addr       = 442;
+  static constexpr inline uint16_t ir_fire_time_addr         = 443;
+  static constexpr inline uint16_t ir_sync_reg_start_addr    = 282;
+  static constexpr inline uint32_t ir_fire_max_wait          = 3600000;
+  static constexpr inline uint32_t ir_fire_align_limit       = 2000;
+  static constexpr inline uint32_t ir_verify_timeout         = 1000;
+  static constexpr inline uint32_t ir_poll_time              = 10;
+  static constexpr inline uint32_t ir_learn_timeout          = 10000;
+  /* 线程栈(字): 最深调用链为 调度合并发送(包络编译) 与 宏/码库经 Nor Flash 读写, 静态分析约 0.94KB, 加内核/HAL 调用与 FPU 上下文约 1.4KB, 余量约 0.6KB */
+  static constexpr inline uint16_t ir_thread_stack_size      = 512;
+  static constexpr inline ir_pin_t ir_learn_pin              = { Gpio::PA, 15 };
+  static constexpr inline ir_pin_t ir_pins[]                 = {
+    { Gpio::PA, 11 },
+    { Gpio::PA, 10 },
+    { Gpio::PA, 9 },
+    { Gpio::PA, 8 },
+    { Gpio::PC, 9 },
+    { Gpio::PC, 8 },
+    { Gpio::PC, 7 },
+    { Gpio::PC, 6 },
+  };
 
 protected:
   virtual void event_loop() override
   {
     process();
-    msleep(eeprom().ir.flash_time);
+    process_ac();
+    process_raw();
+    learn();
+    process_library();
+    process_text();
+    process_macro();
+    dispatch();
+    verify();
+    report();
+
+    /* 等待发送完成通知、最近的帧间延时或宏步骤到期 (宏步骤因通道忙推迟时等待发送完成通知) */
+    uint32_t now   = ul_port_os_get_tick_count();
+    uint32_t wait  = scheduler.next_wakeup(now);
+    uint32_t macro = m_macro.next_wakeup(now);
+    if (macro < wait && !m_macro_blocked)
+      wait = macro;
+    m_event.try_acquire(wait < ir_poll_time ? wait : ir_poll_time);
+  }
+
+  bool channel_enable(uint8_t index)
+  {
+    switch (index)
+    {
+      case 0 :
+        return eeprom().ir.channel_01_enable;
+      case 1 :
+        return eeprom().ir.channel_02_enable;
+      case 2 :
+        return eeprom().ir.channel_03_enable;
+      case 3 :
+        return eeprom().ir.channel_04_enable;
+      case 4 :
+        return eeprom().ir.channel_05_enable;
+      case 5 :
+        return eeprom().ir.channel_06_enable;
+      case 6 :
+        return eeprom().ir.channel_07_enable;
+      case 7 :
+        return eeprom().ir.channel_08_enable;
+      default :
+        return false;
+    }
   }
 
   void set_channel_pulse(uint8_t pulse)
   {
-    ir_1.set_pulse_width(pulse);
-    ir_2.set_pulse_width(pulse);
-    ir_3.set_pulse_width(pulse);
-    ir_4.set_pulse_width(pulse);
-    ir_5.set_pulse_width(pulse);
-    ir_6.set_pulse_width(pulse);
-    ir_7.set_pulse_width(pulse);
-    ir_8.set_pulse_width(pulse);
+    for (device::IR* channel : ir_channels)
+      channel->set_pulse_width(pulse);
   }
 
   void process_addvance()
@@ -173,6 +345,128 @@ protected:
     }
   }
 
+  uint8_t priority(ir_source_e source)
+  {
+    uint16_t value = holding_register[ir_priority_start_addr + source];
+    return static_cast<uint8_t>((value > 0xFF) ? 0xFF : value);
+  }
+
+  bool claim(uint8_t index, uint8_t priority)
+  {
+    /* 通道空闲, 或当前任务优先级更低且处于帧间: 抢占当前任务, 按策略挂起(抢占任务结束后恢复)或丢弃其时序 */
+    if (!scheduler.admit(index, priority))
+      return false;
+
+    if (!scheduler.is_busy(index))
+      return true;
+
+    device::ir_preempt_policy policy = (0 != holding_register[ir_preempt_policy_addr]) ? device::ir_preempt_policy::DROP : device::ir_preempt_policy::RESUME;
+    if (scheduler.preempt(index, policy))
+      ir_channels[index]->suspend();
+    else
+      ir_channels[index]->release();
+
+    /* 被抢占任务的发送校验不再有效; 挂起的定时任务恢复后按本地时刻发送 */
+    if (index == m_verify.channel)
+      m_verify.channel = device::IR_Scheduler::CHANNEL_COUNT;
+    m_fire_at[index] = 0;
+
+    if (m_preemptions < 0xFFFF)
+      m_preemptions++;
+    return true;
+  }
+
+  uint64_t fire_time()
+  {
+    /* 网络发射时刻(ms), 0为未设置 */
+    uint64_t fire = 0;
+    return holding_register.get(fire, ir_fire_time_addr);
+  }
+
+  bool submit(uint8_t index, uint8_t count, uint32_t now, uint8_t priority)
+  {
+    /* 已设置网络发射时刻: 换算为本地时刻提交定时任务, 首帧开始前对齐网络时间 (触发时刻在对齐后记录) */
+    uint64_t fire = fire_time() * 1000000;
+    if (0 != fire)
+    {
+      uint64_t network;
+      if (!m_sync->now(network))
+      {
+        m_fire_status = FIRE_UNSYNCED;
+        return false;
+      }
+
+      if (fire <= network || fire - network > static_cast<uint64_t>(ir_fire_max_wait) * 1000000)
+      {
+        m_fire_status = FIRE_LATE;
+        return false;
+      }
+
+      if (!scheduler.submit_at(index, count, eeprom().ir.flash_time, now + static_cast<uint32_t>((fire - network) / 1000000), priority))
+        return false;
+
+      m_fire_at[index] = fire;
+      m_fire_status    = FIRE_SCHEDULED;
+      return true;
+    }
+
+    /* 提交成功时记录触发时刻, 首帧开始时统计触发延迟 */
+    if (!scheduler.submit(index, count, eeprom().ir.flash_time, now, priority))
+      return false;
+
+    m_fire_at[index] = 0;
+    m_stats.trigger(index, ul_port_system_get_cycles(), now);
+    return true;
+  }
+
+  void align(uint8_t due)
+  {
+    /* 定时任务: 本地时刻按ms向下取整, 到期后等待至网络发射时刻 (同一帧的通道按最晚时刻) */
+    uint64_t target = 0;
+    uint8_t  timed  = 0;
+    for (uint8_t i = 0; i < device::IR_Scheduler::CHANNEL_COUNT; i++)
+    {
+      if (!(due & (1U << i)) || 0 == m_fire_at[i])
+        continue;
+
+      timed |= (1U << i);
+      if (m_fire_at[i] > target)
+        target = m_fire_at[i];
+      m_fire_at[i] = 0;
+    }
+
+    if (0 == timed)
+      return;
+
+    uint64_t network;
+    if (m_sync->now(network) && target > network && target - network <= static_cast<uint64_t>(ir_fire_align_limit) * 1000)
+      system::kernel::Delay::sleep_us(static_cast<uint32_t>((target - network) / 1000));
+
+    uint32_t cycles = ul_port_system_get_cycles();
+    uint32_t now    = ul_port_os_get_tick_count();
+    for (uint8_t i = 0; i < device::IR_Scheduler::CHANNEL_COUNT; i++)
+    {
+      if (timed & (1U << i))
+        m_stats.trigger(i, cycles, now);
+    }
+  }
+
+  void started(uint8_t mask, uint32_t cycles, uint32_t now)
+  {
+    uint32_t clock = ul_port_system_get_clock();
+    for (uint8_t i = 0; i < device::IR_Scheduler::CHANNEL_COUNT; i++)
+    {
+      if (mask & (1U << i))
+        m_stats.start(i, cycles, now, clock);
+    }
+  }
+
+  void complete(uint8_t index, bool success, uint32_t now)
+  {
+    m_stats.complete(index, success, ir_channels[index]->timeline().duration());
+    scheduler.complete(index, success, now);
+  }
+
   void process()
   {
     if (true == eeprom.get_addvance_flag() || true == m_addvance_flag)
@@ -187,22 +481,20 @@ protected:
       holding_register.get(ir_data_len, ir_holding_reg_start_addr + 2);
       holding_register.get(ir_data, 30, ir_holding_reg_start_addr + 4);
 
-      if (ir_channel == 1)
-        ir_1.send(static_cast<device::ir_type>(eeprom().ir.type), ir_data, ir_data_len, ir_data_count, eeprom().ir.flash_time);
-      else if (ir_channel == 2)
-        ir_2.send(static_cast<device::ir_type>(eeprom().ir.type), ir_data, ir_data_len, ir_data_count, eeprom().ir.flash_time);
-      else if (ir_channel == 3)
-        ir_3.send(static_cast<device::ir_type>(eeprom().ir.type), ir_data, ir_data_len, ir_data_count, eeprom().ir.flash_time);
-      else if (ir_channel == 4)
-        ir_4.send(static_cast<device::ir_type>(eeprom().ir.type), ir_data, ir_data_len, ir_data_count, eeprom().ir.flash_time);
-      else if (ir_channel == 5)
-        ir_5.send(static_cast<device::ir_type>(eeprom().ir.type), ir_data, ir_data_len, ir_data_count, eeprom().ir.flash_time);
-      else if (ir_channel == 6)
-        ir_6.send(static_cast<device::ir_type>(eeprom().ir.type), ir_data, ir_data_len, ir_data_count, eeprom().ir.flash_time);
-      else if (ir_channel == 7)
-        ir_7.send(static_cast<device::ir_type>(eeprom().ir.type), ir_data, ir_data_len, ir_data_count, eeprom().ir.flash_time);
-      else if (ir_channel == 8)
-        ir_8.send(static_cast<device::ir_type>(eeprom().ir.type), ir_data, ir_data_len, ir_data_count, eeprom().ir.flash_time);
+      /* 通道上一任务未结束且不可抢占: 保留触发标志, 下一周期重试 */
+      uint8_t index = ir_channel - 1;
+      uint8_t level = priority(SOURCE_SEND);
+      if (index < device::IR_Scheduler::CHANNEL_COUNT && !scheduler.admit(index, level))
+        return;
+
+      if (index < device::IR_Scheduler::CHANNEL_COUNT && claim(index, level) && ir_channels[index]->prepare(static_cast<device::ir_type>(eeprom().ir.type), ir_data, ir_data_len))
+      {
+        uint8_t repeat = verify_arm(index, static_cast<device::ir_type>(eeprom().ir.type), reinterpret_cast<const uint8_t*>(ir_data), ir_data_len, ir_data_count, level);
+        if (submit(index, repeat, ul_port_os_get_tick_count(), level))
+          m_prepared |= (1U << index);
+        else
+          ir_channels[index]->release();
+      }
 
       if (eeprom().ir.auto_clean_flag)
       {
@@ -217,65 +509,862 @@ protected:
     }
   }
 
-public:
-  ir_app(const std::string& name, Object* parent, protocol::modbus::Register& holding_register, rom& eeprom) : system::kernel::Thread(name, parent), holding_register(holding_register), eeprom(eeprom), ir_1(*new device::IR("IR1", this)), ir_2(*new device::IR("IR2", this)), ir_3(*new device::IR("IR3", this)), ir_4(*new device::IR("IR4", this)), ir_5(*new device::IR("IR5", this)), ir_6(*new device::IR("IR6", this)), ir_7(*new device::IR("IR7", this)), ir_8(*new device::IR("IR8", this)) {}
+  static device::ir_ac_state_t ac_state(uint16_t flags, uint16_t temperature)
+  {
+    /* 0xPMFS: 开机/模式/风速/扫风 各4位 */
+    return device::ir_ac_state_t {
+      0 != ((flags >> 12) & 0x0F),
+      static_cast<device::ir_ac_mode>((flags >> 8) & 0x0F),
+      static_cast<device::ir_ac_fan>((flags >> 4) & 0x0F),
+      0 != (flags & 0x0F),
+      static_cast<uint8_t>((temperature > 0xFF) ? 0 : temperature),
+    };
+  }
 
-  void open()
+  void process_ac()
+  {
+    /* 空调状态指令: 通道掩码, 品牌, 0xPMFS (开机/模式/风速/扫风), 设定温度; 通道掩码非0即触发 */
+    uint16_t block[4] = {};
+    holding_register.get(block, 4, ir_ac_reg_start_addr);
+    if (0 == block[0])
+      return;
+
+    /* 通道上一任务未结束且不可抢占: 保留指令, 下一周期重试 */
+    uint8_t level = priority(SOURCE_AC);
+    for (uint8_t i = 0; i < device::IR_Scheduler::CHANNEL_COUNT; i++)
+    {
+      if ((block[0] & (1U << i)) && !scheduler.admit(i, level))
+        return;
+    }
+
+    device::ir_ac_state_t state  = ac_state(block[2], block[3]);
+    device::ir_type       type   = static_cast<device::ir_type>(block[1]);
+    uint8_t               length = 0;
+    device::ir_ac_error   error  = device::IR_AC::build(type, state, m_ac_data, sizeof(m_ac_data), length);
+
+    if (device::ir_ac_error::NONE == error)
+    {
+      uint32_t now = ul_port_os_get_tick_count();
+      for (uint8_t i = 0; i < device::IR_Scheduler::CHANNEL_COUNT; i++)
+      {
+        if (!(block[0] & (1U << i)) || !claim(i, level) || !ir_channels[i]->prepare(type, reinterpret_cast<const char*>(m_ac_data), length))
+          continue;
+
+        if (submit(i, verify_arm(i, type, m_ac_data, length, 1, level), now, level))
+          m_prepared |= (1U << i);
+        else
+          ir_channels[i]->release();
+      }
+    }
+
+    input_register.set(static_cast<uint16_t>(error), ir_input_reg_start_addr + 12);
+    holding_register.clear(ir_ac_reg_start_addr);
+  }
+
+  void process_raw()
   {
-    if (eeprom().ir.channel_08_enable)
+    /* 原始时序: 单次写多个寄存器上传整个上传区, 通道掩码非0即触发 */
+    if (0 == holding_register[ir_raw_reg_start_addr])
+      return;
+
+    holding_register.get(m_raw_regs, device::IR_Raw::BLOCK_SIZE, ir_raw_reg_start_addr);
+
+    device::ir_raw_header_t header = {};
+    uint16_t                count  = 0;
+    device::ir_raw_error    error  = device::IR_Raw::parse(m_raw_regs, device::IR_Raw::BLOCK_SIZE, header, m_raw_pulses, device::IR_Raw::MAX_PULSES, count);
+
+    /* 保留最近一次校验通过的上传, 供指令库存储 */
+    m_raw_header = header;
+    m_raw_count  = count;
+
+    if (device::ir_raw_error::NONE == error)
     {
-      ir_8.open(Gpio::PC, 6, eeprom().ir.channel_pulse);
-      holding_register.set(8, ir_holding_reg_start_addr + 0);
+      /* 通道上一任务未结束且不可抢占: 保留上传区, 下一周期重试 */
+      uint8_t level = priority(SOURCE_RAW);
+      for (uint8_t i = 0; i < device::IR_Scheduler::CHANNEL_COUNT; i++)
+      {
+        if ((header.mask & (1U << i)) && !scheduler.admit(i, level))
+          return;
+      }
+
+      uint32_t now    = ul_port_os_get_tick_count();
+      uint8_t  repeat = (0 == header.count) ? 1 : static_cast<uint8_t>((header.count > 0xFF) ? 0xFF : header.count);
+      for (uint8_t i = 0; i < device::IR_Scheduler::CHANNEL_COUNT; i++)
+      {
+        if (!(header.mask & (1U << i)) || !claim(i, level) || !ir_channels[i]->prepare(m_raw_pulses, count, header.frequency, static_cast<uint8_t>(header.duty)))
+          continue;
+
+        if (submit(i, repeat, now, level))
+          m_prepared |= (1U << i);
+        else
+          ir_channels[i]->release();
+      }
     }
 
-    if (eeprom().ir.channel_07_enable)
+    input_register.set(static_cast<uint16_t>(error), ir_input_reg_start_addr + 11);
+    holding_register.clear(ir_raw_reg_start_addr);
+  }
+
+  uint16_t learned_carrier() const
+  {
+    /* 学习到的载波超出发送范围时返回0, 按默认载波重放/存储 */
+    uint32_t frequency = m_receiver.result().carrier();
+    if (frequency < device::IR_Library::MIN_FREQUENCY || frequency > device::IR_Library::MAX_FREQUENCY)
+      return 0;
+    return static_cast<uint16_t>(frequency);
+  }
+
+  void learn()
+  {
+    /* 学习: 接收引脚捕获一帧, 完成后可重放至指定通道 */
+    if (1 == holding_register[ir_holding_reg_start_addr + 31])
     {
-      ir_7.open(Gpio::PC, 7, eeprom().ir.channel_pulse);
-      holding_register.set(7, ir_holding_reg_start_addr + 0);
+      m_receiver.start(ir_learn_timeout);
+      holding_register.clear(ir_holding_reg_start_addr + 31);
     }
 
-    if (eeprom().ir.channel_06_enable)
+    device::IR_Receiver::state_e state = m_receiver.poll();
+
+    /* 重放: 接收完成后逐通道排队, 已排队的通道从掩码中清除; 仍在接收, 通道上一任务不可抢占或载入失败时保留, 下一周期重试 */
+    uint8_t mask = 0;
+    holding_register.get(mask, ir_holding_reg_start_addr + 32);
+    if (0 != mask && (device::IR_Receiver::IDLE == state || device::IR_Receiver::TIMEOUT == state))
+    {
+      /* 未在学习或学习超时: 没有可重放的时序 */
+      holding_register.clear(ir_holding_reg_start_addr + 32);
+    }
+    else if (0 != mask && device::IR_Receiver::DONE == state)
     {
-      ir_6.open(Gpio::PC, 8, eeprom().ir.channel_pulse);
-      holding_register.set(6, ir_holding_reg_start_addr + 0);
+      const device::IR_Learner& result    = m_receiver.result();
+      uint16_t                  frequency = learned_carrier();
+      uint32_t                  now       = ul_port_os_get_tick_count();
+      uint8_t                   level     = priority(SOURCE_LEARN);
+      uint8_t                   remain    = mask;
+      for (uint8_t i = 0; i < device::IR_Scheduler::CHANNEL_COUNT; i++)
+      {
+        if (!(mask & (1U << i)))
+          continue;
+
+        /* 通道未打开: 无法重放 */
+        if (!ir_channels[i]->is_open())
+        {
+          remain &= ~(1U << i);
+          continue;
+        }
+
+        if (!claim(i, level) || !ir_channels[i]->prepare(result.data(), result.size(), frequency))
+          continue;
+
+        if (submit(i, 1, now, level))
+        {
+          m_prepared |= (1U << i);
+          remain     &= ~(1U << i);
+        }
+        else
+          ir_channels[i]->release();
+      }
+
+      if (remain != mask)
+        holding_register.set(remain, ir_holding_reg_start_addr + 32);
     }
 
-    if (eeprom().ir.channel_05_enable)
+    input_register.set(static_cast<uint16_t>(state), ir_input_reg_start_addr + 7);
+    input_register.set(m_receiver.result().size(), ir_input_reg_start_addr + 8);
+    input_register.set(static_cast<uint16_t>(m_receiver.result().carrier()), ir_input_reg_start_addr + 9);
+    input_register.set(static_cast<uint16_t>(m_receiver.result().segments()), ir_input_reg_start_addr + 10);
+  }
+
+  void process_library()
+  {
+    /* 指令库管理: 指令编号, 操作 (1: 存储最近一次原始时序上传, 2: 存储学习结果, 3: 删除, 4: 清空); 操作非0即触发, 无可存储时序或操作无效返回 MISSING */
+    uint16_t block[2] = {};
+    holding_register.get(block, 2, ir_library_reg_start_addr + device::IR_Scheduler::CHANNEL_COUNT);
+    if (0 != block[1])
     {
-      ir_5.open(Gpio::PC, 9, eeprom().ir.channel_pulse);
-      holding_register.set(5, ir_holding_reg_start_addr + 0);
+      device::ir_library_error  error  = device::ir_library_error::MISSING;
+      const device::IR_Learner& result = m_receiver.result();
+      switch (block[1])
+      {
+        case 1 :
+          if (0 != m_raw_count)
+            error = m_library.store(block[0], m_raw_pulses, m_raw_count, m_raw_header.frequency, static_cast<uint8_t>(m_raw_header.duty));
+          break;
+        case 2 :
+          if (device::IR_Receiver::DONE == m_receiver.state())
+          {
+            error = m_library.store(block[0], result.data(), result.size(), learned_carrier());
+          }
+          break;
+        case 3 :
+          error = m_library.remove(block[0]);
+          break;
+        case 4 :
+          error = m_library.clear();
+          break;
+        default :
+          break;
+      }
+
+      input_register.set(static_cast<uint16_t>(error), ir_input_reg_start_addr + 13);
+      holding_register.clear(ir_library_reg_start_addr + device::IR_Scheduler::CHANNEL_COUNT, 2);
     }
 
-    if (eeprom().ir.channel_04_enable)
+    /* 按编号发送: 每个通道一个寄存器, 单次写单个寄存器(FC6)写入指令编号即触发 */
+    uint16_t ids[device::IR_Scheduler::CHANNEL_COUNT] = {};
+    holding_register.get(ids, device::IR_Scheduler::CHANNEL_COUNT, ir_library_reg_start_addr);
+
+    uint16_t                  loaded = 0;
+    device::ir_library_code_t code   = {};
+    uint32_t                  now    = ul_port_os_get_tick_count();
+    uint8_t                   level  = priority(SOURCE_LIBRARY);
+    for (uint8_t i = 0; i < device::IR_Scheduler::CHANNEL_COUNT; i++)
     {
-      ir_4.open(Gpio::PA, 8, eeprom().ir.channel_pulse);
-      holding_register.set(4, ir_holding_reg_start_addr + 0);
+      /* 通道上一任务未结束且不可抢占: 保留编号, 下一周期重试 */
+      if (0 == ids[i] || !claim(i, level))
+        continue;
+
+      /* 多个通道发送同一编号时只读取一次 */
+      device::ir_library_error error = device::ir_library_error::NONE;
+      if (ids[i] != loaded)
+      {
+        error  = m_library.load(ids[i], m_library_pulses, device::IR_Library::MAX_PULSES, code);
+        loaded = (device::ir_library_error::NONE == error) ? ids[i] : 0;
+      }
+
+      if (device::ir_library_error::NONE == error && ir_channels[i]->prepare(m_library_pulses, code.count, code.frequency, code.duty))
+      {
+        if (submit(i, 1, now, level))
+          m_prepared |= (1U << i);
+        else
+          ir_channels[i]->release();
+      }
+
+      input_register.set(static_cast<uint16_t>(error), ir_input_reg_start_addr + 13);
+      holding_register.clear(ir_library_reg_start_addr + i);
     }
 
-    if (eeprom().ir.channel_03_enable)
+    input_register.set(m_library.size(), ir_input_reg_start_addr + 14);
+  }
+
+  void text_line(bool store)
+  {
+    device::ir_text_error error = m_text.error();
+    if (device::ir_text_error::NONE != error)
     {
-      ir_3.open(Gpio::PA, 9, eeprom().ir.channel_pulse);
-      holding_register.set(3, ir_holding_reg_start_addr + 0);
+      if (m_text_rejected < 0xFFFF)
+        m_text_rejected++;
+      input_register.set(static_cast<uint16_t>(error), ir_text_input_start_addr + 0);
+      input_register.set(static_cast<uint16_t>(m_text.line()), ir_text_input_start_addr + 3);
+      m_text.next();
+      return;
     }
 
-    if (eeprom().ir.channel_02_enable)
+    if (m_text_accepted < 0xFFFF)
+      m_text_accepted++;
+    input_register.set(static_cast<uint16_t>(error), ir_text_input_start_addr + 0);
+    input_register.set(m_text.size(), ir_text_input_start_addr + 4);
+    input_register.set(static_cast<uint16_t>(m_text.frequency()), ir_text_input_start_addr + 5);
+
+    /* 行首未指定编号时使用下一指令编号寄存器, 存储后递增 */
+    if (store)
     {
-      ir_2.open(Gpio::PA, 10, eeprom().ir.channel_pulse);
-      holding_register.set(2, ir_holding_reg_start_addr + 0);
+      uint16_t id = m_text.id();
+      if (0 == id)
+      {
+        id = holding_register[ir_text_reg_start_addr + 2];
+        if (0 != id)
+          holding_register.set(static_cast<uint16_t>(id + 1), ir_text_reg_start_addr + 2);
+      }
+
+      device::ir_library_error result = m_library.store(id, m_text.data(), m_text.size(), static_cast<uint16_t>(m_text.frequency()));
+      input_register.set(static_cast<uint16_t>(result), ir_text_input_start_addr + 6);
     }
 
-    if (eeprom().ir.channel_01_enable)
+    m_text.next();
+  }
+
+  void process_text()
+  {
+    /* 文本导入: 字符数量, 操作 (0: 校验, 1: 校验并存入指令库, 2: 复位解析器), 下一指令编号, 文本 (每寄存器2个字符, 高字节在前) */
+    /* 字符数量非0即触发, 每行以换行符结束, 一行可跨多次上传 (上传区缓存与原始时序共用) */
+    uint16_t length = holding_register[ir_text_reg_start_addr];
+    if (0 == length)
+      return;
+
+    holding_register.get(m_raw_regs, device::IR_Raw::BLOCK_SIZE, ir_text_reg_start_addr);
+    if (2 == m_raw_regs[1])
     {
-      ir_1.open(Gpio::PA, 11, eeprom().ir.channel_pulse);
-      holding_register.set(1, ir_holding_reg_start_addr + 0);
+      m_text.reset(m_text_pulses, device::IR_Library::MAX_PULSES);
+      m_text_accepted = 0;
+      m_text_rejected = 0;
+    }
+    else
+    {
+      if (length > ir_text_max_length)
+        length = ir_text_max_length;
+
+      for (uint16_t i = 0; i < length; i += 2)
+      {
+        const uint16_t reg      = m_raw_regs[3 + i / 2];
+        const char     chars[2] = { static_cast<char>(reg >> 8), static_cast<char>(reg & 0xFF) };
+        const char*    text     = chars;
+        uint32_t       count    = (length - i < 2) ? 1 : 2;
+        while (0 != count)
+        {
+          uint32_t used  = m_text.feed(text, count);
+          text          += used;
+          count         -= used;
+          if (m_text.ready())
+            text_line(1 == m_raw_regs[1]);
+        }
+      }
+    }
+
+    input_register.set(m_text_accepted, ir_text_input_start_addr + 1);
+    input_register.set(m_text_rejected, ir_text_input_start_addr + 2);
+    holding_register.clear(ir_text_reg_start_addr);
+  }
+
+  bool macro_step(const device::ir_macro_step_t& step, uint32_t now)
+  {
+    /* 指令库指令读取时序, 空调状态指令生成指令数据; 各通道分别准备后提交发送一次 */
+    device::ir_library_code_t code   = {};
+    device::ir_type           type   = static_cast<device::ir_type>(step.args[0] >> 8);
+    uint8_t                   length = 0;
+    if (device::ir_macro_kind::CODE == step.kind)
+    {
+      if (device::ir_library_error::NONE != m_library.load(step.args[0], m_library_pulses, device::IR_Library::MAX_PULSES, code))
+        return false;
+    }
+    else if (device::ir_ac_error::NONE != device::IR_AC::build(type, ac_state(step.args[1], step.args[0] & 0xFF), m_ac_data, sizeof(m_ac_data), length))
+    {
+      return false;
+    }
+
+    uint8_t level = priority(SOURCE_MACRO);
+    for (uint8_t i = 0; i < device::IR_Scheduler::CHANNEL_COUNT; i++)
+    {
+      if (!(step.mask & (1U << i)) || !claim(i, level))
+        continue;
+
+      bool prepared = (device::ir_macro_kind::CODE == step.kind) ? ir_channels[i]->prepare(m_library_pulses, code.count, code.frequency, code.duty) : ir_channels[i]->prepare(type, reinterpret_cast<const char*>(m_ac_data), length);
+      if (!prepared)
+        continue;
+
+      if (submit(i, 1, now, level))
+        m_prepared |= (1U << i);
+      else
+        ir_channels[i]->release();
+    }
+    return true;
+  }
+
+  void process_macro()
+  {
+    device::ir_library_io_t io    = { library_read, library_write, m_nor_flash };
+    uint32_t                now   = ul_port_os_get_tick_count();
+    device::ir_macro_error  error = device::ir_macro_error::NONE;
+
+    /* 宏上传: 宏编号, 步骤数量, 步骤 (通道掩码 | 类型 << 8, 延时(ms), 参数0, 参数1); 单次写多个寄存器上传, 宏编号非0即触发, 校验通过后存入 NOR Flash */
+    if (0 != holding_register[ir_macro_reg_start_addr + 1])
+    {
+      uint16_t id = 0;
+      holding_register.get(m_macro_regs, device::IR_Macro::BLOCK_SIZE, ir_macro_reg_start_addr + 1);
+      error = device::IR_Macro::parse(m_macro_regs, device::IR_Macro::BLOCK_SIZE, id, m_macro_steps);
+      if (device::ir_macro_error::NONE == error)
+        error = m_library.is_mounted() ? device::IR_Macro::save(io, ir_macro_base, id, m_macro_steps) : device::ir_macro_error::IO;
+
+      input_register.set(static_cast<uint16_t>(error), ir_input_reg_start_addr + 15);
+      holding_register.clear(ir_macro_reg_start_addr + 1);
+    }
+
+    /* 宏执行: 单次写单个寄存器写入宏编号即启动 (替换执行中的宏), 写入0xFFFF停止 */
+    uint16_t run = holding_register[ir_macro_reg_start_addr];
+    if (0 != run)
+    {
+      error = device::ir_macro_error::NONE;
+      if (0xFFFF == run)
+        m_macro.stop();
+      else if (!m_library.is_mounted())
+        error = device::ir_macro_error::IO;
+      else if (device::ir_macro_error::NONE == (error = device::IR_Macro::load(io, ir_macro_base, run, m_macro_steps)))
+        m_macro.start(run, m_macro_steps, now);
+
+      input_register.set(static_cast<uint16_t>(error), ir_input_reg_start_addr + 15);
+      holding_register.clear(ir_macro_reg_start_addr);
+    }
+
+    /* 到期步骤: 通道上一任务未结束且不可抢占时保留步骤下一周期重试, 后续步骤时刻不受影响 */
+    m_macro_blocked = false;
+    for (const device::ir_macro_step_t* step = m_macro.due(now); nullptr != step && !m_macro_blocked; step = m_macro.due(now))
+    {
+      for (uint8_t i = 0; i < device::IR_Scheduler::CHANNEL_COUNT; i++)
+      {
+        if ((step->mask & (1U << i)) && !scheduler.admit(i, priority(SOURCE_MACRO)))
+          m_macro_blocked = true;
+      }
+
+      if (m_macro_blocked)
+        break;
+
+      if (!macro_step(*step, now))
+        input_register.set(static_cast<uint16_t>(device::ir_macro_error::STEP), ir_input_reg_start_addr + 15);
+      m_macro.advance();
+    }
+
+    input_register.set(m_macro.id(), ir_input_reg_start_addr + 16);
+    input_register.set(m_macro.index(), ir_input_reg_start_addr + 17);
+  }
+
+#if IR_APP_WAVE_ENGINE
+  void dispatch()
+  {
+    uint32_t now = ul_port_os_get_tick_count();
+
+    /* 回收波形引擎已结束(或超时)的帧 */
+    if (0 != m_wave_flight.mask)
+    {
+      bool success = m_wave.finish(0);
+      if (!success && now - m_wave_flight.start <= m_wave_flight.timeout)
+        return;
+
+      if (!success)
+        m_wave.abort();
+
+      for (uint8_t i = 0; i < device::IR_Scheduler::CHANNEL_COUNT; i++)
+      {
+        if (m_wave_flight.mask & (1U << i))
+          complete(i, success, now);
+      }
+      m_wave_flight.mask = 0;
+    }
+
+    uint8_t ready = 0;
+    for (uint8_t i = 0; i < device::IR_Scheduler::CHANNEL_COUNT; i++)
+    {
+      if (ir_channels[i]->is_open())
+        ready |= (1U << i);
+    }
+
+    uint8_t due = scheduler.poll(now, ready);
+    if (0 == due)
+      return;
+    align(due);
+
+    /* 全部到期通道合并为一帧, 由单个定时器的DMA写入 BSRR 同时输出 */
+    const device::ir_pulse_t* pulses[device::IR_Waveform::CHANNEL_COUNT] = {};
+    uint16_t                  sizes[device::IR_Waveform::CHANNEL_COUNT]  = {};
+    uint32_t                  duration                                   = 0;
+    uint32_t                  frequency                                  = 0;
+    float                     duty                                       = 0;
+
+    for (uint8_t i = 0; i < device::IR_Scheduler::CHANNEL_COUNT; i++)
+    {
+      if (!(due & (1U << i)))
+        continue;
+
+      /* 各通道共用载波: 以首个通道的载波设置为准, 设置不同的通道下一轮发送 */
+      if (0 == frequency)
+      {
+        frequency = ir_channels[i]->frequency();
+        duty      = ir_channels[i]->duty();
+      }
+      else if (ir_channels[i]->frequency() != frequency || ir_channels[i]->duty() != duty)
+      {
+        scheduler.defer(i);
+        due &= ~(1U << i);
+        continue;
+      }
+
+      const device::IR_Timeline& timeline = ir_channels[i]->timeline();
+      pulses[i]                           = timeline.data();
+      sizes[i]                            = timeline.size();
+      if (timeline.duration() > duration)
+        duration = timeline.duration();
+    }
+
+    uint32_t cycles = ul_port_system_get_cycles();
+    if (m_wave.start(pulses, sizes, &m_event, frequency, duty))
+    {
+      started(due, cycles, now);
+      m_wave_flight.mask    = due;
+      m_wave_flight.start   = now;
+      m_wave_flight.timeout = duration / 1000 + 100;
+      return;
+    }
+
+    for (uint8_t i = 0; i < device::IR_Scheduler::CHANNEL_COUNT; i++)
+    {
+      if (due & (1U << i))
+        complete(i, false, now);
+    }
+  }
+#else
+  void dispatch()
+  {
+    uint32_t now = ul_port_os_get_tick_count();
+
+    /* 回收硬件载波已结束(或超时)的帧 */
+    for (ir_flight_t& flight : m_flights)
+    {
+      if (0 == flight.mask)
+        continue;
+
+      bool success = flight.carrier->finish(0);
+      if (!success && now - flight.start <= flight.timeout)
+        continue;
+
+      if (!success)
+        flight.carrier->abort();
+
+      for (uint8_t i = 0; i < device::IR_Scheduler::CHANNEL_COUNT; i++)
+      {
+        if (flight.mask & (1U << i))
+          complete(i, success, now);
+      }
+      flight.mask = 0;
+    }
+
+    /* 可发送通道: 软件载波通道, 或所属硬件载波空闲的通道 */
+    uint8_t ready = 0;
+    for (uint8_t i = 0; i < device::IR_Scheduler::CHANNEL_COUNT; i++)
+    {
+      device::IR_Carrier* carrier = ir_channels[i]->carrier();
+      if (ir_channels[i]->is_open() && (nullptr == carrier || !carrier->is_busy()))
+        ready |= (1U << i);
+    }
+
+    uint8_t due = scheduler.poll(now, ready);
+    if (0 == due)
+      return;
+    align(due);
+
+    /* 硬件载波: 同一定时器的到期通道合并为一帧同时发送 */
+    for (ir_flight_t& flight : m_flights)
+    {
+      const device::ir_pulse_t* pulses[device::IR_Envelope::CHANNEL_COUNT] = {};
+      uint16_t                  sizes[device::IR_Envelope::CHANNEL_COUNT]  = {};
+      uint8_t                   mask                                       = 0;
+      uint32_t                  duration                                   = 0;
+      uint32_t                  frequency                                  = 0;
+      float                     duty                                       = 0;
+
+      if (nullptr == flight.carrier)
+        continue;
+
+      for (uint8_t i = 0; i < device::IR_Scheduler::CHANNEL_COUNT; i++)
+      {
+        if (!(due & (1U << i)) || ir_channels[i]->carrier() != flight.carrier)
+          continue;
+
+        /* 同一定时器的通道共用载波: 以首个通道的载波设置为准, 设置不同的通道下一轮发送 */
+        if (0 == mask)
+        {
+          frequency = ir_channels[i]->frequency();
+          duty      = ir_channels[i]->duty();
+        }
+        else if (ir_channels[i]->frequency() != frequency || ir_channels[i]->duty() != duty)
+        {
+          scheduler.defer(i);
+          due &= ~(1U << i);
+          continue;
+        }
+
+        const device::IR_Timeline& timeline = ir_channels[i]->timeline();
+        uint8_t                    channel  = ir_channels[i]->carrier_channel() - 1;
+
+        pulses[channel] = timeline.data();
+        sizes[channel]  = timeline.size();
+
+        /* 合并后的包络超出载波包络缓存区: 该通道下一轮发送 */
+        if (0 != mask && device::IR_Envelope::count(pulses, sizes, frequency) > device::IR_Carrier::ENVELOPE_CAPACITY)
+        {
+          pulses[channel] = nullptr;
+          sizes[channel]  = 0;
+          scheduler.defer(i);
+          due &= ~(1U << i);
+          continue;
+        }
+
+        mask           |= (1U << i);
+        if (timeline.duration() > duration)
+          duration = timeline.duration();
+      }
+
+      if (0 == mask)
+        continue;
+
+      uint32_t cycles = ul_port_system_get_cycles();
+      if (flight.carrier->start(pulses, sizes, &m_event, frequency, duty))
+      {
+        started(mask, cycles, now);
+        flight.mask    = mask;
+        flight.start   = now;
+        flight.timeout = duration / 1000 + 100;
+      }
+      else
+      {
+        for (uint8_t i = 0; i < device::IR_Scheduler::CHANNEL_COUNT; i++)
+        {
+          if (mask & (1U << i))
+            complete(i, false, now);
+        }
+      }
+      due &= ~mask;
+    }
+
+    /* 软件载波: 逐通道阻塞输出 */
+    for (uint8_t i = 0; i < device::IR_Scheduler::CHANNEL_COUNT; i++)
+    {
+      if (due & (1U << i))
+      {
+        started(1U << i, ul_port_system_get_cycles(), ul_port_os_get_tick_count());
+        bool success = ir_channels[i]->flash();
+        complete(i, success, ul_port_os_get_tick_count());
+      }
+    }
+  }
+#endif
+
+  uint8_t verify_arm(uint8_t index, device::ir_type type, const uint8_t* data, uint8_t length, uint8_t count, uint8_t priority)
+  {
+    /* 发送校验 (使能且接收空闲时): 只发送一次, 校验失败时再重发, 最多发送 count 次; 否则按 count 次发送 */
+    device::IR_Receiver::state_e state = m_receiver.state();
+    if (0 == holding_register[ir_verify_enable_addr] || device::IR_Scheduler::CHANNEL_COUNT != m_verify.channel || length > sizeof(m_verify.data))
+      return count;
+
+    if (device::IR_Receiver::LISTENING == state || device::IR_Receiver::CAPTURING == state || !m_receiver.start(ir_verify_timeout))
+      return count;
+
+    m_verify.channel  = index;
+    m_verify.type     = type;
+    m_verify.length   = length;
+    m_verify.retries  = (count > 1) ? static_cast<uint8_t>(count - 1) : 0;
+    m_verify.priority = priority;
+    memmove(m_verify.data, data, length); /* 重发时数据即为本缓存区 */
+    return 1;
+  }
+
+  void verify()
+  {
+    /* 等待发送结束且接收完成 (帧结束后静默 END_GAP) */
+    uint8_t index = m_verify.channel;
+    if (device::IR_Scheduler::CHANNEL_COUNT == index || scheduler.is_busy(index))
+      return;
+
+    device::IR_Receiver::state_e state = m_receiver.poll();
+    if (device::IR_Receiver::LISTENING == state || device::IR_Receiver::CAPTURING == state)
+      return;
+
+    /* 未接收到信号视为头码缺失 */
+    uint16_t                     errors   = 0;
+    device::ir_decode_error      error    = device::ir_decode_error::LEADER;
+    const device::ir_protocol_t* protocol = device::IR_Protocol::get(m_verify.type);
+    if (device::IR_Receiver::DONE == state && nullptr != protocol)
+      error = device::IR_Decoder::verify(*protocol, m_verify.data, m_verify.length, m_receiver.result().data(), m_receiver.result().size(), errors);
+
+    input_register.set(static_cast<uint16_t>(error), ir_verify_reg_start_addr + device::IR_Scheduler::CHANNEL_COUNT);
+    input_register.set(errors, ir_verify_reg_start_addr + device::IR_Scheduler::CHANNEL_COUNT + 1);
+    m_verify.channel = device::IR_Scheduler::CHANNEL_COUNT;
+    if (device::ir_decode_error::NONE == error)
+      return;
+
+    if (m_verify_errors[index] < 0xFFFF)
+      m_verify_errors[index]++;
+    input_register.set(m_verify_errors[index], ir_verify_reg_start_addr + index);
+
+    /* 校验失败: 重新准备时序, 剩余次数继续按校验发送 (任务结束时已释放时序缓存区) */
+    if (0 == m_verify.retries || !ir_channels[index]->prepare(m_verify.type, reinterpret_cast<const char*>(m_verify.data), m_verify.length))
+      return;
+
+    if (submit(index, verify_arm(index, m_verify.type, m_verify.data, m_verify.length, m_verify.retries, m_verify.priority), ul_port_os_get_tick_count(), m_verify.priority))
+      m_prepared |= (1U << index);
+    else
+      ir_channels[index]->release();
+  }
+
+  void report()
+  {
+    /* 任务结束的通道释放时序缓存区 */
+    uint8_t finished = m_prepared & (scheduler.done_mask() | scheduler.failed_mask());
+    for (uint8_t i = 0; i < device::IR_Scheduler::CHANNEL_COUNT; i++)
+    {
+      if (finished & (1U << i))
+        ir_channels[i]->release();
+    }
+    m_prepared &= ~finished;
+
+    /* 抢占任务结束的通道恢复挂起的任务及其时序 */
+    uint8_t resumed = scheduler.resume(ul_port_os_get_tick_count());
+    for (uint8_t i = 0; i < device::IR_Scheduler::CHANNEL_COUNT; i++)
+    {
+      if (!(resumed & (1U << i)))
+        continue;
+
+      if (ir_channels[i]->resume())
+        m_prepared |= (1U << i);
+      else
+        scheduler.cancel(i);
+    }
+
+    input_register.set(scheduler.busy_mask(), ir_input_reg_start_addr + 0);
+    input_register.set(scheduler.done_mask(), ir_input_reg_start_addr + 1);
+    input_register.set(scheduler.failed_mask(), ir_input_reg_start_addr + 2);
+    input_register.set(device::IR::cache().hits(), ir_input_reg_start_addr + 3);
+    input_register.set(device::IR::cache().misses(), ir_input_reg_start_addr + 5);
+    input_register.set(scheduler.suspended_mask(), ir_preempt_reg_start_addr + 0);
+    input_register.set(m_preemptions, ir_preempt_reg_start_addr + 1);
+
+    /* 软件载波发送时序统计: 每个通道一组寄存器, 写入非0清除全部通道的统计 */
+    if (0 != holding_register[ir_timing_clear_addr])
+    {
+      for (device::IR* channel : ir_channels)
+        channel->timing().clear();
+      holding_register.clear(ir_timing_clear_addr);
+    }
+
+    uint16_t regs[device::IR_Timing::REGISTER_COUNT];
+    for (uint8_t i = 0; i < device::IR_Scheduler::CHANNEL_COUNT; i++)
+    {
+      ir_channels[i]->timing().registers(regs);
+      input_register.set(regs, device::IR_Timing::REGISTER_COUNT, ir_timing_reg_start_addr + i * device::IR_Timing::REGISTER_COUNT);
+    }
+
+    /* 通道发送统计: 每个通道一组寄存器, 写入非0清除全部通道的统计 */
+    if (0 != holding_register[ir_stats_clear_addr])
+    {
+      m_stats.clear();
+      holding_register.clear(ir_stats_clear_addr);
+    }
+
+    uint16_t stats[device::IR_Stats::REGISTER_COUNT];
+    for (uint8_t i = 0; i < device::IR_Scheduler::CHANNEL_COUNT; i++)
+    {
+      m_stats.depth(i, scheduler.depth(i));
+      m_stats.registers(i, stats);
+      input_register.set(stats, device::IR_Stats::REGISTER_COUNT, ir_stats_reg_start_addr + i * device::IR_Stats::REGISTER_COUNT);
+    }
+
+    report_sync();
+  }
+
+  void report_sync()
+  {
+    /* 网络时间同步: 角色(0关闭, 1从时钟, 2主时钟), 域号 */
+    uint16_t role = holding_register[ir_sync_role_addr];
+    m_sync->set_role(role <= static_cast<uint16_t>(protocol::ptp::ptp_role::MASTER) ? static_cast<protocol::ptp::ptp_role>(role) : protocol::ptp::ptp_role::OFF);
+    m_sync->set_domain(static_cast<uint8_t>(holding_register[ir_sync_domain_addr]));
+
+    /* 发射时刻变化时重新计状态, 时刻已过时清除 (已提交的定时任务不受影响) */
+    uint64_t fire    = fire_time();
+    uint64_t network = 0;
+    bool     synced  = m_sync->now(network);
+    if (fire != m_fire_last)
+    {
+      m_fire_last   = fire;
+      m_fire_status = (0 != fire) ? FIRE_ARMED : FIRE_IDLE;
+    }
+    if (0 != fire && synced && fire * 1000000 <= network)
+      holding_register.clear(ir_fire_time_addr, 4);
+
+    uint8_t timed = 0;
+    for (uint8_t i = 0; i < device::IR_Scheduler::CHANNEL_COUNT; i++)
+    {
+      if (0 != m_fire_at[i])
+        timed |= (1U << i);
+    }
+
+    protocol::ptp::ptp_status_t status = m_sync->status();
+    uint64_t                    ms     = network / 1000000;
+    uint16_t                    regs[17];
+    regs[0] = static_cast<uint16_t>(status.state);
+    memcpy(&regs[1], &status.offset, sizeof(uint32_t));
+    memcpy(&regs[3], &status.ppb, sizeof(uint32_t));
+    memcpy(&regs[5], &status.delay, sizeof(uint32_t));
+    memcpy(&regs[7], &status.samples, sizeof(uint32_t));
+    memcpy(&regs[9], &status.outliers, sizeof(uint32_t));
+    memcpy(&regs[11], &ms, sizeof(uint64_t));
+    regs[15] = m_fire_status;
+    regs[16] = timed;
+    input_register.set(regs, 17, ir_sync_reg_start_addr);
+  }
+
+  static uint32_t library_read(void* arg, uint32_t position, void* data, uint32_t len)
+  {
+    return static_cast<device::Nor_Flash*>(arg)->read(position, data, len);
+  }
+
+  static uint32_t library_write(void* arg, uint32_t position, const void* data, uint32_t len)
+  {
+    return static_cast<device::Nor_Flash*>(arg)->write(position, data, len);
+  }
+
+public:
+  ir_app(const std::string& name, Object* parent, protocol::modbus::Register& holding_register, protocol::modbus::Register& input_register, rom& eeprom) : system::kernel::Thread(name, parent), holding_register(holding_register), input_register(input_register), eeprom(eeprom), m_event(1, 0), m_verify_errors {}
+  {
+    for (uint8_t i = 0; i < device::IR_Scheduler::CHANNEL_COUNT; i++)
+      ir_channels[i] = new device::IR(std::string("IR") + static_cast<char>('1' + i), this);
+
+    m_nor_flash = new device::Nor_Flash("NOR_FLASH", this);
+    m_sync      = new protocol::ptp::Ptp("PTP", this);
+  }
+
+  void open()
+  {
+    for (uint8_t i = device::IR_Scheduler::CHANNEL_COUNT; i > 0; i--)
+    {
+      if (channel_enable(i - 1))
+      {
+#if IR_APP_WAVE_ENGINE
+        ir_channels[i - 1]->open(ir_pins[i - 1].port, ir_pins[i - 1].pin, eeprom().ir.channel_pulse, false);
+        m_wave.set_pin(i - 1, ir_pins[i - 1].port, ir_pins[i - 1].pin);
+#else
+        ir_channels[i - 1]->open(ir_pins[i - 1].port, ir_pins[i - 1].pin, eeprom().ir.channel_pulse);
+#endif
+        holding_register.set(i, ir_holding_reg_start_addr + 0);
+      }
     }
 
     holding_register.set(1, ir_holding_reg_start_addr + 1);
+
+#if IR_APP_WAVE_ENGINE
+    m_wave.open();
+#endif
+
+    m_receiver.open(ir_learn_pin.port, ir_learn_pin.pin);
+    m_text.reset(m_text_pulses, device::IR_Library::MAX_PULSES);
+
+    /* 指令库: 扫描槽位头部重建索引, 挂载失败时指令库操作返回未挂载 */
+    if (m_nor_flash->open(ir_library_spi, ir_library_cs_pin.port, ir_library_cs_pin.pin))
+      m_library.mount(device::ir_library_io_t { library_read, library_write, m_nor_flash }, 0, ir_library_size);
+    input_register.set(static_cast<uint16_t>(m_library.is_mounted() ? device::ir_library_error::NONE : device::ir_library_error::MOUNT), ir_input_reg_start_addr + 13);
+
+    /* 登记各硬件载波 (每个定时器一帧) */
+    for (device::IR* channel : ir_channels)
+    {
+      device::IR_Carrier* carrier = channel->carrier();
+      if (nullptr == carrier)
+        continue;
+
+      for (ir_flight_t& flight : m_flights)
+      {
+        if (carrier == flight.carrier)
+          break;
+
+        if (nullptr == flight.carrier)
+        {
+          flight.carrier = carrier;
+          break;
+        }
+      }
+    }
   }
 
   void start(uint8_t priority = THREAD_DEF_PRIORITY)
   {
-    system::kernel::Thread::start(priority, 256, 0);
+    /* 网络时间同步线程优先于发送线程, 报文及时处理 */
+    m_sync->start(priority + 1);
+    system::kernel::Thread::start(priority, ir_thread_stack_size, 0);
   }
 
   virtual ~ir_app() {}
@@ -3,6 +3,7 @@
 
 #include "port_net_init.h"
 #include "port_iwdg.h"
+#include "delay.hpp"
 #include "ir_app.hpp"
 #include "key.hpp"
 
@@ -322,10 +323,12 @@ protected:
   }
 
 public:
-  main_app(const std::string& name, Object* parent = nullptr) : system::kernel::Thread(name, parent), holding_register(*new protocol::modbus::Register("HOLDING_REGISTER", this, 60)), input_register(*new protocol::modbus::Register("INPUT_REGISTER", this, 20)), modbus_tcp(*new protocol::modbus::Modbus_Tcp_Server("MODBUS_TCP", this)), eeprom(*new rom("EEPROM", this)), bios_key(*new device::Key("BIOS_KEY", this))
+  main_app(const std::string& name, Object* parent = nullptr) : system::kernel::Thread(name, parent), holding_register(*new protocol::modbus::Register("HOLDING_REGISTER", this, 447)), input_register(*new protocol::modbus::Register("INPUT_REGISTER", this, 299)), modbus_tcp(*new protocol::modbus::Modbus_Tcp_Server("MODBUS_TCP", this)), eeprom(*new rom("EEPROM", this)), bios_key(*new device::Key("BIOS_KEY", this))
   {
     get_version(__DATE__, __TIME__);
 
+    system::kernel::Delay::open();
+
     eeprom.open();
     eeprom.download();
 
@@ -350,7 +353,7 @@ public:
 
   void start(uint8_t priority = THREAD_DEF_PRIORITY)
   {
-    ir = new ir_app("IR", this, holding_register, eeprom);
+    ir = new ir_app("IR", this, holding_register, input_register, eeprom);
     ir->open();
     ir->start(priority + 3);
 
@@ -60,7 +60,7 @@
 #define ipconfigCOMPATIBLE_WITH_SINGLE              1
 #define ipconfigIGNORE_UNKNOWN_PACKETS              1
 #define ipconfigCHECK_IP_QUEUE_SPACE                1
-#define ipconfigUDP_MAX_RX_PACKETS                  1
+#define ipconfigUDP_MAX_RX_PACKETS                  4
 #define ipconfigETHERNET_MINIMUM_PACKET_BYTES       1
 #define ipconfigTCP_IP_SANITY                       1
 #define ipconfigSUPPORT_NETWORK_DOWN_EVENT          1
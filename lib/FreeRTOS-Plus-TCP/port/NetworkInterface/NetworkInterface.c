@@ -55,6 +55,7 @@
 #include "NetworkBufferManagement.h"
 #include "NetworkInterface.h"
 #include "phyHandling.h"
+#include "port_net_ptp.h"
 
 /* ST includes. */
 #if defined( STM32F4 )
@@ -777,6 +778,12 @@ static BaseType_t prvNetworkInterfaceInput( ETH_HandleTypeDef * pxEthHandle,
 
             configASSERT( pxCurDescriptor->xDataLength <= niEMAC_DATA_BUFFER_SIZE );
 
+            /* Record the MAC receive timestamp of PTP event messages before the
+             * frame is handed to the IP task. */
+            v_port_net_ptp_rx_hook( pxCurDescriptor->pucEthernetBuffer, pxCurDescriptor->xDataLength,
+                                    pxEthHandle->RxDescList.TimeStamp.TimeStampHigh,
+                                    pxEthHandle->RxDescList.TimeStamp.TimeStampLow );
+
             pxCurDescriptor->pxInterface = pxInterface;
             pxCurDescriptor->pxEndPoint = FreeRTOS_MatchingEndpoint( pxCurDescriptor->pxInterface, pxCurDescriptor->pucEthernetBuffer );
             #if ipconfigIS_ENABLED( ipconfigUSE_LINKED_RX_MESSAGES )
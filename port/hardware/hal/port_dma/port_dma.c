@@ -172,6 +172,54 @@ static uint32_t s_ul_port_dma_get_priority(const port_dma_priority_e dma_priorit
   }
 }
 
+/**
+ * @brief (静态) port DMA 获取 HAL库 DMA 外设数据宽度
+ *
+ * @param  data_width  DMA 数据宽度
+ * @return uint32_t    DMA 外设数据宽度HAL库编码
+ */
+static uint32_t s_ul_port_dma_get_periph_width(const port_dma_data_width_e data_width)
+{
+  switch (data_width)
+  {
+    case PORT_DMA_BYTE :
+      return DMA_PDATAALIGN_BYTE;
+    case PORT_DMA_HALFWORD :
+      return DMA_PDATAALIGN_HALFWORD;
+    case PORT_DMA_WORD :
+      return DMA_PDATAALIGN_WORD;
+
+    default :
+      g_e_error_code = UNDEFINED_ERROR;
+      ERROR_HANDLE("port dma get periph width error!\n");
+      return DMA_PDATAALIGN_BYTE;
+  }
+}
+
+/**
+ * @brief (静态) port DMA 获取 HAL库 DMA 内存数据宽度
+ *
+ * @param  data_width  DMA 数据宽度
+ * @return uint32_t    DMA 内存数据宽度HAL库编码
+ */
+static uint32_t s_ul_port_dma_get_memory_width(const port_dma_data_width_e data_width)
+{
+  switch (data_width)
+  {
+    case PORT_DMA_BYTE :
+      return DMA_MDATAALIGN_BYTE;
+    case PORT_DMA_HALFWORD :
+      return DMA_MDATAALIGN_HALFWORD;
+    case PORT_DMA_WORD :
+      return DMA_MDATAALIGN_WORD;
+
+    default :
+      g_e_error_code = UNDEFINED_ERROR;
+      ERROR_HANDLE("port dma get memory width error!\n");
+      return DMA_MDATAALIGN_BYTE;
+  }
+}
+
 /**
  * @brief (静态) port DMA HAL库 DMA 时钟使能
  *
@@ -334,6 +382,47 @@ dma_err:
   return g_e_error_code;
 }
 
+/**
+ * @brief port DMA 设置数据宽度(默认为字节, 需在DMA空闲时调用)
+ *
+ * @param  dma_num           DMA 编号 (1-2)
+ * @param  dma_stream_num    DMA 流编号 (0-7)
+ * @param  periph_width      DMA 外设数据宽度
+ * @param  memory_width      DMA 内存数据宽度
+ * @return error_code_e      错误编码
+ */
+error_code_e e_port_dma_set_data_width(const uint8_t dma_num, const uint8_t dma_stream_num, const port_dma_data_width_e periph_width, const port_dma_data_width_e memory_width)
+{
+  /* DMA 空指针判断 */
+  DMA_HandleTypeDef* dma_handle = pt_port_dma_get_handle(dma_num, dma_stream_num);
+  if (NULL == dma_handle)
+  {
+    g_e_error_code = NO_INIT_ERROR;
+    ERROR_HANDLE("port dma this stream is not init!\n");
+    return g_e_error_code;
+  }
+
+  if (HAL_DMA_STATE_READY != dma_handle->State)
+  {
+    g_e_error_code = SETUP_ERROR;
+    ERROR_HANDLE("port dma stream is busy!\n");
+    return g_e_error_code;
+  }
+
+  dma_handle->Init.PeriphDataAlignment = s_ul_port_dma_get_periph_width(periph_width);
+  dma_handle->Init.MemDataAlignment    = s_ul_port_dma_get_memory_width(memory_width);
+
+  /* DMA 重新初始化 */
+  if (HAL_OK != HAL_DMA_Init(dma_handle))
+  {
+    g_e_error_code = INIT_ERROR;
+    ERROR_HANDLE("port dma set data width failed!\n");
+    return g_e_error_code;
+  }
+
+  return SUCESS;
+}
+
 /**
  * @brief port DMA 解除初始化
  *
@@ -41,10 +41,19 @@ extern "C"
     PORT_DMA_VERY_HIGH, /* port DMA 极高优先级 */
   } port_dma_priority_e;
 
+  /// @brief port DMA 数据宽度
+  typedef enum PORT_DMA_DATA_WIDTH_E
+  {
+    PORT_DMA_BYTE,     /* port DMA 数据宽度 字节 */
+    PORT_DMA_HALFWORD, /* port DMA 数据宽度 半字 */
+    PORT_DMA_WORD,     /* port DMA 数据宽度 字 */
+  } port_dma_data_width_e;
+
   extern void         v_port_dma_nvic_enable(const uint8_t dma_num, const uint8_t dma_stream_num);
   extern void         v_port_dma_nvic_disable(const uint8_t dma_num, const uint8_t dma_stream_num);
   extern void         v_port_dma_nvic_set_priority(const uint8_t dma_num, const uint8_t dma_stream_num, uint8_t dma_nvic_priority);
   extern error_code_e e_port_dma_init(const uint8_t dma_num, const uint8_t dma_stream_num, const uint8_t dma_channel, const port_dma_direction_e dma_direction, const port_dma_mode_e dma_mode, const port_dma_priority_e dma_priority);
+  extern error_code_e e_port_dma_set_data_width(const uint8_t dma_num, const uint8_t dma_stream_num, const port_dma_data_width_e periph_width, const port_dma_data_width_e memory_width);
   extern error_code_e e_port_dma_deinit(const uint8_t dma_num, const uint8_t dma_stream_num);
 
 #if __cplusplus
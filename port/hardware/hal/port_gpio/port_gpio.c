@@ -388,6 +388,18 @@ void v_port_gpio_toggle(const uint8_t gpio_port, const uint8_t gpio_pin)
   HAL_GPIO_TogglePin(sl_pt_port_gpio_get_port(gpio_port), sl_ul_port_gpio_get_pin(gpio_pin));
 }
 
+/**
+ * @brief port GPIO 获取端口置位/复位寄存器(BSRR)地址 (供DMA直接写入)
+ *
+ * @param  gpio_port  GPIO 端口编号
+ * @return uint32_t   BSRR 寄存器地址，端口错误返回0
+ */
+uint32_t ul_port_gpio_get_bsrr_address(const uint8_t gpio_port)
+{
+  GPIO_TypeDef* gpio = sl_pt_port_gpio_get_port(gpio_port);
+  return gpio ? (uint32_t)&gpio->BSRR : 0;
+}
+
 /**
  * @brief port GPIO 解除初始化
  *
@@ -64,16 +64,17 @@ extern "C"
     void* arg;               /* port GPIO 回调函数参数 */
   } port_gpio_callback_t;
 
-  extern void v_port_gpio_nvic_enable(const uint8_t gpio_pin);
-  extern void v_port_gpio_nvic_disable(const uint8_t gpio_pin);
-  extern void v_port_gpio_nvic_set_pority(const uint8_t gpio_pin, uint8_t gpio_nvic_pority);
-  extern void v_port_gpio_init(const uint8_t gpio_port, const uint8_t gpio_pin, const port_gpio_mode_e gpio_mode, const port_gpio_event_e gpio_event, const port_gpio_pull_e gpio_pull, const port_gpio_speed_e gpio_speed, const port_gpio_callback_t* gpio_callback);
-  extern void v_port_gpio_af_init(const uint8_t gpio_port, const uint8_t gpio_pin, const port_gpio_mode_e gpio_mode, const port_gpio_pull_e gpio_pull, const port_gpio_speed_e gpio_speed, const uint32_t gpio_af_channel);
-  extern void v_port_gpio_change_mode(const uint8_t gpio_port, const uint8_t gpio_pin, const port_gpio_mode_e gpio_mode, const port_gpio_event_e gpio_event, const port_gpio_pull_e gpio_pull, const port_gpio_speed_e gpio_speed, const port_gpio_callback_t* gpio_callback);
-  extern void v_port_gpio_write(const uint8_t gpio_port, const uint8_t gpio_pin, const bool gpio_value);
-  extern bool b_port_gpio_read(const uint8_t gpio_port, const uint8_t gpio_pin);
-  extern void v_port_gpio_toggle(const uint8_t gpio_port, const uint8_t gpio_pin);
-  extern void v_port_gpio_deinit(const uint8_t gpio_port, const uint8_t gpio_pin, const port_gpio_mode_e gpio_mode);
+  extern void     v_port_gpio_nvic_enable(const uint8_t gpio_pin);
+  extern void     v_port_gpio_nvic_disable(const uint8_t gpio_pin);
+  extern void     v_port_gpio_nvic_set_pority(const uint8_t gpio_pin, uint8_t gpio_nvic_pority);
+  extern void     v_port_gpio_init(const uint8_t gpio_port, const uint8_t gpio_pin, const port_gpio_mode_e gpio_mode, const port_gpio_event_e gpio_event, const port_gpio_pull_e gpio_pull, const port_gpio_speed_e gpio_speed, const port_gpio_callback_t* gpio_callback);
+  extern void     v_port_gpio_af_init(const uint8_t gpio_port, const uint8_t gpio_pin, const port_gpio_mode_e gpio_mode, const port_gpio_pull_e gpio_pull, const port_gpio_speed_e gpio_speed, const uint32_t gpio_af_channel);
+  extern void     v_port_gpio_change_mode(const uint8_t gpio_port, const uint8_t gpio_pin, const port_gpio_mode_e gpio_mode, const port_gpio_event_e gpio_event, const port_gpio_pull_e gpio_pull, const port_gpio_speed_e gpio_speed, const port_gpio_callback_t* gpio_callback);
+  extern void     v_port_gpio_write(const uint8_t gpio_port, const uint8_t gpio_pin, const bool gpio_value);
+  extern bool     b_port_gpio_read(const uint8_t gpio_port, const uint8_t gpio_pin);
+  extern void     v_port_gpio_toggle(const uint8_t gpio_port, const uint8_t gpio_pin);
+  extern uint32_t ul_port_gpio_get_bsrr_address(const uint8_t gpio_port);
+  extern void     v_port_gpio_deinit(const uint8_t gpio_port, const uint8_t gpio_pin, const port_gpio_mode_e gpio_mode);
 
 #if __cplusplus
 }
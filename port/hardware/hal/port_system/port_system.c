@@ -128,4 +128,37 @@ void v_port_system_delay_us(uint32_t us)
   /* 延时等待 */
   while ((DWT->CYCCNT - tickStart) < us)
     v_port_os_thread_yield();
-}
\ No newline at end of file
+}
+
+/**
+ * @brief port 系统 忙等待至指定时刻 (不让出CPU, 周期计数回绕安全)
+ *
+ * @param deadline 目标时刻(CPU周期计数)
+ */
+void v_port_system_spin_until(uint32_t deadline)
+{
+  while ((int32_t)(DWT->CYCCNT - deadline) < 0)
+  {
+  }
+}
+
+/**
+ * @brief port 系统 忙等待延时 (不让出CPU, 用于短间隔精确延时)
+ *
+ * @param us 延时时间(us)
+ */
+void v_port_system_spin_us(uint32_t us)
+{
+  uint32_t start = DWT->CYCCNT;
+  v_port_system_spin_until(start + us * (SystemCoreClock / 1000000));
+}
+
+uint32_t ul_port_system_get_clock()
+{
+  return SystemCoreClock;
+}
+
+uint32_t ul_port_system_get_cycles()
+{
+  return DWT->CYCCNT;
+}
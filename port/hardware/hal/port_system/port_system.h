@@ -21,6 +21,10 @@ extern "C"
   extern void                     v_port_system_reset();
   extern port_system_work_time_t* p_port_system_get_work_time();
   extern void                     v_port_system_delay_us(uint32_t us);
+  extern void                     v_port_system_spin_us(uint32_t us);
+  extern void                     v_port_system_spin_until(uint32_t deadline);
+  extern uint32_t                 ul_port_system_get_clock();
+  extern uint32_t                 ul_port_system_get_cycles();
 
 #if __cplusplus
 }
@@ -9,6 +9,7 @@
  *
  */
 #include "port_tim.h"
+#include "port_dma.h"
 #include "port_include.h"
 
 /// @brief TIM 中断默认优先级
@@ -38,6 +39,34 @@ static const uint32_t sc_aul_port_timeer_channel_map[]               = { TIM_CHA
  */
 static const HAL_TIM_ActiveChannel sc_ae_port_timer_active_channel[] = { HAL_TIM_ACTIVE_CHANNEL_1, HAL_TIM_ACTIVE_CHANNEL_2, HAL_TIM_ACTIVE_CHANNEL_3, HAL_TIM_ACTIVE_CHANNEL_4 };
 
+/**
+ * @brief (静态常量) port TIM DMA请求信息数组 (更新事件, 比较通道1~4; DMA编号为0表示不支持)
+ *
+ */
+static const uint8_t sc_auc_port_timer_dma_info[TIMER_COUNT][TIMER_DMA_REQUEST_COUNT][3] = {
+  { { 2, 5, 6 }, { 2, 1, 6 }, { 2, 2, 6 }, { 2, 6, 6 }, { 2, 4, 6 } }, /* TIM1  UP/CH1/CH2/CH3/CH4 -> DMA2-Stream5/1/2/6/4-Channel6 */
+  { { 1, 1, 3 }, { 1, 5, 3 }, { 1, 6, 3 }, { 1, 1, 3 }, { 1, 7, 3 } }, /* TIM2  UP/CH1/CH2/CH3/CH4 -> DMA1-Stream1/5/6/1/7-Channel3 */
+  { { 1, 2, 5 }, { 1, 4, 5 }, { 1, 5, 5 }, { 1, 7, 5 }, { 1, 2, 5 } }, /* TIM3  UP/CH1/CH2/CH3/CH4 -> DMA1-Stream2/4/5/7/2-Channel5 */
+  { { 1, 6, 2 }, { 1, 0, 2 }, { 1, 3, 2 }, { 1, 7, 2 }, { 0, 0, 0 } }, /* TIM4  UP/CH1/CH2/CH3     -> DMA1-Stream6/0/3/7-Channel2 */
+  { { 1, 0, 6 }, { 1, 2, 6 }, { 1, 4, 6 }, { 1, 0, 6 }, { 1, 1, 6 } }, /* TIM5  UP/CH1/CH2/CH3/CH4 -> DMA1-Stream0/2/4/0/1-Channel6 */
+  { { 1, 1, 7 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 } }, /* TIM6  UP                 -> DMA1-Stream1-Channel7 */
+  { { 1, 2, 1 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 } }, /* TIM7  UP                 -> DMA1-Stream2-Channel1 */
+  { { 2, 1, 7 }, { 2, 2, 7 }, { 2, 3, 7 }, { 2, 4, 7 }, { 2, 7, 7 } }, /* TIM8  UP/CH1/CH2/CH3/CH4 -> DMA2-Stream1/2/3/4/7-Channel7 */
+  { { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 } }, /* TIM9  不支持 */
+  { { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 } }, /* TIM10 不支持 */
+  { { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 } }, /* TIM11 不支持 */
+  { { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 } }, /* TIM12 不支持 */
+  { { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 } }, /* TIM13 不支持 */
+  { { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 } }, /* TIM14 不支持 */
+};
+
+/**
+ * @brief (静态常量) port TIM DMA请求使能位与HAL库DMA句柄下标 (更新事件, 比较通道1~4)
+ *
+ */
+static const uint32_t sc_aul_port_timer_dma_source[TIMER_DMA_REQUEST_COUNT] = { TIM_DMA_UPDATE, TIM_DMA_CC1, TIM_DMA_CC2, TIM_DMA_CC3, TIM_DMA_CC4 };
+static const uint16_t sc_aus_port_timer_dma_id[TIMER_DMA_REQUEST_COUNT]     = { TIM_DMA_ID_UPDATE, TIM_DMA_ID_CC1, TIM_DMA_ID_CC2, TIM_DMA_ID_CC3, TIM_DMA_ID_CC4 };
+
 /**
  * @brief (全局变量) port TIM HAL 句柄指针数组
  *
@@ -65,14 +94,19 @@ typedef struct PORT_TIMER_IC_DATA_T
  */
 typedef struct PORT_TIMER_INFO_T
 {
-  port_timer_ic_data_t* ic_data;     /* port TIM 输入捕获信息结构体指针 */
-  port_os_semaphore_t   binary;      /* port TIM 二值信号量 */
-  uint8_t               channel_num; /* port TIM 工作通道 */
-  port_timer_type_e     type;        /* port TIM 工作模式 */
-  bool                  is_running;  /* port TIM 工作标志位 */
-  float                 frequency;   /* port TIM 频率 */
-  float                 duty_cycle;  /* port TIM 占空比 */
-  port_timer_callback_t callback;    /* port TIM 回调函数 */
+  port_timer_ic_data_t* ic_data;      /* port TIM 输入捕获信息结构体指针 */
+  port_os_semaphore_t   binary;       /* port TIM 二值信号量 */
+  uint8_t               channel_num;  /* port TIM 工作通道 */
+  uint8_t               channel_mask; /* port TIM 输出比较 已配置通道掩码 */
+  port_timer_type_e     type;         /* port TIM 工作模式 */
+  bool                  is_running;   /* port TIM 工作标志位 */
+  float                 frequency;    /* port TIM 频率 */
+  float                 duty_cycle;   /* port TIM 占空比 */
+  port_timer_callback_t callback;     /* port TIM 回调函数 */
+  port_timer_callback_t dma_callback[TIMER_DMA_REQUEST_COUNT];      /* port TIM DMA传输完成回调函数 */
+  port_timer_callback_t dma_half_callback[TIMER_DMA_REQUEST_COUNT]; /* port TIM DMA传输过半回调函数 */
+  uint8_t               dma_config[TIMER_DMA_REQUEST_COUNT];        /* port TIM DMA当前配置(数据流方向 + 工作模式 + 数据宽度) */
+  uint8_t               dma_init_mask;                              /* port TIM DMA已初始化请求掩码 */
 } port_timer_info_t;
 
 /**
@@ -81,6 +115,8 @@ typedef struct PORT_TIMER_INFO_T
  */
 static port_timer_info_t* s_apt_port_timer_info[TIMER_COUNT] = { 0 };
 
+extern DMA_HandleTypeDef* pt_port_dma_get_handle(const uint8_t dma_num, const uint8_t dma_stream_num);
+
 /**
  * @brief (静态内联) port TIM 获取 HAL库 TIM 通道句柄
  *
@@ -318,6 +354,48 @@ uint32_t ul_port_timer_get_gpio_af(const uint8_t timer_num)
   }
 }
 
+/**
+ * @brief port TIM 获取 定时器输入时钟频率
+ *
+ * @param  timer_num  TIM 通道编号
+ * @return uint32_t   定时器输入时钟频率(Hz)
+ */
+uint32_t ul_port_timer_get_clock(const uint8_t timer_num)
+{
+  switch (timer_num)
+  {
+    case 1 :
+    case 8 :
+    case 9 :
+    case 10 :
+    case 11 :
+      /* TIM1 TIM8~TIM11 在APB2上 (如果APB2预分频系数等于1,则频率不变,否则频率乘以2) */
+      if (0 == (RCC->CFGR & RCC_CFGR_PPRE2_2))
+        return HAL_RCC_GetPCLK2Freq();
+      else
+        return HAL_RCC_GetPCLK2Freq() * 2;
+    case 2 :
+    case 3 :
+    case 4 :
+    case 5 :
+    case 6 :
+    case 7 :
+    case 12 :
+    case 13 :
+    case 14 :
+      /* 其余定时器在APB1上 (如果APB1预分频系数等于1,则频率不变,否则频率乘以2) */
+      if (0 == (RCC->CFGR & RCC_CFGR_PPRE1_2))
+        return HAL_RCC_GetPCLK1Freq();
+      else
+        return HAL_RCC_GetPCLK1Freq() * 2;
+
+    default :
+      g_e_error_code = UNDEFINED_ERROR;
+      ERROR_HANDLE("port timer get clock error!\n");
+      return 0;
+  }
+}
+
 /**
  * @brief (静态) port TIM HAL库 TIM 时钟使能
  *
@@ -829,6 +907,14 @@ static void s_v_port_timer_period_elapsed_callback(const uint8_t timer_num)
     return;
   }
 
+  if (PORT_TIMER_OC == timer_info->type)
+  {
+    /* TIM 输出比较模式更新事件回调函数 */
+    if (timer_info->callback.function)
+      timer_info->callback.function(timer_info->callback.arg);
+    return;
+  }
+
   if (PORT_TIMER_NORMAL == timer_info->type)
   {
     /* TIM 普通模式回调函数 */
@@ -971,12 +1057,18 @@ error_code_e e_port_timer_start(const uint8_t timer_num)
       }
     case PORT_TIMER_OC :
       {
-        /* TIM 使能(开始输出比较) */
-        if (HAL_OK != HAL_TIM_OC_Start_IT(timer_handle, sl_ul_port_timer_get_channel(timer_info->channel_num)))
+        /* TIM 使能(开始输出比较, 包含所有已配置的通道) */
+        for (uint8_t i = 1; i <= 4; i++)
         {
-          g_e_error_code = SETUP_ERROR;
-          ERROR_HANDLE("port timer oc start failed!\n");
-          return g_e_error_code;
+          if (0 == (timer_info->channel_mask & (1 << (i - 1))))
+            continue;
+
+          if (HAL_OK != HAL_TIM_OC_Start_IT(timer_handle, sl_ul_port_timer_get_channel(i)))
+          {
+            g_e_error_code = SETUP_ERROR;
+            ERROR_HANDLE("port timer oc start failed!\n");
+            return g_e_error_code;
+          }
         }
         timer_info->is_running = true;
         break;
@@ -1051,12 +1143,18 @@ error_code_e e_port_timer_stop(const uint8_t timer_num)
       }
     case PORT_TIMER_OC :
       {
-        /* TIM 失能(结束输出比较) */
-        if (HAL_OK != HAL_TIM_OC_Stop_IT(timer_handle, sl_ul_port_timer_get_channel(timer_info->channel_num)))
+        /* TIM 失能(结束输出比较, 包含所有已配置的通道) */
+        for (uint8_t i = 1; i <= 4; i++)
         {
-          g_e_error_code = SETUP_ERROR;
-          ERROR_HANDLE("port timer oc stop failed!\n");
-          return g_e_error_code;
+          if (0 == (timer_info->channel_mask & (1 << (i - 1))))
+            continue;
+
+          if (HAL_OK != HAL_TIM_OC_Stop_IT(timer_handle, sl_ul_port_timer_get_channel(i)))
+          {
+            g_e_error_code = SETUP_ERROR;
+            ERROR_HANDLE("port timer oc stop failed!\n");
+            return g_e_error_code;
+          }
         }
         timer_info->is_running = false;
         break;
@@ -1521,8 +1619,9 @@ error_code_e e_port_timer_oc_init(const uint8_t timer_num, const uint16_t timer_
   memset(timer_info, 0, sizeof(port_timer_info_t));
 
   /* TIM 设置模式 */
-  timer_info->type        = PORT_TIMER_OC;
-  timer_info->channel_num = timer_channel_num;
+  timer_info->type         = PORT_TIMER_OC;
+  timer_info->channel_num  = timer_channel_num;
+  timer_info->channel_mask = (uint8_t)(1 << (timer_channel_num - 1));
   /*
     ---------------------频率计算公式---------------------
        clk_frequency   /   (arr + 1)   *   (psc + 1)
@@ -1563,12 +1662,237 @@ timer_oc_init_err:
 }
 
 /**
- * @brief port TIM 解除初始化
+ * @brief port TIM 输出比较模式 追加(重新配置)通道
+ *
+ * @note   定时器需已通过 e_port_timer_oc_init 初始化; 通道比较值开启预装载, 在更新事件时生效
+ * @param  timer_num          TIM 通道编号
+ * @param  timer_channel_num  TIM 通道编码(1~4)
+ * @param  timer_oc_mode      TIM 输出比较工作模式
+ * @param  timer_compare      TIM 初始比较值
+ * @return error_code_e       错误代码
+ */
+error_code_e e_port_timer_oc_channel_init(const uint8_t timer_num, const uint8_t timer_channel_num, const port_timer_oc_mode_e timer_oc_mode, const uint16_t timer_compare)
+{
+  /* TIM 输入参数合法性检查 */
+  if (timer_num < 1 || timer_num > TIMER_COUNT || timer_channel_num < 1 || timer_channel_num > 4)
+  {
+    g_e_error_code = UNDEFINED_ERROR;
+    ERROR_HANDLE("port timer invalid number!\n");
+    return g_e_error_code;
+  }
+
+  /* TIM 获取指针 */
+  TIM_HandleTypeDef* timer_handle = g_apt_port_timer_handle[timer_num - 1];
+  port_timer_info_t* timer_info   = s_apt_port_timer_info[timer_num - 1];
+
+  /* TIM 空指针判断 */
+  if (NULL == timer_info || NULL == timer_handle)
+  {
+    g_e_error_code = NO_INIT_ERROR;
+    ERROR_HANDLE("port timer this timer is not init!\n");
+    return g_e_error_code;
+  }
+
+  if (PORT_TIMER_OC != timer_info->type)
+  {
+    g_e_error_code = UNDEFINED_ERROR;
+    ERROR_HANDLE("port timer type not support!\n");
+    return g_e_error_code;
+  }
+
+  uint32_t           timer_channel   = sl_ul_port_timer_get_channel(timer_channel_num);
+  uint8_t            timer_bit       = (uint8_t)(1 << (timer_channel_num - 1));
+  TIM_OC_InitTypeDef timer_oc_config = { 0 };
+
+  /* TIM 运行中的通道需先停止 */
+  if (true == timer_info->is_running && 0 != (timer_info->channel_mask & timer_bit))
+    HAL_TIM_OC_Stop_IT(timer_handle, timer_channel);
+
+  /* TIM 输出比较配置 */
+  timer_oc_config.OCMode     = s_ul_port_timer_get_oc_mode(timer_oc_mode);
+  timer_oc_config.Pulse      = timer_compare;
+  timer_oc_config.OCPolarity = TIM_OCPOLARITY_HIGH;
+  timer_oc_config.OCFastMode = TIM_OCFAST_DISABLE;
+  if (HAL_OK != HAL_TIM_OC_ConfigChannel(timer_handle, &timer_oc_config, timer_channel))
+  {
+    g_e_error_code = INIT_ERROR;
+    ERROR_HANDLE("port timer oc config channel failed!\n");
+    return g_e_error_code;
+  }
+
+  /* TIM 比较值预装载使能 */
+  __HAL_TIM_ENABLE_OCxPRELOAD(timer_handle, timer_channel);
+  timer_info->channel_mask |= timer_bit;
+
+  /* TIM 运行中则立即开启该通道 */
+  if (true == timer_info->is_running)
+  {
+    if (HAL_OK != HAL_TIM_OC_Start_IT(timer_handle, timer_channel))
+    {
+      g_e_error_code = SETUP_ERROR;
+      ERROR_HANDLE("port timer oc start failed!\n");
+      return g_e_error_code;
+    }
+  }
+
+  return SUCESS;
+}
+
+/**
+ * @brief port TIM 设置通道比较值(寄存器直写, 可在中断中调用)
+ *
+ * @param  timer_num          TIM 通道编号
+ * @param  timer_channel_num  TIM 通道编码(1~4)
+ * @param  timer_compare      TIM 比较值
+ * @return error_code_e       错误代码
+ */
+error_code_e e_port_timer_set_compare(const uint8_t timer_num, const uint8_t timer_channel_num, const uint16_t timer_compare)
+{
+  /* TIM 输入参数合法性检查 */
+  if (timer_num < 1 || timer_num > TIMER_COUNT || timer_channel_num < 1 || timer_channel_num > 4)
+  {
+    g_e_error_code = UNDEFINED_ERROR;
+    ERROR_HANDLE("port timer invalid number!\n");
+    return g_e_error_code;
+  }
+
+  /* TIM 获取指针 */
+  TIM_HandleTypeDef* timer_handle = g_apt_port_timer_handle[timer_num - 1];
+
+  /* TIM 空指针判断 */
+  if (NULL == timer_handle)
+  {
+    g_e_error_code = NO_INIT_ERROR;
+    ERROR_HANDLE("port timer this timer is not init!\n");
+    return g_e_error_code;
+  }
+
+  __HAL_TIM_SET_COMPARE(timer_handle, sl_ul_port_timer_get_channel(timer_channel_num), timer_compare);
+  return SUCESS;
+}
+
+/**
+ * @brief port TIM 设置重复计数值(仅高级定时器TIM1/TIM8, 可在中断中调用)
+ *
+ * @note   写入值在下一次更新事件时生效, 更新事件每 (timer_repetition + 1) 个计数周期产生一次
+ * @param  timer_num          TIM 通道编号
+ * @param  timer_repetition   TIM 重复计数值(0~255)
+ * @return error_code_e       错误代码
+ */
+error_code_e e_port_timer_set_repetition(const uint8_t timer_num, const uint8_t timer_repetition)
+{
+  /* TIM 输入参数合法性检查 */
+  if (1 != timer_num && 8 != timer_num)
+  {
+    g_e_error_code = UNDEFINED_ERROR;
+    ERROR_HANDLE("port timer repetition counter not support!\n");
+    return g_e_error_code;
+  }
+
+  /* TIM 获取指针 */
+  TIM_HandleTypeDef* timer_handle = g_apt_port_timer_handle[timer_num - 1];
+
+  /* TIM 空指针判断 */
+  if (NULL == timer_handle)
+  {
+    g_e_error_code = NO_INIT_ERROR;
+    ERROR_HANDLE("port timer this timer is not init!\n");
+    return g_e_error_code;
+  }
+
+  timer_handle->Instance->RCR = timer_repetition;
+  return SUCESS;
+}
+
+/**
+ * @brief port TIM 设置自动重装载值(寄存器直写, 可在中断中调用)
  *
+ * @note   开启自动重装载预装载时, 写入值在下一次更新事件时生效
  * @param  timer_num      TIM 通道编号
+ * @param  timer_arr      TIM 自动重装载值
  * @return error_code_e   错误代码
  */
-error_code_e e_port_timer_deinit(const uint8_t timer_num)
+error_code_e e_port_timer_set_autoreload(const uint8_t timer_num, const uint32_t timer_arr)
+{
+  /* TIM 输入参数合法性检查 */
+  if (timer_num < 1 || timer_num > TIMER_COUNT)
+  {
+    g_e_error_code = UNDEFINED_ERROR;
+    ERROR_HANDLE("port timer invalid number!\n");
+    return g_e_error_code;
+  }
+
+  /* TIM 获取指针 */
+  TIM_HandleTypeDef* timer_handle = g_apt_port_timer_handle[timer_num - 1];
+
+  /* TIM 空指针判断 */
+  if (NULL == timer_handle)
+  {
+    g_e_error_code = NO_INIT_ERROR;
+    ERROR_HANDLE("port timer this timer is not init!\n");
+    return g_e_error_code;
+  }
+
+  timer_handle->Instance->ARR = timer_arr;
+  return SUCESS;
+}
+
+/**
+ * @brief port TIM 获取自动重装载寄存器地址(供DMA数据流写入)
+ *
+ * @param  timer_num  TIM 通道编号
+ * @return uint32_t   自动重装载寄存器地址，未初始化返回0
+ */
+uint32_t ul_port_timer_get_autoreload_address(const uint8_t timer_num)
+{
+  if (timer_num < 1 || timer_num > TIMER_COUNT || NULL == g_apt_port_timer_handle[timer_num - 1])
+    return 0;
+
+  return (uint32_t)&g_apt_port_timer_handle[timer_num - 1]->Instance->ARR;
+}
+
+/**
+ * @brief port TIM 软件产生更新事件(立即装载预装载寄存器并复位计数器, 不触发更新中断)
+ *
+ * @param  timer_num      TIM 通道编号
+ * @return error_code_e   错误代码
+ */
+error_code_e e_port_timer_generate_update(const uint8_t timer_num)
+{
+  /* TIM 输入参数合法性检查 */
+  if (timer_num < 1 || timer_num > TIMER_COUNT)
+  {
+    g_e_error_code = UNDEFINED_ERROR;
+    ERROR_HANDLE("port timer invalid number!\n");
+    return g_e_error_code;
+  }
+
+  /* TIM 获取指针 */
+  TIM_HandleTypeDef* timer_handle = g_apt_port_timer_handle[timer_num - 1];
+
+  /* TIM 空指针判断 */
+  if (NULL == timer_handle)
+  {
+    g_e_error_code = NO_INIT_ERROR;
+    ERROR_HANDLE("port timer this timer is not init!\n");
+    return g_e_error_code;
+  }
+
+  /* URS置位: 软件更新事件不置位更新中断标志 */
+  timer_handle->Instance->CR1 |= TIM_CR1_URS;
+  timer_handle->Instance->EGR  = TIM_EGR_UG;
+  timer_handle->Instance->CR1 &= ~TIM_CR1_URS;
+  return SUCESS;
+}
+
+/**
+ * @brief port TIM 输出比较模式 设置更新事件回调函数
+ *
+ * @param  timer_num        TIM 通道编号
+ * @param  timer_callback   TIM 回调函数(为NULL时关闭更新中断)
+ * @return error_code_e     错误代码
+ */
+error_code_e e_port_timer_oc_set_update_callback(const uint8_t timer_num, const port_timer_callback_t* timer_callback)
 {
   /* TIM 输入参数合法性检查 */
   if (timer_num < 1 || timer_num > TIMER_COUNT)
@@ -1584,13 +1908,572 @@ error_code_e e_port_timer_deinit(const uint8_t timer_num)
 
   /* TIM 空指针判断 */
   if (NULL == timer_info || NULL == timer_handle)
+  {
+    g_e_error_code = NO_INIT_ERROR;
+    ERROR_HANDLE("port timer this timer is not init!\n");
     return g_e_error_code;
+  }
 
-  /* TIM 停止工作 */
-  if (SUCESS != e_port_timer_stop(timer_num))
+  if (PORT_TIMER_OC != timer_info->type)
   {
-    g_e_error_code = SETUP_ERROR;
-    ERROR_HANDLE("port timer stop failed!\n");
+    g_e_error_code = UNDEFINED_ERROR;
+    ERROR_HANDLE("port timer type not support!\n");
+    return g_e_error_code;
+  }
+
+  if (NULL == timer_callback)
+  {
+    /* TIM 关闭更新中断 */
+    __HAL_TIM_DISABLE_IT(timer_handle, TIM_IT_UPDATE);
+    memset(&timer_info->callback, 0, sizeof(port_timer_callback_t));
+    return SUCESS;
+  }
+
+  memcpy(&timer_info->callback, timer_callback, sizeof(port_timer_callback_t));
+
+  /* TIM 开启更新中断 */
+  __HAL_TIM_CLEAR_IT(timer_handle, TIM_IT_UPDATE);
+  __HAL_TIM_ENABLE_IT(timer_handle, TIM_IT_UPDATE);
+  HAL_NVIC_SetPriority(sl_e_port_timer_get_irqn(timer_num), TIMER_NVIC_DEF_PRIORITY, 0);
+  HAL_NVIC_EnableIRQ(sl_e_port_timer_get_irqn(timer_num));
+  return SUCESS;
+}
+
+/**
+ * @brief (静态) port TIM 获取 HAL库 TIM DMA 突发传输起始寄存器
+ *
+ * @param  timer_dma_base TIM DMA 突发传输起始寄存器
+ * @return uint32_t       TIM DMA 突发传输起始寄存器HAL库编码
+ */
+static uint32_t s_ul_port_timer_get_dma_base(const port_timer_dma_base_e timer_dma_base)
+{
+  switch (timer_dma_base)
+  {
+    case PORT_TIMER_DMA_BASE_ARR :
+      return TIM_DMABASE_ARR;
+    case PORT_TIMER_DMA_BASE_RCR :
+      return TIM_DMABASE_RCR;
+    case PORT_TIMER_DMA_BASE_CCR1 :
+      return TIM_DMABASE_CCR1;
+
+    default :
+      g_e_error_code = UNDEFINED_ERROR;
+      ERROR_HANDLE("port timer get dma base error!\n");
+      return TIM_DMABASE_CCR1;
+  }
+}
+
+/**
+ * @brief (静态内联) port TIM DMA 配置编码
+ *
+ * @param  dma_direction  DMA 数据流方向
+ * @param  dma_mode       DMA 工作模式
+ * @param  dma_width      DMA 数据宽度
+ * @return uint8_t        配置编码
+ */
+static inline uint8_t sl_uc_port_timer_dma_config(const port_dma_direction_e dma_direction, const port_dma_mode_e dma_mode, const port_dma_data_width_e dma_width)
+{
+  return (uint8_t)(((uint8_t)dma_direction << 3) | ((uint8_t)dma_mode << 2) | (uint8_t)dma_width);
+}
+
+/**
+ * @brief (静态) port TIM DMA请求 初始化(配置不同时重新初始化)
+ *
+ * @param  timer_num      TIM 通道编号
+ * @param  timer_request  TIM DMA请求
+ * @param  dma_direction  DMA 数据流方向
+ * @param  dma_mode       DMA 工作模式
+ * @param  dma_width      DMA 数据宽度(外设与内存相同)
+ * @return error_code_e   错误代码
+ */
+static error_code_e s_e_port_timer_dma_init(const uint8_t timer_num, const port_timer_dma_request_e timer_request, const port_dma_direction_e dma_direction, const port_dma_mode_e dma_mode, const port_dma_data_width_e dma_width)
+{
+  const uint8_t*     dma_info   = sc_auc_port_timer_dma_info[timer_num - 1][timer_request];
+  port_timer_info_t* timer_info = s_apt_port_timer_info[timer_num - 1];
+  const uint8_t      config     = sl_uc_port_timer_dma_config(dma_direction, dma_mode, dma_width);
+
+  if ((timer_info->dma_init_mask & (1U << timer_request)) && config == timer_info->dma_config[timer_request])
+    return SUCESS;
+
+  if (timer_info->dma_init_mask & (1U << timer_request))
+  {
+    e_port_dma_deinit(dma_info[0], dma_info[1]);
+    timer_info->dma_init_mask &= ~(1U << timer_request);
+  }
+
+  if (SUCESS != e_port_dma_init(dma_info[0], dma_info[1], dma_info[2], dma_direction, dma_mode, PORT_DMA_VERY_HIGH))
+    return g_e_error_code;
+
+  if (SUCESS != e_port_dma_set_data_width(dma_info[0], dma_info[1], dma_width, dma_width))
+  {
+    e_port_dma_deinit(dma_info[0], dma_info[1]);
+    return g_e_error_code;
+  }
+
+  __HAL_LINKDMA(g_apt_port_timer_handle[timer_num - 1], hdma[sc_aus_port_timer_dma_id[timer_request]], *pt_port_dma_get_handle(dma_info[0], dma_info[1]));
+  timer_info->dma_config[timer_request]  = config;
+  timer_info->dma_init_mask             |= (1U << timer_request);
+  return SUCESS;
+}
+
+/**
+ * @brief (静态) port TIM DMA请求 解除初始化
+ *
+ * @param timer_num      TIM 通道编号
+ * @param timer_request  TIM DMA请求
+ */
+static void s_v_port_timer_dma_deinit(const uint8_t timer_num, const port_timer_dma_request_e timer_request)
+{
+  const uint8_t* dma_info = sc_auc_port_timer_dma_info[timer_num - 1][timer_request];
+
+  e_port_dma_deinit(dma_info[0], dma_info[1]);
+  g_apt_port_timer_handle[timer_num - 1]->hdma[sc_aus_port_timer_dma_id[timer_request]]  = NULL;
+  s_apt_port_timer_info[timer_num - 1]->dma_init_mask                                   &= ~(1U << timer_request);
+}
+
+/**
+ * @brief (静态) port TIM 查找DMA句柄对应的定时器与DMA请求
+ *
+ * @param  hdma           DMA HAL库句柄结构体指针
+ * @param  timer_request  TIM DMA请求(输出)
+ * @return int            TIM 下标，未找到返回-1
+ */
+static int s_i_port_timer_dma_find(const DMA_HandleTypeDef* hdma, port_timer_dma_request_e* timer_request)
+{
+  TIM_HandleTypeDef* timer_handle = (TIM_HandleTypeDef*)hdma->Parent;
+
+  for (uint8_t i = 0; i < TIMER_COUNT; i++)
+  {
+    if (g_apt_port_timer_handle[i] != timer_handle || NULL == s_apt_port_timer_info[i])
+      continue;
+
+    for (uint8_t j = 0; j < TIMER_DMA_REQUEST_COUNT; j++)
+    {
+      if (timer_handle->hdma[sc_aus_port_timer_dma_id[j]] == hdma)
+      {
+        *timer_request = (port_timer_dma_request_e)j;
+        return i;
+      }
+    }
+  }
+  return -1;
+}
+
+/**
+ * @brief (静态) port TIM DMA 传输完成回调函数(普通模式下关闭DMA请求后通知使用者)
+ *
+ * @param hdma DMA HAL库句柄结构体指针
+ */
+static void s_v_port_timer_dma_cplt_callback(DMA_HandleTypeDef* hdma)
+{
+  port_timer_dma_request_e timer_request = PORT_TIMER_DMA_UPDATE;
+  int                      index         = s_i_port_timer_dma_find(hdma, &timer_request);
+  if (index < 0)
+    return;
+
+  if (DMA_CIRCULAR != hdma->Init.Mode)
+    __HAL_TIM_DISABLE_DMA(g_apt_port_timer_handle[index], sc_aul_port_timer_dma_source[timer_request]);
+
+  port_timer_callback_t* callback = &s_apt_port_timer_info[index]->dma_callback[timer_request];
+  if (callback->function)
+    callback->function(callback->arg);
+}
+
+/**
+ * @brief (静态) port TIM DMA 传输过半回调函数
+ *
+ * @param hdma DMA HAL库句柄结构体指针
+ */
+static void s_v_port_timer_dma_half_callback(DMA_HandleTypeDef* hdma)
+{
+  port_timer_dma_request_e timer_request = PORT_TIMER_DMA_UPDATE;
+  int                      index         = s_i_port_timer_dma_find(hdma, &timer_request);
+  if (index < 0)
+    return;
+
+  port_timer_callback_t* callback = &s_apt_port_timer_info[index]->dma_half_callback[timer_request];
+  if (callback->function)
+    callback->function(callback->arg);
+}
+
+/**
+ * @brief (静态) port TIM DMA 传输错误回调函数(关闭DMA请求, 不通知使用者)
+ *
+ * @param hdma DMA HAL库句柄结构体指针
+ */
+static void s_v_port_timer_dma_error_callback(DMA_HandleTypeDef* hdma)
+{
+  port_timer_dma_request_e timer_request = PORT_TIMER_DMA_UPDATE;
+  int                      index         = s_i_port_timer_dma_find(hdma, &timer_request);
+  if (index < 0)
+    return;
+
+  __HAL_TIM_DISABLE_DMA(g_apt_port_timer_handle[index], sc_aul_port_timer_dma_source[timer_request]);
+}
+
+/**
+ * @brief (静态) port TIM DMA请求 数据流传输开始
+ *
+ * @param  timer_num              TIM 通道编号
+ * @param  timer_request          TIM DMA请求
+ * @param  dma_direction          DMA 数据流方向(内存到外设 或 外设到内存)
+ * @param  periph_address         外设寄存器地址
+ * @param  timer_data             内存缓存区(需在传输完成前保持有效)
+ * @param  timer_count            传输数量
+ * @param  dma_width              DMA 数据宽度
+ * @param  dma_mode               DMA 工作模式
+ * @param  timer_half_callback    传输过半回调函数(可为NULL)
+ * @param  timer_cplt_callback    传输完成回调函数(可为NULL)
+ * @return error_code_e           错误代码
+ */
+static error_code_e s_e_port_timer_dma_start(const uint8_t timer_num, const port_timer_dma_request_e timer_request, const port_dma_direction_e dma_direction, const uint32_t periph_address, const void* timer_data, const uint16_t timer_count, const port_dma_data_width_e dma_width, const port_dma_mode_e dma_mode, const port_timer_callback_t* timer_half_callback, const port_timer_callback_t* timer_cplt_callback)
+{
+  /* TIM 输入参数合法性检查 */
+  if (timer_num < 1 || timer_num > TIMER_COUNT || timer_request >= TIMER_DMA_REQUEST_COUNT || 0 == sc_auc_port_timer_dma_info[timer_num - 1][timer_request][0] || 0 == periph_address || NULL == timer_data || 0 == timer_count)
+  {
+    g_e_error_code = UNDEFINED_ERROR;
+    ERROR_HANDLE("port timer dma stream invalid parameter!\n");
+    return g_e_error_code;
+  }
+
+  /* TIM 获取指针 */
+  TIM_HandleTypeDef* timer_handle = g_apt_port_timer_handle[timer_num - 1];
+  port_timer_info_t* timer_info   = s_apt_port_timer_info[timer_num - 1];
+
+  /* TIM 空指针判断 */
+  if (NULL == timer_info || NULL == timer_handle)
+  {
+    g_e_error_code = NO_INIT_ERROR;
+    ERROR_HANDLE("port timer this timer is not init!\n");
+    return g_e_error_code;
+  }
+
+  /* TIM DMA请求 首次使用或配置变化时初始化 */
+  DMA_HandleTypeDef* dma_handle = timer_handle->hdma[sc_aus_port_timer_dma_id[timer_request]];
+  if (NULL != dma_handle && HAL_DMA_STATE_READY != dma_handle->State)
+  {
+    g_e_error_code = SETUP_ERROR;
+    ERROR_HANDLE("port timer dma is busy!\n");
+    return g_e_error_code;
+  }
+
+  if (SUCESS != s_e_port_timer_dma_init(timer_num, timer_request, dma_direction, dma_mode, dma_width))
+  {
+    ERROR_HANDLE("port timer dma init failed!\n");
+    return g_e_error_code;
+  }
+  dma_handle = timer_handle->hdma[sc_aus_port_timer_dma_id[timer_request]];
+
+  if (timer_cplt_callback)
+    memcpy(&timer_info->dma_callback[timer_request], timer_cplt_callback, sizeof(port_timer_callback_t));
+  else
+    memset(&timer_info->dma_callback[timer_request], 0, sizeof(port_timer_callback_t));
+
+  if (timer_half_callback)
+    memcpy(&timer_info->dma_half_callback[timer_request], timer_half_callback, sizeof(port_timer_callback_t));
+  else
+    memset(&timer_info->dma_half_callback[timer_request], 0, sizeof(port_timer_callback_t));
+
+  dma_handle->XferCpltCallback     = s_v_port_timer_dma_cplt_callback;
+  dma_handle->XferHalfCpltCallback = timer_half_callback ? s_v_port_timer_dma_half_callback : NULL;
+  dma_handle->XferErrorCallback    = s_v_port_timer_dma_error_callback;
+
+  /* HAL库 源地址/目标地址 按数据流方向排列 */
+  uint32_t src_address = (PORT_DMA_PERIPH_TO_MEMORY == dma_direction) ? periph_address : (uint32_t)timer_data;
+  uint32_t dst_address = (PORT_DMA_PERIPH_TO_MEMORY == dma_direction) ? (uint32_t)timer_data : periph_address;
+  if (HAL_OK != HAL_DMA_Start_IT(dma_handle, src_address, dst_address, timer_count))
+  {
+    g_e_error_code = TRANSFER_ERROR;
+    ERROR_HANDLE("port timer dma start failed!\n");
+    return g_e_error_code;
+  }
+
+  /* TIM 开启DMA请求 */
+  __HAL_TIM_ENABLE_DMA(timer_handle, sc_aul_port_timer_dma_source[timer_request]);
+  return SUCESS;
+}
+
+/**
+ * @brief port TIM DMA请求 数据流传输开始(每次请求将一个数据写入指定外设地址)
+ *
+ * @note   更新事件请求写入预装载寄存器时, 于下一次更新事件生效; 循环模式下由传输过半/完成回调函数填充缓存区
+ * @param  timer_num              TIM 通道编号
+ * @param  timer_request          TIM DMA请求
+ * @param  periph_address         外设寄存器地址(可为其他外设, 如GPIO BSRR)
+ * @param  timer_data             传输数据(需在传输完成前保持有效)
+ * @param  timer_count            传输数量
+ * @param  dma_width              DMA 数据宽度
+ * @param  dma_mode               DMA 工作模式
+ * @param  timer_half_callback    传输过半回调函数(可为NULL)
+ * @param  timer_cplt_callback    传输完成回调函数(可为NULL)
+ * @return error_code_e           错误代码
+ */
+error_code_e e_port_timer_dma_stream_start(const uint8_t timer_num, const port_timer_dma_request_e timer_request, const uint32_t periph_address, const void* timer_data, const uint16_t timer_count, const port_dma_data_width_e dma_width, const port_dma_mode_e dma_mode, const port_timer_callback_t* timer_half_callback, const port_timer_callback_t* timer_cplt_callback)
+{
+  return s_e_port_timer_dma_start(timer_num, timer_request, PORT_DMA_MEMORY_TO_PERIPH, periph_address, timer_data, timer_count, dma_width, dma_mode, timer_half_callback, timer_cplt_callback);
+}
+
+/**
+ * @brief port TIM DMA请求 数据流传输停止
+ *
+ * @param  timer_num      TIM 通道编号
+ * @param  timer_request  TIM DMA请求
+ * @return error_code_e   错误代码
+ */
+error_code_e e_port_timer_dma_stream_stop(const uint8_t timer_num, const port_timer_dma_request_e timer_request)
+{
+  /* TIM 输入参数合法性检查 */
+  if (timer_num < 1 || timer_num > TIMER_COUNT || timer_request >= TIMER_DMA_REQUEST_COUNT)
+  {
+    g_e_error_code = UNDEFINED_ERROR;
+    ERROR_HANDLE("port timer invalid number!\n");
+    return g_e_error_code;
+  }
+
+  /* TIM 获取指针 */
+  TIM_HandleTypeDef* timer_handle = g_apt_port_timer_handle[timer_num - 1];
+  port_timer_info_t* timer_info   = s_apt_port_timer_info[timer_num - 1];
+
+  /* TIM 空指针判断 */
+  if (NULL == timer_info || NULL == timer_handle)
+  {
+    g_e_error_code = NO_INIT_ERROR;
+    ERROR_HANDLE("port timer this timer is not init!\n");
+    return g_e_error_code;
+  }
+
+  if (0 == (timer_info->dma_init_mask & (1U << timer_request)))
+    return SUCESS;
+
+  /* TIM 关闭DMA请求并终止传输 */
+  DMA_HandleTypeDef* dma_handle = timer_handle->hdma[sc_aus_port_timer_dma_id[timer_request]];
+  __HAL_TIM_DISABLE_DMA(timer_handle, sc_aul_port_timer_dma_source[timer_request]);
+  if (HAL_DMA_STATE_BUSY == dma_handle->State && HAL_OK != HAL_DMA_Abort(dma_handle))
+  {
+    g_e_error_code = SETUP_ERROR;
+    ERROR_HANDLE("port timer dma abort failed!\n");
+    return g_e_error_code;
+  }
+
+  return SUCESS;
+}
+
+/**
+ * @brief port TIM 更新事件DMA 突发传输开始(每次更新事件将一组数据写入从起始寄存器开始的连续寄存器)
+ *
+ * @note   数据在更新事件时写入预装载寄存器, 于下一次更新事件生效; 全部数据传输完成后在中断中调用回调函数
+ * @param  timer_num            TIM 通道编号
+ * @param  timer_dma_base       TIM DMA 突发传输起始寄存器
+ * @param  timer_burst_length   TIM 每次更新事件传输的寄存器数量(1~18)
+ * @param  timer_data           TIM 传输数据(半字, 需在传输完成前保持有效)
+ * @param  timer_burst_count    TIM 突发传输次数(更新事件数)
+ * @param  timer_callback       TIM 传输完成回调函数(可为NULL)
+ * @return error_code_e         错误代码
+ */
+error_code_e e_port_timer_dma_burst_start(const uint8_t timer_num, const port_timer_dma_base_e timer_dma_base, const uint8_t timer_burst_length, const uint16_t* timer_data, const uint16_t timer_burst_count, const port_timer_callback_t* timer_callback)
+{
+  /* TIM 输入参数合法性检查 */
+  if (timer_num < 1 || timer_num > TIMER_COUNT || timer_burst_length < 1 || timer_burst_length > 18 || (uint32_t)timer_burst_length * timer_burst_count > 0xFFFF)
+  {
+    g_e_error_code = UNDEFINED_ERROR;
+    ERROR_HANDLE("port timer dma burst invalid parameter!\n");
+    return g_e_error_code;
+  }
+
+  TIM_HandleTypeDef* timer_handle = g_apt_port_timer_handle[timer_num - 1];
+  if (NULL == timer_handle)
+  {
+    g_e_error_code = NO_INIT_ERROR;
+    ERROR_HANDLE("port timer this timer is not init!\n");
+    return g_e_error_code;
+  }
+
+  /* TIM 传输进行中不修改突发传输配置 */
+  if (NULL != timer_handle->hdma[TIM_DMA_ID_UPDATE] && HAL_DMA_STATE_READY != timer_handle->hdma[TIM_DMA_ID_UPDATE]->State)
+  {
+    g_e_error_code = SETUP_ERROR;
+    ERROR_HANDLE("port timer dma is busy!\n");
+    return g_e_error_code;
+  }
+
+  /* TIM 突发传输配置: 起始寄存器 + 传输长度, 目标为DMAR */
+  timer_handle->Instance->DCR = s_ul_port_timer_get_dma_base(timer_dma_base) | ((uint32_t)(timer_burst_length - 1) << TIM_DCR_DBL_Pos);
+  return e_port_timer_dma_stream_start(timer_num, PORT_TIMER_DMA_UPDATE, (uint32_t)&timer_handle->Instance->DMAR, timer_data, (uint16_t)(timer_burst_length * timer_burst_count), PORT_DMA_HALFWORD, PORT_DMA_NORMAL, NULL, timer_callback);
+}
+
+/**
+ * @brief port TIM 更新事件DMA 突发传输停止
+ *
+ * @param  timer_num      TIM 通道编号
+ * @return error_code_e   错误代码
+ */
+error_code_e e_port_timer_dma_burst_stop(const uint8_t timer_num)
+{
+  return e_port_timer_dma_stream_stop(timer_num, PORT_TIMER_DMA_UPDATE);
+}
+
+/**
+ * @brief port TIM 输入捕获DMA 开始(每次捕获由DMA将捕获值写入缓存区, 不产生捕获中断)
+ *
+ * @note   32位定时器(TIM2, TIM5)按字传输, 其余按半字传输; 循环模式下由传输过半/完成回调函数取走数据
+ * @param  timer_num              TIM 通道编号(需已按输入捕获模式初始化)
+ * @param  timer_data             捕获值缓存区(需在捕获停止前保持有效)
+ * @param  timer_count            缓存区容量(捕获值数量)
+ * @param  dma_mode               DMA 工作模式
+ * @param  timer_half_callback    传输过半回调函数(可为NULL)
+ * @param  timer_cplt_callback    传输完成回调函数(可为NULL)
+ * @return error_code_e           错误代码
+ */
+error_code_e e_port_timer_ic_dma_start(const uint8_t timer_num, void* timer_data, const uint16_t timer_count, const port_dma_mode_e dma_mode, const port_timer_callback_t* timer_half_callback, const port_timer_callback_t* timer_cplt_callback)
+{
+  /* TIM 输入参数合法性检查 */
+  if (timer_num < 1 || timer_num > TIMER_COUNT)
+  {
+    g_e_error_code = UNDEFINED_ERROR;
+    ERROR_HANDLE("port timer invalid number!\n");
+    return g_e_error_code;
+  }
+
+  /* TIM 获取指针 */
+  TIM_HandleTypeDef* timer_handle = g_apt_port_timer_handle[timer_num - 1];
+  port_timer_info_t* timer_info   = s_apt_port_timer_info[timer_num - 1];
+
+  /* TIM 空指针判断 */
+  if (NULL == timer_info || NULL == timer_handle || PORT_TIMER_IC != timer_info->type)
+  {
+    g_e_error_code = NO_INIT_ERROR;
+    ERROR_HANDLE("port timer this timer is not init as input capture!\n");
+    return g_e_error_code;
+  }
+
+  if (true == timer_info->is_running)
+  {
+    g_e_error_code = SETUP_ERROR;
+    ERROR_HANDLE("port timer ic is running!\n");
+    return g_e_error_code;
+  }
+
+  /* TIM 捕获寄存器 CCR1~CCR4 地址连续 */
+  const port_timer_dma_request_e timer_request  = (port_timer_dma_request_e)(PORT_TIMER_DMA_CC1 + timer_info->channel_num - 1);
+  const uint32_t                 periph_address = (uint32_t)(&timer_handle->Instance->CCR1 + (timer_info->channel_num - 1));
+  const port_dma_data_width_e    dma_width      = IS_TIM_32B_COUNTER_INSTANCE(timer_handle->Instance) ? PORT_DMA_WORD : PORT_DMA_HALFWORD;
+
+  if (SUCESS != s_e_port_timer_dma_start(timer_num, timer_request, PORT_DMA_PERIPH_TO_MEMORY, periph_address, timer_data, timer_count, dma_width, dma_mode, timer_half_callback, timer_cplt_callback))
+    return g_e_error_code;
+
+  /* TIM 使能(开始输入捕获, 不开启捕获中断) */
+  if (HAL_OK != HAL_TIM_IC_Start(timer_handle, sl_ul_port_timer_get_channel(timer_info->channel_num)))
+  {
+    e_port_timer_dma_stream_stop(timer_num, timer_request);
+    g_e_error_code = SETUP_ERROR;
+    ERROR_HANDLE("port timer ic dma start failed!\n");
+    return g_e_error_code;
+  }
+
+  timer_info->is_running = true;
+  return SUCESS;
+}
+
+/**
+ * @brief port TIM 输入捕获DMA 停止(先停止捕获再终止传输, 终止后可读取剩余传输数量)
+ *
+ * @param  timer_num      TIM 通道编号
+ * @return error_code_e   错误代码
+ */
+error_code_e e_port_timer_ic_dma_stop(const uint8_t timer_num)
+{
+  /* TIM 输入参数合法性检查 */
+  if (timer_num < 1 || timer_num > TIMER_COUNT)
+  {
+    g_e_error_code = UNDEFINED_ERROR;
+    ERROR_HANDLE("port timer invalid number!\n");
+    return g_e_error_code;
+  }
+
+  /* TIM 获取指针 */
+  TIM_HandleTypeDef* timer_handle = g_apt_port_timer_handle[timer_num - 1];
+  port_timer_info_t* timer_info   = s_apt_port_timer_info[timer_num - 1];
+
+  /* TIM 空指针判断 */
+  if (NULL == timer_info || NULL == timer_handle || PORT_TIMER_IC != timer_info->type)
+  {
+    g_e_error_code = NO_INIT_ERROR;
+    ERROR_HANDLE("port timer this timer is not init as input capture!\n");
+    return g_e_error_code;
+  }
+
+  if (false == timer_info->is_running)
+    return SUCESS;
+
+  if (HAL_OK != HAL_TIM_IC_Stop(timer_handle, sl_ul_port_timer_get_channel(timer_info->channel_num)))
+  {
+    g_e_error_code = SETUP_ERROR;
+    ERROR_HANDLE("port timer ic dma stop failed!\n");
+    return g_e_error_code;
+  }
+  timer_info->is_running = false;
+
+  return e_port_timer_dma_stream_stop(timer_num, (port_timer_dma_request_e)(PORT_TIMER_DMA_CC1 + timer_info->channel_num - 1));
+}
+
+/**
+ * @brief port TIM DMA请求 获取剩余传输数量(循环模式下用于计算写入位置, 可在中断中调用)
+ *
+ * @param  timer_num      TIM 通道编号
+ * @param  timer_request  TIM DMA请求
+ * @return uint16_t       剩余传输数量，未初始化返回0
+ */
+uint16_t us_port_timer_dma_get_remaining(const uint8_t timer_num, const port_timer_dma_request_e timer_request)
+{
+  if (timer_num < 1 || timer_num > TIMER_COUNT || timer_request >= TIMER_DMA_REQUEST_COUNT || NULL == g_apt_port_timer_handle[timer_num - 1])
+    return 0;
+
+  DMA_HandleTypeDef* dma_handle = g_apt_port_timer_handle[timer_num - 1]->hdma[sc_aus_port_timer_dma_id[timer_request]];
+  if (NULL == dma_handle)
+    return 0;
+
+  return (uint16_t)__HAL_DMA_GET_COUNTER(dma_handle);
+}
+
+/**
+ * @brief port TIM 解除初始化
+ *
+ * @param  timer_num      TIM 通道编号
+ * @return error_code_e   错误代码
+ */
+error_code_e e_port_timer_deinit(const uint8_t timer_num)
+{
+  /* TIM 输入参数合法性检查 */
+  if (timer_num < 1 || timer_num > TIMER_COUNT)
+  {
+    g_e_error_code = UNDEFINED_ERROR;
+    ERROR_HANDLE("port timer invalid number!\n");
+    return g_e_error_code;
+  }
+
+  /* TIM 获取指针 */
+  TIM_HandleTypeDef* timer_handle = g_apt_port_timer_handle[timer_num - 1];
+  port_timer_info_t* timer_info   = s_apt_port_timer_info[timer_num - 1];
+
+  /* TIM 空指针判断 */
+  if (NULL == timer_info || NULL == timer_handle)
+    return g_e_error_code;
+
+  /* TIM 停止工作 */
+  if (SUCESS != e_port_timer_stop(timer_num))
+  {
+    g_e_error_code = SETUP_ERROR;
+    ERROR_HANDLE("port timer stop failed!\n");
+  }
+
+  /* TIM DMA请求 解除初始化 */
+  for (uint8_t i = 0; i < TIMER_DMA_REQUEST_COUNT; i++)
+  {
+    if (timer_info->dma_init_mask & (1U << i))
+    {
+      e_port_timer_dma_stream_stop(timer_num, (port_timer_dma_request_e)i);
+      s_v_port_timer_dma_deinit(timer_num, (port_timer_dma_request_e)i);
+    }
   }
 
   /* TIM 端口解除初始化 */
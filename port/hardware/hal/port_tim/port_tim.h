@@ -18,9 +18,12 @@ extern "C"
 
 #include <stdbool.h>
 #include "error_handle.h"
+#include "port_dma.h"
 
 /// @brief TIM 定时器总数
-#define TIMER_COUNT 14
+#define TIMER_COUNT             14
+/// @brief TIM DMA请求总数 (更新事件, 比较通道1~4)
+#define TIMER_DMA_REQUEST_COUNT 5
 
   /// @brief port TIM 工作模式
   typedef enum PORT_TIMER_TYPE_E
@@ -53,6 +56,24 @@ extern "C"
     PORT_TIMER_FORCED_INACTIVE, /* port TIM 强制非激活模式 */
   } port_timer_oc_mode_e;
 
+  /// @brief port TIM DMA 突发传输起始寄存器
+  typedef enum PORT_TIMER_DMA_BASE_E
+  {
+    PORT_TIMER_DMA_BASE_ARR,  /* port TIM DMA 突发传输 自动重装载寄存器起始 */
+    PORT_TIMER_DMA_BASE_RCR,  /* port TIM DMA 突发传输 重复计数寄存器起始 */
+    PORT_TIMER_DMA_BASE_CCR1, /* port TIM DMA 突发传输 比较寄存器1起始 */
+  } port_timer_dma_base_e;
+
+  /// @brief port TIM DMA请求
+  typedef enum PORT_TIMER_DMA_REQUEST_E
+  {
+    PORT_TIMER_DMA_UPDATE, /* port TIM DMA请求 更新事件 */
+    PORT_TIMER_DMA_CC1,    /* port TIM DMA请求 比较通道1 */
+    PORT_TIMER_DMA_CC2,    /* port TIM DMA请求 比较通道2 */
+    PORT_TIMER_DMA_CC3,    /* port TIM DMA请求 比较通道3 */
+    PORT_TIMER_DMA_CC4,    /* port TIM DMA请求 比较通道4 */
+  } port_timer_dma_request_e;
+
   /// @brief port TIM 回调函数结构体
   typedef struct PORT_TIMER_CALLBACK_T
   {
@@ -61,6 +82,7 @@ extern "C"
   } port_timer_callback_t;
 
   extern uint32_t     ul_port_timer_get_gpio_af(const uint8_t timer_num);
+  extern uint32_t     ul_port_timer_get_clock(const uint8_t timer_num);
   extern error_code_e e_port_timer_start(const uint8_t timer_num);
   extern error_code_e e_port_timer_stop(const uint8_t timer_num);
   extern bool         b_port_timer_wait_semaphore(const uint8_t timer_num, uint32_t waiting_time);
@@ -71,6 +93,20 @@ extern "C"
   extern error_code_e e_port_timer_normal_init(const uint8_t timer_num, const uint16_t timer_psc, const uint16_t timer_arr, const port_timer_counter_mode_e timer_counter_mode, const uint8_t timer_division, const port_timer_callback_t* timer_callback);
   extern error_code_e e_port_timer_ic_init(const uint8_t timer_num, const uint16_t timer_psc, const uint16_t timer_arr, const uint8_t timer_channel_num, const uint8_t timer_ic_prescaler, const port_timer_counter_mode_e timer_counter_mode, const uint8_t timer_division, const bool timer_auto_reload);
   extern error_code_e e_port_timer_oc_init(const uint8_t timer_num, const uint16_t timer_psc, const uint16_t timer_arr, const uint8_t timer_channel_num, const port_timer_oc_mode_e timer_oc_mode, const port_timer_counter_mode_e timer_counter_mode, const uint8_t timer_division, const bool timer_auto_reload);
+  extern error_code_e e_port_timer_oc_channel_init(const uint8_t timer_num, const uint8_t timer_channel_num, const port_timer_oc_mode_e timer_oc_mode, const uint16_t timer_compare);
+  extern error_code_e e_port_timer_set_compare(const uint8_t timer_num, const uint8_t timer_channel_num, const uint16_t timer_compare);
+  extern error_code_e e_port_timer_set_repetition(const uint8_t timer_num, const uint8_t timer_repetition);
+  extern error_code_e e_port_timer_set_autoreload(const uint8_t timer_num, const uint32_t timer_arr);
+  extern uint32_t     ul_port_timer_get_autoreload_address(const uint8_t timer_num);
+  extern error_code_e e_port_timer_generate_update(const uint8_t timer_num);
+  extern error_code_e e_port_timer_oc_set_update_callback(const uint8_t timer_num, const port_timer_callback_t* timer_callback);
+  extern error_code_e e_port_timer_dma_burst_start(const uint8_t timer_num, const port_timer_dma_base_e timer_dma_base, const uint8_t timer_burst_length, const uint16_t* timer_data, const uint16_t timer_burst_count, const port_timer_callback_t* timer_callback);
+  extern error_code_e e_port_timer_dma_burst_stop(const uint8_t timer_num);
+  extern error_code_e e_port_timer_dma_stream_start(const uint8_t timer_num, const port_timer_dma_request_e timer_request, const uint32_t periph_address, const void* timer_data, const uint16_t timer_count, const port_dma_data_width_e dma_width, const port_dma_mode_e dma_mode, const port_timer_callback_t* timer_half_callback, const port_timer_callback_t* timer_cplt_callback);
+  extern error_code_e e_port_timer_dma_stream_stop(const uint8_t timer_num, const port_timer_dma_request_e timer_request);
+  extern error_code_e e_port_timer_ic_dma_start(const uint8_t timer_num, void* timer_data, const uint16_t timer_count, const port_dma_mode_e dma_mode, const port_timer_callback_t* timer_half_callback, const port_timer_callback_t* timer_cplt_callback);
+  extern error_code_e e_port_timer_ic_dma_stop(const uint8_t timer_num);
+  extern uint16_t     us_port_timer_dma_get_remaining(const uint8_t timer_num, const port_timer_dma_request_e timer_request);
   extern error_code_e e_port_timer_deinit(const uint8_t timer_num);
 
 #if __cplusplus
@@ -221,6 +221,30 @@ bool b_port_os_timer_start(port_os_timer_t timer, const uint32_t period_ms)
   }
 }
 
+bool b_port_os_timer_restart(port_os_timer_t timer, const uint32_t period_ms)
+{
+  if (NULL == timer || 0 == period_ms)
+  {
+    g_e_error_code = NO_INIT_ERROR;
+    ERROR_HANDLE("port os restart timer error!\n");
+    return false;
+  }
+  else
+  {
+    if (sl_b_port_os_is_in_isr())
+    {
+      BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+      if (pdPASS != xTimerChangePeriodFromISR((TimerHandle_t)timer, pdMS_TO_TICKS(period_ms), &xHigherPriorityTaskWoken))
+        return false;
+      if (xHigherPriorityTaskWoken == pdTRUE)
+        portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+      return true;
+    }
+    else
+      return pdPASS == xTimerChangePeriod((TimerHandle_t)timer, pdMS_TO_TICKS(period_ms), 0U);
+  }
+}
+
 bool b_port_os_timer_stop(port_os_timer_t timer)
 {
   if (NULL == timer)
@@ -44,6 +44,7 @@ extern "C"
   extern port_os_timer_t     pt_port_os_timer_create(const char* const name, const uint32_t period_ms, const bool auto_reload, port_os_timer_callback_t callback, void* arg);
   extern void*               pv_port_os_timer_get_arg(port_os_timer_t timer);
   extern bool                b_port_os_timer_start(port_os_timer_t timer, const uint32_t period_ms);
+  extern bool                b_port_os_timer_restart(port_os_timer_t timer, const uint32_t period_ms);
   extern bool                b_port_os_timer_stop(port_os_timer_t timer);
   extern bool                b_port_os_timer_delete(port_os_timer_t timer);
   extern port_os_mutex_t     pt_port_os_mutex_create();
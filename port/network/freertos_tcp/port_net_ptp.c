@@ -0,0 +1,249 @@
+#include "port_net_ptp.h"
+#include "port_include.h"
+#include "port_system.h"
+
+/// @brief PTP 接收时间戳记录数量
+#define PORT_NET_PTP_RX_COUNT 8
+/// @brief PTP 时间更新等待上限(次)
+#define PORT_NET_PTP_WAIT     100000
+
+typedef struct PORT_NET_PTP_RX_T
+{
+  uint32_t            source;
+  uint16_t            sequence;
+  uint8_t             type;
+  uint8_t             valid;
+  port_net_ptp_time_t time;
+} port_net_ptp_rx_t;
+
+static bool              s_b_port_net_ptp_init    = false;
+static uint32_t          s_ul_port_net_ptp_addend = 0;
+static uint8_t           s_uc_port_net_ptp_rx_index;
+static port_net_ptp_rx_t s_t_port_net_ptp_rx[PORT_NET_PTP_RX_COUNT];
+
+static inline uint16_t sl_us_port_net_ptp_read16(const uint8_t* data)
+{
+  return (uint16_t)((data[0] << 8) | data[1]);
+}
+
+static bool s_b_port_net_ptp_wait(uint32_t flag)
+{
+  for (uint32_t i = 0; i < PORT_NET_PTP_WAIT; i++)
+  {
+    if (0 == (ETH->PTPTSCR & flag))
+      return true;
+  }
+  return false;
+}
+
+error_code_e e_port_net_ptp_init()
+{
+  if (s_b_port_net_ptp_init)
+    return SUCESS;
+
+  /* MAC时钟由网络接口初始化时打开 */
+  if (0 == (RCC->AHB1ENR & RCC_AHB1ENR_ETHMACEN))
+  {
+    g_e_error_code = NO_INIT_ERROR;
+    ERROR_HANDLE("port ptp eth mac not init!\n");
+    return g_e_error_code;
+  }
+
+  uint32_t clock = ul_port_system_get_clock();
+  /* 亚秒增量取HCLK周期的2倍(ns, 向上取整), 累加器目标频率 1e9/ssir 低于HCLK, 基础加数约为2^31 */
+  uint32_t ssir  = (2000000000U + clock - 1) / clock;
+  if (ssir > 0xFF)
+  {
+    g_e_error_code = INIT_ERROR;
+    ERROR_HANDLE("port ptp clock too low!\n");
+    return g_e_error_code;
+  }
+
+  s_ul_port_net_ptp_addend = (uint32_t)((1000000000ULL << 32) / ((uint64_t)ssir * clock));
+
+  /* 时间戳使能, 所有接收帧记录时间戳, 亚秒按ns计数(数字回滚), 精细更新 */
+  ETH->MACIMR |= ETH_MACIMR_TSTIM;
+  ETH->PTPTSCR = ETH_PTPTSCR_TSE | ETH_PTPTSCR_TSSARFE | ETH_PTPTSCR_TSSSR;
+  ETH->PTPSSIR = ssir;
+  ETH->PTPTSAR = s_ul_port_net_ptp_addend;
+  ETH->PTPTSCR |= ETH_PTPTSCR_TSARU;
+  if (!s_b_port_net_ptp_wait(ETH_PTPTSCR_TSARU))
+  {
+    g_e_error_code = INIT_ERROR;
+    ERROR_HANDLE("port ptp addend update timeout!\n");
+    return g_e_error_code;
+  }
+  ETH->PTPTSCR  |= ETH_PTPTSCR_TSFCU;
+
+  ETH->PTPTSHUR  = 0;
+  ETH->PTPTSLUR  = 0;
+  ETH->PTPTSCR  |= ETH_PTPTSCR_TSSTI;
+  if (!s_b_port_net_ptp_wait(ETH_PTPTSCR_TSSTI))
+  {
+    g_e_error_code = INIT_ERROR;
+    ERROR_HANDLE("port ptp time init timeout!\n");
+    return g_e_error_code;
+  }
+
+  memset(s_t_port_net_ptp_rx, 0, sizeof(s_t_port_net_ptp_rx));
+  s_uc_port_net_ptp_rx_index = 0;
+  s_b_port_net_ptp_init      = true;
+  return SUCESS;
+}
+
+bool b_port_net_ptp_is_init()
+{
+  return s_b_port_net_ptp_init;
+}
+
+void v_port_net_ptp_get_time(port_net_ptp_time_t* time)
+{
+  uint32_t seconds;
+  uint32_t nanoseconds;
+
+  /* 读取期间秒进位时重读 */
+  do
+  {
+    seconds     = ETH->PTPTSHR;
+    nanoseconds = ETH->PTPTSLR & ETH_PTPTSLR_STSS;
+  } while (seconds != ETH->PTPTSHR);
+
+  time->seconds     = seconds;
+  time->nanoseconds = nanoseconds;
+}
+
+error_code_e e_port_net_ptp_set_time(const port_net_ptp_time_t* time)
+{
+  if (!s_b_port_net_ptp_init)
+  {
+    g_e_error_code = NO_INIT_ERROR;
+    ERROR_HANDLE("port ptp not init!\n");
+    return g_e_error_code;
+  }
+
+  if (time->nanoseconds >= 1000000000U)
+  {
+    g_e_error_code = SETUP_ERROR;
+    ERROR_HANDLE("port ptp nanoseconds out of range!\n");
+    return g_e_error_code;
+  }
+
+  ETH->PTPTSHUR  = time->seconds;
+  ETH->PTPTSLUR  = time->nanoseconds;
+  ETH->PTPTSCR  |= ETH_PTPTSCR_TSSTI;
+  if (!s_b_port_net_ptp_wait(ETH_PTPTSCR_TSSTI))
+  {
+    g_e_error_code = SETUP_ERROR;
+    ERROR_HANDLE("port ptp time init timeout!\n");
+    return g_e_error_code;
+  }
+  return SUCESS;
+}
+
+error_code_e e_port_net_ptp_step(int64_t ns)
+{
+  if (!s_b_port_net_ptp_init)
+  {
+    g_e_error_code = NO_INIT_ERROR;
+    ERROR_HANDLE("port ptp not init!\n");
+    return g_e_error_code;
+  }
+
+  /* 读取与重新初始化在临界区内完成 (减法更新的亚秒编码随MAC版本不同, 统一按绝对时间写入) */
+  v_port_os_enter_critical();
+  port_net_ptp_time_t now;
+  v_port_net_ptp_get_time(&now);
+
+  int64_t total = (int64_t)now.seconds * 1000000000LL + now.nanoseconds + ns;
+  if (total < 0)
+    total = 0;
+
+  port_net_ptp_time_t time = { (uint32_t)(total / 1000000000LL), (uint32_t)(total % 1000000000LL) };
+  error_code_e        ret  = e_port_net_ptp_set_time(&time);
+  v_port_os_exit_critical();
+  return ret;
+}
+
+error_code_e e_port_net_ptp_set_ppb(int32_t ppb)
+{
+  if (!s_b_port_net_ptp_init)
+  {
+    g_e_error_code = NO_INIT_ERROR;
+    ERROR_HANDLE("port ptp not init!\n");
+    return g_e_error_code;
+  }
+
+  int64_t addend = (int64_t)s_ul_port_net_ptp_addend + (int64_t)s_ul_port_net_ptp_addend * ppb / 1000000000LL;
+  if (addend <= 0 || addend > 0xFFFFFFFFLL)
+  {
+    g_e_error_code = SETUP_ERROR;
+    ERROR_HANDLE("port ptp frequency adjust out of range!\n");
+    return g_e_error_code;
+  }
+
+  if (!s_b_port_net_ptp_wait(ETH_PTPTSCR_TSARU))
+  {
+    g_e_error_code = SETUP_ERROR;
+    ERROR_HANDLE("port ptp addend busy!\n");
+    return g_e_error_code;
+  }
+  ETH->PTPTSAR  = (uint32_t)addend;
+  ETH->PTPTSCR |= ETH_PTPTSCR_TSARU;
+  return SUCESS;
+}
+
+void v_port_net_ptp_rx_hook(const uint8_t* frame, uint32_t length, uint32_t stamp_high, uint32_t stamp_low)
+{
+  if (!s_b_port_net_ptp_init || NULL == frame)
+    return;
+
+  /* 以太网头(14) + IPv4头(>=20) + UDP头(8) + PTP头(34) */
+  if (length < 14 + 20 + 8 + 34 || 0x0800 != sl_us_port_net_ptp_read16(&frame[12]))
+    return;
+
+  const uint8_t* ip        = &frame[14];
+  uint32_t       ip_length = (uint32_t)(ip[0] & 0x0F) * 4;
+  if (0x40 != (ip[0] & 0xF0) || ip_length < 20 || 17 != ip[9] || 0 != (sl_us_port_net_ptp_read16(&ip[6]) & 0x3FFF))
+    return;
+
+  if (length < 14 + ip_length + 8 + 34)
+    return;
+
+  const uint8_t* udp = ip + ip_length;
+  if (PORT_NET_PTP_EVENT_PORT != sl_us_port_net_ptp_read16(&udp[2]))
+    return;
+
+  /* PTP头: 报文类型在首字节低4位, 序号在偏移30 */
+  const uint8_t*     ptp   = udp + 8;
+  port_net_ptp_rx_t* entry = &s_t_port_net_ptp_rx[s_uc_port_net_ptp_rx_index];
+
+  v_port_os_enter_critical();
+  memcpy(&entry->source, &ip[12], sizeof(uint32_t));
+  entry->type                = ptp[0] & 0x0F;
+  entry->sequence            = sl_us_port_net_ptp_read16(&ptp[30]);
+  entry->time.seconds        = stamp_high;
+  entry->time.nanoseconds    = stamp_low & ETH_PTPTSLR_STSS;
+  entry->valid               = 1;
+  s_uc_port_net_ptp_rx_index = (s_uc_port_net_ptp_rx_index + 1) % PORT_NET_PTP_RX_COUNT;
+  v_port_os_exit_critical();
+}
+
+bool b_port_net_ptp_rx_stamp(uint32_t source, uint8_t type, uint16_t sequence, port_net_ptp_time_t* time)
+{
+  bool found = false;
+
+  v_port_os_enter_critical();
+  for (uint8_t i = 0; i < PORT_NET_PTP_RX_COUNT; i++)
+  {
+    port_net_ptp_rx_t* entry = &s_t_port_net_ptp_rx[i];
+    if (entry->valid && entry->source == source && entry->type == type && entry->sequence == sequence)
+    {
+      *time        = entry->time;
+      entry->valid = 0;
+      found        = true;
+      break;
+    }
+  }
+  v_port_os_exit_critical();
+  return found;
+}
@@ -0,0 +1,37 @@
+#ifndef __PORT_NET_PTP_H__
+#define __PORT_NET_PTP_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+#include <stdbool.h>
+#include "error_handle.h"
+
+/// @brief PTP 事件报文UDP端口 (Sync / Delay_Req, 接收时记录MAC时间戳)
+#define PORT_NET_PTP_EVENT_PORT   319
+/// @brief PTP 普通报文UDP端口 (Follow_Up / Delay_Resp)
+#define PORT_NET_PTP_GENERAL_PORT 320
+
+  /// @brief 结构体 PTP 时间 (MAC系统时间)
+  typedef struct PORT_NET_PTP_TIME_T
+  {
+    uint32_t seconds;
+    uint32_t nanoseconds;
+  } port_net_ptp_time_t;
+
+  extern error_code_e e_port_net_ptp_init();
+  extern bool         b_port_net_ptp_is_init();
+  extern void         v_port_net_ptp_get_time(port_net_ptp_time_t* time);
+  extern error_code_e e_port_net_ptp_set_time(const port_net_ptp_time_t* time);
+  extern error_code_e e_port_net_ptp_step(int64_t ns);
+  extern error_code_e e_port_net_ptp_set_ppb(int32_t ppb);
+  extern void         v_port_net_ptp_rx_hook(const uint8_t* frame, uint32_t length, uint32_t stamp_high, uint32_t stamp_low);
+  extern bool         b_port_net_ptp_rx_stamp(uint32_t source, uint8_t type, uint16_t sequence, port_net_ptp_time_t* time);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __PORT_NET_PTP_H__ */
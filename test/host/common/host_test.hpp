@@ -0,0 +1,72 @@
+/**
+ * @file      host_test.hpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library host test helpers (主机测试 断言与计时)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#ifndef __HOST_TEST_HPP__
+#define __HOST_TEST_HPP__
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+/// @brief 主机测试 失败计数
+inline int& host_test_failures()
+{
+  static int s_failures = 0;
+  return s_failures;
+}
+
+/// @brief 主机测试 断言 (失败时打印位置并计数, 不中断后续用例)
+#define HOST_CHECK(cond)                                                \
+  do                                                                    \
+  {                                                                     \
+    if (!(cond))                                                        \
+    {                                                                   \
+      std::printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond);       \
+      host_test_failures()++;                                           \
+    }                                                                   \
+  } while (0)
+
+/**
+ * @brief 主机测试 结束并返回进程退出码
+ *
+ * @param  name 测试名称
+ * @return int  全部通过返回0
+ */
+inline int host_test_result(const char* name)
+{
+  std::printf("%s: %s (%d failures)\n", name, host_test_failures() ? "FAILED" : "passed", host_test_failures());
+  return host_test_failures() ? 1 : 0;
+}
+
+/**
+ * @brief 主机测试 计时 (返回每次调用的平均耗时)
+ *
+ * @param  iterations 调用次数
+ * @param  body       被测函数
+ * @return double     平均耗时(ns)
+ */
+template <typename Body>
+inline double host_bench(uint32_t iterations, Body&& body)
+{
+  auto start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < iterations; i++)
+    body(i);
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+}
+
+/// @brief 主机测试 阻止编译器优化掉基准测试结果
+template <typename T>
+inline void host_keep(const T& value)
+{
+  asm volatile("" : : "g"(&value) : "memory");
+}
+
+#endif /* __HOST_TEST_HPP__ */
@@ -0,0 +1,133 @@
+/**
+ * @file      ir_ac_test.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library host test for IR air conditioner frames (红外遥控 空调状态帧与已知有效载荷比对测试)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "host_test.hpp"
+#include "ir_ac.hpp"
+#include "ir_protocol.hpp"
+
+#include <cstring>
+
+using namespace OwO::device;
+
+/**
+ * @brief (静态) 生成状态帧并与已知有效载荷比对, 且可按品牌协议编码
+ */
+static bool sl_same(ir_type type, const ir_ac_state_t& state, const uint8_t* expect, uint8_t expect_length)
+{
+  uint8_t data[IR_AC::MAX_LENGTH];
+  uint8_t length = 0;
+  if (ir_ac_error::NONE != IR_AC::build(type, state, data, sizeof(data), length) || length != expect_length)
+    return false;
+  if (0 != std::memcmp(data, expect, expect_length))
+    return false;
+
+  static ir_pulse_t buffer[IR_Timeline::MAX_PULSES];
+  IR_Timeline       timeline;
+  timeline.attach(buffer, IR_Timeline::MAX_PULSES);
+  return IR_Protocol::encode(*IR_Protocol::get(type), data, length, timeline);
+}
+
+/**
+ * @brief (静态) 已知有效载荷: 开机, 制冷, 自动风, 无摆风, 24℃
+ */
+static void sl_check_reference()
+{
+  const ir_ac_state_t cool = { true, ir_ac_mode::COOL, ir_ac_fan::AUTO, false, 24 };
+
+  const uint8_t aux[13]     = { 0xC3, 0x87, 0xE0, 0x00, 0xA0, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x08, 0x12 };
+  const uint8_t tcl[28]     = { 0x23, 0xCB, 0x26, 0x01, 0x00, 0x24, 0x03, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x83,
+                                0x23, 0xCB, 0x26, 0x01, 0x00, 0x24, 0x03, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, 0x83 };
+  const uint8_t midea[12]   = { 0xA1, 0x80, 0x47, 0xFF, 0xFF, 0x59, 0x5E, 0x7F, 0xB8, 0x00, 0x00, 0xA6 };
+  const uint8_t segment[10] = { 0x09, 0x08, 0x20, 0x50, 0x02, 0x00, 0x00, 0x10, 0x00, 0x68 };
+  uint8_t       gree[30];
+  for (int i = 0; i < 3; i++)
+    std::memcpy(gree + i * 10, segment, sizeof(segment));
+
+  HOST_CHECK(sl_same(ir_type::AUX, cool, aux, sizeof(aux)));
+  HOST_CHECK(sl_same(ir_type::TCL, cool, tcl, sizeof(tcl)));
+  HOST_CHECK(sl_same(ir_type::GREE, cool, gree, sizeof(gree)));
+  HOST_CHECK(sl_same(ir_type::MIDEA, cool, midea, sizeof(midea)));
+
+  /* 美的 自动模式 25℃ */
+  const ir_ac_state_t automatic = { true, ir_ac_mode::AUTO, ir_ac_fan::AUTO, false, 25 };
+  uint8_t             data[IR_AC::MAX_LENGTH];
+  uint8_t             length = 0;
+  HOST_CHECK(ir_ac_error::NONE == IR_AC::build(ir_type::MIDEA, automatic, data, sizeof(data), length));
+  HOST_CHECK(0x82 == data[1] && 0x48 == data[2]);
+}
+
+/**
+ * @brief (静态) 关机, 制热, 高风, 摆风, 30℃ 各字段与校验和
+ */
+static void sl_check_fields()
+{
+  const ir_ac_state_t heat = { false, ir_ac_mode::HEAT, ir_ac_fan::HIGH, true, 30 };
+  uint8_t             data[IR_AC::MAX_LENGTH];
+  uint8_t             length = 0;
+
+  HOST_CHECK(ir_ac_error::NONE == IR_AC::build(ir_type::GREE, heat, data, sizeof(data), length));
+  HOST_CHECK((4 | (3 << 4) | 0x40) == data[0] && 14 == data[1]);
+
+  HOST_CHECK(ir_ac_error::NONE == IR_AC::build(ir_type::AUX, heat, data, sizeof(data), length));
+  HOST_CHECK((22 << 3) == data[1] && 0x20 == data[4] && 0x80 == data[6] && 0 == data[9]);
+  uint8_t sum = 0;
+  for (int i = 0; i < 12; i++)
+    sum += data[i];
+  HOST_CHECK(sum == data[12]);
+
+  HOST_CHECK(ir_ac_error::NONE == IR_AC::build(ir_type::TCL, heat, data, sizeof(data), length));
+  HOST_CHECK(0x20 == data[5] && 1 == data[6] && 1 == data[7] && (0x40 | 0x38 | 5) == data[8]);
+
+  HOST_CHECK(ir_ac_error::NONE == IR_AC::build(ir_type::MIDEA, heat, data, sizeof(data), length));
+  HOST_CHECK(((3 << 3) | 3) == data[1] && (0x40 | 13) == data[2]);
+  for (int i = 0; i < 6; i++)
+    HOST_CHECK(static_cast<uint8_t>(~data[i]) == data[6 + i]);
+}
+
+/**
+ * @brief (静态) 不支持的品牌, 越界的状态字段与缓存区不足
+ */
+static void sl_check_errors()
+{
+  const ir_ac_state_t cool = { true, ir_ac_mode::COOL, ir_ac_fan::AUTO, false, 24 };
+  uint8_t             data[IR_AC::MAX_LENGTH];
+  uint8_t             length = 9;
+
+  HOST_CHECK(ir_ac_error::BRAND == IR_AC::build(ir_type::OUTES, cool, data, sizeof(data), length) && 0 == length);
+  HOST_CHECK(ir_ac_error::BRAND == IR_AC::build(ir_type::XIAOMI, cool, data, sizeof(data), length));
+  HOST_CHECK(ir_ac_error::BRAND == IR_AC::build(ir_type::HISENSE, cool, data, sizeof(data), length));
+  HOST_CHECK(!IR_AC::is_supported(ir_type::OUTES));
+
+  ir_ac_state_t state = cool;
+  state.temperature   = 16;
+  HOST_CHECK(ir_ac_error::TEMPERATURE == IR_AC::build(ir_type::MIDEA, state, data, sizeof(data), length));
+  state.temperature = 31;
+  HOST_CHECK(ir_ac_error::TEMPERATURE == IR_AC::build(ir_type::GREE, state, data, sizeof(data), length));
+  state.temperature = 32;
+  HOST_CHECK(ir_ac_error::NONE == IR_AC::build(ir_type::AUX, state, data, sizeof(data), length));
+  state.mode = static_cast<ir_ac_mode>(5);
+  HOST_CHECK(ir_ac_error::MODE == IR_AC::build(ir_type::AUX, state, data, sizeof(data), length));
+  state.mode = ir_ac_mode::DRY;
+  state.fan  = static_cast<ir_ac_fan>(4);
+  HOST_CHECK(ir_ac_error::FAN == IR_AC::build(ir_type::AUX, state, data, sizeof(data), length));
+
+  HOST_CHECK(ir_ac_error::SIZE == IR_AC::build(ir_type::GREE, cool, data, 29, length));
+
+  uint8_t min = 0, max = 0;
+  HOST_CHECK(IR_AC::range(ir_type::TCL, min, max) && 16 == min && 31 == max);
+}
+
+int main()
+{
+  sl_check_reference();
+  sl_check_fields();
+  sl_check_errors();
+  return host_test_result("ir_ac_test");
+}
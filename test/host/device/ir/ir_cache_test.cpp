@@ -0,0 +1,157 @@
+/**
+ * @file      ir_cache_test.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library host test and benchmark for IR timeline cache (红外遥控 时序缓存测试与编码/命中耗时基准)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "host_test.hpp"
+#include "ir_cache.hpp"
+
+#include <cstdlib>
+
+using namespace OwO::device;
+
+/// @brief 测试载波设置
+static constexpr uint32_t sc_carrier = 38000;
+/// @brief 奥克斯指令长度 (106个脉冲, 占用4个内存块)
+static constexpr uint8_t  sc_length  = 13;
+
+/**
+ * @brief (静态) 按编码流程访问缓存: 命中返回1, 未命中并编码写入返回0, 无法预留返回-1
+ *
+ * @param cache  时序缓存
+ * @param data   指令数据
+ * @param pinned 保持占用(不释放)
+ */
+static int sl_access(IR_Cache& cache, const uint8_t* data, bool pinned)
+{
+  const ir_protocol_t& protocol = *IR_Protocol::get(ir_type::AUX);
+  ir_cache_key_t       key      = IR_Cache::make_key(ir_type::AUX, data, sc_length, sc_carrier);
+
+  int entry = cache.find(key, data);
+  if (entry >= 0)
+  {
+    HOST_CHECK(cache.size(entry) == IR_Protocol::count(protocol, sc_length));
+    if (!pinned)
+      cache.release(static_cast<uint8_t>(entry));
+    return 1;
+  }
+
+  entry = cache.reserve(key, data, IR_Protocol::count(protocol, sc_length));
+  if (entry < 0)
+    return -1;
+
+  IR_Timeline timeline;
+  timeline.attach(cache.data(entry), cache.capacity(entry));
+  HOST_CHECK(IR_Protocol::encode(protocol, data, sc_length, timeline));
+  cache.commit(static_cast<uint8_t>(entry), timeline.size());
+  if (!pinned)
+    cache.release(static_cast<uint8_t>(entry));
+  return 0;
+}
+
+/**
+ * @brief (静态) 命中, 最近最少使用淘汰, 占用中的条目不可淘汰
+ */
+static void sl_check_lru()
+{
+  static IR_Cache cache;
+  uint8_t         data[IR_Cache::ENTRY_COUNT][sc_length];
+  for (auto& payload : data)
+  {
+    for (uint8_t& byte : payload)
+      byte = static_cast<uint8_t>(std::rand());
+  }
+
+  /* 16个条目 x 4个内存块 = 64个内存块, 全部可缓存 */
+  for (const auto& payload : data)
+    HOST_CHECK(0 == sl_access(cache, payload, false));
+  for (const auto& payload : data)
+    HOST_CHECK(1 == sl_access(cache, payload, false));
+  HOST_CHECK(IR_Cache::ENTRY_COUNT == cache.hits());
+  HOST_CHECK(IR_Cache::ENTRY_COUNT == cache.misses());
+
+  /* 新指令淘汰最近最少使用的条目 (第0条) */
+  uint8_t        other[sc_length] = { 1, 2, 3 };
+  ir_cache_key_t key              = IR_Cache::make_key(ir_type::AUX, other, sc_length, sc_carrier);
+  int            entry            = cache.reserve(key, other, 106);
+  HOST_CHECK(entry >= 0);
+  if (entry >= 0)
+    cache.discard(static_cast<uint8_t>(entry));
+  HOST_CHECK(0 == sl_access(cache, data[0], false));
+
+  /* 散列相同但数据不同不命中 */
+  uint8_t changed[sc_length];
+  for (uint8_t i = 0; i < sc_length; i++)
+    changed[i] = data[1][i];
+  changed[sc_length - 1] ^= 0x01;
+  HOST_CHECK(cache.find(IR_Cache::make_key(ir_type::AUX, data[1], sc_length, sc_carrier), changed) < 0);
+
+  /* 全部条目占用中: 预留失败, 不淘汰 */
+  for (const auto& payload : data)
+    sl_access(cache, payload, true);
+  uint8_t busy[sc_length] = { 9 };
+  HOST_CHECK(cache.reserve(IR_Cache::make_key(ir_type::AUX, busy, sc_length, sc_carrier), busy, 106) < 0);
+}
+
+/**
+ * @brief (静态) 各品牌编码耗时与缓存命中耗时
+ */
+static void sl_bench()
+{
+  static const ir_type sc_types[]   = { ir_type::AUX, ir_type::TCL, ir_type::GREE, ir_type::OUTES, ir_type::MIDEA, ir_type::XIAOMI, ir_type::HISENSE };
+  static const uint8_t sc_lengths[] = { 13, 28, 30, 15, 24, 19, 23 };
+  static ir_pulse_t    buffer[IR_Timeline::MAX_PULSES];
+  constexpr uint32_t   iterations = 100000;
+
+  for (uint8_t b = 0; b < sizeof(sc_types) / sizeof(sc_types[0]); b++)
+  {
+    const ir_protocol_t& protocol = *IR_Protocol::get(sc_types[b]);
+    static IR_Cache      cache;
+    uint8_t              data[32];
+    for (uint8_t& byte : data)
+      byte = static_cast<uint8_t>(std::rand());
+
+    double encode = host_bench(iterations, [&](uint32_t) {
+      IR_Timeline timeline;
+      timeline.attach(buffer, IR_Timeline::MAX_PULSES);
+      IR_Protocol::encode(protocol, data, sc_lengths[b], timeline);
+      host_keep(timeline);
+    });
+
+    cache.clear();
+    ir_cache_key_t key   = IR_Cache::make_key(sc_types[b], data, sc_lengths[b], sc_carrier);
+    int            entry = cache.reserve(key, data, IR_Protocol::count(protocol, sc_lengths[b]));
+    HOST_CHECK(entry >= 0);
+    if (entry < 0)
+      continue;
+    IR_Timeline filled;
+    filled.attach(cache.data(entry), cache.capacity(entry));
+    IR_Protocol::encode(protocol, data, sc_lengths[b], filled);
+    cache.commit(static_cast<uint8_t>(entry), filled.size());
+    cache.release(static_cast<uint8_t>(entry));
+
+    double hit = host_bench(iterations, [&](uint32_t) {
+      ir_cache_key_t lookup = IR_Cache::make_key(sc_types[b], data, sc_lengths[b], sc_carrier);
+      int            found  = cache.find(lookup, data);
+      IR_Timeline    timeline;
+      timeline.attach(cache.data(found), cache.size(found), cache.size(found));
+      host_keep(timeline);
+      cache.release(static_cast<uint8_t>(found));
+    });
+
+    std::printf("brand %u: %3u pulses  encode %7.1f ns  cache hit %6.1f ns  (%.1fx)\n", b, filled.size(), encode, hit, encode / hit);
+  }
+}
+
+int main()
+{
+  std::srand(6);
+  sl_check_lru();
+  sl_bench();
+  return host_test_result("ir_cache_test");
+}
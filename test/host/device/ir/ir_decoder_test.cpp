@@ -0,0 +1,141 @@
+/**
+ * @file      ir_decoder_test.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library host test for IR decoder (红外遥控 合成接收波形解码校验测试)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "host_test.hpp"
+#include "ir_decoder.hpp"
+#include "ir_learn.hpp"
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace OwO::device;
+
+/// @brief 接收头标记展宽(us) (空闲相应缩短)
+static constexpr int sc_bias   = 100;
+/// @brief 边沿抖动(us)
+static constexpr int sc_jitter = 60;
+
+static std::mt19937 s_random(7);
+static ir_pulse_t   s_buffer[IR_Timeline::MAX_PULSES];
+static ir_pulse_t   s_capture[IR_Timeline::MAX_PULSES];
+
+/**
+ * @brief (静态) 合成接收头解调后的捕获: 标记展宽, 边沿抖动, 可选帧前毛刺, 经学习器还原为脉冲序列
+ */
+static uint16_t sl_capture(const ir_pulse_t* pulses, uint16_t size, bool noise)
+{
+  std::vector<uint32_t> stamps;
+  uint32_t              time = 1000;
+  if (noise)
+  {
+    stamps.push_back(time);
+    stamps.push_back(time += 150);
+    time += 3000;
+  }
+  for (uint16_t i = 0; i < size; i++)
+  {
+    int jitter = static_cast<int>(s_random() % (2 * sc_jitter + 1)) - sc_jitter;
+    int mark   = pulses[i].mark + sc_bias + jitter;
+    int space  = (0 != pulses[i].space) ? pulses[i].space - sc_bias - jitter : 0;
+    stamps.push_back(time);
+    stamps.push_back(time += mark);
+    time += (space > 0) ? space : 0;
+  }
+
+  IR_Learner learner;
+  learner.reset(s_capture, IR_Timeline::MAX_PULSES, 1000000, 32);
+  learner.feed(stamps.data(), static_cast<uint16_t>(stamps.size()));
+  return learner.finish();
+}
+
+/**
+ * @brief (静态) 各品牌各长度: 合成捕获可解码且与请求一致, 单比特差异与截断可检出
+ */
+static void sl_check_brands()
+{
+  struct
+  {
+    ir_type type;
+    uint8_t length;
+  } const sc_cases[] = {
+    { ir_type::AUX,     13 },
+    { ir_type::TCL,     28 },
+    { ir_type::GREE,    30 },
+    { ir_type::OUTES,   15 },
+    { ir_type::MIDEA,   6  },
+    { ir_type::MIDEA,   24 },
+    { ir_type::XIAOMI,  12 },
+    { ir_type::XIAOMI,  19 },
+    { ir_type::HISENSE, 21 },
+    { ir_type::HISENSE, 23 },
+  };
+
+  for (const auto& item : sc_cases)
+  {
+    const ir_protocol_t* protocol = IR_Protocol::get(item.type);
+    for (int round = 0; round < 50; round++)
+    {
+      uint8_t data[IR_Decoder::MAX_LENGTH];
+      for (uint8_t i = 0; i < item.length; i++)
+        data[i] = static_cast<uint8_t>(s_random());
+
+      IR_Timeline timeline;
+      timeline.attach(s_buffer, IR_Timeline::MAX_PULSES);
+      HOST_CHECK(IR_Protocol::encode(*protocol, data, item.length, timeline));
+
+      uint16_t count  = sl_capture(timeline.data(), timeline.size(), 0 != (round & 1));
+      uint16_t errors = 99;
+      HOST_CHECK(ir_decode_error::NONE == IR_Decoder::verify(*protocol, data, item.length, s_capture, count, errors) && 0 == errors);
+
+      /* 请求中一个实际发送的比特不同: 检出1个错误 */
+      uint8_t known[IR_Decoder::MAX_LENGTH];
+      uint8_t decoded[IR_Decoder::MAX_LENGTH];
+      IR_Decoder::decode(*protocol, item.length, s_capture, count, decoded, known);
+      uint8_t byte = static_cast<uint8_t>(round % item.length);
+      uint8_t bit  = static_cast<uint8_t>(known[byte] & -known[byte]);
+      if (0 != bit)
+      {
+        data[byte] ^= bit;
+        HOST_CHECK(ir_decode_error::MISMATCH == IR_Decoder::verify(*protocol, data, item.length, s_capture, count, errors) && 1 == errors);
+        data[byte] ^= bit;
+      }
+
+      /* 捕获截断 */
+      HOST_CHECK(ir_decode_error::LENGTH == IR_Decoder::verify(*protocol, data, item.length, s_capture, count / 2, errors));
+    }
+  }
+}
+
+/**
+ * @brief (静态) 符号空闲损坏, 长度与帧格式不符, 头码不符
+ */
+static void sl_check_errors()
+{
+  const ir_protocol_t* protocol = IR_Protocol::get(ir_type::AUX);
+  const uint8_t        data[13] = { 1, 2, 3 };
+  IR_Timeline          timeline;
+  timeline.attach(s_buffer, IR_Timeline::MAX_PULSES);
+  HOST_CHECK(IR_Protocol::encode(*protocol, data, sizeof(data), timeline));
+
+  uint16_t errors = 0;
+  std::memcpy(s_capture, s_buffer, timeline.size() * sizeof(ir_pulse_t));
+  s_capture[5].space = 1100;
+  HOST_CHECK(ir_decode_error::SYMBOL == IR_Decoder::verify(*protocol, data, sizeof(data), s_capture, timeline.size(), errors));
+  HOST_CHECK(ir_decode_error::LAYOUT == IR_Decoder::verify(*protocol, data, sizeof(data) - 1, s_capture, timeline.size(), errors));
+  HOST_CHECK(ir_decode_error::LEADER == IR_Decoder::verify(*IR_Protocol::get(ir_type::TCL), data, 28, s_buffer, timeline.size(), errors));
+}
+
+int main()
+{
+  sl_check_brands();
+  sl_check_errors();
+  return host_test_result("ir_decoder_test");
+}
@@ -0,0 +1,127 @@
+/**
+ * @file      ir_envelope_test.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library host test for IR carrier envelope (红外遥控 载波包络主机测试)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "host_test.hpp"
+#include "ir_envelope.hpp"
+#include "ir_protocol.hpp"
+
+#include <cstdlib>
+#include <vector>
+
+using namespace OwO::device;
+
+/// @brief 测试载波频率(Hz) (TIM1/TIM8 36MHz, ARR 946)
+static constexpr uint32_t sc_frequency = 38014;
+/// @brief 测试载波标记比较值
+static constexpr uint16_t sc_compare   = 316;
+
+/**
+ * @brief (静态) 单通道: 包络还原的时序与门控序列器参考时序一致, 末尾空闲步骤无输出, 容量不足时失败
+ */
+static void sl_check_single(const ir_pulse_t* pulses, uint16_t size, uint8_t channel)
+{
+  uint32_t count = IR_Envelope::count(pulses, size, sc_frequency);
+  HOST_CHECK(count > IR_Envelope::TAIL_STEPS);
+
+  std::vector<ir_envelope_step_t> steps(count);
+  HOST_CHECK(0 == IR_Envelope::build(pulses, size, sc_frequency, channel, sc_compare, steps.data(), count - 1));
+  HOST_CHECK(count == IR_Envelope::build(pulses, size, sc_frequency, channel, sc_compare, steps.data(), count));
+
+  for (uint32_t i = count - IR_Envelope::TAIL_STEPS; i < count; i++)
+  {
+    HOST_CHECK(0 == steps[i].rcr);
+    for (uint16_t ccr : steps[i].ccr)
+      HOST_CHECK(0 == ccr);
+  }
+  for (uint32_t i = 0; i < count; i++)
+  {
+    for (uint8_t c = 0; c < IR_Envelope::CHANNEL_COUNT; c++)
+    {
+      if (c == channel - 1)
+        HOST_CHECK(0 == steps[i].ccr[c] || sc_compare == steps[i].ccr[c]);
+      else
+        HOST_CHECK(0 == steps[i].ccr[c]);
+    }
+  }
+
+  std::vector<ir_pulse_t> output(size + 1), reference(size + 1);
+  uint16_t                decoded = IR_Envelope::decode(steps.data(), count, sc_frequency, channel, output.data(), static_cast<uint16_t>(output.size()));
+  uint16_t                modeled = IR_Gate_Sequencer::model(pulses, size, sc_frequency, reference.data(), static_cast<uint16_t>(reference.size()));
+  HOST_CHECK(decoded == modeled);
+  for (uint16_t i = 0; i < decoded && i < modeled; i++)
+  {
+    HOST_CHECK(output[i].mark == reference[i].mark);
+    HOST_CHECK(output[i].space == reference[i].space);
+  }
+}
+
+int main()
+{
+  std::srand(3);
+
+  /* 参考时序: 头码, 数据位, 超过单步上限的长空闲, 零时长脉冲, 无空闲的尾码 */
+  const ir_pulse_t reference[] = { { 9000, 4500 }, { 560, 1680 }, { 560, 560 }, { 560, 20000 }, { 0, 0 }, { 560, 40000 }, { 8000, 0 } };
+  for (uint8_t channel = 1; channel <= IR_Envelope::CHANNEL_COUNT; channel++)
+    sl_check_single(reference, sizeof(reference) / sizeof(reference[0]), channel);
+
+  /* 多通道合并: 各通道还原的时序与单独编译一致 (帧较短的通道末尾空闲可被其他通道延长) */
+  static ir_pulse_t buffers[IR_Envelope::CHANNEL_COUNT][IR_Timeline::MAX_PULSES];
+  const ir_type     types[IR_Envelope::CHANNEL_COUNT]   = { ir_type::GREE, ir_type::MIDEA, ir_type::XIAOMI, ir_type::TCL };
+  const uint8_t     lengths[IR_Envelope::CHANNEL_COUNT] = { 30, 24, 19, 28 };
+  for (int round = 0; round < 200; round++)
+  {
+    IR_Timeline       timelines[IR_Envelope::CHANNEL_COUNT];
+    const ir_pulse_t* pulses[IR_Envelope::CHANNEL_COUNT] = {};
+    uint16_t          sizes[IR_Envelope::CHANNEL_COUNT]  = {};
+    for (uint8_t c = 0; c < IR_Envelope::CHANNEL_COUNT; c++)
+    {
+      uint8_t data[32];
+      for (uint8_t& byte : data)
+        byte = static_cast<uint8_t>(std::rand());
+      timelines[c].attach(buffers[c], IR_Timeline::MAX_PULSES);
+      HOST_CHECK(IR_Protocol::encode(*IR_Protocol::get(types[c]), data, lengths[c], timelines[c]));
+      if (std::rand() % 4)
+      {
+        pulses[c] = timelines[c].data();
+        sizes[c]  = timelines[c].size();
+      }
+    }
+
+    uint32_t count = IR_Envelope::count(pulses, sizes, sc_frequency);
+    if (0 == count)
+      continue;
+
+    std::vector<ir_envelope_step_t> steps(count);
+    HOST_CHECK(count == IR_Envelope::build(pulses, sizes, sc_frequency, sc_compare, steps.data(), count));
+
+    for (uint8_t c = 0; c < IR_Envelope::CHANNEL_COUNT; c++)
+    {
+      static ir_pulse_t output[IR_Timeline::MAX_PULSES], model[IR_Timeline::MAX_PULSES];
+      uint16_t          decoded = IR_Envelope::decode(steps.data(), count, sc_frequency, c + 1, output, IR_Timeline::MAX_PULSES);
+      if (nullptr == pulses[c])
+      {
+        HOST_CHECK(decoded <= 1);
+        HOST_CHECK(0 == decoded || 0 == output[0].mark);
+        continue;
+      }
+
+      uint16_t modeled = IR_Gate_Sequencer::model(pulses[c], sizes[c], sc_frequency, model, IR_Timeline::MAX_PULSES);
+      HOST_CHECK(decoded == modeled);
+      for (uint16_t i = 0; i < decoded && i < modeled; i++)
+      {
+        HOST_CHECK(output[i].mark == model[i].mark);
+        HOST_CHECK(output[i].space >= model[i].space);
+        HOST_CHECK(i + 1 == decoded || output[i].space == model[i].space);
+      }
+    }
+  }
+
+  return host_test_result("ir_envelope_test");
+}
@@ -0,0 +1,149 @@
+/**
+ * @file      ir_gate_test.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library host test for IR gate sequencer (红外遥控 载波门控主机模型测试)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "host_test.hpp"
+#include "ir_protocol.hpp"
+#include "ir_timeline.hpp"
+
+#include <cstdlib>
+#include <vector>
+
+using namespace OwO::device;
+
+/// @brief 测试载波频率(Hz): 各品牌常用载波及上下限
+static const uint32_t sc_frequencies[] = { 30000, 36000, 37975, 38000, 40000, 56000 };
+
+/**
+ * @brief (静态) 各阶段边界的理想载波周期位置 (累计时长四舍五入, 跳过零时长阶段)
+ */
+static std::vector<uint32_t> sl_ideal_edges(const ir_pulse_t* pulses, uint16_t size, uint32_t frequency)
+{
+  std::vector<uint32_t> edges;
+  uint32_t              elapsed = 0;
+  for (uint16_t i = 0; i < size; i++)
+  {
+    const uint32_t phases[2] = { pulses[i].mark, pulses[i].space };
+    for (uint32_t phase : phases)
+    {
+      if (0 == phase)
+        continue;
+      elapsed += phase;
+      edges.push_back(IR_Gate_Sequencer::to_cycles(elapsed, frequency));
+    }
+  }
+  return edges;
+}
+
+/**
+ * @brief (静态) 门控步骤合并为阶段边界位置, 并检查单步周期数
+ */
+static std::vector<uint32_t> sl_step_edges(const ir_pulse_t* pulses, uint16_t size, uint32_t frequency)
+{
+  std::vector<uint32_t> edges;
+  IR_Gate_Sequencer     sequencer;
+  ir_gate_step_t        step;
+  uint32_t              cycles = 0;
+  bool                  mark   = true;
+  bool                  first  = true;
+
+  sequencer.reset(pulses, size, frequency);
+  while (sequencer.next(step))
+  {
+    HOST_CHECK(step.cycles >= 1 && step.cycles <= IR_Gate_Sequencer::MAX_STEP_CYCLES);
+    if (!first && step.mark != mark)
+      edges.push_back(cycles);
+    first   = false;
+    mark    = step.mark;
+    cycles += step.cycles;
+  }
+  if (!first)
+    edges.push_back(cycles);
+  return edges;
+}
+
+/**
+ * @brief (静态) 检查一帧: 边沿累计误差不超过半个载波周期, 主机模型还原的脉冲与输入一致
+ */
+static void sl_check_frame(const ir_pulse_t* pulses, uint16_t size, uint32_t frequency)
+{
+  std::vector<uint32_t> ideal = sl_ideal_edges(pulses, size, frequency);
+  std::vector<uint32_t> steps = sl_step_edges(pulses, size, frequency);
+
+  /* 相邻阶段取整后周期数可能为0, 此时两个边界重合, 门控步骤中不再出现 */
+  std::vector<uint32_t> expect;
+  uint32_t              last = 0;
+  for (uint32_t edge : ideal)
+  {
+    if (edge != last)
+      expect.push_back(edge);
+    last = edge;
+  }
+  HOST_CHECK(expect == steps);
+
+  /* 主机模型: 每个阶段量化到载波周期, 单个阶段误差不超过一个载波周期 */
+  std::vector<ir_pulse_t> output(size + 1);
+  uint16_t                count  = IR_Gate_Sequencer::model(pulses, size, frequency, output.data(), static_cast<uint16_t>(output.size()));
+  uint32_t                period = (1000000 + frequency - 1) / frequency;
+  HOST_CHECK(count == size);
+  for (uint16_t i = 0; i < count && i < size; i++)
+  {
+    HOST_CHECK(static_cast<uint32_t>(std::abs(output[i].mark - pulses[i].mark)) <= period);
+    HOST_CHECK(static_cast<uint32_t>(std::abs(output[i].space - pulses[i].space)) <= period);
+  }
+}
+
+int main()
+{
+  std::srand(1);
+  ir_pulse_t buffer[IR_Timeline::MAX_PULSES];
+
+  /* 各品牌编码器输出, 随机载荷 */
+  for (int type = static_cast<int>(ir_type::AUX); type <= static_cast<int>(ir_type::HISENSE); type++)
+  {
+    const ir_protocol_t* protocol = IR_Protocol::get(static_cast<ir_type>(type));
+    HOST_CHECK(nullptr != protocol);
+    if (nullptr == protocol)
+      continue;
+
+    for (uint8_t length = 1; length <= 32; length++)
+    {
+      if (nullptr == IR_Protocol::find(*protocol, length))
+        continue;
+
+      for (int round = 0; round < 8; round++)
+      {
+        uint8_t data[32];
+        for (uint8_t& byte : data)
+          byte = static_cast<uint8_t>(std::rand());
+
+        IR_Timeline timeline;
+        timeline.attach(buffer, IR_Timeline::MAX_PULSES);
+        HOST_CHECK(IR_Protocol::encode(*protocol, data, length, timeline));
+        for (uint32_t frequency : sc_frequencies)
+          sl_check_frame(timeline.data(), timeline.size(), frequency);
+      }
+    }
+  }
+
+  /* 随机时序: 含超过单步上限的长空闲与短于一个载波周期的阶段 */
+  for (int round = 0; round < 200; round++)
+  {
+    uint16_t size = static_cast<uint16_t>(1 + std::rand() % 64);
+    for (uint16_t i = 0; i < size; i++)
+    {
+      buffer[i].mark  = static_cast<uint16_t>(30 + std::rand() % 10000);
+      buffer[i].space = static_cast<uint16_t>(30 + std::rand() % 65000);
+    }
+    for (uint32_t frequency : sc_frequencies)
+      sl_check_frame(buffer, size, frequency);
+  }
+
+  return host_test_result("ir_gate_test");
+}
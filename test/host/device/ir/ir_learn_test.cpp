@@ -0,0 +1,189 @@
+/**
+ * @file      ir_learn_test.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library host test for IR learning decoder (红外遥控 学习解码与聚类压缩测试)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "host_test.hpp"
+#include "ir_learn.hpp"
+#include "ir_protocol.hpp"
+
+#include <cstdlib>
+#include <vector>
+
+using namespace OwO::device;
+
+/// @brief 输入捕获计数时钟(Hz) (TIM2, 90MHz)
+static constexpr uint32_t sc_clock = 90000000;
+
+/// @brief 录制样本: 解调接收头输出, 1MHz 16位计数器 (计数回绕两次), NEC 地址0x00 指令0x45, 约40ms后一个重复码
+static const uint32_t sc_nec_capture[] = {
+  0xEFF5, 0x132F, 0x24C4, 0x26D4, 0x290C, 0x2B29, 0x2D5E, 0x2F95, 0x31D3, 0x3424, 0x362E, 0x3877,
+  0x3A77, 0x3CDE, 0x3F12, 0x413E, 0x4365, 0x45A3, 0x47DD, 0x49DC, 0x5091, 0x5299, 0x5966, 0x5B75,
+  0x61F4, 0x6444, 0x6AFE, 0x6D20, 0x73C2, 0x75E6, 0x7C5E, 0x7EA1, 0x8526, 0x8752, 0x8E15, 0x9063,
+  0x96DE, 0x98EB, 0x9B15, 0x9D69, 0xA3F6, 0xA613, 0xA877, 0xAAAA, 0xACB2, 0xAF12, 0xB10A, 0xB375,
+  0xB9CA, 0xBC37, 0xBE26, 0xC090, 0xC29A, 0xC4C4, 0xCB96, 0xCDB6, 0xCFF6, 0xD214, 0xD89A, 0xDAED,
+  0xE16D, 0xE3A6, 0xEA1B, 0xEC4E, 0xEEB6, 0xF0A6, 0xF778, 0xF98C, 0x956D, 0xB8A7, 0xC172, 0xC3B1,
+};
+
+/**
+ * @brief (静态) 时长在容差内 (5% + 40us)
+ */
+static bool sl_near(uint32_t actual, uint32_t expect)
+{
+  uint32_t diff = (actual > expect) ? actual - expect : expect - actual;
+  return diff <= expect / 20 + 40;
+}
+
+/**
+ * @brief (静态) 录制样本: 还原脉冲, 分段, 无载波, 聚类后同类时长相同
+ */
+static void sl_check_fixture()
+{
+  ir_pulse_t output[64];
+  IR_Learner learner;
+  learner.reset(output, 64, 1000000, 16);
+  learner.feed(sc_nec_capture, sizeof(sc_nec_capture) / sizeof(sc_nec_capture[0]));
+  uint16_t size = learner.finish();
+
+  /* 头码 + 32位 + 尾码(含帧间隔) + 重复码头 + 尾码 */
+  HOST_CHECK(36 == size);
+  HOST_CHECK(0 == learner.carrier());
+  HOST_CHECK(2 == learner.segments());
+  HOST_CHECK(34 == learner.segment_end(0));
+  HOST_CHECK(2 == learner.mark_clusters());
+  HOST_CHECK(4 == learner.space_clusters());
+  if (36 != size)
+    return;
+
+  const uint8_t command[4] = { 0x00, 0xFF, 0x45, 0xBA };
+  HOST_CHECK(sl_near(output[0].mark, 9000) && sl_near(output[0].space, 4500));
+  for (uint8_t i = 0; i < 32; i++)
+  {
+    const ir_pulse_t& bit = output[1 + i];
+    HOST_CHECK(bit.mark == output[1].mark && sl_near(bit.mark, 560));
+    HOST_CHECK(sl_near(bit.space, ((command[i / 8] >> (i % 8)) & 0x01) ? 1690 : 560));
+  }
+  HOST_CHECK(sl_near(output[33].space, 39900));
+  HOST_CHECK(output[34].mark == output[0].mark && sl_near(output[34].space, 2250));
+  HOST_CHECK(output[35].mark == output[1].mark);
+}
+
+/**
+ * @brief (静态) 由时序生成捕获边沿: 解调输出(边沿抖动) 或 含载波的原始输出
+ */
+static std::vector<uint32_t> sl_capture(const ir_pulse_t* pulses, uint16_t size, bool carrier, uint32_t start, int jitter)
+{
+  std::vector<uint32_t> stamps;
+  const double          ticks  = sc_clock / 1e6;
+  const double          period = 1e6 / 38000;
+  double                now    = 0;
+  for (uint16_t i = 0; i < size; i++)
+  {
+    if (carrier)
+    {
+      uint32_t cycles = static_cast<uint32_t>(pulses[i].mark / period + 0.5);
+      for (uint32_t c = 0; c < cycles; c++)
+      {
+        stamps.push_back(start + static_cast<uint32_t>((now + c * period) * ticks));
+        stamps.push_back(start + static_cast<uint32_t>((now + c * period + period / 3) * ticks));
+      }
+    }
+    else
+    {
+      int rise = jitter ? std::rand() % (2 * jitter + 1) - jitter : 0;
+      int fall = jitter ? std::rand() % (2 * jitter + 1) - jitter : 0;
+      stamps.push_back(start + static_cast<uint32_t>((now + rise) * ticks));
+      stamps.push_back(start + static_cast<uint32_t>((now + pulses[i].mark + fall) * ticks));
+    }
+    now += pulses[i].mark + pulses[i].space;
+  }
+  return stamps;
+}
+
+/**
+ * @brief (静态) 各品牌合成捕获: 解调输出与含载波输出均还原为原时序, 识别载波与分段
+ */
+static void sl_check_brands()
+{
+  static ir_pulse_t source[IR_Timeline::MAX_PULSES], output[IR_Timeline::MAX_PULSES];
+  uint8_t           data[32];
+  for (uint8_t& byte : data)
+    byte = static_cast<uint8_t>(std::rand());
+
+  for (int type = static_cast<int>(ir_type::AUX); type <= static_cast<int>(ir_type::HISENSE); type++)
+  {
+    const ir_protocol_t* protocol = IR_Protocol::get(static_cast<ir_type>(type));
+    for (uint8_t length = 1; length <= 32; length++)
+    {
+      IR_Timeline timeline;
+      timeline.attach(source, IR_Timeline::MAX_PULSES);
+      if (nullptr == IR_Protocol::find(*protocol, length) || !IR_Protocol::encode(*protocol, data, length, timeline))
+        continue;
+
+      uint16_t size = timeline.size();
+      uint8_t  gaps = 1;
+      for (uint16_t i = 0; i + 1 < size; i++)
+      {
+        if (source[i].space >= IR_Learner::SEGMENT_GAP)
+          gaps++;
+      }
+
+      for (bool carrier : { false, true })
+      {
+        /* 起始时刻接近计数回绕 */
+        std::vector<uint32_t> stamps = sl_capture(source, size, carrier, 0xFFFF0000u, carrier ? 0 : 15);
+        IR_Learner            learner;
+        learner.reset(output, IR_Timeline::MAX_PULSES, sc_clock, 32);
+        learner.feed(stamps.data(), static_cast<uint16_t>(stamps.size()));
+        HOST_CHECK(size == learner.finish());
+        HOST_CHECK(!learner.overflow());
+
+        for (uint16_t i = 0; i < size && i < learner.size(); i++)
+        {
+          HOST_CHECK(sl_near(output[i].mark, source[i].mark));
+          HOST_CHECK(i + 1 == size || sl_near(output[i].space, source[i].space));
+        }
+
+        if (carrier)
+          HOST_CHECK(learner.carrier() >= 37620 && learner.carrier() <= 38380);
+        else
+          HOST_CHECK(0 == learner.carrier());
+        HOST_CHECK(learner.segments() == ((gaps > IR_Learner::MAX_SEGMENTS) ? IR_Learner::MAX_SEGMENTS : gaps));
+      }
+    }
+  }
+}
+
+/**
+ * @brief (静态) 输出缓存区不足: 截断并置溢出标志
+ */
+static void sl_check_overflow()
+{
+  static ir_pulse_t source[IR_Timeline::MAX_PULSES];
+  ir_pulse_t        output[10];
+  uint8_t           data[13] = {};
+  IR_Timeline       timeline;
+  timeline.attach(source, IR_Timeline::MAX_PULSES);
+  HOST_CHECK(IR_Protocol::encode(*IR_Protocol::get(ir_type::AUX), data, sizeof(data), timeline));
+
+  std::vector<uint32_t> stamps = sl_capture(source, timeline.size(), false, 0, 0);
+  IR_Learner            learner;
+  learner.reset(output, 10, sc_clock);
+  learner.feed(stamps.data(), static_cast<uint16_t>(stamps.size()));
+  HOST_CHECK(10 == learner.finish());
+  HOST_CHECK(learner.overflow());
+}
+
+int main()
+{
+  std::srand(8);
+  sl_check_fixture();
+  sl_check_brands();
+  sl_check_overflow();
+  return host_test_result("ir_learn_test");
+}
@@ -0,0 +1,1041 @@
+/**
+ * @file      ir_legacy_encoder.hpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library host test fixture: legacy per-brand IR encoders (红外遥控 旧版逐品牌编码器, 协议描述表的参考实现)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#ifndef __IR_LEGACY_ENCODER_HPP__
+#define __IR_LEGACY_ENCODER_HPP__
+
+#include "ir_timeline.hpp"
+
+/// @brief 名称空间 库名
+namespace OwO
+{
+/// @brief 名称空间 设备
+namespace device
+{
+/// @brief 类 IR 旧版编码器 -- 协议描述表替换前 IR 类中的逐品牌编码函数, 原样保留 (引脚输出改为记录时序)
+class IR_Legacy_Encoder
+{
+public:
+  enum
+  {
+    _0_32MS  = 320,
+    _0_371MS = 371,
+    _0_44MS  = 440,
+    _0_5MS   = 500,
+    _0_56MS  = 560,
+    _0_67MS  = 670,
+    _0_588MS = 588,
+    _0_882MS = 882,
+    _1MS     = 1000,
+    _1_08MS  = 1080,
+    _1_47MS  = 1470,
+    _1_6MS   = 1600,
+    _1_68MS  = 1680,
+    _1_84MS  = 1840,
+    _20MS    = 2000,
+    _2_21MS  = 2210,
+    _26_37MS = 2637,
+    _3_08MS  = 3080,
+    _3_64MS  = 3640,
+    _40MS    = 4000,
+    _4_5MS   = 4500,
+    _5_22MS  = 5220,
+    _71MS    = 7100,
+    _8MS     = 8000,
+    _9MS     = 9000,
+  };
+
+
+  /// @brief 指令数据
+  char*       m_data_tmp;
+  /// @brief 输出时序 (替代原引脚输出)
+  IR_Timeline m_timeline;
+
+  /**
+   * @brief IR 旧版编码器 输出一个脉冲 (原实现直接翻转引脚, 此处记录至时序)
+   *
+   * @param high 标记时长(us)
+   * @param low  空闲时长(us)
+   */
+  void m_ir_flash(uint32_t high, uint32_t low)
+  {
+    m_timeline.push(high, low);
+  }
+
+#if 1 /* AUX 奥克斯 */
+  /**
+   * @brief (私有内联函数) IR 奥克斯红外遥控 头码
+   *
+   */
+  void m_aux_start()
+  {
+    m_ir_flash(_9MS, _4_5MS);
+  }
+  /**
+   * @brief (私有内联函数) IR 奥克斯红外遥控 二进制0
+   *
+   */
+  void m_aux_0()
+  {
+    m_ir_flash(_0_56MS, _0_56MS);
+  }
+  /**
+   * @brief (私有内联函数) IR 奥克斯红外遥控 二进制1
+   *
+   */
+  void m_aux_1()
+  {
+    m_ir_flash(_0_56MS, _1_68MS);
+  }
+  /**
+   * @brief (私有内联函数) IR 奥克斯红外遥控 尾码
+   *
+   */
+  void m_aux_stop()
+  {
+    m_ir_flash(_0_56MS, 0);
+  }
+  /**
+   * @brief (私有内联函数) IR 奥克斯红外遥控 获取数据
+   *
+   */
+  char& m_aux_data(uint8_t pos)
+  {
+    return m_data_tmp[pos];
+  }
+  /**
+   * @brief (私有内联函数) IR 奥克斯红外遥控 输出
+   *
+   * @param  len 指令长度
+   * @return bool 成功返回true，失败返回false
+   */
+  bool m_aux(uint8_t len);
+#endif
+
+#if 1 /* TCL */
+  /**
+   * @brief (私有内联函数) IR TCL红外遥控 头码
+   *
+   */
+  void m_tcl_start()
+  {
+    m_ir_flash(_3_08MS, _1_6MS);
+  }
+  /**
+   * @brief (私有内联函数) IR TCL红外遥控 二进制0
+   *
+   */
+  void m_tcl_0()
+  {
+    m_ir_flash(_0_5MS, _0_32MS);
+  }
+  /**
+   * @brief (私有内联函数) IR TCL红外遥控 二进制1
+   *
+   */
+  void m_tcl_1()
+  {
+    m_ir_flash(_0_5MS, _1_08MS);
+  }
+  /**
+   * @brief (私有内联函数) IR TCL红外遥控 延时
+   *
+   */
+  void m_tcl_wait()
+  {
+    m_ir_flash(0, _71MS);
+  }
+  /**
+   * @brief (私有内联函数) IR TCL红外遥控 尾码
+   *
+   */
+  void m_tcl_stop()
+  {
+    m_ir_flash(_0_5MS, 0);
+  }
+  /**
+   * @brief (私有内联函数) IR TCL红外遥控 获取数据
+   *
+   */
+  char& m_tcl_data(uint8_t loaction, uint8_t pos)
+  {
+    return m_data_tmp[pos + (loaction - 1) * 14];
+  }
+  /**
+   * @brief (私有函数) IR TCL红外遥控 输出
+   *
+   * @param  len 指令长度
+   * @return bool 成功返回true，失败返回false
+   */
+  bool m_tcl(uint8_t len);
+#endif
+
+#if 1 /* GREE 格力 */
+  /**
+   * @brief (私有内联函数) IR 格力红外遥控 头码
+   *
+   */
+  void m_gree_start()
+  {
+    m_ir_flash(_9MS, _4_5MS);
+  }
+  /**
+   * @brief (私有内联函数) IR 格力红外遥控 二进制0
+   *
+   */
+  void m_gree_0()
+  {
+    m_ir_flash(_0_56MS, _0_67MS);
+  }
+  /**
+   * @brief (私有内联函数) IR 格力红外遥控 二进制1
+   *
+   */
+  void m_gree_1()
+  {
+    m_ir_flash(_0_56MS, _1_6MS);
+  }
+  /**
+   * @brief (私有内联函数) IR 格力红外遥控 延时
+   *
+   * @param time 延时
+   */
+  void m_gree_wait(uint8_t time)
+  {
+    if (20 == time)
+      m_ir_flash(_0_67MS, _20MS);
+    else if (40 == time)
+      m_ir_flash(_0_67MS, _40MS);
+  }
+  /**
+   * @brief (私有内联函数) IR 格力红外遥控 尾码
+   *
+   */
+  void m_gree_stop()
+  {
+    m_ir_flash(_0_67MS, _0_56MS);
+  }
+  /**
+   * @brief (私有内联函数) IR 格力红外遥控 获取数据
+   *
+   */
+  char& m_gree_data(uint8_t loaction, uint8_t num, uint8_t pos = 0);
+  /**
+   * @brief (私有函数) IR 格力红外遥控 输出
+   *
+   * @param  len 指令长度
+   * @return bool 成功返回true，失败返回false
+   */
+  bool  m_gree(uint8_t len);
+#endif
+
+#if 1 /* OUTES 中广欧斯特 */
+  /**
+   * @brief (私有内联函数) IR 中广欧斯特红外遥控 头码
+   *
+   */
+  void m_outes_start()
+  {
+    m_ir_flash(_3_64MS, _1_84MS);
+  }
+  /**
+   * @brief (私有内联函数) IR 中广欧斯特红外遥控 二进制0
+   *
+   */
+  void m_outes_0()
+  {
+    m_ir_flash(_0_44MS, _0_44MS);
+  }
+  /**
+   * @brief (私有内联函数) IR 中广欧斯特红外遥控 二进制1
+   *
+   */
+  void m_outes_1()
+  {
+    m_ir_flash(_0_44MS, _1_84MS);
+  }
+  /**
+   * @brief (私有内联函数) IR 中广欧斯特红外遥控 尾码
+   *
+   */
+  void m_outes_stop()
+  {
+    m_ir_flash(_0_44MS, 0);
+  }
+  /**
+   * @brief (私有内联函数) IR 中广欧斯特红外遥控 获取数据
+   *
+   */
+  char& m_outes_data(uint8_t pos)
+  {
+    return m_data_tmp[pos];
+  }
+  /**
+   * @brief (私有函数) IR 中广欧斯特红外遥控 输出
+   *
+   * @param  len 指令长度
+   * @return bool 成功返回true，失败返回false
+   */
+  bool m_outes(uint8_t len);
+#endif
+
+#if 1 /* MIDEA 美的 */
+  /**
+   * @brief (私有内联函数) IR 美的红外遥控 头码
+   *
+   */
+  void m_midea_start()
+  {
+    m_ir_flash(_4_5MS, _4_5MS);
+  }
+  /**
+   * @brief (私有内联函数) IR 美的红外遥控 二进制0
+   *
+   */
+  void m_midea_0()
+  {
+    m_ir_flash(_0_56MS, _0_56MS);
+  }
+  /**
+   * @brief (私有内联函数) IR 美的红外遥控 二进制1
+   *
+   */
+  void m_midea_1()
+  {
+    m_ir_flash(_0_56MS, _1_6MS);
+  }
+  /**
+   * @brief (私有内联函数) IR 美的红外遥控 延时
+   *
+   */
+  void m_midea_wait()
+  {
+    m_ir_flash(_0_56MS, _5_22MS);
+  }
+  /**
+   * @brief (私有内联函数) IR 美的红外遥控 尾码
+   *
+   */
+  void m_midea_stop()
+  {
+    m_ir_flash(_0_56MS, _0_56MS);
+  }
+  /**
+   * @brief (私有内联函数) IR 美的红外遥控 获取数据
+   *
+   */
+  char& m_midea_data(uint8_t loaction, uint8_t pos)
+  {
+    return m_data_tmp[pos + (loaction - 1) * 6];
+  }
+  /**
+   * @brief (私有函数) IR 美的红外遥控 输出
+   *
+   * @param  len 指令长度
+   * @return bool 成功返回true，失败返回false
+   */
+  bool m_midea(uint8_t len);
+#endif
+
+#if 1 /* XIAOMI 小米 */
+  /**
+   * @brief (私有内联函数) IR 小米红外遥控 头码
+   *
+   */
+  void m_xiaomi_start()
+  {
+    m_ir_flash(_1MS, _0_588MS);
+  }
+  /**
+   * @brief (私有内联函数) IR 小米红外遥控 二进制00
+   *
+   */
+  void m_xiaomi_00()
+  {
+    m_ir_flash(_0_588MS, _0_371MS);
+  }
+  /**
+   * @brief (私有内联函数) IR 小米红外遥控 二进制01
+   *
+   */
+  void m_xiaomi_01()
+  {
+    m_ir_flash(_0_588MS, _0_882MS);
+  }
+  /**
+   * @brief (私有内联函数) IR 小米红外遥控 二进制10
+   *
+   */
+  void m_xiaomi_10()
+  {
+    m_ir_flash(_0_588MS, _2_21MS);
+  }
+  /**
+   * @brief (私有内联函数) IR 小米红外遥控 二进制11
+   *
+   */
+  void m_xiaomi_11()
+  {
+    m_ir_flash(_0_588MS, _1_47MS);
+  }
+  /**
+   * @brief (私有内联函数) IR 小米红外遥控 延时
+   *
+   */
+  void m_xiaomi_wait()
+  {
+    m_ir_flash(_0_588MS, _26_37MS);
+  }
+  /**
+   * @brief (私有内联函数) IR 小米红外遥控 尾码
+   *
+   */
+  void m_xiaomi_stop()
+  {
+    m_ir_flash(_0_588MS, 0);
+  }
+  /**
+   * @brief (私有内联函数) IR 小米红外遥控 获取数据
+   *
+   */
+  char& m_xiaomi_data(uint8_t loaction, uint8_t pos)
+  {
+    return m_data_tmp[pos + (loaction - 1) * 11];
+  }
+  /**
+   * @brief (私有函数) IR 小米红外遥控 输出
+   *
+   * @param  len 指令长度
+   * @return bool 成功返回true，失败返回false
+   */
+  bool m_xiaomi(uint8_t len);
+#endif
+
+#if 1 /* HISENSE 海信 */
+  /**
+   * @brief (私有内联函数) IR 海信红外遥控 头码
+   *
+   */
+  void m_hisense_start()
+  {
+    m_ir_flash(_9MS, _4_5MS);
+  }
+  /**
+   * @brief (私有内联函数) IR 海信红外遥控 二进制0
+   *
+   */
+  void m_hisense_0()
+  {
+    m_ir_flash(_0_56MS, _0_56MS);
+  }
+  /**
+   * @brief (私有内联函数) IR 海信红外遥控 二进制1
+   *
+   */
+  void m_hisense_1()
+  {
+    m_ir_flash(_0_56MS, _1_68MS);
+  }
+  /**
+   * @brief (私有内联函数) IR 海信红外遥控 延时
+   *
+   */
+  void m_hisense_wait()
+  {
+    m_ir_flash(_0_56MS, _8MS);
+  }
+  /**
+   * @brief (私有内联函数) IR 海信红外遥控 尾码
+   *
+   */
+  void m_hisense_stop()
+  {
+    m_ir_flash(_0_56MS, 0);
+  }
+  /**
+   * @brief (私有内联函数) IR 海信红外遥控 获取数据
+   *
+   */
+  char& m_hisense_data(uint8_t loaction, uint8_t pos)
+  {
+    if (1 == loaction)
+      return m_data_tmp[pos];
+    else if (2 == loaction)
+      return m_data_tmp[pos + 6];
+    else
+      return m_data_tmp[pos + 14];
+  }
+  /**
+   * @brief (私有函数) IR 海信红外遥控 输出
+   *
+   * @param  len 指令长度
+   * @return bool 成功返回true，失败返回false
+   */
+  bool m_hisense(uint8_t len);
+#endif
+};
+
+/**
+ * @brief (私有函数) IR 奥克斯红外遥控 输出
+ *
+ * @param  len 指令长度
+ * @return bool 成功返回true，失败返回false
+ */
+inline bool IR_Legacy_Encoder::m_aux(uint8_t len)
+{
+  // 长度判断
+  if (13 != len)
+    return false;
+
+  uint8_t i = 0;
+  uint8_t j = 0;
+  // 头码
+  m_aux_start();
+  for (i = 0; i < 13; i++)
+  {
+    for (j = 0; j < 8; j++)
+    {
+      if (m_aux_data(i) & (0x01 << j))
+        m_aux_1();
+      else
+        m_aux_0();
+    }
+  }
+  // 结束码
+  m_aux_stop();
+  return true;
+}
+
+/**
+ * @brief (私有函数) IR TCL红外遥控 输出
+ *
+ * @param  len 指令长度
+ * @return bool 成功返回true，失败返回false
+ */
+inline bool IR_Legacy_Encoder::m_tcl(uint8_t len)
+{
+  // 长度判断
+  if (28 != len)
+    return false;
+
+  uint8_t i = 0;
+  uint8_t j = 0;
+  // 头码
+  m_tcl_start();
+  for (i = 0; i < 14; i++)
+  {
+    for (j = 0; j < 8; j++)
+    {
+      if (m_tcl_data(1, i) & (0x01 << j))
+        m_tcl_1();
+      else
+        m_tcl_0();
+    }
+  }
+  m_tcl_stop();
+  m_tcl_wait();
+  m_tcl_start();
+  for (i = 0; i < 14; i++)
+  {
+    for (j = 0; j < 8; j++)
+    {
+      if (m_tcl_data(2, i) & (0x01 << j))
+        m_tcl_1();
+      else
+        m_tcl_0();
+    }
+  }
+  // 结束码
+  m_tcl_stop();
+  return true;
+}
+
+/**
+ * @brief (私有函数) IR 格力红外遥控 数据获取
+ *
+ * @param loaction  数据位置
+ * @param num       发送段数
+ * @param pos       位移量
+ * @return char&
+ */
+inline char& IR_Legacy_Encoder::m_gree_data(uint8_t loaction, uint8_t num, uint8_t pos)
+{
+  if (1 == loaction)
+    return m_data_tmp[(num - 1) * 10 + pos];
+  else if (2 == loaction)
+    return m_data_tmp[(num - 1) * 10 + 4];
+  else if (3 == loaction)
+    return m_data_tmp[(num - 1) * 10 + 5];
+  else if (4 == loaction)
+    return m_data_tmp[(num - 1) * 10 + pos + 6];
+  else
+    return m_data_tmp[(num - 1) * 10 + 9];
+}
+
+/**
+ * @brief (私有函数) IR 格力红外遥控 输出
+ *
+ * @param  len 指令长度
+ * @return bool 成功返回true，失败返回false
+ */
+inline bool IR_Legacy_Encoder::m_gree(uint8_t len)
+{
+  // 长度判断
+  if (30 != len)
+    return false;
+
+  uint8_t i = 0;
+  uint8_t j = 0;
+
+  // 第一段
+  // 头码
+  m_gree_start();
+  // 先发送11 12 13 14 寄存器数据，8位发送
+  for (i = 0; i < 4; i++)
+  {
+    for (j = 0; j < 8; j++)
+    {
+      if (m_gree_data(1, 1, i) & (0x01 << j))
+        m_gree_1();
+      else
+        m_gree_0();
+    }
+  }
+  // 15 寄存器数据，3位发送
+  for (j = 0; j < 3; j++)
+  {
+    if (m_gree_data(2, 1) & (0x01 << j))
+      m_gree_1();
+    else
+      m_gree_0();
+  }
+  // 发送连接码，等待20MS
+  m_gree_wait(20);
+  // 16 寄存器数据，1位发送
+  if (m_gree_data(3, 1) & (0x01))
+    m_gree_1();
+  else
+    m_gree_0();
+  // 先发送17 18 19 寄存器数据，8位发送
+  for (i = 0; i < 3; i++)
+  {
+    for (j = 0; j < 8; j++)
+    {
+      if (m_gree_data(4, 1, i) & (0x01 << j))
+        m_gree_1();
+      else
+        m_gree_0();
+    }
+  }
+  // 先发送28 寄存器数据，7位发送
+  for (j = 0; j < 7; j++)
+  {
+    if (m_gree_data(5, 1) & (0x01 << j))
+      m_gree_1();
+    else
+      m_gree_0();
+  }
+  // 发送连接码，等待40MS
+  m_gree_wait(40);
+  // 第一段结束
+
+  // 第二段
+  // 头码
+  m_gree_start();
+  // 先发送11 12 13 14 寄存器数据，8位发送
+  for (i = 0; i < 4; i++)
+  {
+    for (j = 0; j < 8; j++)
+    {
+      if (m_gree_data(1, 2, i) & (0x01 << j))
+        m_gree_1();
+      else
+        m_gree_0();
+    }
+  }
+  // 15 寄存器数据，3位发送
+  for (j = 0; j < 3; j++)
+  {
+    if (m_gree_data(2, 2) & (0x01 << j))
+      m_gree_1();
+    else
+      m_gree_0();
+  }
+  // 发送连接码，等待20MS
+  m_gree_wait(20);
+  // 16 寄存器数据，1位发送
+  if (m_gree_data(3, 2) & (0x01))
+    m_gree_1();
+  else
+    m_gree_0();
+  // 先发送17 18 19 寄存器数据，8位发送
+  for (i = 0; i < 3; i++)
+  {
+    for (j = 0; j < 8; j++)
+    {
+      if (m_gree_data(4, 2, i) & (0x01 << j))
+        m_gree_1();
+      else
+        m_gree_0();
+    }
+  }
+  // 先发送28 寄存器数据，7位发送
+  for (j = 0; j < 7; j++)
+  {
+    if (m_gree_data(5, 2) & (0x01 << j))
+      m_gree_1();
+    else
+      m_gree_0();
+  }
+  // 发送连接码，等待40MS
+  m_gree_wait(40);
+  // 第二段结束
+
+  // 第三段
+  // 头码
+  m_gree_start();
+  // 先发送21 22 23 24 寄存器数据，8位发送
+  for (i = 0; i < 4; i++)
+  {
+    for (j = 0; j < 8; j++)
+    {
+      if (m_gree_data(1, 3, i) & (0x01 << j))
+        m_gree_1();
+      else
+        m_gree_0();
+    }
+  }
+  // 25 寄存器数据，3位发送
+  for (j = 0; j < 3; j++)
+  {
+    if (m_gree_data(2, 3) & (0x01 << j))
+      m_gree_1();
+    else
+      m_gree_0();
+  }
+  // 发送连接码，等待20MS
+  m_gree_wait(20);
+  // 26 寄存器数据，1位发送
+  if (m_gree_data(3, 3) & (0x01))
+    m_gree_1();
+  else
+    m_gree_0();
+  // 先发27 28 29 寄存器数据，8位发送
+  for (i = 0; i < 3; i++)
+  {
+    for (j = 0; j < 8; j++)
+    {
+      if (m_gree_data(4, 3, i) & (0x01 << j))
+        m_gree_1();
+      else
+        m_gree_0();
+    }
+  }
+  // 先发送28 寄存器数据，7位发送
+  for (j = 0; j < 7; j++)
+  {
+    if (m_gree_data(5, 3) & (0x01 << j))
+      m_gree_1();
+    else
+      m_gree_0();
+  }
+  // 结束码
+  m_gree_stop();
+  return true;
+}
+
+/**
+ * @brief (私有函数) IR 中广欧斯特红外遥控 输出
+ *
+ * @param  len 指令长度
+ * @return bool 成功返回true，失败返回false
+ */
+inline bool IR_Legacy_Encoder::m_outes(uint8_t len)
+{
+  // 长度判断
+  if (15 != len)
+    return false;
+
+  uint8_t i = 0;
+  uint8_t j = 0;
+  // 头码
+  m_outes_start();
+  // 中广贴牌奥克斯为15个字节   2025.06.01修改
+  for (i = 0; i < 15; i++)
+  {
+    for (j = 0; j < 8; j++)
+    {
+      if (m_outes_data(i) & (0x01 << j))
+        m_outes_1();
+      else
+        m_outes_0();
+    }
+  }
+  // 结束码
+  m_outes_stop();
+  return true;
+}
+
+/**
+ * @brief (私有函数) IR 美的红外遥控 输出
+ *
+ * @param  len 指令长度
+ * @return bool 成功返回true，失败返回false
+ */
+inline bool IR_Legacy_Encoder::m_midea(uint8_t len)
+{
+  // 长度判断
+  if (6 != len && 12 != len && 18 != len && 24 != len)
+    return false;
+
+  uint8_t i = 0;
+  uint8_t j = 0;
+  // 头码
+  m_midea_start();
+  // 8位数据从高到低位发送
+  for (i = 0; i < 6; i++)
+  {
+    // 先发送11 12 13 14 15 16寄存器数据，8位发送
+    for (j = 0; j < 8; j++)
+    {
+      if (m_midea_data(1, i) & (0x80 >> j))
+        m_midea_1();
+      else
+        m_midea_0();
+    }
+  }
+
+  if (6 == len)
+  {
+    m_midea_stop();
+    return true;
+  }
+  else
+    m_midea_wait();
+
+  // 头码
+  m_midea_start();
+  // 8位数据从高到低位发送
+  for (i = 0; i < 6; i++)
+  {
+    // 先发送17 18 19 20 21 22 寄存器数据，8位发送
+    for (j = 0; j < 8; j++)
+    {
+      if (m_midea_data(2, i) & (0x80 >> j))
+        m_midea_1();
+      else
+        m_midea_0();
+    }
+  }
+
+  if (12 == len)
+  {
+    m_midea_stop();
+    return true;
+  }
+  else
+    m_midea_wait();
+
+  // 头码
+  m_midea_start();
+  // 8位数据从高到低位发送
+  for (i = 0; i < 6; i++)
+  {
+    // 先发送23 24 25 26 27 28 寄存器数据，8位发送
+    for (j = 0; j < 8; j++)
+    {
+      if (m_midea_data(3, i) & (0x80 >> j))
+        m_midea_1();
+      else
+        m_midea_0();
+    }
+  }
+
+  if (18 == len)
+  {
+    m_midea_stop();
+    return true;
+  }
+  else
+    m_midea_wait();
+
+  // 头码
+  m_midea_start();
+  // 8位数据从高到低位发送
+  for (i = 0; i < 6; i++)
+  {
+    // 先发送29 30 31 32 33 34 寄存器数据，8位发送
+    for (j = 0; j < 8; j++)
+    {
+      if (m_midea_data(4, i) & (0x80 >> j))
+        m_midea_1();
+      else
+        m_midea_0();
+    }
+  }
+
+  // 结束码
+  m_midea_stop();
+  return true;
+}
+
+/**
+ * @brief (私有函数) IR 小米红外遥控 输出
+ *
+ * @param  len 指令长度
+ * @return bool 成功返回true，失败返回false
+ */
+inline bool IR_Legacy_Encoder::m_xiaomi(uint8_t len)
+{
+  // 长度判断
+  if (12 != len && 19 != len)
+    return false;
+
+  uint8_t i = 0;
+  uint8_t j = 0;
+  // 头码
+  m_xiaomi_start();
+  if (12 == len)
+  {
+    // 发12个字节
+    for (i = 0; i < 12; i++)
+    {
+      // 先发送11 12 13 14 寄存器数据，8位发送
+      for (j = 4; j > 0; j--)
+      {
+        if (((m_xiaomi_data(1, i) >> (j * 2 - 2)) & 0x03) == 0x03)
+          m_xiaomi_11();
+        else if (((m_xiaomi_data(1, i) >> (j * 2 - 2)) & 0x01) == 0x01)
+          m_xiaomi_01();
+        else if (((m_xiaomi_data(1, i) >> (j * 2 - 2)) & 0x02) == 0x02)
+          m_xiaomi_10();
+        else
+          m_xiaomi_00();
+      }
+    }
+  }
+  else if (19 == len)
+  {
+    // 第一段码11个字节
+    for (i = 0; i < 11; i++)
+    {
+      // 先发送11 12 13 14 寄存器数据，8位发送
+      for (j = 4; j > 0; j--)
+      {
+        if (((m_xiaomi_data(1, i) >> (j * 2 - 2)) & 0x03) == 0x03)
+          m_xiaomi_11();
+        else if (((m_xiaomi_data(1, i) >> (j * 2 - 2)) & 0x01) == 0x01)
+          m_xiaomi_01();
+        else if (((m_xiaomi_data(1, i) >> (j * 2 - 2)) & 0x02) == 0x02)
+          m_xiaomi_10();
+        else
+          m_xiaomi_00();
+      }
+    }
+    // 2024.3.4小米二段码需要加等待时间
+    m_xiaomi_wait();
+    // 第二段码8个字节
+    for (i = 0; i < 8; i++)
+    {
+      // 先发送11 12 13 14 寄存器数据，8位发送
+      for (j = 4; j > 0; j--)
+      {
+        if (((m_xiaomi_data(2, i) >> (j * 2 - 2)) & 0x03) == 0x03)
+          m_xiaomi_11();
+        else if (((m_xiaomi_data(2, i) >> (j * 2 - 2)) & 0x01) == 0x01)
+          m_xiaomi_01();
+        else if (((m_xiaomi_data(2, i) >> (j * 2 - 2)) & 0x02) == 0x02)
+          m_xiaomi_10();
+        else
+          m_xiaomi_00();
+      }
+    }
+  }
+  // 结束码
+  m_xiaomi_stop();
+  return true;
+}
+
+/**
+ * @brief (私有函数) IR 海信红外遥控 输出
+ *
+ * @param  len 指令长度
+ * @return bool 成功返回true，失败返回false
+ */
+inline bool IR_Legacy_Encoder::m_hisense(uint8_t len)
+{
+  // 长度判断
+  if (21 != len && 23 != len)
+    return false;
+
+  uint8_t i = 0;
+  uint8_t j = 0;
+  // 头码
+  m_hisense_start();
+  if (21 == len)
+  {
+    // 海信科龙遥控协议 V3.0
+    for (i = 0; i < 6; i++)
+    {
+      for (j = 0; j < 8; j++)
+      {
+        if (m_hisense_data(1, i) & (0x01 << j))
+          m_hisense_1();
+        else
+          m_hisense_0();
+      }
+    }
+    m_hisense_wait();
+    // 海信科龙遥控协议
+    for (i = 0; i < 8; i++)
+    {
+      for (j = 0; j < 8; j++)
+      {
+        if (m_hisense_data(2, i) & (0x01 << j))
+          m_hisense_1();
+        else
+          m_hisense_0();
+      }
+    }
+    m_hisense_wait();
+    // 海信科龙遥控协议
+    for (i = 0; i < 7; i++)
+    {
+      for (j = 0; j < 8; j++)
+      {
+        if (m_hisense_data(3, i) & (0x01 << j))
+          m_hisense_1();
+        else
+          m_hisense_0();
+      }
+    }
+  }
+  else if (23 == len)
+  {
+    // 海信科龙遥控协议 V4.0
+    for (i = 0; i < 23; i++)
+    {
+      for (j = 0; j < 8; j++)
+      {
+        if (m_hisense_data(1, i) & (0x01 << j))
+          m_hisense_1();
+        else
+          m_hisense_0();
+      }
+    }
+  }
+  // 结束码
+  m_hisense_stop();
+  return true;
+}
+} /* namespace device */
+} /* namespace OwO */
+
+#endif /* __IR_LEGACY_ENCODER_HPP__ */
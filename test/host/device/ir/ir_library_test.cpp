@@ -0,0 +1,355 @@
+/**
+ * @file      ir_library_test.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library host test for IR code library (红外遥控 NOR Flash 指令库 存储/重挂载/掉电测试)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "host_test.hpp"
+#include "ir_library.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <vector>
+
+using namespace OwO::device;
+
+/// @brief 模拟存储器 扇区大小(字节, 擦除单位)
+static constexpr uint32_t sc_sector_size = 4096;
+/// @brief 模拟存储器 页大小(字节, 编程单位)
+static constexpr uint32_t sc_page_size   = 256;
+/// @brief 测试区域槽位数量
+static constexpr uint16_t sc_slots       = 64;
+/// @brief 槽位头部标识
+static constexpr uint16_t sc_magic       = 0x5249;
+/// @brief 槽位头部 状态字节偏移
+static constexpr uint32_t sc_state       = 13;
+/// @brief 槽位头部长度(字节)
+static constexpr uint32_t sc_header_size = 16;
+
+/// @brief 结构体 测试指令 (期望内容)
+struct sl_code_t
+{
+  std::vector<ir_pulse_t> pulses;
+  uint16_t                frequency;
+  uint8_t                 duty;
+};
+
+/// @brief 模拟 NOR Flash (仅可 1->0 编程, 擦除以扇区为单位)
+static std::vector<uint8_t> s_flash(sc_slots * IR_Library::SLOT_SIZE, 0xFF);
+/// @brief 掉电前剩余的编程/擦除操作数 (-1为不掉电)
+static int32_t              s_budget    = -1;
+/// @brief 已掉电 (之后的写入全部失败)
+static bool                 s_power_off = false;
+/// @brief 整扇区擦除时同扇区其他槽位有效的次数 (擦除中途掉电会丢失该指令)
+static uint32_t             s_clobbered = 0;
+/// @brief 整扇区擦除次数
+static uint32_t             s_erases    = 0;
+
+/**
+ * @brief (静态) 消耗一次编程/擦除操作, 预算耗尽时掉电
+ */
+static bool sl_power()
+{
+  if (s_power_off)
+    return false;
+  if (s_budget > 0 && 0 == --s_budget)
+    s_power_off = true;
+  return !s_power_off;
+}
+
+/**
+ * @brief (静态) 按页编程 (只清零位), 掉电时只完成当前页的前半部分
+ */
+static void sl_program(uint32_t address, const uint8_t* data, uint32_t length)
+{
+  for (uint32_t done = 0; done < length;)
+  {
+    uint32_t size = std::min(length - done, sc_page_size - (address + done) % sc_page_size);
+    bool     on   = sl_power();
+    uint32_t n    = on ? size : size / 2;
+    for (uint32_t i = 0; i < n; i++)
+      s_flash[address + done + i] &= data[done + i];
+    if (!on)
+      return;
+    done += size;
+  }
+}
+
+static uint32_t sl_read(void*, uint32_t address, void* data, uint32_t length)
+{
+  std::memcpy(data, &s_flash[address], length);
+  return length;
+}
+
+/**
+ * @brief (静态) 写入 (与 W25Q256 驱动相同: 逐扇区比较, 需要0->1时读出整扇区, 擦除后重写)
+ */
+static uint32_t sl_write(void*, uint32_t address, const void* data, uint32_t length)
+{
+  const uint8_t* p = static_cast<const uint8_t*>(data);
+  for (uint32_t done = 0; done < length;)
+  {
+    uint32_t position = address + done;
+    uint32_t sector   = position - position % sc_sector_size;
+    uint32_t size     = std::min(length - done, sector + sc_sector_size - position);
+
+    bool erase = false;
+    for (uint32_t i = 0; i < size; i++)
+      erase |= (p[done + i] & ~s_flash[position + i]) != 0;
+
+    if (erase)
+    {
+      /* 同扇区中写入范围之外的有效槽位 */
+      for (uint32_t slot = sector; slot < sector + sc_sector_size; slot += IR_Library::SLOT_SIZE)
+      {
+        uint16_t magic;
+        std::memcpy(&magic, &s_flash[slot], sizeof(magic));
+        if ((slot + IR_Library::SLOT_SIZE <= position || slot >= position + size) && sc_magic == magic && 0xFF == s_flash[slot + sc_state])
+          s_clobbered++;
+      }
+
+      std::vector<uint8_t> buffer(s_flash.begin() + sector, s_flash.begin() + sector + sc_sector_size);
+      std::memcpy(&buffer[position - sector], p + done, size);
+      s_erases++;
+      if (!sl_power())
+      {
+        std::memset(&s_flash[sector], 0xFF, sc_sector_size);
+        return done;
+      }
+      std::memset(&s_flash[sector], 0xFF, sc_sector_size);
+      sl_program(sector, buffer.data(), sc_sector_size);
+    }
+    else
+      sl_program(position, p + done, size);
+
+    if (s_power_off)
+      return done;
+    done += size;
+  }
+  return length;
+}
+
+/// @brief 模拟存储器 存储接口
+static const ir_library_io_t sc_io = { sl_read, sl_write, nullptr };
+
+/**
+ * @brief (静态) 生成随机测试指令
+ */
+static sl_code_t sl_make_code()
+{
+  sl_code_t code;
+  code.pulses.resize(1 + std::rand() % IR_Library::MAX_PULSES);
+  for (ir_pulse_t& pulse : code.pulses)
+    pulse = ir_pulse_t { static_cast<uint16_t>(100 + std::rand() % 9000), static_cast<uint16_t>(std::rand() % 20000) };
+  code.frequency = (std::rand() % 2) ? static_cast<uint16_t>(IR_Library::MIN_FREQUENCY + std::rand() % 30000) : 0;
+  code.duty      = (std::rand() % 2) ? static_cast<uint8_t>(IR_Library::MIN_DUTY + std::rand() % 50) : 0;
+  return code;
+}
+
+static ir_library_error sl_store(IR_Library& library, uint16_t id, const sl_code_t& code)
+{
+  return library.store(id, code.pulses.data(), static_cast<uint16_t>(code.pulses.size()), code.frequency, code.duty);
+}
+
+/**
+ * @brief (静态) 指令库内容与期望一致
+ */
+static bool sl_matches(IR_Library& library, const std::map<uint16_t, sl_code_t>& codes)
+{
+  static ir_pulse_t pulses[IR_Library::MAX_PULSES];
+  bool              ok = (codes.size() == library.size());
+  for (const auto& item : codes)
+  {
+    ir_library_code_t code;
+    ok &= (ir_library_error::NONE == library.load(item.first, pulses, IR_Library::MAX_PULSES, code));
+    ok &= (code.count == item.second.pulses.size() && code.frequency == item.second.frequency && code.duty == item.second.duty);
+    ok &= (0 == std::memcmp(pulses, item.second.pulses.data(), code.count * sizeof(ir_pulse_t)));
+  }
+  return ok;
+}
+
+/**
+ * @brief (静态) 擦除后写满, 重挂载, 参数校验与替换
+ */
+static void sl_check_fill(std::map<uint16_t, sl_code_t>& codes)
+{
+  std::unique_ptr<IR_Library> library(new IR_Library());
+  sl_code_t                   code = sl_make_code();
+  HOST_CHECK(ir_library_error::MOUNT == sl_store(*library, 1, code));
+  HOST_CHECK(library->mount(sc_io, 0, static_cast<uint32_t>(s_flash.size())) && sc_slots == library->capacity() && 0 == library->size());
+
+  /* 写满后返回 FULL, 已存储的指令不受影响 */
+  for (uint16_t id = 1; id <= sc_slots; id++)
+  {
+    codes[id] = sl_make_code();
+    HOST_CHECK(ir_library_error::NONE == sl_store(*library, id, codes[id]));
+  }
+  HOST_CHECK(ir_library_error::FULL == sl_store(*library, sc_slots + 1, code));
+  HOST_CHECK(ir_library_error::FULL == sl_store(*library, 1, code));
+  HOST_CHECK(sl_matches(*library, codes));
+
+  library.reset(new IR_Library());
+  HOST_CHECK(library->mount(sc_io, 0, static_cast<uint32_t>(s_flash.size())) && sl_matches(*library, codes));
+
+  /* 参数校验 */
+  ir_pulse_t        pulses[IR_Library::MAX_PULSES + 1] = {};
+  ir_library_code_t loaded;
+  HOST_CHECK(ir_library_error::ID == sl_store(*library, 0, code));
+  HOST_CHECK(ir_library_error::LENGTH == library->store(2, pulses, 0));
+  HOST_CHECK(ir_library_error::LENGTH == library->store(2, pulses, IR_Library::MAX_PULSES + 1));
+  HOST_CHECK(ir_library_error::CARRIER == library->store(2, pulses, 1, IR_Library::MAX_FREQUENCY + 1));
+  HOST_CHECK(ir_library_error::CARRIER == library->store(2, pulses, 1, 0, IR_Library::MAX_DUTY + 1));
+  HOST_CHECK(ir_library_error::MISSING == library->load(sc_slots + 1, pulses, IR_Library::MAX_PULSES, loaded));
+  HOST_CHECK(ir_library_error::LENGTH == library->load(1, pulses, 0, loaded));
+
+  /* 替换: 删除末尾两个扇区的指令后替换, 数量不变 */
+  for (uint16_t id = sc_slots - 3; id <= sc_slots; id++)
+  {
+    HOST_CHECK(ir_library_error::NONE == library->remove(id));
+    codes.erase(id);
+  }
+  HOST_CHECK(ir_library_error::MISSING == library->remove(sc_slots));
+  for (uint16_t id : { 7, 9 })
+  {
+    codes[id] = sl_make_code();
+    HOST_CHECK(ir_library_error::NONE == sl_store(*library, id, codes[id]));
+  }
+  HOST_CHECK(sl_matches(*library, codes));
+
+  library.reset(new IR_Library());
+  HOST_CHECK(library->mount(sc_io, 0, static_cast<uint32_t>(s_flash.size())) && sl_matches(*library, codes));
+}
+
+/**
+ * @brief (静态) 替换过程中任意时刻掉电: 其他指令完好, 被替换的指令为旧内容或新内容
+ */
+static void sl_check_power_loss()
+{
+  /* 基准: 写满后删除槽位0 (同扇区槽位1有效) 与槽位4, 5 (整扇区空闲); 挂载后从槽位0开始分配 */
+  std::fill(s_flash.begin(), s_flash.end(), 0xFF);
+  std::map<uint16_t, sl_code_t> codes;
+  std::unique_ptr<IR_Library>   library(new IR_Library());
+  HOST_CHECK(library->mount(sc_io, 0, static_cast<uint32_t>(s_flash.size())));
+  for (uint16_t id = 1; id <= sc_slots; id++)
+  {
+    codes[id] = sl_make_code();
+    HOST_CHECK(ir_library_error::NONE == sl_store(*library, id, codes[id]));
+  }
+  for (uint16_t id : { 1, 5, 6 })
+  {
+    HOST_CHECK(ir_library_error::NONE == library->remove(id));
+    codes.erase(id);
+  }
+  const std::vector<uint8_t> baseline = s_flash;
+
+  const uint16_t target = 40;
+  sl_code_t      update = sl_make_code();
+  bool           done   = false;
+  uint32_t       cuts   = 0;
+  s_clobbered           = 0;
+  s_erases              = 0;
+  for (int32_t budget = 1; !done; budget++)
+  {
+    s_flash = baseline;
+    library.reset(new IR_Library());
+    HOST_CHECK(library->mount(sc_io, 0, static_cast<uint32_t>(s_flash.size())));
+
+    s_budget               = budget;
+    s_power_off            = false;
+    ir_library_error error = sl_store(*library, target, update);
+    HOST_CHECK(s_power_off || ir_library_error::NONE == error);
+    done        = !s_power_off;
+    cuts       += s_power_off ? 1 : 0;
+    s_budget    = -1;
+    s_power_off = false;
+
+    /* 上电重挂载 */
+    library.reset(new IR_Library());
+    HOST_CHECK(library->mount(sc_io, 0, static_cast<uint32_t>(s_flash.size())));
+
+    std::map<uint16_t, sl_code_t> old_codes = codes;
+    std::map<uint16_t, sl_code_t> new_codes = codes;
+    new_codes[target]                       = update;
+    HOST_CHECK(sl_matches(*library, old_codes) || sl_matches(*library, new_codes));
+    HOST_CHECK(!done || sl_matches(*library, new_codes));
+  }
+
+  /* 整扇区空闲的槽位经过擦除重写, 有效槽位所在扇区从未被擦除 */
+  HOST_CHECK(cuts > 2 && s_erases > 0 && 0 == s_clobbered);
+}
+
+/**
+ * @brief (静态) 校验值损坏, 每扇区仅剩一个有效槽位时的 FULL, 清空
+ */
+static void sl_check_corruption()
+{
+  std::fill(s_flash.begin(), s_flash.end(), 0xFF);
+  std::map<uint16_t, sl_code_t> codes;
+  std::unique_ptr<IR_Library>   library(new IR_Library());
+  HOST_CHECK(library->mount(sc_io, 0, static_cast<uint32_t>(s_flash.size())));
+  for (uint16_t id = 1; id <= sc_slots; id++)
+  {
+    codes[id] = sl_make_code();
+    HOST_CHECK(ir_library_error::NONE == sl_store(*library, id, codes[id]));
+  }
+
+  /* 脉冲数据与头部字段损坏 (槽位 = 编号 - 1) */
+  ir_pulse_t        pulses[IR_Library::MAX_PULSES];
+  ir_library_code_t loaded;
+  s_flash[3 * IR_Library::SLOT_SIZE + sc_header_size] ^= 0x01;
+  s_flash[5 * IR_Library::SLOT_SIZE + 10] ^= 0x40;
+  HOST_CHECK(ir_library_error::CRC == library->load(4, pulses, IR_Library::MAX_PULSES, loaded) && 0 == loaded.count);
+  HOST_CHECK(ir_library_error::CRC == library->load(6, pulses, IR_Library::MAX_PULSES, loaded));
+  codes.erase(4);
+  codes.erase(6);
+  HOST_CHECK(ir_library_error::NONE == library->remove(4) && ir_library_error::NONE == library->remove(6));
+  HOST_CHECK(sl_matches(*library, codes));
+
+  /* 头部标识损坏: 重挂载时视为空闲 */
+  s_flash[9 * IR_Library::SLOT_SIZE] = 0x00;
+  codes.erase(10);
+  library.reset(new IR_Library());
+  HOST_CHECK(library->mount(sc_io, 0, static_cast<uint32_t>(s_flash.size())) && sl_matches(*library, codes));
+
+  /* 每扇区删除一个槽位: 空闲槽位均未擦除且同扇区槽位有效, 不能安全写入 */
+  sl_code_t code = sl_make_code();
+  for (uint16_t id = 2; id <= sc_slots; id += 2)
+  {
+    if (codes.count(id))
+    {
+      HOST_CHECK(ir_library_error::NONE == library->remove(id));
+      codes.erase(id);
+    }
+  }
+  s_erases = 0;
+  HOST_CHECK(ir_library_error::FULL == sl_store(*library, 100, code));
+
+  /* 同扇区两个槽位均空闲后可擦除重写 */
+  HOST_CHECK(ir_library_error::NONE == library->remove(1));
+  codes.erase(1);
+  codes[100] = code;
+  HOST_CHECK(ir_library_error::NONE == sl_store(*library, 100, code) && 1 == s_erases && sl_matches(*library, codes));
+
+  HOST_CHECK(ir_library_error::NONE == library->clear() && 0 == library->size());
+  library.reset(new IR_Library());
+  HOST_CHECK(library->mount(sc_io, 0, static_cast<uint32_t>(s_flash.size())) && 0 == library->size());
+  HOST_CHECK(ir_library_error::NONE == sl_store(*library, 1, code) && 1 == library->size());
+}
+
+int main()
+{
+  std::srand(12);
+
+  std::map<uint16_t, sl_code_t> codes;
+  sl_check_fill(codes);
+  sl_check_power_loss();
+  sl_check_corruption();
+  return host_test_result("ir_library_test");
+}
@@ -0,0 +1,184 @@
+/**
+ * @file      ir_macro_test.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library host test for IR macro sequencer (红外遥控 宏指令虚拟时钟测试)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "host_test.hpp"
+#include "ir_macro.hpp"
+
+#include <cstring>
+#include <vector>
+
+using namespace OwO::device;
+
+/// @brief 测试宏编号
+static constexpr uint16_t sc_id          = 3;
+/// @brief 测试宏步骤数量
+static constexpr uint16_t sc_count       = 5;
+/// @brief 存储记录头部长度(字节)
+static constexpr uint32_t sc_record_size = 8;
+/// @brief 测试宏各步骤延时(ms)
+static constexpr uint16_t sc_delays[sc_count] = { 0, 1500, 250, 3000, 1 };
+
+/// @brief 模拟存储器 (擦除状态)
+static std::vector<uint8_t> s_flash(IR_Macro::MAX_MACROS * IR_Macro::SLOT_SIZE, 0xFF);
+
+static uint32_t sl_read(void*, uint32_t address, void* data, uint32_t length)
+{
+  std::memcpy(data, &s_flash[address], length);
+  return length;
+}
+
+static uint32_t sl_write(void*, uint32_t address, const void* data, uint32_t length)
+{
+  std::memcpy(&s_flash[address], data, length);
+  return length;
+}
+
+/**
+ * @brief (静态) 生成测试宏上传区 (第3步为空调状态指令, 其余为学习码)
+ */
+static void sl_make_block(uint16_t* regs)
+{
+  std::memset(regs, 0, IR_Macro::BLOCK_SIZE * sizeof(uint16_t));
+  regs[0] = sc_id;
+  regs[1] = sc_count;
+  for (uint16_t i = 0; i < sc_count; i++)
+  {
+    uint16_t* step = &regs[2 + i * IR_Macro::STEP_SIZE];
+    step[0]        = static_cast<uint16_t>((1 << i) | ((2 == i ? 1 : 0) << 8));
+    step[1]        = sc_delays[i];
+    step[2]        = (2 == i) ? static_cast<uint16_t>((2 << 8) | 24) : static_cast<uint16_t>(100 + i);
+    step[3]        = 0x1110;
+  }
+}
+
+/**
+ * @brief (静态) 上传区校验, 存储与掉电/损坏恢复
+ */
+static void sl_check_storage(IR_Macro::macro_t& macro)
+{
+  const ir_library_io_t io = { sl_read, sl_write, nullptr };
+  uint16_t              regs[IR_Macro::BLOCK_SIZE];
+  uint16_t              bad[IR_Macro::BLOCK_SIZE];
+  uint16_t              id = 0;
+  IR_Macro::macro_t     loaded;
+
+  sl_make_block(regs);
+  HOST_CHECK(ir_macro_error::NONE == IR_Macro::parse(regs, IR_Macro::BLOCK_SIZE, id, macro) && sc_id == id && sc_count == macro.count);
+  HOST_CHECK(ir_macro_error::NONE == IR_Macro::save(io, 0, id, macro));
+  HOST_CHECK(ir_macro_error::NONE == IR_Macro::load(io, 0, sc_id, loaded) && sc_count == loaded.count);
+  HOST_CHECK(0 == std::memcmp(loaded.steps, macro.steps, sc_count * sizeof(ir_macro_step_t)));
+  HOST_CHECK(ir_macro_error::MISSING == IR_Macro::load(io, 0, sc_id + 1, loaded));
+
+  /* 步骤数据损坏 */
+  const uint32_t steps = (sc_id - 1) * IR_Macro::SLOT_SIZE + sc_record_size;
+  s_flash[steps + 5] ^= 1;
+  HOST_CHECK(ir_macro_error::MISSING == IR_Macro::load(io, 0, sc_id, loaded));
+  s_flash[steps + 5] ^= 1;
+
+  /* 掉电: 新步骤已写入, 头部仍为旧记录 */
+  IR_Macro::macro_t changed = macro;
+  changed.steps[0].delay    = 7;
+  std::memcpy(&s_flash[steps], changed.steps, sc_count * sizeof(ir_macro_step_t));
+  HOST_CHECK(ir_macro_error::MISSING == IR_Macro::load(io, 0, sc_id, loaded));
+  HOST_CHECK(ir_macro_error::NONE == IR_Macro::save(io, 0, sc_id, macro));
+
+  struct
+  {
+    uint16_t       reg;
+    uint16_t       value;
+    ir_macro_error error;
+  } const sc_cases[] = {
+    { 0,     0,      ir_macro_error::ID      },
+    { 0,     65,     ir_macro_error::ID      },
+    { 1,     29,     ir_macro_error::LENGTH  },
+    { 2 + 4, 0x0100, ir_macro_error::CHANNEL },
+    { 2 + 4, 0x0201, ir_macro_error::KIND    },
+    { 2 + 6, 0,      ir_macro_error::CODE    },
+  };
+  for (const auto& item : sc_cases)
+  {
+    std::memcpy(bad, regs, sizeof(bad));
+    bad[item.reg] = item.value;
+    HOST_CHECK(item.error == IR_Macro::parse(bad, IR_Macro::BLOCK_SIZE, id, loaded));
+  }
+  HOST_CHECK(ir_macro_error::LENGTH == IR_Macro::parse(regs, 2 + 4 * IR_Macro::STEP_SIZE, id, loaded));
+}
+
+/**
+ * @brief (静态) 虚拟时钟执行: 定时器按等待时间唤醒, 各步骤在累加延时的时刻执行 (含计数回绕)
+ */
+static void sl_check_timing(const IR_Macro::macro_t& macro)
+{
+  for (uint32_t start : { 1000u, 0xFFFFF000u })
+  {
+    IR_Macro sequencer;
+    HOST_CHECK(sequencer.start(sc_id, macro, start));
+
+    uint32_t expect[sc_count];
+    uint32_t time = start;
+    for (uint16_t i = 0; i < sc_count; i++)
+      expect[i] = time += sc_delays[i];
+
+    uint32_t fired[sc_count] = {};
+    uint16_t count           = 0;
+    uint32_t now             = start;
+    for (int guard = 0; 0 != sequencer.id() && guard < 100000; guard++)
+    {
+      uint32_t wakeup  = sequencer.next_wakeup(now);
+      now             += (IR_Macro::NO_WAKEUP == wakeup) ? 1 : wakeup;
+      for (const ir_macro_step_t* step = sequencer.due(now); nullptr != step && count < sc_count; step = sequencer.due(now))
+      {
+        fired[count++] = now;
+        sequencer.advance();
+      }
+    }
+    HOST_CHECK(sc_count == count);
+    for (uint16_t i = 0; i < sc_count; i++)
+      HOST_CHECK(expect[i] == fired[i]);
+    HOST_CHECK(IR_Macro::NO_WAKEUP == sequencer.next_wakeup(now));
+  }
+
+  /* 通道忙推迟第2步400ms: 后续步骤时刻不受影响 */
+  IR_Macro sequencer;
+  sequencer.start(sc_id, macro, 0);
+  uint32_t fired[sc_count] = {};
+  uint16_t count           = 0;
+  uint32_t now             = 0;
+  for (int guard = 0; 0 != sequencer.id() && guard < 100000; guard++)
+  {
+    uint32_t wakeup  = sequencer.next_wakeup(now);
+    now             += (0 != wakeup) ? wakeup : 1;
+    if (nullptr != sequencer.due(now) && 1 == sequencer.index() && now < 1500 + 400)
+      continue;
+    for (const ir_macro_step_t* step = sequencer.due(now); nullptr != step && count < sc_count; step = sequencer.due(now))
+    {
+      fired[count++] = now;
+      sequencer.advance();
+    }
+  }
+  HOST_CHECK(sc_count == count && 1900 == fired[1] && 1900 == fired[2] && 4750 == fired[3] && 4751 == fired[4]);
+
+  /* 停止与替换 */
+  sequencer.start(sc_id, macro, 0);
+  sequencer.stop();
+  HOST_CHECK(nullptr == sequencer.due(100000) && 0 == sequencer.id());
+  sequencer.start(sc_id, macro, 0);
+  sequencer.advance();
+  sequencer.start(sc_id, macro, 10);
+  HOST_CHECK(0 == sequencer.index() && 10 == sequencer.deadline());
+}
+
+int main()
+{
+  IR_Macro::macro_t macro;
+  sl_check_storage(macro);
+  sl_check_timing(macro);
+  return host_test_result("ir_macro_test");
+}
@@ -0,0 +1,195 @@
+/**
+ * @file      ir_preempt_test.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library host test for IR scheduler preemption (红外遥控 调度器优先级抢占模拟时钟测试)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "host_test.hpp"
+#include "ir_scheduler.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+
+using namespace OwO::device;
+
+/// @brief 全部通道掩码
+static constexpr uint8_t  sc_all     = 0xFF;
+/// @brief 帧发送时长(ms)
+static constexpr uint32_t sc_frame   = 70;
+/// @brief 帧间延时(ms)
+static constexpr uint32_t sc_delay   = 100;
+/// @brief 常规任务重复次数
+static constexpr uint8_t  sc_repeats = 20;
+/// @brief 紧急任务优先级
+static constexpr uint8_t  sc_urgent  = 9;
+
+/// @brief 结构体 模拟结果
+struct sl_result_t
+{
+  uint32_t worst_routine; /* 排在常规任务之后的紧急任务最大延迟(ms) */
+  uint32_t worst;         /* 紧急任务最大延迟(ms) */
+  uint32_t total;         /* 紧急任务延迟总和(ms) */
+  uint32_t urgent_sent;   /* 紧急任务发送帧数 */
+  uint32_t routine_sent;  /* 常规任务发送帧数 */
+  uint32_t routine_total; /* 常规任务提交帧数 */
+};
+
+/**
+ * @brief (静态) 单通道模拟时钟 (1ms步进): 空闲时持续提交多次重复的常规任务, 随机到达紧急任务
+ */
+static sl_result_t sl_simulate(bool preempt, ir_preempt_policy policy)
+{
+  IR_Scheduler scheduler;
+  sl_result_t  result    = {};
+  int          on_air    = -1; /* 发送中的任务 (0常规, 1紧急) */
+  int          current   = -1; /* 占用通道的任务 */
+  int          suspended = -1; /* 挂起的任务 */
+  int          pending   = 0;  /* 紧急任务 0无, 1等待提交, 2已提交 */
+  uint32_t     end       = 0;
+  uint32_t     arrival   = 0;
+  bool         routine   = false;
+
+  std::srand(1234);
+  for (uint32_t now = 0; now < 2000000; now++)
+  {
+    if (on_air >= 0 && now >= end)
+    {
+      scheduler.complete(0, true, now);
+      on_air = -1;
+    }
+
+    if (!scheduler.is_busy(0) && 0 == scheduler.suspended_mask() && 0 == pending && scheduler.submit(0, sc_repeats, sc_delay, now, 0))
+    {
+      current                = 0;
+      result.routine_total  += sc_repeats;
+    }
+
+    if (0 == pending && 0 == std::rand() % 3000)
+    {
+      pending = 1;
+      arrival = now;
+      routine = !scheduler.is_busy(0) || 0 == current;
+    }
+
+    if (0 != pending)
+    {
+      uint8_t level = preempt ? sc_urgent : 0;
+      if (scheduler.admit(0, level))
+      {
+        if (scheduler.is_busy(0))
+          suspended = scheduler.preempt(0, policy) ? current : -1;
+        scheduler.submit(0, 1, sc_delay, now, level);
+        current = 1;
+        pending = 2;
+      }
+    }
+
+    if (0 != scheduler.poll(now, (on_air < 0) ? 1 : 0))
+    {
+      on_air = current;
+      end    = now + sc_frame;
+      if (1 == current)
+      {
+        uint32_t latency = now - arrival;
+        if (latency > result.worst)
+          result.worst = latency;
+        if (routine && latency > result.worst_routine)
+          result.worst_routine = latency;
+        result.total += latency;
+        result.urgent_sent++;
+        pending = 0;
+      }
+      else
+      {
+        result.routine_sent++;
+      }
+    }
+
+    if (0 != scheduler.resume(now))
+    {
+      current   = suspended;
+      suspended = -1;
+    }
+  }
+
+  return result;
+}
+
+/**
+ * @brief (静态) 抢占/恢复/丢弃 与不抢占的紧急任务延迟对比
+ */
+static void sl_check_latency()
+{
+  const char* const sc_names[] = { "no preemption", "preempt+resume", "preempt+drop" };
+  for (int mode = 0; mode < 3; mode++)
+  {
+    sl_result_t result = sl_simulate(0 != mode, (2 == mode) ? ir_preempt_policy::DROP : ir_preempt_policy::RESUME);
+    std::printf("%-15s urgent=%u worst(behind routine)=%ums worst=%ums mean=%.1fms routine sent/submitted=%u/%u\n", sc_names[mode], result.urgent_sent,
+                result.worst_routine, result.worst, static_cast<double>(result.total) / result.urgent_sent, result.routine_sent, result.routine_total);
+
+    HOST_CHECK(result.urgent_sent > 100);
+    if (0 != mode)
+      HOST_CHECK(result.worst_routine <= sc_frame && result.worst <= sc_frame + sc_delay);
+    /* 恢复: 仅执行中的任务可能未完成; 丢弃: 被抢占任务的剩余帧丢失 */
+    if (1 == mode)
+      HOST_CHECK(result.routine_total - result.routine_sent <= sc_repeats);
+    if (2 == mode)
+      HOST_CHECK(result.routine_sent < result.routine_total - sc_repeats);
+  }
+}
+
+/**
+ * @brief (静态) 抢占状态转换: 发送中不可抢占, 挂起后恢复剩余帧, 嵌套抢占保留较高优先级的挂起任务
+ */
+static void sl_check_states()
+{
+  IR_Scheduler scheduler;
+  scheduler.submit(1, 5, 10, 0, 1);
+  HOST_CHECK(!scheduler.admit(1, 1) && scheduler.admit(1, 2));
+
+  scheduler.poll(0, sc_all);
+  HOST_CHECK(!scheduler.admit(1, sc_urgent) && !scheduler.preempt(1, ir_preempt_policy::RESUME));
+
+  scheduler.complete(1, true, 0);
+  HOST_CHECK(scheduler.admit(1, sc_urgent) && scheduler.preempt(1, ir_preempt_policy::RESUME));
+  HOST_CHECK(0x02 == scheduler.suspended_mask() && !scheduler.is_busy(1));
+
+  scheduler.submit(1, 1, 10, 0, sc_urgent);
+  HOST_CHECK(0 == scheduler.resume(0));
+  scheduler.poll(0, sc_all);
+  scheduler.complete(1, true, 0);
+  scheduler.poll(10, 0);
+  HOST_CHECK(0x02 == scheduler.resume(10) && ir_job_state::PENDING == scheduler.state(1) && 0 == scheduler.suspended_mask());
+
+  int sent = 0;
+  for (uint32_t now = 10; now < 200; now++)
+  {
+    if (0 != scheduler.poll(now, sc_all))
+    {
+      sent++;
+      scheduler.complete(1, true, now);
+    }
+  }
+  HOST_CHECK(4 == sent);
+
+  scheduler.reset();
+  scheduler.submit(2, 3, 10, 0, 1);
+  scheduler.preempt(2, ir_preempt_policy::RESUME);
+  scheduler.submit(2, 3, 10, 0, 5);
+  HOST_CHECK(scheduler.preempt(2, ir_preempt_policy::RESUME));
+  scheduler.submit(2, 3, 10, 0, 3);
+  HOST_CHECK(!scheduler.preempt(2, ir_preempt_policy::RESUME));
+  scheduler.cancel(2);
+  HOST_CHECK(0 == scheduler.suspended_mask());
+}
+
+int main()
+{
+  sl_check_states();
+  sl_check_latency();
+  return host_test_result("ir_preempt_test");
+}
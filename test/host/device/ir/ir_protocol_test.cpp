@@ -0,0 +1,88 @@
+/**
+ * @file      ir_protocol_test.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library host test for IR protocol descriptors (红外遥控 协议描述表与旧版编码器一致性测试)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "host_test.hpp"
+#include "ir_legacy_encoder.hpp"
+#include "ir_protocol.hpp"
+
+#include <cstdlib>
+
+using namespace OwO::device;
+
+/// @brief 结构体 品牌与旧版编码函数
+struct brand_t
+{
+  ir_type type;
+  bool (IR_Legacy_Encoder::*encode)(uint8_t);
+};
+
+int main()
+{
+  static const brand_t sc_brands[] = {
+    { ir_type::AUX,     &IR_Legacy_Encoder::m_aux     },
+    { ir_type::TCL,     &IR_Legacy_Encoder::m_tcl     },
+    { ir_type::GREE,    &IR_Legacy_Encoder::m_gree    },
+    { ir_type::OUTES,   &IR_Legacy_Encoder::m_outes   },
+    { ir_type::MIDEA,   &IR_Legacy_Encoder::m_midea   },
+    { ir_type::XIAOMI,  &IR_Legacy_Encoder::m_xiaomi  },
+    { ir_type::HISENSE, &IR_Legacy_Encoder::m_hisense },
+  };
+
+  static ir_pulse_t legacy_buffer[IR_Timeline::MAX_PULSES];
+  static ir_pulse_t generic_buffer[IR_Timeline::MAX_PULSES];
+  uint32_t          frames = 0;
+
+  std::srand(1);
+  for (const brand_t& brand : sc_brands)
+  {
+    const ir_protocol_t* protocol = IR_Protocol::get(brand.type);
+    HOST_CHECK(nullptr != protocol);
+    if (nullptr == protocol)
+      continue;
+
+    /* 全部指令长度: 旧版拒绝的长度描述表也必须拒绝; 接受的长度逐脉冲比较 */
+    for (uint8_t length = 0; length < 32; length++)
+    {
+      for (int round = 0; round < 200; round++)
+      {
+        char data[32];
+        for (char& byte : data)
+          byte = static_cast<char>(std::rand());
+
+        IR_Legacy_Encoder legacy;
+        legacy.m_data_tmp = data;
+        legacy.m_timeline.attach(legacy_buffer, IR_Timeline::MAX_PULSES);
+        bool expect = (legacy.*brand.encode)(length);
+
+        IR_Timeline generic;
+        generic.attach(generic_buffer, IR_Timeline::MAX_PULSES);
+        bool actual = IR_Protocol::encode(*protocol, reinterpret_cast<const uint8_t*>(data), length, generic);
+
+        HOST_CHECK(expect == actual);
+        if (!expect || !actual)
+          break;
+
+        HOST_CHECK(!legacy.m_timeline.is_overflow() && !generic.is_overflow());
+        HOST_CHECK(legacy.m_timeline.size() == generic.size());
+        HOST_CHECK(IR_Protocol::count(*protocol, length) >= generic.size());
+        for (uint16_t i = 0; i < generic.size() && i < legacy.m_timeline.size(); i++)
+        {
+          HOST_CHECK(legacy_buffer[i].mark == generic_buffer[i].mark);
+          HOST_CHECK(legacy_buffer[i].space == generic_buffer[i].space);
+        }
+        frames++;
+      }
+    }
+  }
+
+  std::printf("compared %u frames\n", frames);
+  HOST_CHECK(frames > 0);
+  return host_test_result("ir_protocol_test");
+}
@@ -0,0 +1,216 @@
+/**
+ * @file      ir_raw_test.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library host test for IR raw timing upload (红外遥控 原始时序上传区校验与边界测试)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "host_test.hpp"
+#include "ir_protocol.hpp"
+#include "ir_raw.hpp"
+
+#include <cstdlib>
+#include <cstring>
+
+using namespace OwO::device;
+
+/// @brief 解码输出缓存区容量
+static constexpr uint16_t sc_capacity = 400;
+
+static uint16_t   s_regs[IR_Raw::BLOCK_SIZE];
+static ir_pulse_t s_source[sc_capacity];
+static ir_pulse_t s_output[sc_capacity];
+
+/**
+ * @brief (静态) 编码后解码: 头部与时序原样还原
+ */
+static void sl_check_round_trip()
+{
+  uint8_t data[32];
+  for (uint8_t& byte : data)
+    byte = static_cast<uint8_t>(std::rand());
+
+  uint32_t trips = 0;
+  for (int type = static_cast<int>(ir_type::AUX); type <= static_cast<int>(ir_type::HISENSE); type++)
+  {
+    const ir_protocol_t* protocol = IR_Protocol::get(static_cast<ir_type>(type));
+    for (uint8_t length = 1; length <= 32; length++)
+    {
+      IR_Timeline timeline;
+      timeline.attach(s_source, sc_capacity);
+      if (nullptr == IR_Protocol::find(*protocol, length) || !IR_Protocol::encode(*protocol, data, length, timeline))
+        continue;
+
+      ir_raw_header_t header  = { 0x05, 2, 40000, 33, 0, 0 };
+      uint16_t        written = IR_Raw::build(s_source, timeline.size(), header, s_regs, IR_Raw::BLOCK_SIZE);
+      if (0 == written)
+        continue;
+
+      ir_raw_header_t parsed = {};
+      uint16_t        count  = 0;
+      HOST_CHECK(ir_raw_error::NONE == IR_Raw::parse(s_regs, written, parsed, s_output, sc_capacity, count));
+      HOST_CHECK(timeline.size() == count);
+      HOST_CHECK(0 == std::memcmp(s_source, s_output, count * sizeof(ir_pulse_t)));
+      HOST_CHECK(0x05 == parsed.mask && 2 == parsed.count && 40000 == parsed.frequency && 33 == parsed.duty);
+      HOST_CHECK(written == IR_Raw::registers(parsed));
+      trips++;
+    }
+  }
+  HOST_CHECK(trips > 0);
+
+  /* 超过字典容量的不同时长: 直接上传时长 */
+  for (uint16_t i = 0; i < 40; i++)
+    s_source[i] = { static_cast<uint16_t>(300 + i * 7), static_cast<uint16_t>(500 + i * 11) };
+  s_source[39].space = 0;
+
+  ir_raw_header_t header  = { 1, 0, 0, 0, 0, 0 };
+  uint16_t        written = IR_Raw::build(s_source, 40, header, s_regs, IR_Raw::BLOCK_SIZE);
+  ir_raw_header_t parsed  = {};
+  uint16_t        count   = 0;
+  HOST_CHECK(IR_Raw::HEADER_SIZE + 80 == written && 0 == header.dictionary);
+  HOST_CHECK(ir_raw_error::NONE == IR_Raw::parse(s_regs, written, parsed, s_output, sc_capacity, count));
+  HOST_CHECK(40 == count && 0 == std::memcmp(s_source, s_output, 40 * sizeof(ir_pulse_t)));
+  HOST_CHECK(ir_raw_error::SIZE == IR_Raw::parse(s_regs, written - 1, parsed, s_output, sc_capacity, count) && 0 == count);
+
+  /* 奇数时长数量: 末尾空闲为0 */
+  s_regs[4] = 79;
+  HOST_CHECK(ir_raw_error::NONE == IR_Raw::parse(s_regs, written, parsed, s_output, sc_capacity, count) && 40 == count && 0 == s_output[39].space);
+
+  /* 寄存器不足时编码失败 */
+  header = { 1, 1, 0, 0, 0, 0 };
+  HOST_CHECK(0 == IR_Raw::build(s_source, 40, header, s_regs, 50));
+}
+
+/**
+ * @brief (静态) 生成一个字典上传区 (3个脉冲, 字典大小2)
+ */
+static uint16_t sl_make_block()
+{
+  const ir_pulse_t pulses[3] = { { 560, 560 }, { 560, 1690 }, { 560, 0 } };
+  ir_raw_header_t  header    = { 1, 1, 0, 0, 0, 0 };
+  return IR_Raw::build(pulses, 3, header, s_regs, IR_Raw::BLOCK_SIZE);
+}
+
+/**
+ * @brief (静态) 各项校验错误
+ */
+static void sl_check_errors()
+{
+  ir_raw_header_t header = {};
+  uint16_t        count  = 99;
+  uint16_t        size   = 0;
+
+  HOST_CHECK(ir_raw_error::SIZE == IR_Raw::parse(s_regs, IR_Raw::HEADER_SIZE - 1, header, s_output, sc_capacity, count) && 0 == count);
+
+  size = sl_make_block();
+  HOST_CHECK(IR_Raw::HEADER_SIZE + 3 + 2 == size);
+  HOST_CHECK(ir_raw_error::NONE == IR_Raw::parse(s_regs, size, header, s_output, sc_capacity, count) && 3 == count);
+
+  struct
+  {
+    uint16_t     reg;
+    uint16_t     value;
+    ir_raw_error error;
+  } const sc_cases[] = {
+    { 0, 0,      ir_raw_error::CHANNEL    },
+    { 0, 0x100,  ir_raw_error::CHANNEL    },
+    { 2, 29999,  ir_raw_error::CARRIER    },
+    { 2, 60001,  ir_raw_error::CARRIER    },
+    { 2, 56000,  ir_raw_error::NONE       },
+    { 3, 9,      ir_raw_error::DUTY       },
+    { 3, 61,     ir_raw_error::DUTY       },
+    { 3, 50,     ir_raw_error::NONE       },
+    { 4, 0,      ir_raw_error::LENGTH     },
+    { 4, 9,      ir_raw_error::SIZE       },
+    { 4, 5,      ir_raw_error::NONE       },
+    { 5, 17,     ir_raw_error::DICTIONARY },
+    { 6, 0,      ir_raw_error::DURATION   },
+  };
+  for (const auto& item : sc_cases)
+  {
+    size              = sl_make_block();
+    s_regs[item.reg]  = item.value;
+    ir_raw_error error = IR_Raw::parse(s_regs, size, header, s_output, sc_capacity, count);
+    HOST_CHECK(item.error == error);
+    HOST_CHECK(ir_raw_error::NONE == error || 0 == count);
+  }
+
+  /* 字典下标越界 */
+  size       = sl_make_block();
+  s_regs[9] |= 0x000F;
+  HOST_CHECK(ir_raw_error::INDEX == IR_Raw::parse(s_regs, size, header, s_output, sc_capacity, count) && 0 == count);
+
+  /* 输出缓存区不足 */
+  size = sl_make_block();
+  HOST_CHECK(ir_raw_error::LENGTH == IR_Raw::parse(s_regs, size, header, s_output, 2, count) && 0 == count);
+
+  /* 非末尾空闲为0 */
+  const ir_pulse_t gapless[2] = { { 560, 0 }, { 560, 0 } };
+  header                      = { 1, 1, 0, 0, 0, 0 };
+  size                        = IR_Raw::build(gapless, 2, header, s_regs, IR_Raw::BLOCK_SIZE);
+  HOST_CHECK(ir_raw_error::DURATION == IR_Raw::parse(s_regs, size, header, s_output, sc_capacity, count));
+
+  /* 帧总时长超出上限 */
+  ir_pulse_t long_pulses[17];
+  for (ir_pulse_t& pulse : long_pulses)
+    pulse = { 60000, 60000 };
+  header = { 1, 1, 0, 0, 0, 0 };
+  size   = IR_Raw::build(long_pulses, 17, header, s_regs, IR_Raw::BLOCK_SIZE);
+  HOST_CHECK(ir_raw_error::FRAME_TIME == IR_Raw::parse(s_regs, size, header, s_output, sc_capacity, count));
+}
+
+/**
+ * @brief (静态) 随机上传区: 输出不越界, 校验通过的时序满足全部约束
+ */
+static void sl_check_random()
+{
+  for (int round = 0; round < 200000; round++)
+  {
+    uint16_t size = static_cast<uint16_t>(std::rand() % (IR_Raw::BLOCK_SIZE + 1));
+    for (uint16_t i = 0; i < size; i++)
+      s_regs[i] = static_cast<uint16_t>(std::rand());
+
+    /* 部分头部字段取合法值, 使校验深入到数据部分 */
+    if (size >= IR_Raw::HEADER_SIZE && (round & 1))
+    {
+      s_regs[0] = static_cast<uint16_t>(1 + std::rand() % 0xFF);
+      s_regs[2] = 0;
+      s_regs[3] = 0;
+      s_regs[4] = static_cast<uint16_t>(std::rand() % (2 * size));
+      s_regs[5] = static_cast<uint16_t>(std::rand() % (IR_Raw::MAX_DICTIONARY + 2));
+    }
+
+    uint16_t        capacity = static_cast<uint16_t>(std::rand() % IR_Raw::MAX_PULSES + 1);
+    ir_raw_header_t header   = {};
+    uint16_t        count    = 0xFFFF;
+    ir_raw_error    error    = IR_Raw::parse(s_regs, size, header, s_output, capacity, count);
+    if (ir_raw_error::NONE != error)
+    {
+      HOST_CHECK(0 == count);
+      continue;
+    }
+
+    uint32_t total = 0;
+    HOST_CHECK(count >= 1 && count <= capacity);
+    HOST_CHECK(IR_Raw::registers(header) <= size);
+    for (uint16_t i = 0; i < count && i < capacity; i++)
+    {
+      HOST_CHECK(0 != s_output[i].mark);
+      HOST_CHECK(i + 1 == count || 0 != s_output[i].space);
+      total += s_output[i].mark + s_output[i].space;
+    }
+    HOST_CHECK(total <= IR_Raw::MAX_FRAME_TIME);
+  }
+}
+
+int main()
+{
+  std::srand(9);
+  sl_check_round_trip();
+  sl_check_errors();
+  sl_check_random();
+  return host_test_result("ir_raw_test");
+}
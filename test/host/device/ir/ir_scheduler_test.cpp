@@ -0,0 +1,149 @@
+/**
+ * @file      ir_scheduler_test.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library host test for IR multi-channel scheduler (红外遥控 多通道调度器模拟时钟测试)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "host_test.hpp"
+#include "ir_scheduler.hpp"
+
+#include <cstdlib>
+
+using namespace OwO::device;
+
+/// @brief 全部通道掩码
+static constexpr uint8_t sc_all = 0xFF;
+
+/**
+ * @brief (静态) 任务生命周期: 提交, 取出, 帧间延时, 失败, 完成 (时刻跨越32位回绕)
+ */
+static void sl_lifecycle()
+{
+  IR_Scheduler scheduler;
+  uint32_t     now = 0xFFFFFF00u;
+
+  for (uint8_t c = 0; c < IR_Scheduler::CHANNEL_COUNT; c++)
+    HOST_CHECK(scheduler.submit(c, 2, 500, now));
+  HOST_CHECK(!scheduler.submit(3, 1, 0, now));
+  HOST_CHECK(!scheduler.submit(IR_Scheduler::CHANNEL_COUNT, 1, 0, now));
+  HOST_CHECK(sc_all == scheduler.busy_mask());
+  HOST_CHECK(IR_Scheduler::NO_WAKEUP == scheduler.next_wakeup(now));
+
+  HOST_CHECK(sc_all == scheduler.poll(now, sc_all));
+  HOST_CHECK(0 == scheduler.poll(now, sc_all));
+
+  now += 100;
+  for (uint8_t c = 0; c < IR_Scheduler::CHANNEL_COUNT; c++)
+    scheduler.complete(c, 5 != c, now);
+  HOST_CHECK(0x20 == scheduler.failed_mask());
+  HOST_CHECK(0xDF == scheduler.busy_mask());
+  HOST_CHECK(500 == scheduler.next_wakeup(now));
+
+  now += 499;
+  HOST_CHECK(0 == scheduler.poll(now, sc_all));
+  HOST_CHECK(1 == scheduler.next_wakeup(now));
+
+  /* 到期但通道未就绪: 保持等待发送, 就绪后再取出 */
+  now += 1;
+  HOST_CHECK(0x0F == scheduler.poll(now, 0x0F));
+  HOST_CHECK(0xD0 == scheduler.poll(now, 0xF0));
+
+  now += 100;
+  for (uint8_t c = 0; c < IR_Scheduler::CHANNEL_COUNT; c++)
+    scheduler.complete(c, true, now);
+  HOST_CHECK(0 == scheduler.done_mask());
+
+  /* 最后一帧之后仍保持帧间延时, 到期后完成 */
+  now += 500;
+  scheduler.poll(now, 0);
+  HOST_CHECK(0xDF == scheduler.done_mask());
+  HOST_CHECK(0 == scheduler.busy_mask());
+  HOST_CHECK(IR_Scheduler::NO_WAKEUP == scheduler.next_wakeup(now));
+
+  /* 完成或失败的通道可再次提交 */
+  HOST_CHECK(scheduler.submit(5, 1, 0, now));
+  HOST_CHECK(0 == scheduler.failed_mask());
+
+  /* 推迟: 取出的通道回到等待发送 */
+  HOST_CHECK(0x20 == scheduler.poll(now, sc_all));
+  scheduler.defer(5);
+  HOST_CHECK(ir_job_state::PENDING == scheduler.state(5));
+  scheduler.cancel(5);
+  HOST_CHECK(ir_job_state::IDLE == scheduler.state(5));
+}
+
+/**
+ * @brief (静态) 模拟时钟: 随机任务与帧时长, 每毫秒轮询一次, 检查发送次数与帧间延时
+ */
+static void sl_simulation()
+{
+  IR_Scheduler scheduler;
+  uint32_t     now = 0xFFFF0000u;
+
+  uint8_t  count[IR_Scheduler::CHANNEL_COUNT]    = {};
+  uint32_t delay[IR_Scheduler::CHANNEL_COUNT]    = {};
+  uint8_t  started[IR_Scheduler::CHANNEL_COUNT]  = {};
+  uint32_t end[IR_Scheduler::CHANNEL_COUNT]      = {};
+  uint32_t last[IR_Scheduler::CHANNEL_COUNT]     = {};
+  bool     on_air[IR_Scheduler::CHANNEL_COUNT]   = {};
+  uint32_t jobs                                  = 0;
+
+  for (uint32_t tick = 0; tick < 200000; tick++, now++)
+  {
+    /* 空闲通道随机提交新任务 */
+    for (uint8_t c = 0; c < IR_Scheduler::CHANNEL_COUNT; c++)
+    {
+      if (scheduler.is_busy(c) || 0 != std::rand() % 50)
+        continue;
+
+      HOST_CHECK(started[c] == count[c]);
+      count[c]   = static_cast<uint8_t>(1 + std::rand() % 4);
+      delay[c]   = static_cast<uint32_t>(std::rand() % 200);
+      started[c] = 0;
+      HOST_CHECK(scheduler.submit(c, count[c], delay[c], now));
+      jobs++;
+    }
+
+    /* 帧结束 */
+    for (uint8_t c = 0; c < IR_Scheduler::CHANNEL_COUNT; c++)
+    {
+      if (on_air[c] && now == end[c])
+      {
+        scheduler.complete(c, true, now);
+        on_air[c] = false;
+        last[c]   = now;
+      }
+    }
+
+    /* 下一次唤醒时刻不晚于任何等待中的任务到期时刻 */
+    uint32_t wakeup = scheduler.next_wakeup(now);
+    uint8_t  ready  = scheduler.poll(now, sc_all);
+    for (uint8_t c = 0; c < IR_Scheduler::CHANNEL_COUNT; c++)
+    {
+      if (!(ready & (1U << c)))
+        continue;
+
+      /* 首帧立即发送, 后续帧恰在帧间延时到期时发送 */
+      HOST_CHECK(0 == started[c] || now - last[c] == delay[c]);
+      HOST_CHECK(0 == started[c] || wakeup <= delay[c]);
+      HOST_CHECK(started[c] < count[c]);
+      started[c]++;
+      on_air[c] = true;
+      end[c]    = now + 20 + static_cast<uint32_t>(std::rand() % 100);
+    }
+  }
+
+  HOST_CHECK(jobs > 1000);
+}
+
+int main()
+{
+  std::srand(4);
+  sl_lifecycle();
+  sl_simulation();
+  return host_test_result("ir_scheduler_test");
+}
@@ -0,0 +1,153 @@
+/**
+ * @file      ir_stats_test.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library host test for IR per-channel statistics (红外遥控 通道统计快照一致性与基准测试)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "host_test.hpp"
+#include "ir_stats.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+
+using namespace OwO::device;
+
+/// @brief 测试CPU主频(Hz)
+static constexpr uint32_t sc_clock    = 180000000;
+/// @brief 每帧发送时长(us)
+static constexpr uint32_t sc_duration = 67500;
+
+/**
+ * @brief (静态) 计数, 延迟, 排队帧数与寄存器导出
+ */
+static void sl_check_counters()
+{
+  IR_Stats           stats;
+  ir_channel_stats_t snapshot;
+
+  /* 任务3帧: 首帧记录延迟, 其后为重复帧 */
+  stats.trigger(2, 1000, 10);
+  stats.depth(2, 3);
+  stats.start(2, 1000 + 180 * 250, 10, sc_clock);
+  stats.complete(2, true, sc_duration);
+  stats.start(2, 0, 110, sc_clock);
+  stats.complete(2, true, sc_duration);
+  stats.start(2, 0, 210, sc_clock);
+  stats.complete(2, false, sc_duration);
+  stats.depth(2, 0);
+  HOST_CHECK(stats.snapshot(2, snapshot));
+  HOST_CHECK(2 == snapshot.frames && 1 == snapshot.repeats && 1 == snapshot.failures && 2 * sc_duration == snapshot.airtime);
+  HOST_CHECK(250 == snapshot.latency && 250 == snapshot.max_latency && 0 == snapshot.depth && 3 == snapshot.peak_depth);
+
+  /* 长延迟按系统时刻换算; 较小的延迟不改变最大值 */
+  stats.trigger(2, 0, 1000);
+  stats.start(2, 0, 1000 + IR_Stats::LONG_LATENCY, sc_clock);
+  stats.trigger(2, 0, 0);
+  stats.start(2, 180 * 40, 5, sc_clock);
+  HOST_CHECK(stats.snapshot(2, snapshot) && 40 == snapshot.latency && IR_Stats::LONG_LATENCY * 1000 == snapshot.max_latency);
+
+  uint16_t regs[IR_Stats::REGISTER_COUNT];
+  stats.registers(2, regs);
+  uint32_t value = 0;
+  std::memcpy(&value, &regs[0], sizeof(value));
+  HOST_CHECK(2 == value);
+  std::memcpy(&value, &regs[6], sizeof(value));
+  HOST_CHECK(2 * sc_duration / 1000 == value);
+  HOST_CHECK(0 == regs[12] && 3 == regs[13]);
+
+  /* 排队帧数超出16位时饱和, 通道下标错误 */
+  stats.depth(2, 0x12345);
+  stats.registers(2, regs);
+  HOST_CHECK(0xFFFF == regs[12] && 0xFFFF == regs[13]);
+  HOST_CHECK(!stats.snapshot(IR_Stats::CHANNEL_COUNT, snapshot));
+  stats.registers(IR_Stats::CHANNEL_COUNT, regs);
+  HOST_CHECK(0 == regs[0] && 0 == regs[13]);
+
+  stats.clear();
+  HOST_CHECK(stats.snapshot(2, snapshot) && 0 == snapshot.frames && 0 == snapshot.airtime && 0 == snapshot.peak_depth);
+}
+
+/**
+ * @brief (静态) 发送线程持续更新, 读取线程不加锁读取: 快照内各计数始终相互一致
+ */
+static void sl_check_snapshot()
+{
+  IR_Stats              stats;
+  std::atomic<bool>     done(false);
+  std::atomic<uint32_t> reads(0);
+  uint32_t              torn = 0;
+
+  std::thread reader([&]() {
+    ir_channel_stats_t snapshot;
+    uint32_t           last = 0;
+    while (!done.load(std::memory_order_relaxed))
+    {
+      stats.snapshot(0, snapshot);
+      if (snapshot.airtime != static_cast<uint64_t>(snapshot.frames) * sc_duration || snapshot.repeats != snapshot.frames / 2 || snapshot.peak_depth < snapshot.depth || snapshot.frames < last)
+        torn++;
+      last = snapshot.frames;
+      reads.fetch_add(1, std::memory_order_relaxed);
+    }
+  });
+
+  /* 等待读取线程开始后再更新 */
+  while (0 == reads.load(std::memory_order_relaxed))
+    std::this_thread::yield();
+
+  for (uint32_t i = 0; i < 2000000; i++)
+  {
+    /* 每个任务2帧: 首帧 + 1个重复帧 */
+    if (0 == i % 2)
+      stats.trigger(0, i, i);
+    stats.depth(0, 2 - i % 2);
+    stats.start(0, i, i, sc_clock);
+    stats.complete(0, true, sc_duration);
+  }
+  done.store(true);
+  reader.join();
+
+  ir_channel_stats_t snapshot;
+  HOST_CHECK(stats.snapshot(0, snapshot) && 2000000 == snapshot.frames && 1000000 == snapshot.repeats);
+  HOST_CHECK(0 == torn);
+  std::printf("stats: %u concurrent snapshots, %u inconsistent\n", reads.load(), torn);
+}
+
+/**
+ * @brief (静态) 基准测试: 发送路径更新与快照读取
+ */
+static void sl_bench()
+{
+  IR_Stats           stats;
+  ir_channel_stats_t snapshot;
+  uint16_t           regs[IR_Stats::REGISTER_COUNT];
+
+  double update = host_bench(10000000, [&](uint32_t i) {
+    uint8_t channel = static_cast<uint8_t>(i & (IR_Stats::CHANNEL_COUNT - 1));
+    stats.start(channel, i, i, sc_clock);
+    stats.complete(channel, true, sc_duration);
+  });
+  double read = host_bench(10000000, [&](uint32_t i) {
+    stats.snapshot(static_cast<uint8_t>(i & (IR_Stats::CHANNEL_COUNT - 1)), snapshot);
+    host_keep(snapshot);
+  });
+  double output = host_bench(10000000, [&](uint32_t i) {
+    stats.registers(static_cast<uint8_t>(i & (IR_Stats::CHANNEL_COUNT - 1)), regs);
+    host_keep(regs);
+  });
+
+  std::printf("stats: update (start + complete) %.1f ns, snapshot %.1f ns, registers %.1f ns\n", update, read, output);
+}
+
+int main()
+{
+  sl_check_counters();
+  sl_check_snapshot();
+  sl_bench();
+  return host_test_result("ir_stats_test");
+}
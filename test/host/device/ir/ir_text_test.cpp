@@ -0,0 +1,363 @@
+/**
+ * @file      ir_text_test.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library host test for IR Pronto/raw text parser (红外遥控 文本码解析模糊测试与基准测试)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "host_test.hpp"
+#include "ir_text.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace OwO::device;
+
+/// @brief 单行脉冲容量
+static constexpr uint16_t sc_capacity = IR_Timeline::MAX_PULSES;
+
+/// @brief 结构体 单行解析结果
+struct sl_line_t
+{
+  ir_text_error           error;
+  uint16_t                id;
+  uint32_t                frequency;
+  uint32_t                line;
+  std::vector<ir_pulse_t> pulses;
+};
+
+static std::mt19937 s_random(42);
+static ir_pulse_t   s_buffer[sc_capacity];
+
+/**
+ * @brief (静态) 解析整段文本 (chunked 为 true 时按 1~17 字节随机分片输入)
+ */
+static std::vector<sl_line_t> sl_parse(const std::string& text, bool chunked)
+{
+  std::vector<sl_line_t> lines;
+  IR_Text                parser;
+  parser.reset(s_buffer, sc_capacity);
+
+  auto take = [&]() {
+    lines.push_back({ parser.error(), parser.id(), parser.frequency(), parser.line(), std::vector<ir_pulse_t>(parser.data(), parser.data() + parser.size()) });
+    parser.next();
+  };
+
+  size_t position = 0;
+  while (position < text.size())
+  {
+    size_t length = chunked ? 1 + s_random() % 17 : text.size() - position;
+    length        = std::min(length, text.size() - position);
+
+    const char* data = text.data() + position;
+    uint32_t    left = static_cast<uint32_t>(length);
+    while (0 != left)
+    {
+      uint32_t used  = parser.feed(data, left);
+      data          += used;
+      left          -= used;
+      if (parser.ready())
+        take();
+      else if (0 == used)
+      {
+        HOST_CHECK(!"parser stalled");
+        return lines;
+      }
+    }
+    position += length;
+  }
+  if (parser.finish())
+    take();
+  return lines;
+}
+
+static bool sl_same(const std::vector<sl_line_t>& a, const std::vector<sl_line_t>& b)
+{
+  if (a.size() != b.size())
+    return false;
+
+  for (size_t i = 0; i < a.size(); i++)
+  {
+    if (a[i].error != b[i].error || a[i].id != b[i].id || a[i].frequency != b[i].frequency || a[i].line != b[i].line || a[i].pulses.size() != b[i].pulses.size())
+      return false;
+    for (size_t j = 0; j < a[i].pulses.size(); j++)
+      if (a[i].pulses[j].mark != b[i].pulses[j].mark || a[i].pulses[j].space != b[i].pulses[j].space)
+        return false;
+  }
+  return true;
+}
+
+/**
+ * @brief (静态) 固定样例与各项错误
+ */
+static void sl_check_examples()
+{
+  /* Pronto 0x6D -> 38029Hz, 0x157 个周期 -> 9015us */
+  auto lines = sl_parse("# header\n\n7: 0000 006D 0003 0001 0157 00AC 0015 0016 0015 0041 0157 0056  \r\n@38 +9000 -4500 +560 -1690 560\n{9000, 4500, 560, 560}\n", false);
+  HOST_CHECK(3 == lines.size());
+  if (3 == lines.size())
+  {
+    HOST_CHECK(ir_text_error::NONE == lines[0].error && 7 == lines[0].id && 38029 == lines[0].frequency && 4 == lines[0].pulses.size() && 3 == lines[0].line);
+    HOST_CHECK(ir_text_error::NONE == lines[1].error && 38000 == lines[1].frequency && 3 == lines[1].pulses.size());
+    HOST_CHECK(3 != lines[1].pulses.size() || (560 == lines[1].pulses[2].mark && 0 == lines[1].pulses[2].space));
+    HOST_CHECK(ir_text_error::NONE == lines[2].error && 2 == lines[2].pulses.size() && 5 == lines[2].line);
+  }
+
+  std::string saturated;
+  for (int i = 0; i < 32; i++)
+    saturated += "65535 ";
+  saturated += "\n";
+
+  struct
+  {
+    std::string   text;
+    ir_text_error error;
+  } const sc_cases[] = {
+    { "0100 006D 0001 0000 0010 0010\n",      ir_text_error::PRONTO     },
+    { "0000 006D 0002 0000 0010 0010\n",      ir_text_error::PRONTO     },
+    { "0000 006D 0001 0000 0010 0010 0010\n", ir_text_error::PRONTO     },
+    { "0000 0010 0001 0000 0010 0010\n",      ir_text_error::CARRIER    },
+    { "0000 006D 0000 0000\n",                ir_text_error::LENGTH     },
+    { "0000 006D 0001 0000 12345 0010\n",     ir_text_error::NUMBER     },
+    { "+9000 +4500\n",                        ir_text_error::SIGN       },
+    { "9000 0 560 560\n",                     ir_text_error::DURATION   },
+    { "70000 100\n",                          ir_text_error::DURATION   },
+    { "9000 4500 @38000\n",                   ir_text_error::FORMAT     },
+    { "@20000 9000\n",                        ir_text_error::CARRIER    },
+    { "9000 x\n",                             ir_text_error::FORMAT     },
+    { "9000 45a0\n",                          ir_text_error::FORMAT     },
+    { "1234567890\n",                         ir_text_error::NUMBER     },
+    { "0: 9000\n",                            ir_text_error::NUMBER     },
+    { "5:\n",                                 ir_text_error::LENGTH     },
+    { saturated,                              ir_text_error::FRAME_TIME },
+  };
+  for (const auto& item : sc_cases)
+  {
+    lines = sl_parse(item.text, false);
+    HOST_CHECK(1 == lines.size() && item.error == lines[0].error && lines[0].pulses.empty());
+  }
+
+  /* 超出缓存区容量 */
+  std::string large;
+  for (uint16_t i = 0; i <= sc_capacity; i++)
+    large += "500 500 ";
+  lines = sl_parse(large + "\n", false);
+  HOST_CHECK(1 == lines.size() && ir_text_error::LENGTH == lines[0].error);
+}
+
+/**
+ * @brief (静态) 随机生成的 Pronto/原始时长文本: 与独立换算结果一致, 且与分片方式无关
+ */
+static void sl_check_round_trip()
+{
+  for (int round = 0; round < 2000; round++)
+  {
+    std::string            text;
+    std::vector<sl_line_t> expect;
+    int                    count  = 1 + s_random() % 8;
+    uint32_t               number = 1;
+    for (int k = 0; k < count; k++)
+    {
+      if (0 == s_random() % 4)
+      {
+        text += (s_random() % 2) ? "# comment 0000 zz\n" : "\r\n";
+        number++;
+      }
+
+      sl_line_t line = {};
+      line.line      = number++;
+      line.error     = ir_text_error::NONE;
+      if (0 == s_random() % 3)
+      {
+        line.id  = static_cast<uint16_t>(1 + s_random() % 2048);
+        text    += std::to_string(line.id) + ":" + ((s_random() % 2) ? " " : "");
+      }
+
+      if (s_random() % 2)
+      {
+        /* Pronto: 载波字 0x46~0x85 (约31k~60kHz), 独立按浮点换算 */
+        uint16_t word   = static_cast<uint16_t>(0x46 + s_random() % 0x40);
+        double   period = word * (IR_Text::PRONTO_UNIT / 1e6);
+        int      pairs  = 1 + s_random() % 100;
+        int      once   = s_random() % (pairs + 1);
+        char     buffer[32];
+        line.frequency = static_cast<uint32_t>(std::lround(1e6 / period));
+        std::snprintf(buffer, sizeof(buffer), "0000 %04X %04X %04X", word, once, pairs - once);
+        text += buffer;
+        for (int p = 0; p < pairs; p++)
+        {
+          uint16_t mark  = static_cast<uint16_t>(1 + s_random() % 150);
+          uint16_t space = static_cast<uint16_t>((p == pairs - 1 && s_random() % 2) ? 0x0E94 : 1 + s_random() % 400);
+          std::snprintf(buffer, sizeof(buffer), (s_random() % 2) ? " %04x %04x" : " %04X %04X", mark, space);
+          text += buffer;
+          line.pulses.push_back({ static_cast<uint16_t>(std::lround(mark * period)), static_cast<uint16_t>(std::min<long>(std::lround(space * period), 65535)) });
+        }
+      }
+      else
+      {
+        /* 原始时长: 可选载波, 符号, 花括号与逗号 */
+        bool sign  = s_random() % 2;
+        bool brace = 0 == s_random() % 3;
+        int  pairs = 1 + s_random() % 150;
+        if (s_random() % 2)
+        {
+          line.frequency  = 30 + s_random() % 31;
+          text           += "@" + std::to_string(line.frequency) + " ";
+          line.frequency *= 1000;
+        }
+        if (brace)
+          text += "{";
+        for (int p = 0; p < pairs; p++)
+        {
+          uint16_t mark  = static_cast<uint16_t>(1 + s_random() % 5000);
+          uint16_t space = static_cast<uint16_t>(1 + s_random() % 5000);
+          text          += (sign ? "+" : "") + std::to_string(mark) + (brace ? ", " : " ");
+          if (p == pairs - 1 && s_random() % 2)
+          {
+            line.pulses.push_back({ mark, 0 });
+            break;
+          }
+          text += (sign ? "-" : "") + std::to_string(space) + (brace ? ", " : "\t");
+          line.pulses.push_back({ mark, space });
+        }
+        if (brace)
+          text += "}";
+      }
+
+      if (0 == s_random() % 3)
+        text += " # trailing";
+      if (k != count - 1 || s_random() % 2)
+        text += (s_random() % 2) ? "\r\n" : "\n";
+      expect.push_back(line);
+    }
+
+    auto whole = sl_parse(text, false);
+    HOST_CHECK(sl_same(whole, sl_parse(text, true)));
+    HOST_CHECK(sl_same(whole, expect));
+  }
+}
+
+/**
+ * @brief (静态) 模糊测试: 随机字节与变异的有效文本, 分片结果一致, 接受的行满足全部约束
+ */
+static void sl_check_fuzz()
+{
+  static const char sc_alphabet[] = "0123456789abcdefABCDEF +-@:#,{}\r\n\tx";
+  uint32_t          accepted      = 0;
+
+  for (int round = 0; round < 200000; round++)
+  {
+    std::string text;
+    if (s_random() % 2)
+    {
+      text = (s_random() % 2) ? "0000 006D 0003 0001 0157 00AC 0015 0016 0015 0041 0157 0056\n" : "@38 +9000 -4500 +560 -1690 +560 -560\n";
+      for (int m = 0; m < 1 + static_cast<int>(s_random() % 4); m++)
+      {
+        size_t at = s_random() % (text.size() + 1);
+        switch (s_random() % 3)
+        {
+          case 0 :
+            text.insert(at, 1, sc_alphabet[s_random() % (sizeof(sc_alphabet) - 1)]);
+            break;
+          case 1 :
+            if (at < text.size())
+              text.erase(at, 1);
+            break;
+          default :
+            if (at < text.size())
+              text[at] = static_cast<char>(s_random());
+            break;
+        }
+      }
+    }
+    else
+    {
+      int length = s_random() % 400;
+      for (int i = 0; i < length; i++)
+        text += (s_random() % 8) ? sc_alphabet[s_random() % (sizeof(sc_alphabet) - 1)] : static_cast<char>(s_random());
+    }
+
+    auto lines = sl_parse(text, false);
+    HOST_CHECK(sl_same(lines, sl_parse(text, true)));
+    HOST_CHECK(lines.size() <= static_cast<size_t>(std::count(text.begin(), text.end(), '\n')) + 1);
+    for (const sl_line_t& line : lines)
+    {
+      if (ir_text_error::NONE != line.error)
+      {
+        HOST_CHECK(line.pulses.empty());
+        continue;
+      }
+
+      uint64_t total = 0;
+      accepted++;
+      HOST_CHECK(!line.pulses.empty() && line.pulses.size() <= sc_capacity);
+      HOST_CHECK(0 == line.frequency || (line.frequency >= IR_Text::MIN_FREQUENCY && line.frequency <= IR_Text::MAX_FREQUENCY));
+      for (size_t j = 0; j < line.pulses.size(); j++)
+      {
+        HOST_CHECK(0 != line.pulses[j].mark && (0 != line.pulses[j].space || j + 1 == line.pulses.size()));
+        total += line.pulses[j].mark + line.pulses[j].space;
+      }
+      HOST_CHECK(total <= IR_Text::MAX_FRAME_TIME);
+    }
+  }
+  HOST_CHECK(accepted > 1000);
+}
+
+/**
+ * @brief (静态) 基准测试: Pronto 与原始时长混合文本的解析吞吐量
+ */
+static void sl_bench()
+{
+  std::string corpus;
+  while (corpus.size() < (2u << 20))
+  {
+    corpus += "0000 006D 0022 0002 0157 00AC";
+    for (int i = 0; i < 33; i++)
+      corpus += (i & 1) ? " 0015 0041" : " 0015 0016";
+    corpus += " 0015 0689 0157 0056 0015 0E94\n";
+    corpus += "+9000 -4500";
+    for (int i = 0; i < 32; i++)
+      corpus += (i & 1) ? " +560 -1690" : " +560 -560";
+    corpus += " +560\n";
+  }
+
+  IR_Text  parser;
+  uint32_t codes = 0;
+  parser.reset(s_buffer, sc_capacity);
+  double ns = host_bench(4, [&](uint32_t) {
+    const char* data = corpus.data();
+    uint32_t    left = static_cast<uint32_t>(corpus.size());
+    while (0 != left)
+    {
+      uint32_t used  = parser.feed(data, left);
+      data          += used;
+      left          -= used;
+      if (parser.ready())
+      {
+        codes++;
+        host_keep(parser.size());
+        parser.next();
+      }
+    }
+  });
+
+  double seconds = ns * 4 / 1e9;
+  HOST_CHECK(0 != codes);
+  std::printf("text parse: %.1f ns/char, %.1f MB/s, %.2f M codes/s\n", ns / corpus.size(), corpus.size() * 4 / seconds / 1e6, codes / seconds / 1e6);
+}
+
+int main()
+{
+  sl_check_examples();
+  sl_check_round_trip();
+  sl_check_fuzz();
+  sl_bench();
+  return host_test_result("ir_text_test");
+}
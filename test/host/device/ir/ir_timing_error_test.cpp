@@ -0,0 +1,147 @@
+/**
+ * @file      ir_timing_error_test.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library host test for IR carrier timing error (红外遥控 各品牌最坏累计时序误差测试)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "host_test.hpp"
+#include "ir_protocol.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace OwO::device;
+
+/// @brief 测试时钟(Hz): 高级定时器(硬件载波), CPU主频(软件载波)
+static constexpr uint32_t sc_clocks[]       = { 36000000, 180000000 };
+/// @brief 原实现的脉冲宽度(us): 各时长整除后截断
+static constexpr uint32_t sc_legacy_width   = 32;
+
+/**
+ * @brief (静态) 门控步骤各边沿的累计载波周期数 (相邻同类步骤为同一阶段)
+ */
+static std::vector<uint32_t> sl_step_edges(const ir_pulse_t* pulses, uint16_t size, uint32_t frequency)
+{
+  std::vector<uint32_t> edges;
+  IR_Gate_Sequencer     sequencer;
+  ir_gate_step_t        step;
+  uint32_t              cycles = 0;
+  bool                  mark   = true;
+
+  sequencer.reset(pulses, size, frequency);
+  while (sequencer.next(step))
+  {
+    HOST_CHECK(0 != step.cycles && step.cycles <= IR_Gate_Sequencer::MAX_STEP_CYCLES);
+    if (step.mark != mark)
+      edges.push_back(cycles);
+    mark    = step.mark;
+    cycles += step.cycles;
+  }
+  edges.push_back(cycles);
+  return edges;
+}
+
+/**
+ * @brief (静态) 脉冲序列各边沿的理想累计时长(us) (末尾空闲为0时不计)
+ */
+static std::vector<uint32_t> sl_ideal_edges(const ir_pulse_t* pulses, uint16_t size)
+{
+  std::vector<uint32_t> edges;
+  uint32_t              elapsed = 0;
+  for (uint16_t i = 0; i < size; i++)
+  {
+    elapsed += pulses[i].mark;
+    edges.push_back(elapsed);
+    if (0 == pulses[i].space)
+      continue;
+    elapsed += pulses[i].space;
+    edges.push_back(elapsed);
+  }
+  return edges;
+}
+
+int main()
+{
+  std::srand(11);
+
+  for (int type = static_cast<int>(ir_type::AUX); type <= static_cast<int>(ir_type::HISENSE); type++)
+  {
+    const ir_protocol_t* protocol = IR_Protocol::get(static_cast<ir_type>(type));
+    HOST_CHECK(protocol->frequency >= 30000 && protocol->frequency <= 60000);
+
+    /* 取该品牌最长的指令 */
+    uint8_t length = 0;
+    for (uint8_t i = 1; i <= 32; i++)
+      if (nullptr != IR_Protocol::find(*protocol, i))
+        length = i;
+    HOST_CHECK(0 != length);
+
+    uint8_t data[32];
+    for (uint8_t& byte : data)
+      byte = static_cast<uint8_t>(std::rand());
+
+    static ir_pulse_t buffer[IR_Timeline::MAX_PULSES];
+    IR_Timeline       timeline;
+    timeline.attach(buffer, IR_Timeline::MAX_PULSES);
+    HOST_CHECK(IR_Protocol::encode(*protocol, data, length, timeline));
+
+    const std::vector<uint32_t> ideal       = sl_ideal_edges(timeline.data(), timeline.size());
+    double                      worst       = 0;
+    double                      worst_round = 0;
+    for (uint32_t clock : sc_clocks)
+    {
+      for (uint32_t carrier = 30000; carrier <= 60000; carrier += 500)
+      {
+        /* 实际载波频率与换算用的整数频率 (与 IR_Carrier::configure 一致) */
+        uint32_t period    = (clock + carrier / 2) / carrier;
+        double   actual    = static_cast<double>(clock) / period;
+        uint32_t frequency = (clock + period / 2) / period;
+
+        const std::vector<uint32_t> edges = sl_step_edges(timeline.data(), timeline.size(), frequency);
+        HOST_CHECK(edges.size() == ideal.size());
+
+        /* 误差扩散: 任意边沿不超过半个载波周期 + 整数频率量化误差 */
+        double   error_round = 0;
+        uint32_t rounded     = 0;
+        for (size_t i = 0; i < edges.size() && i < ideal.size(); i++)
+        {
+          double error = std::fabs(edges[i] * 1e6 / actual - ideal[i]);
+          HOST_CHECK(error <= 0.5e6 / actual + std::fabs(frequency - actual) / actual * ideal[i] + 0.01);
+          if (error > worst)
+            worst = error;
+
+          /* 对照: 各阶段单独四舍五入 */
+          rounded += IR_Gate_Sequencer::to_cycles(ideal[i] - (i ? ideal[i - 1] : 0), frequency);
+          error    = std::fabs(rounded * 1e6 / actual - ideal[i]);
+          if (error > error_round)
+            error_round = error;
+        }
+        if (error_round > worst_round)
+          worst_round = error_round;
+      }
+    }
+
+    /* 对照: 原实现按脉冲宽度截断 */
+    double   worst_legacy = 0;
+    uint32_t output       = 0;
+    for (size_t i = 0; i < ideal.size(); i++)
+    {
+      uint32_t time  = ideal[i] - (i ? ideal[i - 1] : 0);
+      output        += time / sc_legacy_width * sc_legacy_width;
+      if (ideal[i] - output > worst_legacy)
+        worst_legacy = ideal[i] - output;
+    }
+
+    HOST_CHECK(worst <= worst_round && worst < worst_legacy);
+    std::printf("type %d: %3u pulses %6uus  worst edge error: diffused %5.1fus  per-phase round %6.1fus  legacy truncate %7.1fus\n",
+                type, timeline.size(), timeline.duration(), worst, worst_round, worst_legacy);
+  }
+
+  return host_test_result("ir_timing_error_test");
+}
@@ -0,0 +1,132 @@
+/**
+ * @file      ir_timing_test.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library host test for IR transmit timing statistics (红外遥控 发送时序统计汇总测试)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "host_test.hpp"
+#include "ir_timing.hpp"
+
+#include <cstring>
+#include <random>
+
+using namespace OwO::device;
+
+/// @brief 测试CPU主频(Hz) (72个周期为1000ns)
+static constexpr uint32_t sc_clock = 72000000;
+
+/**
+ * @brief (静态) 各边沿准时: 偏差为0
+ */
+static void sl_check_exact(IR_Timing& timing)
+{
+  timing.begin(sc_clock, 1000);
+  timing.rise(1000, 1000, false);
+  timing.fall(1631, 1631);
+  timing.rise(2895, 2895, true);
+  timing.fall(3526, 3526);
+  timing.end(4790, 4790);
+
+  const ir_timing_frame_t& frame = timing.last();
+  HOST_CHECK(4 == frame.edges && 0 == frame.max_deviation && 0 == frame.mean_deviation && 0 == frame.period_error);
+  HOST_CHECK((4790 - 1000) / 72 == frame.duration && 4 == timing.histogram()[0] && 1 == timing.frames());
+}
+
+/**
+ * @brief (静态) 已知偏差: 最大/平均偏差, 载波周期误差, 与上一帧累计的直方图与寄存器
+ */
+static void sl_check_known(IR_Timing& timing)
+{
+  timing.begin(sc_clock, 0);
+  timing.rise(0, 9, false);             /* 125ns -> 区间1 */
+  timing.fall(100, 172);                /* 1000ns -> 区间4 */
+  timing.rise(1000, 1018, true);        /* 250ns -> 区间2, 周期误差 +9个周期 */
+  timing.fall(1100, 1100);              /* 0 -> 区间0 */
+  timing.rise(2000, 2000, true);        /* 周期误差 -18个周期 */
+  timing.fall(2100, 2100 + 72 * 20);    /* 20us -> 区间7 */
+  timing.end(3000, 3000 + 5);
+
+  const ir_timing_frame_t& frame = timing.last();
+  HOST_CHECK(6 == frame.edges);
+  HOST_CHECK(20000 == frame.max_deviation);
+  HOST_CHECK(static_cast<uint32_t>((9 + 72 + 18 + 0 + 0 + 1440) / 6 * 1000000000ULL / sc_clock) == frame.mean_deviation);
+  HOST_CHECK(-static_cast<int32_t>(4 * 1000000000ULL / sc_clock) == frame.period_error);
+
+  /* 两帧累计 */
+  const uint32_t expect[IR_Timing::BUCKET_COUNT] = { 4 + 2, 1, 1, 0, 1, 0, 0, 1 };
+  for (uint8_t i = 0; i < IR_Timing::BUCKET_COUNT; i++)
+    HOST_CHECK(expect[i] == timing.histogram()[i]);
+
+  uint16_t regs[IR_Timing::REGISTER_COUNT];
+  timing.registers(regs);
+  HOST_CHECK(2 == regs[0] && 20000 == regs[1] && 20000 == regs[2] && -55 == static_cast<int16_t>(regs[4]));
+  uint32_t duration = 0;
+  std::memcpy(&duration, &regs[5], sizeof(duration));
+  HOST_CHECK(frame.duration == duration);
+  for (uint8_t i = 0; i < IR_Timing::BUCKET_COUNT; i++)
+    HOST_CHECK(expect[i] == regs[7 + i]);
+
+  timing.clear();
+  timing.registers(regs);
+  HOST_CHECK(0 == regs[0] && 0 == regs[7]);
+}
+
+/**
+ * @brief (静态) 模拟软件载波: 虚拟周期计数器(含回绕)上的写入延迟抖动
+ */
+static void sl_check_simulated()
+{
+  std::mt19937 random(1);
+  uint32_t     period = (sc_clock + 19000) / 38000;
+  uint32_t     high   = static_cast<uint32_t>(period * 33 / 100.0f + 0.5f);
+  uint32_t     now    = 0xFFFFF000;
+  auto         wait   = [&](uint32_t deadline) {
+    if (static_cast<int32_t>(now - deadline) < 0)
+      now = deadline;
+    now += random() % 20;
+  };
+
+  IR_Timing timing;
+  uint32_t  edge     = now;
+  uint32_t  intended = 0;
+  timing.begin(sc_clock, edge);
+  for (int step = 0; step < 67; step++)
+  {
+    uint16_t cycles  = (0 == step % 2 || 0 != step % 3) ? 21 : 64;
+    intended        += cycles;
+    if (0 != step % 2)
+    {
+      edge += cycles * period;
+      wait(edge);
+      continue;
+    }
+    for (uint16_t i = 0; i < cycles; i++)
+    {
+      now += random() % 20;
+      timing.rise(edge, now, 0 != i);
+      wait(edge + high);
+      timing.fall(edge + high, now);
+      edge += period;
+      wait(edge);
+    }
+  }
+  timing.end(edge, now);
+
+  const ir_timing_frame_t& frame = timing.last();
+  HOST_CHECK(frame.max_deviation < 40 * 1000000000ULL / sc_clock + 1);
+  HOST_CHECK(static_cast<uint32_t>(static_cast<uint64_t>(intended) * period * 1000000 / sc_clock) == frame.expected);
+  HOST_CHECK(frame.duration - frame.expected <= 1);
+}
+
+int main()
+{
+  IR_Timing timing;
+  sl_check_exact(timing);
+  sl_check_known(timing);
+  sl_check_simulated();
+  return host_test_result("ir_timing_test");
+}
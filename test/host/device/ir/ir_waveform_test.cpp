@@ -0,0 +1,157 @@
+/**
+ * @file      ir_waveform_test.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library host test and benchmark for IR GPIO waveform (红外遥控 GPIO 波形事件合并测试与基准)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "host_test.hpp"
+#include "ir_protocol.hpp"
+#include "ir_waveform.hpp"
+
+#include <cstdlib>
+#include <vector>
+
+using namespace OwO::device;
+
+/// @brief 定时器时钟(Hz)
+static constexpr uint32_t sc_clock     = 36000000;
+/// @brief 载波频率(Hz)
+static constexpr uint32_t sc_frequency = 38000;
+/// @brief 载波占空比(%)
+static constexpr float    sc_duty      = 33.3f;
+
+/// @brief 结构体 一个载波周期的高电平区间(定时器计数)
+struct pulse_span_t
+{
+  uint64_t rise;
+  uint64_t fall;
+
+  bool operator==(const pulse_span_t& other) const
+  {
+    return rise == other.rise && fall == other.fall;
+  }
+};
+
+int main()
+{
+  /* 通道引脚: 通道1~4 为端口槽0 PA11~PA8, 通道5~8 为端口槽1 PC9~PC6 */
+  ir_wave_pin_t pins[IR_Waveform::CHANNEL_COUNT];
+  for (uint8_t c = 0; c < IR_Waveform::CHANNEL_COUNT; c++)
+  {
+    pins[c].slot = c / 4;
+    pins[c].mask = static_cast<uint16_t>(1U << ((c < 4) ? 11 - c : 9 - (c - 4)));
+  }
+
+  static const ir_type sc_types[]   = { ir_type::AUX, ir_type::TCL, ir_type::GREE, ir_type::OUTES, ir_type::MIDEA, ir_type::XIAOMI, ir_type::HISENSE };
+  static const uint8_t sc_lengths[] = { 13, 28, 30, 15, 24, 19, 23 };
+  static ir_pulse_t    buffers[IR_Waveform::CHANNEL_COUNT][IR_Timeline::MAX_PULSES];
+
+  std::srand(1);
+  uint64_t total_events = 0;
+  uint64_t total_edges  = 0;
+  double   total_ns     = 0;
+  uint32_t frames       = 0;
+
+  for (int round = 0; round < 300; round++)
+  {
+    IR_Timeline       timelines[IR_Waveform::CHANNEL_COUNT];
+    const ir_pulse_t* pulses[IR_Waveform::CHANNEL_COUNT] = {};
+    uint16_t          sizes[IR_Waveform::CHANNEL_COUNT]  = {};
+    for (uint8_t c = 0; c < IR_Waveform::CHANNEL_COUNT; c++)
+    {
+      if (0 == std::rand() % 5)
+        continue;
+
+      int     brand = std::rand() % 7;
+      uint8_t data[32];
+      for (uint8_t& byte : data)
+        byte = static_cast<uint8_t>(std::rand());
+      timelines[c].attach(buffers[c], IR_Timeline::MAX_PULSES);
+      HOST_CHECK(IR_Protocol::encode(*IR_Protocol::get(sc_types[brand]), data, sc_lengths[brand], timelines[c]));
+      pulses[c] = timelines[c].data();
+      sizes[c]  = timelines[c].size();
+    }
+
+    IR_Waveform waveform;
+    HOST_CHECK(waveform.reset(pulses, sizes, pins, sc_clock, sc_frequency, sc_duty));
+    uint32_t period = waveform.period();
+    uint32_t high   = static_cast<uint32_t>(period * sc_duty / 100 + 0.5f);
+
+    std::vector<ir_wave_event_t> events;
+    ir_wave_event_t              event;
+    total_ns += host_bench(1, [&](uint32_t) {
+      while (waveform.next(event))
+        events.push_back(event);
+    });
+    frames++;
+    total_events += events.size();
+    HOST_CHECK(waveform.is_finished());
+
+    /* 预先计算的事件数量与实际一致 (DMA 缓存区按此分配) */
+    HOST_CHECK(events.size() == IR_Waveform::count(pulses, sizes, pins, sc_clock, sc_frequency, sc_duty));
+
+    /* 按 BSRR 写入模拟引脚电平: 事件时长在定时器范围内, 同一引脚不同时置位复位, 不重复置位或复位 */
+    std::vector<pulse_span_t> output[IR_Waveform::CHANNEL_COUNT];
+    uint64_t                  now = 0;
+    uint64_t                  rise[IR_Waveform::CHANNEL_COUNT] = {};
+    bool                      level[IR_Waveform::CHANNEL_COUNT] = {};
+    for (const ir_wave_event_t& item : events)
+    {
+      HOST_CHECK(item.ticks >= IR_Waveform::MIN_TICKS && item.ticks <= IR_Waveform::MAX_TICKS);
+      for (uint8_t c = 0; c < IR_Waveform::CHANNEL_COUNT; c++)
+      {
+        uint32_t bsrr  = item.bsrr[pins[c].slot];
+        bool     set   = bsrr & pins[c].mask;
+        bool     reset = bsrr & (static_cast<uint32_t>(pins[c].mask) << 16);
+        HOST_CHECK(!(set && reset));
+        if (set)
+        {
+          HOST_CHECK(!level[c]);
+          level[c] = true;
+          rise[c]  = now;
+        }
+        if (reset)
+        {
+          HOST_CHECK(level[c]);
+          level[c] = false;
+          output[c].push_back({ rise[c], now });
+        }
+      }
+      now += item.ticks;
+    }
+
+    /* 各通道输出与门控序列器参考一致: 每个标记载波周期一个高电平区间 */
+    for (uint8_t c = 0; c < IR_Waveform::CHANNEL_COUNT; c++)
+    {
+      HOST_CHECK(!level[c]);
+
+      std::vector<pulse_span_t> expect;
+      IR_Gate_Sequencer         sequencer;
+      ir_gate_step_t            step;
+      uint64_t                  cycle = 0;
+      sequencer.reset(pulses[c], sizes[c], (sc_clock + period / 2) / period);
+      while (sequencer.next(step))
+      {
+        if (step.mark)
+        {
+          for (uint32_t i = 0; i < step.cycles; i++)
+            expect.push_back({ (cycle + i) * period, (cycle + i) * period + high });
+        }
+        cycle += step.cycles;
+      }
+
+      total_edges += expect.size() * 2;
+      HOST_CHECK(expect == output[c]);
+    }
+  }
+
+  /* 重合边沿合并: 事件数量少于各通道边沿之和 */
+  HOST_CHECK(total_events < total_edges);
+  std::printf("frames=%u events/frame=%.0f edges/frame=%.0f coalesce=%.2fx  %.1f us/frame %.1f ns/event\n", frames, static_cast<double>(total_events) / frames, static_cast<double>(total_edges) / frames,
+              static_cast<double>(total_edges) / total_events, total_ns / frames / 1000, total_ns / total_events);
+  return host_test_result("ir_waveform_test");
+}
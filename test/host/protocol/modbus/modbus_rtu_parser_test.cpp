@@ -0,0 +1,250 @@
+/**
+ * @file      modbus_rtu_parser_test.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library host test for incremental Modbus frame parsing (Modbus 增量帧解析 模糊测试与基准测试)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "host_test.hpp"
+#include "modbus_codec.hpp"
+#include "modbus_framer.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace OwO::protocol::modbus;
+
+static std::mt19937 s_random(99);
+
+/**
+ * @brief (静态) 随机 RTU 请求 (含多写类与未知功能码, 末尾 CRC)
+ */
+static std::vector<uint8_t> sl_make_request()
+{
+  static const uint8_t sc_functions[] = { 1, 2, 3, 4, 5, 6, 15, 16, 17, 22, 23, 99 };
+  uint8_t              function       = sc_functions[s_random() % sizeof(sc_functions)];
+  std::vector<uint8_t> frame          = { static_cast<uint8_t>(1 + s_random() % 247), function };
+  auto                 append         = [&](int count) {
+    for (int i = 0; i < count; i++)
+      frame.push_back(static_cast<uint8_t>(s_random()));
+  };
+
+  if (15 == function || 16 == function)
+  {
+    uint8_t bytes = static_cast<uint8_t>(s_random() % 240);
+    append(4);
+    frame.push_back(bytes);
+    append(bytes);
+  }
+  else if (23 == function)
+  {
+    uint8_t bytes = static_cast<uint8_t>(s_random() % 236);
+    append(8);
+    frame.push_back(bytes);
+    append(bytes);
+  }
+  else if (22 == function)
+    append(6);
+  else if (17 != function)
+    append(4);
+
+  uint16_t length = static_cast<uint16_t>(frame.size());
+  frame.resize(length + Modbus_Codec::CRC_SIZE);
+  Modbus_Codec::add_crc(frame.data(), length);
+  return frame;
+}
+
+/**
+ * @brief (静态) 有效请求随机切分, 帧内间隔不超过超时: 每帧完整交付
+ */
+static void sl_check_split()
+{
+  uint32_t frames = 0;
+  for (int round = 0; round < 20000; round++)
+  {
+    std::vector<std::vector<uint8_t>> requests;
+    int                               count = 1 + s_random() % 8;
+    for (int i = 0; i < count; i++)
+      requests.push_back(sl_make_request());
+
+    Modbus_Rtu_Parser parser(10);
+    uint32_t          now = 1000;
+    size_t            got = 0;
+    for (const std::vector<uint8_t>& frame : requests)
+    {
+      size_t position = 0;
+      while (position < frame.size())
+      {
+        size_t               length = std::min<size_t>(1 + s_random() % 40, frame.size() - position);
+        std::vector<uint8_t> segment(frame.begin() + position, frame.begin() + position + length);
+        now += s_random() % 10;
+        parser.feed(segment.data(), static_cast<uint32_t>(segment.size()), now, [&](const uint8_t* data, uint16_t size) {
+          HOST_CHECK(got < requests.size() && size == requests[got].size() && 0 == std::memcmp(data, requests[got].data(), size));
+          HOST_CHECK(Modbus_Codec::check_crc(data, size));
+          got++;
+        });
+        position += length;
+      }
+      /* 主机等待应答的间隔 */
+      now += 1 + s_random() % 10;
+    }
+    HOST_CHECK(requests.size() == got && 0 == parser.pending());
+    frames += static_cast<uint32_t>(got);
+  }
+  std::printf("rtu split: %u frames intact\n", frames);
+}
+
+/**
+ * @brief (静态) 部分帧后停滞: RTU 静默后丢弃并接收下一帧; TCP 报告超时由调用方关闭连接; 无后续输入时由 expire 发现
+ */
+static void sl_check_stall()
+{
+  Modbus_Rtu_Parser    parser(10);
+  std::vector<uint8_t> frame = sl_make_request();
+  int                  got   = 0;
+  parser.feed(frame.data(), 3, 0, [&](const uint8_t*, uint16_t) { got++; });
+  parser.feed(frame.data(), static_cast<uint32_t>(frame.size()), 50, [&](const uint8_t* data, uint16_t size) {
+    HOST_CHECK(size == frame.size() && 0 == std::memcmp(data, frame.data(), size));
+    got++;
+  });
+  HOST_CHECK(1 == got && 1 == parser.timeouts());
+
+  Modbus_Tcp_Framer framer(1000);
+  const uint8_t     adu[12] = { 0, 1, 0, 0, 0, 6, 1, 3, 0, 0, 0, 1 };
+  HOST_CHECK(framer.feed(adu, 5, 0, [&](const uint8_t*, uint16_t) { got++; }));
+  HOST_CHECK(!framer.feed(adu + 5, 7, 1500, [&](const uint8_t*, uint16_t) { got++; }) && 1 == framer.timeouts() && 0 == framer.pending());
+  HOST_CHECK(framer.feed(adu, 5, 2000, [&](const uint8_t*, uint16_t) { got++; }));
+  HOST_CHECK(framer.feed(adu + 5, 7, 2999, [&](const uint8_t*, uint16_t size) { got += (12 == size) ? 1 : 100; }));
+  HOST_CHECK(2 == got);
+
+  /* 部分MBAP头后不再有输入: 等待输入超时时由 expire 发现, 不等下一段到达 */
+  HOST_CHECK(framer.feed(adu, 4, 3000, [&](const uint8_t*, uint16_t) { got++; }) && 4 == framer.pending());
+  HOST_CHECK(!framer.expire(4000) && 4 == framer.pending());
+  HOST_CHECK(framer.expire(4001) && 0 == framer.pending() && 2 == framer.timeouts());
+  HOST_CHECK(!framer.expire(9000) && 2 == framer.timeouts());
+
+  parser.feed(frame.data(), 3, 100, [&](const uint8_t*, uint16_t) { got++; });
+  HOST_CHECK(!parser.expire(110) && 3 == parser.pending());
+  HOST_CHECK(parser.expire(111) && 0 == parser.pending() && 2 == parser.timeouts());
+  HOST_CHECK(!parser.expire(500) && 2 == got);
+}
+
+/**
+ * @brief (静态) CRC 错误: 紧随其后的帧被丢弃, 帧间静默后重新同步
+ */
+static void sl_check_resync()
+{
+  Modbus_Rtu_Parser    parser(10);
+  std::vector<uint8_t> bad    = sl_make_request();
+  std::vector<uint8_t> good   = sl_make_request();
+  int                  valid  = 0;
+  auto                 handle = [&](const uint8_t* data, uint16_t size) {
+    if (Modbus_Codec::check_crc(data, size))
+      valid++;
+    else
+      parser.resync();
+  };
+
+  bad[2] ^= 0x55;
+  std::vector<uint8_t> stream(bad);
+  stream.insert(stream.end(), good.begin(), good.end());
+  parser.feed(stream.data(), static_cast<uint32_t>(stream.size()), 0, handle);
+  parser.feed(good.data(), static_cast<uint32_t>(good.size()), 20, handle);
+  HOST_CHECK(1 == valid && parser.errors() >= 1);
+}
+
+/**
+ * @brief (静态) 模糊测试: 随机字节, 随机切分与间隔, 随机超时; 交付的帧长度自洽, 暂存不越界
+ */
+static void sl_check_fuzz()
+{
+  uint32_t rtu_frames = 0;
+  uint32_t tcp_frames = 0;
+  for (int round = 0; round < 20000; round++)
+  {
+    Modbus_Rtu_Parser parser(1 + s_random() % 20);
+    Modbus_Tcp_Framer framer(1 + s_random() % 2000);
+    uint32_t          now      = s_random();
+    int               segments = 1 + s_random() % 30;
+    for (int i = 0; i < segments; i++)
+    {
+      /* 偏向小数值, 更容易构成看似合法的头部 */
+      std::vector<uint8_t> segment(s_random() % 300);
+      for (uint8_t& byte : segment)
+        byte = static_cast<uint8_t>((s_random() % 4) ? s_random() % 8 : s_random());
+      now += s_random() % 30;
+
+      parser.feed(segment.data(), static_cast<uint32_t>(segment.size()), now, [&](const uint8_t* data, uint16_t size) {
+        HOST_CHECK(size >= 4 && size <= Modbus_Rtu_Parser::ADU_SIZE && size == Modbus_Rtu_Parser::request_size(data, size));
+        if (!Modbus_Codec::check_crc(data, size))
+          parser.resync();
+        rtu_frames++;
+      });
+      framer.feed(segment.data(), static_cast<uint32_t>(segment.size()), now, [&](const uint8_t* data, uint16_t size) {
+        HOST_CHECK(size >= 8 && size <= Modbus_Tcp_Framer::ADU_SIZE && size == Modbus_Tcp_Framer::adu_size(data));
+        tcp_frames++;
+      });
+      HOST_CHECK(parser.pending() < Modbus_Rtu_Parser::ADU_SIZE && framer.pending() < Modbus_Tcp_Framer::ADU_SIZE);
+    }
+  }
+  HOST_CHECK(rtu_frames > 0 && tcp_frames > 0);
+  std::printf("fuzz: %u rtu / %u tcp frames\n", rtu_frames, tcp_frames);
+}
+
+/**
+ * @brief (静态) 基准测试: 64帧连续字节流按不同段长输入
+ */
+static void sl_bench(const char* name, const std::vector<uint8_t>& frame, bool rtu)
+{
+  constexpr int        sc_frames = 64;
+  std::vector<uint8_t> stream;
+  for (int i = 0; i < sc_frames; i++)
+    stream.insert(stream.end(), frame.begin(), frame.end());
+
+  for (size_t segment : { static_cast<size_t>(1), static_cast<size_t>(8), frame.size(), stream.size() })
+  {
+    Modbus_Rtu_Parser parser;
+    Modbus_Tcp_Framer framer;
+    uint32_t          bytes = 0;
+    double            ns    = host_bench(20000, [&](uint32_t k) {
+      for (size_t position = 0; position < stream.size(); position += segment)
+      {
+        uint32_t length = static_cast<uint32_t>(std::min(segment, stream.size() - position));
+        if (rtu)
+          parser.feed(stream.data() + position, length, k, [&](const uint8_t*, uint16_t size) { bytes += size; });
+        else
+          framer.feed(stream.data() + position, length, k, [&](const uint8_t*, uint16_t size) { bytes += size; });
+      }
+    });
+    host_keep(bytes);
+    HOST_CHECK(20000u * stream.size() == bytes);
+    std::printf("%-8s segment %4zu B: %6.1f ns/frame (%5.2f ns/byte)\n", name, segment, ns / sc_frames, ns / stream.size());
+  }
+}
+
+int main()
+{
+  sl_check_split();
+  sl_check_stall();
+  sl_check_resync();
+  sl_check_fuzz();
+
+  /* RTU FC3 (8字节) 与 FC16 x10 (29字节); TCP FC3 (12字节) 与 FC16 x10 (33字节) */
+  std::vector<uint8_t> rtu_read  = { 1, 3, 0, 0, 0, 10, 0xC5, 0xCD };
+  std::vector<uint8_t> rtu_write = { 1, 16, 0, 0, 0, 10, 20 };
+  std::vector<uint8_t> tcp_read  = { 0, 1, 0, 0, 0, 6, 1, 3, 0, 0, 0, 10 };
+  std::vector<uint8_t> tcp_write = { 0, 1, 0, 0, 0, 27, 1, 16, 0, 0, 0, 10, 20 };
+  rtu_write.resize(29);
+  tcp_write.resize(33);
+  sl_bench("rtu fc3", rtu_read, true);
+  sl_bench("rtu fc16", rtu_write, true);
+  sl_bench("tcp fc3", tcp_read, false);
+  sl_bench("tcp fc16", tcp_write, false);
+  return host_test_result("modbus_rtu_parser_test");
+}
@@ -0,0 +1,165 @@
+/**
+ * @file      modbus_tcp_framer_test.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library host test for Modbus TCP framing (Modbus TCP 分帧 随机切分/拼接字节流测试)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "host_test.hpp"
+#include "modbus_framer.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace OwO::protocol::modbus;
+
+static std::mt19937 s_random(1234);
+
+/**
+ * @brief (静态) 随机ADU (长度字段 2~254, ADU 8~260 字节)
+ */
+static std::vector<uint8_t> sl_make_adu(uint16_t transaction)
+{
+  uint16_t             length = static_cast<uint16_t>(2 + s_random() % 253);
+  std::vector<uint8_t> adu(6 + length);
+  adu[0] = static_cast<uint8_t>(transaction >> 8);
+  adu[1] = static_cast<uint8_t>(transaction);
+  adu[2] = 0;
+  adu[3] = 0;
+  adu[4] = static_cast<uint8_t>(length >> 8);
+  adu[5] = static_cast<uint8_t>(length);
+  for (size_t i = 6; i < adu.size(); i++)
+    adu[i] = static_cast<uint8_t>(s_random());
+  return adu;
+}
+
+/**
+ * @brief (静态) 多个ADU拼接后按随机长度切分输入: 按序完整回调, 段内ADU原地回调, 无残留
+ */
+static void sl_check_random_split()
+{
+  uint32_t total   = 0;
+  uint32_t inplace = 0;
+  uint32_t staged  = 0;
+
+  for (int round = 0; round < 20000; round++)
+  {
+    std::vector<std::vector<uint8_t>> adus;
+    std::vector<uint8_t>              stream;
+    int                               count = 1 + s_random() % 12;
+    for (int i = 0; i < count; i++)
+    {
+      adus.push_back(sl_make_adu(static_cast<uint16_t>(round * 16 + i)));
+      stream.insert(stream.end(), adus.back().begin(), adus.back().end());
+    }
+
+    /* 切分粒度: 小段 / 约一个ADU / 多个ADU */
+    Modbus_Tcp_Framer framer;
+    size_t            got      = 0;
+    size_t            position = 0;
+    int               mode     = s_random() % 3;
+    uint32_t          limit    = (0 == mode) ? 8 : (1 == mode) ? 600 : 3000;
+    while (position < stream.size())
+    {
+      size_t length = std::min<size_t>(1 + s_random() % limit, stream.size() - position);
+
+      /* 逐段复制, 越界读取可由 AddressSanitizer 检出 */
+      std::vector<uint8_t> segment(stream.begin() + position, stream.begin() + position + length);
+      bool                 ret = framer.feed(segment.data(), static_cast<uint32_t>(segment.size()), 0, [&](const uint8_t* adu, uint16_t size) {
+        HOST_CHECK(got < adus.size());
+        if (got >= adus.size())
+          return;
+        HOST_CHECK(size == adus[got].size() && 0 == std::memcmp(adu, adus[got].data(), size));
+        if (adu >= segment.data() && adu < segment.data() + segment.size())
+          inplace++;
+        else
+          staged++;
+        got++;
+      });
+      HOST_CHECK(ret);
+      position += length;
+    }
+
+    HOST_CHECK(adus.size() == got && 0 == framer.pending());
+    HOST_CHECK(adus.size() == framer.frames() && 0 == framer.errors());
+    total += static_cast<uint32_t>(got);
+  }
+  HOST_CHECK(inplace > 0 && staged > 0);
+  std::printf("random split: %u frames (%u in place, %u staged)\n", total, inplace, staged);
+}
+
+/**
+ * @brief (静态) 长度字段非法: 丢弃并在下一段重新开始
+ */
+static void sl_check_illegal_length()
+{
+  Modbus_Tcp_Framer framer;
+  int               calls = 0;
+  auto              count = [&](const uint8_t*, uint16_t) { calls++; };
+
+  const uint8_t large[9] = { 0, 1, 0, 0, 0x01, 0x00, 1, 3, 0 };
+  HOST_CHECK(!framer.feed(large, sizeof(large), 0, count) && 0 == framer.pending() && 1 == framer.errors());
+
+  /* MBAP头跨段, 收齐后长度字段为1 */
+  const uint8_t partial[3] = { 0, 1, 0 };
+  const uint8_t small[4]   = { 0, 0x00, 0x01, 1 };
+  HOST_CHECK(framer.feed(partial, sizeof(partial), 0, count) && 3 == framer.pending());
+  HOST_CHECK(!framer.feed(small, sizeof(small), 0, count) && 0 == framer.pending() && 2 == framer.errors());
+
+  const uint8_t good[12] = { 0, 2, 0, 0, 0, 6, 1, 3, 0, 0, 0, 1 };
+  HOST_CHECK(framer.feed(good, sizeof(good), 0, [&](const uint8_t*, uint16_t size) { calls += (12 == size) ? 1 : 100; }));
+  HOST_CHECK(1 == calls);
+}
+
+/**
+ * @brief (静态) 部分帧超过字节间隔超时未续接: 视为对端停滞
+ */
+static void sl_check_timeout()
+{
+  Modbus_Tcp_Framer framer;
+  int               calls    = 0;
+  auto              count    = [&](const uint8_t*, uint16_t) { calls++; };
+  const uint8_t     good[12] = { 0, 2, 0, 0, 0, 6, 1, 3, 0, 0, 0, 1 };
+
+  HOST_CHECK(framer.feed(good, 5, 1000, count));
+  HOST_CHECK(framer.feed(good + 5, 3, 1000 + Modbus_Tcp_Framer::TIMEOUT, count) && 8 == framer.pending());
+  HOST_CHECK(!framer.feed(good + 8, 4, 1001 + 2 * Modbus_Tcp_Framer::TIMEOUT, count) && 1 == framer.timeouts() && 0 == framer.pending());
+
+  /* 无部分帧时的长间隔不算超时 */
+  HOST_CHECK(framer.feed(good, sizeof(good), 0xFFFFFF00u, count) && 1 == calls && 1 == framer.timeouts());
+}
+
+/**
+ * @brief (静态) 同一段内100个流水线请求: 按事务号顺序回调
+ */
+static void sl_check_pipelined()
+{
+  Modbus_Tcp_Framer    framer;
+  std::vector<uint8_t> stream;
+  uint16_t             next = 0;
+  for (uint16_t i = 0; i < 100; i++)
+  {
+    const uint8_t request[12] = { static_cast<uint8_t>(i >> 8), static_cast<uint8_t>(i), 0, 0, 0, 6, 1, 3, 0, 0, 0, 1 };
+    stream.insert(stream.end(), request, request + sizeof(request));
+  }
+  HOST_CHECK(framer.feed(stream.data(), static_cast<uint32_t>(stream.size()), 0, [&](const uint8_t* adu, uint16_t) {
+    HOST_CHECK(next == ((adu[0] << 8) | adu[1]));
+    next++;
+  }));
+  HOST_CHECK(100 == next);
+}
+
+int main()
+{
+  sl_check_random_split();
+  sl_check_illegal_length();
+  sl_check_timeout();
+  sl_check_pipelined();
+  return host_test_result("modbus_tcp_framer_test");
+}
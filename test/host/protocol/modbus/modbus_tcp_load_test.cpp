@@ -0,0 +1,274 @@
+/**
+ * @file      modbus_tcp_load_test.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library host test for concurrent Modbus TCP serving (Modbus TCP 工作线程池 多客户端负载测试)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "host_test.hpp"
+#include "modbus_codec.hpp"
+#include "modbus_framer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace OwO::protocol::modbus;
+
+using sl_clock = std::chrono::steady_clock;
+
+/// @brief 模拟客户端数量 (客户端0为停滞的对端: 不读取应答, 每次发送阻塞至窗口打开)
+static constexpr int      sc_clients    = 4;
+/// @brief 工作线程数量 (与 Modbus_Tcp_Server::WORKER_COUNT 一致)
+static constexpr int      sc_workers    = 3;
+/// @brief 合并应答缓存区大小 (TCP MSS)
+static constexpr uint16_t sc_batch_size = 1460;
+/// @brief 停滞对端的单次发送阻塞时长(ms)
+static constexpr int      sc_stall      = 200;
+/// @brief 每个客户端的请求间隔(ms)
+static constexpr int      sc_interval   = 5;
+/// @brief 负载持续时长(ms)
+static constexpr int      sc_duration   = 1500;
+
+/// @brief 结构体 共享寄存器组 (细粒度加锁)
+struct sl_bank_t
+{
+  std::mutex mutex;
+  uint16_t   registers[512];
+};
+
+/// @brief 结构体 模拟连接 (Modbus_Tcp_Batch 所需的 Tcp_Client 接口)
+struct sl_client_t
+{
+  std::mutex                       mutex;
+  std::vector<uint8_t>             rx;         /* 套接字接收流 (客户端写入) */
+  std::vector<uint8_t>             segment;    /* 零拷贝读取的一段 (只由处理该连接的工作线程访问) */
+  std::deque<sl_clock::time_point> sent;       /* 未应答请求的发送时刻 */
+  std::vector<double>              latency;    /* 各请求延迟(ms) */
+  std::atomic<bool>                dispatched; /* 已交给工作线程 */
+  Modbus_Tcp_Framer                framer;
+  bool                             stalled;
+  bool                             closed;
+
+  sl_client_t() : dispatched(false), stalled(false), closed(false) {}
+
+  int32_t recv_zero_copy(const uint8_t*& data)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    segment.swap(rx);
+    data = segment.data();
+    return static_cast<int32_t>(segment.size());
+  }
+
+  bool release_zero_copy(const uint8_t*, uint32_t)
+  {
+    segment.clear();
+    return true;
+  }
+
+  /// @brief 发送合并的应答: 停滞的对端阻塞, 记录其中各请求的延迟
+  void send(const uint8_t* data, uint16_t length)
+  {
+    int frames = 0;
+    for (uint16_t i = 0; i < length; i += Modbus_Tcp_Framer::adu_size(data + i))
+      frames++;
+    if (stalled)
+      std::this_thread::sleep_for(std::chrono::milliseconds(sc_stall));
+
+    auto                        now = sl_clock::now();
+    std::lock_guard<std::mutex> lock(mutex);
+    for (int i = 0; i < frames; i++)
+    {
+      latency.push_back(std::chrono::duration<double, std::milli>(now - sent.front()).count());
+      sent.pop_front();
+    }
+  }
+
+  void shutdown()
+  {
+    closed = true;
+  }
+};
+
+/// @brief 结构体 待处理连接队列
+struct sl_queue_t
+{
+  std::mutex               mutex;
+  std::condition_variable  ready;
+  std::deque<sl_client_t*> clients;
+
+  void push(sl_client_t* client)
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      clients.push_back(client);
+    }
+    ready.notify_one();
+  }
+
+  bool pop(sl_client_t*& client)
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (!ready.wait_for(lock, std::chrono::milliseconds(20), [&] { return !clients.empty(); }))
+      return false;
+    client = clients.front();
+    clients.pop_front();
+    return true;
+  }
+};
+
+static sl_bank_t s_bank;
+
+/**
+ * @brief (静态) 读保持寄存器应答 (Modbus_Slave::process_tcp_adu 替身: 只在读取寄存器组时加锁, 另计50us的处理开销)
+ */
+static uint16_t sl_respond(const uint8_t* adu, uint8_t* response)
+{
+  uint16_t address  = Modbus_Codec::read16(adu + 8);
+  uint16_t quantity = Modbus_Codec::read16(adu + 10);
+  {
+    std::lock_guard<std::mutex> lock(s_bank.mutex);
+    for (uint16_t i = 0; i < quantity; i++)
+      Modbus_Codec::write16(response + 9 + 2 * i, s_bank.registers[address + i]);
+  }
+  std::memcpy(response, adu, Modbus_Codec::MBAP_SIZE);
+  response[7] = 0x03;
+  response[8] = static_cast<uint8_t>(quantity * 2);
+
+  auto start = sl_clock::now();
+  while (sl_clock::now() - start < std::chrono::microseconds(50))
+    ;
+  return Modbus_Codec::encode_tcp(response, static_cast<uint16_t>(2 + quantity * 2));
+}
+
+/**
+ * @brief (静态) 服务器线程分发就绪连接, 工作线程各自持有 Modbus_Tcp_Batch (与 Modbus_Tcp_Worker 相同), 记录各客户端延迟
+ */
+static void sl_run(int workers, std::vector<sl_client_t>& clients)
+{
+  std::atomic<bool>        stop(false);
+  sl_queue_t               queue;
+  std::vector<std::thread> threads;
+
+  for (int w = 0; w < workers; w++)
+  {
+    threads.emplace_back([&]() {
+      Modbus_Tcp_Batch<sc_batch_size> batch;
+      sl_client_t*                     client = nullptr;
+      while (!stop.load())
+      {
+        if (!queue.pop(client))
+          continue;
+
+        uint32_t now = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(sl_clock::now().time_since_epoch()).count());
+        HOST_CHECK(batch.serve(*client, client->framer, now, sl_respond));
+        client->dispatched.store(false);
+      }
+    });
+  }
+
+  /* 服务器线程: 有数据且未分发的连接放入队列 */
+  threads.emplace_back([&]() {
+    while (!stop.load())
+    {
+      bool idle = true;
+      for (sl_client_t& client : clients)
+      {
+        bool ready;
+        {
+          std::lock_guard<std::mutex> lock(client.mutex);
+          ready = !client.rx.empty();
+        }
+        if (ready && !client.dispatched.load())
+        {
+          idle = false;
+          client.dispatched.store(true);
+          queue.push(&client);
+        }
+      }
+      if (idle)
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+  });
+
+  /* 客户端: 每隔 sc_interval 发送一个请求 */
+  std::vector<std::thread> generators;
+  for (int k = 0; k < static_cast<int>(clients.size()); k++)
+  {
+    generators.emplace_back([&, k]() {
+      auto     end         = sl_clock::now() + std::chrono::milliseconds(sc_duration);
+      uint16_t transaction = 0;
+      while (sl_clock::now() < end)
+      {
+        uint8_t request[12];
+        Modbus_Codec::encode_mbap(request, transaction++, 0, 1, 5);
+        request[7] = 0x03;
+        Modbus_Codec::write16(request + 8, static_cast<uint16_t>(k * 10));
+        Modbus_Codec::write16(request + 10, 10);
+        {
+          std::lock_guard<std::mutex> lock(clients[k].mutex);
+          clients[k].rx.insert(clients[k].rx.end(), request, request + sizeof(request));
+          clients[k].sent.push_back(sl_clock::now());
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(sc_interval));
+      }
+    });
+  }
+
+  for (std::thread& generator : generators)
+    generator.join();
+  std::this_thread::sleep_for(std::chrono::milliseconds(2 * sc_stall + 100));
+  stop.store(true);
+  for (std::thread& thread : threads)
+    thread.join();
+}
+
+/**
+ * @brief (静态) 运行一次负载并报告各客户端延迟, 返回正常客户端的最大延迟(ms)
+ */
+static double sl_report(int workers)
+{
+  std::vector<sl_client_t> clients(sc_clients);
+  clients[0].stalled = true;
+  sl_run(workers, clients);
+
+  double worst = 0;
+  std::printf("workers=%d\n", workers);
+  for (int k = 0; k < sc_clients; k++)
+  {
+    std::vector<double>& latency = clients[k].latency;
+    HOST_CHECK(!latency.empty() && clients[k].sent.empty() && !clients[k].closed);
+    if (latency.empty())
+      continue;
+
+    std::sort(latency.begin(), latency.end());
+    std::printf("  client %d%s: %4zu responses, p50 %7.2f ms, p99 %7.2f ms, max %7.2f ms\n", k, clients[k].stalled ? " (stalled)" : "          ", latency.size(), latency[latency.size() / 2],
+                latency[latency.size() * 99 / 100], latency.back());
+    if (!clients[k].stalled)
+      worst = std::max(worst, latency.back());
+  }
+  return worst;
+}
+
+int main()
+{
+  for (uint16_t i = 0; i < 512; i++)
+    s_bank.registers[i] = static_cast<uint16_t>(i * 7);
+
+  /* 单工作线程: 停滞对端阻塞全部客户端; 工作线程池: 正常客户端不受影响 */
+  double single = sl_report(1);
+  double pool   = sl_report(sc_workers);
+  HOST_CHECK(single >= sc_stall / 2);
+  HOST_CHECK(pool < sc_stall / 2);
+  return host_test_result("modbus_tcp_load_test");
+}
@@ -0,0 +1,249 @@
+/**
+ * @file      modbus_zero_copy_test.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library host test for Modbus TCP zero-copy receive (Modbus TCP 零拷贝接收 套接字替身吞吐量测试)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "host_test.hpp"
+#include "modbus_codec.hpp"
+#include "modbus_framer.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+using namespace OwO::protocol::modbus;
+
+/// @brief 套接字接收流容量 (FreeRTOS+TCP 默认接收窗口)
+static constexpr uint32_t sc_socket_size  = 5840;
+/// @brief 原输入流容量 (IOStream 流缓存区)
+static constexpr uint32_t sc_istream_size = 257;
+/// @brief 请求次数
+static constexpr uint32_t sc_requests     = 1000000;
+/// @brief 应答合并缓存区大小 (与 Modbus_Tcp_Worker::BATCH_SIZE 一致, TCP MSS)
+static constexpr uint16_t sc_batch_size   = 1460;
+
+/// @brief 结构体 字节环形缓存区 (套接字接收流/输入流替身: 零拷贝读取只返回回绕点之前的连续部分)
+struct sl_ring_t
+{
+  uint8_t* buffer;
+  uint32_t size;
+  uint32_t head;
+  uint32_t tail;
+
+  explicit sl_ring_t(uint32_t size) : buffer(static_cast<uint8_t*>(std::malloc(size))), size(size), head(0), tail(0) {}
+  ~sl_ring_t()
+  {
+    std::free(buffer);
+  }
+
+  uint32_t count() const
+  {
+    return (head + size - tail) % size;
+  }
+
+  uint32_t space() const
+  {
+    return size - 1 - count();
+  }
+
+  void put(const uint8_t* data, uint32_t length)
+  {
+    for (uint32_t i = 0; i < length;)
+    {
+      uint32_t chunk = std::min(length - i, size - head);
+      std::memcpy(buffer + head, data + i, chunk);
+      head  = (head + chunk) % size;
+      i    += chunk;
+    }
+  }
+
+  /// @brief 复制读取 (FreeRTOS_recv / istream recv)
+  uint32_t get(uint8_t* data, uint32_t length)
+  {
+    length = std::min(length, count());
+    for (uint32_t i = 0; i < length;)
+    {
+      uint32_t chunk = std::min(length - i, size - tail);
+      std::memcpy(data + i, buffer + tail, chunk);
+      tail  = (tail + chunk) % size;
+      i    += chunk;
+    }
+    return length;
+  }
+
+  /// @brief 零拷贝读取 (FREERTOS_ZERO_COPY)
+  uint32_t peek(const uint8_t*& data) const
+  {
+    data = buffer + tail;
+    return std::min(count(), size - tail);
+  }
+
+  /// @brief 释放零拷贝读取的数据 (FreeRTOS_ReleaseTCPPayloadBuffer)
+  void release(uint32_t length)
+  {
+    tail = (tail + length) % size;
+  }
+};
+
+static uint16_t s_registers[256];
+
+/**
+ * @brief (静态) 读保持寄存器应答 (Modbus_Slave::process_tcp_adu 替身), 返回应答长度
+ */
+static uint16_t sl_respond(const uint8_t* adu, uint8_t* response)
+{
+  const uint8_t* pdu      = adu + Modbus_Codec::MBAP_SIZE;
+  uint16_t       address  = Modbus_Codec::read16(pdu + 1);
+  uint16_t       quantity = Modbus_Codec::read16(pdu + 3);
+
+  std::memcpy(response, adu, Modbus_Codec::MBAP_SIZE);
+  response[7] = pdu[0];
+  response[8] = static_cast<uint8_t>(quantity * 2);
+  for (uint16_t i = 0; i < quantity; i++)
+    Modbus_Codec::write16(response + 9 + 2 * i, s_registers[(address + i) & 0xFF]);
+  return Modbus_Codec::encode_tcp(response, static_cast<uint16_t>(2 + quantity * 2));
+}
+
+/// @brief 结构体 应答汇总
+struct sl_summary_t
+{
+  uint32_t responses;
+  uint32_t checksum;
+
+  void add(const uint8_t* response, uint16_t length)
+  {
+    responses++;
+    for (uint16_t i = 0; i < length; i++)
+      checksum = checksum * 31 + response[i];
+  }
+};
+
+/// @brief 结构体 连接替身 (Modbus_Tcp_Batch 所需的 Tcp_Client 接口: 零拷贝读取套接字接收流, 合并应答逐帧汇总)
+struct sl_socket_t
+{
+  sl_ring_t     ring;
+  sl_summary_t& summary;
+  uint32_t      sends;
+  bool          closed;
+
+  sl_socket_t(uint32_t size, sl_summary_t& summary) : ring(size), summary(summary), sends(0), closed(false) {}
+
+  int32_t recv_zero_copy(const uint8_t*& data)
+  {
+    return static_cast<int32_t>(ring.peek(data));
+  }
+
+  bool release_zero_copy(const uint8_t*, uint32_t length)
+  {
+    ring.release(length);
+    return true;
+  }
+
+  void send(const uint8_t* data, uint16_t length)
+  {
+    sends++;
+    for (uint16_t i = 0; i < length; i += Modbus_Tcp_Framer::adu_size(data + i))
+      summary.add(data + i, Modbus_Tcp_Framer::adu_size(data + i));
+  }
+
+  void shutdown()
+  {
+    closed = true;
+  }
+};
+
+/**
+ * @brief (静态) 生成第 index 个请求 (读保持寄存器, 地址与数量随序号变化)
+ */
+static void sl_request(uint32_t index, uint8_t* adu)
+{
+  Modbus_Codec::encode_mbap(adu, static_cast<uint16_t>(index), 0, 1, 5);
+  adu[7] = 0x03;
+  Modbus_Codec::write16(adu + 8, static_cast<uint16_t>(index % 200));
+  Modbus_Codec::write16(adu + 10, static_cast<uint16_t>(1 + index % 32));
+}
+
+/**
+ * @brief (静态) 原接收路径: 每段 Malloc + FreeRTOS_recv, 复制进输入流, 再分两次 recv 复制进从站接收缓存区
+ */
+static sl_summary_t sl_copy_path(uint32_t requests)
+{
+  sl_ring_t    socket(sc_socket_size);
+  sl_ring_t    istream(sc_istream_size);
+  sl_summary_t summary = {};
+  uint8_t      request[12];
+  uint8_t      frame[Modbus_Tcp_Framer::ADU_SIZE];
+  uint8_t      response[Modbus_Tcp_Framer::ADU_SIZE];
+
+  for (uint32_t i = 0; i < requests; i++)
+  {
+    sl_request(i, request);
+    socket.put(request, sizeof(request));
+
+    /* Tcp_Client::data_input */
+    uint32_t available = istream.space();
+    uint8_t* buffer    = static_cast<uint8_t*>(std::malloc(available));
+    istream.put(buffer, socket.get(buffer, available));
+    std::free(buffer);
+
+    /* Modbus_Slave::process_tcp_frame */
+    if (Modbus_Tcp_Framer::MBAP_SIZE != istream.get(frame, Modbus_Tcp_Framer::MBAP_SIZE))
+      continue;
+    uint16_t size = Modbus_Tcp_Framer::adu_size(frame);
+    if (0 == size || static_cast<uint32_t>(size - Modbus_Tcp_Framer::MBAP_SIZE) != istream.get(frame + Modbus_Tcp_Framer::MBAP_SIZE, size - Modbus_Tcp_Framer::MBAP_SIZE))
+      continue;
+    summary.add(response, sl_respond(frame, response));
+    istream.tail = istream.head;
+  }
+  return summary;
+}
+
+/**
+ * @brief (静态) 零拷贝接收路径: 工作线程的 Modbus_Tcp_Batch 直接在套接字接收流中分帧, 应答生成后释放 (每次到达 batch 个流水线请求)
+ */
+static sl_summary_t sl_zero_copy_path(uint32_t requests, uint32_t batch)
+{
+  sl_summary_t                    summary = {};
+  sl_socket_t                     socket(sc_socket_size, summary);
+  Modbus_Tcp_Framer               framer;
+  Modbus_Tcp_Batch<sc_batch_size> responder;
+  uint8_t                         request[12];
+
+  for (uint32_t i = 0; i < requests; i += batch)
+  {
+    for (uint32_t k = i; k < i + batch && k < requests; k++)
+    {
+      sl_request(k, request);
+      socket.ring.put(request, sizeof(request));
+    }
+    HOST_CHECK(responder.serve(socket, framer, 0, sl_respond));
+  }
+  HOST_CHECK(0 == framer.pending() && 0 == framer.errors() && !socket.closed);
+  HOST_CHECK(socket.sends <= (requests + batch - 1) / batch * 2);
+  return summary;
+}
+
+int main()
+{
+  for (uint16_t i = 0; i < 256; i++)
+    s_registers[i] = static_cast<uint16_t>(i * 7);
+
+  /* 两条路径的应答逐字节一致 (套接字接收流多次回绕) */
+  sl_summary_t copy      = sl_copy_path(10000);
+  sl_summary_t zero_copy = sl_zero_copy_path(10000, 1);
+  HOST_CHECK(10000 == copy.responses && 10000 == zero_copy.responses && copy.checksum == zero_copy.checksum);
+  sl_summary_t pipelined = sl_zero_copy_path(10000, 7);
+  HOST_CHECK(10000 == pipelined.responses && copy.checksum == pipelined.checksum);
+
+  double copy_ns = host_bench(1, [&](uint32_t) { host_keep(sl_copy_path(sc_requests)); }) / sc_requests;
+  double zero_ns = host_bench(1, [&](uint32_t) { host_keep(sl_zero_copy_path(sc_requests, 1)); }) / sc_requests;
+  std::printf("copy path: %.2f M req/s (%.1f ns/req), zero-copy: %.2f M req/s (%.1f ns/req)\n", 1e3 / copy_ns, copy_ns, 1e3 / zero_ns, zero_ns);
+
+  return host_test_result("modbus_zero_copy_test");
+}
@@ -0,0 +1,158 @@
+/**
+ * @file      ptp_servo_test.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library host test for PTP clock servo (PTP 时钟伺服 偏移/漂移模拟测试)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "host_test.hpp"
+#include "ptp_servo.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <random>
+
+using namespace OwO::protocol::ptp;
+
+/// @brief 时间戳分辨率(ns)
+static constexpr double sc_resolution = 20;
+/// @brief 同步后允许的最大偏移(ns)
+static constexpr double sc_tolerance  = 5000;
+
+/// @brief 结构体 模拟主从时钟与网络路径 (主时钟为理想时钟, 从时钟有固有漂移与伺服调整)
+struct sl_clock_t
+{
+  double       master;     /* 主时钟(ns) */
+  double       slave;      /* 从时钟(ns) */
+  double       drift;      /* 固有漂移(ppb) */
+  double       adjust;     /* 伺服调整(ppb) */
+  std::mt19937 random;
+
+  sl_clock_t(double offset, double drift) : master(0), slave(offset), drift(drift), adjust(0), random(42) {}
+
+  void advance(double ns)
+  {
+    slave  += ns * (1 + (drift + adjust) * 1e-9);
+    master += ns;
+  }
+
+  static double stamp(double ns)
+  {
+    return std::floor(ns / sc_resolution) * sc_resolution;
+  }
+
+  /// @brief 单向路径延迟: 40us ± 2us 抖动, 按概率叠加 1~3ms 排队尖峰
+  double path(double spike)
+  {
+    std::uniform_real_distribution<double> jitter(-2000, 2000), chance(0, 1), queue(1e6, 3e6);
+    double                                 delay = 40000 + jitter(random);
+    if (chance(random) < spike)
+      delay += queue(random);
+    return delay;
+  }
+};
+
+/// @brief 结构体 模拟结果 (稳定后)
+struct sl_result_t
+{
+  double worst; /* 最大偏移(ns) */
+  double rate;  /* 平均剩余频率误差(ppb) */
+  int    steps; /* 时钟阶跃次数 */
+};
+
+/**
+ * @brief (静态) 每秒一次 Sync/Delay_Req 交换 (t1~t4), 按伺服输出阶跃或调整频率
+ */
+static sl_result_t sl_run(Ptp_Servo& servo, sl_clock_t& clock, int count, double spike, int settle)
+{
+  sl_result_t result  = {};
+  int         samples = 0;
+  for (int i = 0; i < count; i++)
+  {
+    double t1 = clock.master;
+    double d1 = clock.path(spike);
+    clock.advance(d1);
+    double t2 = sl_clock_t::stamp(clock.slave);
+    clock.advance(1e6);
+    double t3 = sl_clock_t::stamp(clock.slave);
+    double d2 = clock.path(spike);
+    clock.advance(d2);
+    double t4 = sl_clock_t::stamp(clock.master);
+
+    int64_t offset = 0;
+    int64_t delay  = 0;
+    HOST_CHECK(Ptp_Servo::measure(static_cast<int64_t>(t1), static_cast<int64_t>(t2), static_cast<int64_t>(t3), static_cast<int64_t>(t4), offset, delay));
+
+    ptp_servo_action action = servo.sample(offset, delay, static_cast<int64_t>(t2));
+    if (ptp_servo_action::STEP == action)
+    {
+      clock.slave += servo.step();
+      result.steps++;
+    }
+    if (ptp_servo_action::NONE != action)
+      clock.adjust = servo.ppb();
+    clock.advance(1e9 - 1e6 - d1 - d2);
+
+    if (i >= settle)
+    {
+      result.worst  = std::fmax(result.worst, std::fabs(clock.slave - clock.master));
+      result.rate  += clock.drift + clock.adjust;
+      samples++;
+    }
+  }
+  if (0 != samples)
+    result.rate /= samples;
+  return result;
+}
+
+int main()
+{
+  /* 初始偏移2.3s, 漂移 +37.5ppm, 5% 延迟尖峰: 一次阶跃后收敛, 尖峰被剔除 */
+  {
+    Ptp_Servo   servo;
+    sl_clock_t  clock(2.3e9, 37500);
+    sl_result_t result = sl_run(servo, clock, 60, 0.05, 15);
+    std::printf("offset 2.3s drift +37.5ppm: steps=%d worst=%.0fns residual=%.0fppb outliers=%u\n", result.steps, result.worst, result.rate, servo.outliers());
+    HOST_CHECK(1 == result.steps && result.worst < sc_tolerance && std::fabs(result.rate) < 100);
+    HOST_CHECK(servo.outliers() > 0 && servo.synced());
+  }
+
+  /* 初始偏移 -300us, 漂移 -80ppm: 只调整频率, 不阶跃 */
+  {
+    Ptp_Servo   servo;
+    sl_clock_t  clock(-300000, -80000);
+    sl_result_t result = sl_run(servo, clock, 60, 0, 15);
+    std::printf("offset -300us drift -80ppm: steps=%d worst=%.0fns ppb=%d\n", result.steps, result.worst, servo.ppb());
+    HOST_CHECK(0 == result.steps && result.worst < sc_tolerance && servo.synced());
+  }
+
+  /* 同步后主时钟跳变5ms: 重新阶跃一次 */
+  {
+    Ptp_Servo  servo;
+    sl_clock_t clock(5e9, 10000);
+    sl_run(servo, clock, 30, 0.02, 30);
+    clock.master       += 5e6;
+    sl_result_t result  = sl_run(servo, clock, 40, 0.02, 15);
+    std::printf("master jump 5ms: steps=%d worst=%.0fns\n", result.steps, result.worst);
+    HOST_CHECK(1 == result.steps && result.worst < sc_tolerance);
+  }
+
+  /* 漂移超出调整范围: 调整量限幅, 不报告同步 */
+  {
+    Ptp_Servo  servo;
+    sl_clock_t clock(0, 700000);
+    sl_run(servo, clock, 40, 0, 40);
+    HOST_CHECK(-Ptp_Servo::MAX_PPB == servo.ppb() && !servo.synced());
+  }
+
+  /* 偏移/路径延迟计算, 时间戳顺序错误 */
+  int64_t offset = 0;
+  int64_t delay  = 0;
+  HOST_CHECK(Ptp_Servo::measure(1000, 1500, 2000, 2300, offset, delay) && 100 == offset && 400 == delay);
+  HOST_CHECK(!Ptp_Servo::measure(1000, 900, 2000, 1500, offset, delay));
+
+  return host_test_result("ptp_servo_test");
+}
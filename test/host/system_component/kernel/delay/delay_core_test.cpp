@@ -0,0 +1,121 @@
+/**
+ * @file      delay_core_test.cpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library host test for precise delay core (精确延时 计时核心主机测试)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#include "delay_core.hpp"
+#include "fake_delay_clock.hpp"
+#include "host_test.hpp"
+
+#include <initializer_list>
+
+using namespace OwO::system::kernel;
+
+/// @brief 测试时钟 每微秒周期数
+static constexpr uint32_t sc_cycles_per_us = 72;
+/// @brief 测试时钟 每次读取前进的周期数
+static constexpr uint32_t sc_step          = 4;
+
+using sl_delay_t = Delay_Core<Fake_Delay_Clock>;
+
+/**
+ * @brief (静态) 忙等待: 精度与周期计数回绕, 不启动单次定时
+ */
+static void sl_check_spin()
+{
+  for (uint32_t start : { 0u, 0xFFFFFF00u, 0x7FFFFFF0u })
+  {
+    for (uint32_t us : { 0u, 1u, 5u, 19u, 20u })
+    {
+      Fake_Delay_Clock clock(sc_cycles_per_us, sc_step);
+      sl_delay_t       delay(clock);
+      clock.set(start);
+
+      uint32_t begin = clock.now();
+      delay.spin_us(us);
+      uint32_t elapsed = clock.now() - begin;
+      HOST_CHECK(elapsed >= us * sc_cycles_per_us && elapsed <= us * sc_cycles_per_us + 3 * sc_step);
+      HOST_CHECK(0 == clock.shots());
+    }
+  }
+}
+
+/**
+ * @brief (静态) 让出CPU的延时: 长间隔按单次定时分段睡眠, 最后一段忙等待, 结束时刻不早于目标且不超过唤醒延迟
+ */
+static void sl_check_sleep()
+{
+  for (uint32_t latency : { 0u, 500u, 1400u })
+  {
+    for (uint32_t us : { 21u, 25u, 100u, 1000u, 65556u, 65557u, 200000u, 3000000u })
+    {
+      Fake_Delay_Clock clock(sc_cycles_per_us, sc_step, latency);
+      sl_delay_t       delay(clock);
+      clock.set(0xFFFF0000u);
+
+      uint32_t begin = clock.now();
+      HOST_CHECK(delay.sleep_us(us));
+      uint32_t elapsed = clock.now() - begin;
+      HOST_CHECK(elapsed >= us * sc_cycles_per_us && elapsed <= us * sc_cycles_per_us + latency + 3 * sc_step);
+
+      uint32_t shots = (us - 1 <= sl_delay_t::SPIN_LIMIT) ? 0 : (us - 1 - sl_delay_t::SPIN_LIMIT + sl_delay_t::MAX_SHOT - 1) / sl_delay_t::MAX_SHOT;
+      HOST_CHECK(shots == clock.shots());
+
+      /* 忙等待时长不超过 SPIN_LIMIT 与每段的少量开销 */
+      HOST_CHECK(elapsed - clock.idle() <= (sl_delay_t::SPIN_LIMIT + 1) * sc_cycles_per_us + (clock.shots() + 1) * 4 * sc_step);
+      if (us >= 1000)
+        HOST_CHECK(clock.idle() * 100 / elapsed >= 95);
+    }
+  }
+}
+
+/**
+ * @brief (静态) 单次定时故障时退回忙等待, 仍在目标时刻结束; 延时上限
+ */
+static void sl_check_faults()
+{
+  {
+    Fake_Delay_Clock clock;
+    sl_delay_t       delay(clock);
+    clock.set_fault(true, false);
+
+    uint32_t begin = clock.now();
+    HOST_CHECK(!delay.sleep_us(500));
+    uint32_t elapsed = clock.now() - begin;
+    HOST_CHECK(elapsed >= 500 * sc_cycles_per_us && elapsed <= 500 * sc_cycles_per_us + 3 * sc_step);
+    HOST_CHECK(0 == clock.idle());
+  }
+
+  {
+    Fake_Delay_Clock clock;
+    sl_delay_t       delay(clock);
+    clock.set_fault(false, true);
+
+    uint32_t begin = clock.now();
+    HOST_CHECK(!delay.sleep_us(500));
+    HOST_CHECK(clock.now() - begin >= 500 * sc_cycles_per_us && 1 == clock.shots());
+  }
+
+  {
+    Fake_Delay_Clock clock;
+    sl_delay_t       delay(clock);
+
+    uint32_t begin = clock.now();
+    delay.sleep_us(0xFFFFFFFFu);
+    uint32_t elapsed = clock.now() - begin;
+    HOST_CHECK(elapsed >= sl_delay_t::MAX_DELAY * sc_cycles_per_us && elapsed <= sl_delay_t::MAX_DELAY * sc_cycles_per_us + 3 * sc_step);
+  }
+}
+
+int main()
+{
+  sl_check_spin();
+  sl_check_sleep();
+  sl_check_faults();
+  return host_test_result("delay_core_test");
+}
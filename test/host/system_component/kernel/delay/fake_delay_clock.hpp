@@ -0,0 +1,130 @@
+/**
+ * @file      fake_delay_clock.hpp
+ * @author    Sea-Of-Quantum
+ * @brief     OwO Library host test clock for precise delay core (精确延时 主机测试时钟)
+ * @version   v1.0.0
+ * @date      2026-10-17
+ *
+ * @copyright Copyright (c) 2025 by Sea-Of-Quantum, All Rights Reserved.
+ *
+ */
+#ifndef __FAKE_DELAY_CLOCK_HPP__
+#define __FAKE_DELAY_CLOCK_HPP__
+
+#include <stdint.h>
+
+/// @brief 名称空间 库名
+namespace OwO
+{
+/// @brief 名称空间 基础元素
+namespace system
+{
+/// @brief 名称空间 系统接口
+namespace kernel
+{
+/// @brief 类 精确延时 主机测试时钟 -- 每次读取周期计数前进固定步长 (模拟循环开销), 单次定时到期时前进定时时长与唤醒延迟
+class Fake_Delay_Clock
+{
+private:
+  /// @brief 当前周期计数
+  uint32_t m_now;
+  /// @brief 每微秒周期数
+  uint32_t m_cycles_per_us;
+  /// @brief 每次读取前进的周期数
+  uint32_t m_step;
+  /// @brief 唤醒延迟(周期)
+  uint32_t m_latency;
+  /// @brief 已启动的单次定时(us) (0为未启动)
+  uint32_t m_armed;
+  /// @brief 单次定时启动失败
+  bool     m_arm_fail;
+  /// @brief 单次定时不触发 (等待超时)
+  bool     m_lost;
+  /// @brief 周期计数读取次数
+  uint32_t m_reads;
+  /// @brief 单次定时次数
+  uint32_t m_shots;
+  /// @brief 让出CPU的总周期数
+  uint64_t m_idle;
+
+public:
+  explicit Fake_Delay_Clock(uint32_t cycles_per_us = 72, uint32_t step = 4, uint32_t latency = 0) : m_now(0), m_cycles_per_us(cycles_per_us), m_step(step), m_latency(latency), m_armed(0), m_arm_fail(false), m_lost(false), m_reads(0), m_shots(0), m_idle(0) {}
+
+  uint32_t cycles()
+  {
+    uint32_t now  = m_now;
+    m_now        += m_step;
+    m_reads++;
+    return now;
+  }
+
+  uint32_t cycles_per_us() const
+  {
+    return m_cycles_per_us;
+  }
+
+  bool arm(uint32_t us)
+  {
+    if (m_arm_fail || 0 == us)
+      return false;
+    m_armed = us;
+    m_shots++;
+    return true;
+  }
+
+  bool wait(uint32_t ms)
+  {
+    if (0 == m_armed)
+      return false;
+
+    /* 不触发时等待至超时 */
+    uint64_t idle = m_lost ? static_cast<uint64_t>(ms) * 1000 * m_cycles_per_us : static_cast<uint64_t>(m_armed) * m_cycles_per_us + m_latency;
+    m_now        += static_cast<uint32_t>(idle);
+    m_idle       += idle;
+    m_armed       = 0;
+    return !m_lost;
+  }
+
+  void cancel()
+  {
+    m_armed = 0;
+  }
+
+  /// @brief 设置当前周期计数 (测试回绕)
+  void set(uint32_t now)
+  {
+    m_now = now;
+  }
+
+  /// @brief 设置单次定时故障 (启动失败 / 不触发)
+  void set_fault(bool arm_fail, bool lost)
+  {
+    m_arm_fail = arm_fail;
+    m_lost     = lost;
+  }
+
+  uint32_t now() const
+  {
+    return m_now;
+  }
+
+  uint32_t reads() const
+  {
+    return m_reads;
+  }
+
+  uint32_t shots() const
+  {
+    return m_shots;
+  }
+
+  uint64_t idle() const
+  {
+    return m_idle;
+  }
+};
+} /* namespace kernel */
+} /* namespace system */
+} /* namespace OwO */
+
+#endif /* __FAKE_DELAY_CLOCK_HPP__ */